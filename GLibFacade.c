@@ -73,10 +73,37 @@ GString* g_string_new(char *startingString)
 	strncpy(newString->str, startingString, startingStringSize);
 	newString->str[startingStringSize] = '\0';
 	newString->currentStringLength = startingStringSize;
+	newString->flush = NULL;
+	newString->flushContext = NULL;
+	newString->flushThreshold = 0;
+	newString->flushFailed = false;
 	
 	return newString;
 }
 
+/* Like g_string_new(""), but with room for at least reservedSize bytes */
+GString* g_string_sized_new(size_t reservedSize)
+{
+	GString* newString = malloc(sizeof(GString));
+
+	size_t startingBufferSize = kStringBufferStartingSize;
+	while (startingBufferSize < (reservedSize + 1))
+	{
+		startingBufferSize *= kStringBufferGrowthMultiplier;
+	}
+
+	newString->str = malloc(startingBufferSize);
+	newString->currentStringBufferSize = startingBufferSize;
+	newString->str[0] = '\0';
+	newString->currentStringLength = 0;
+	newString->flush = NULL;
+	newString->flushContext = NULL;
+	newString->flushThreshold = 0;
+	newString->flushFailed = false;
+
+	return newString;
+}
+
 char* g_string_free(GString* ripString, bool freeCharacterData)
 {	
 	if (ripString == NULL)
@@ -123,11 +150,44 @@ static void ensureStringBufferCanHold(GString* baseString, size_t newStringSize)
 	}
 }
 
+/* Pass the buffered text to the flush function and empty the buffer.  Once
+   a flush has failed, later output is discarded. */
+static void flushStringBuffer(GString* baseString)
+{
+	if ((baseString->currentStringLength > 0) && !baseString->flushFailed)
+	{
+		if (!baseString->flush(baseString->flushContext, baseString->str, baseString->currentStringLength))
+			baseString->flushFailed = true;
+	}
+	baseString->currentStringLength = 0;
+	baseString->str[0] = '\0';
+}
+
+/* Flush the buffer if appending appendedLength bytes would take it past the
+   threshold.  Returns true if the appended bytes are themselves large enough
+   to have been handed straight to the flush function, without copying. */
+static bool flushBeforeAppend(GString* baseString, const char* appendedString, size_t appendedLength)
+{
+	if (baseString->currentStringLength + appendedLength < baseString->flushThreshold)
+		return false;
+
+	flushStringBuffer(baseString);
+	if (appendedLength < baseString->flushThreshold)
+		return false;
+
+	if (!baseString->flushFailed && !baseString->flush(baseString->flushContext, appendedString, appendedLength))
+		baseString->flushFailed = true;
+	return true;
+}
+
 void g_string_append(GString* baseString, char* appendedString)
 {
 	if ((appendedString != NULL) && (strlen(appendedString) > 0))
 	{
 		size_t appendedStringLength = strlen(appendedString);
+		if ((baseString->flush != NULL) && flushBeforeAppend(baseString, appendedString, appendedStringLength))
+			return;
+
 		size_t newStringLength = baseString->currentStringLength + appendedStringLength;
 		ensureStringBufferCanHold(baseString, newStringLength);
 
@@ -137,8 +197,28 @@ void g_string_append(GString* baseString, char* appendedString)
 	}
 }
 
+/* Append exactly appendedLength bytes, which need not be NUL terminated */
+void g_string_append_len(GString* baseString, const char* appendedString, size_t appendedLength)
+{
+	if ((appendedString != NULL) && (appendedLength > 0))
+	{
+		if ((baseString->flush != NULL) && flushBeforeAppend(baseString, appendedString, appendedLength))
+			return;
+
+		size_t newStringLength = baseString->currentStringLength + appendedLength;
+		ensureStringBufferCanHold(baseString, newStringLength);
+
+		memcpy(baseString->str + baseString->currentStringLength, appendedString, appendedLength);
+		baseString->currentStringLength = newStringLength;
+		baseString->str[baseString->currentStringLength] = '\0';
+	}
+}
+
 void g_string_append_c(GString* baseString, char appendedCharacter)
 {	
+	if ((baseString->flush != NULL) && (baseString->currentStringLength + 1 >= baseString->flushThreshold))
+		flushStringBuffer(baseString);
+
 	size_t newSizeNeeded = baseString->currentStringLength + 1;
 	ensureStringBufferCanHold(baseString, newSizeNeeded);
 	
@@ -177,6 +257,41 @@ void g_string_prepend(GString* baseString, char* prependedString)
 	}
 }
 
+/* Make room for at least extraLength more bytes without changing the string */
+void g_string_reserve(GString* baseString, size_t extraLength)
+{
+	ensureStringBufferCanHold(baseString, baseString->currentStringLength + extraLength);
+}
+
+/* Shorten the string to newLength bytes, keeping the buffer for reuse */
+void g_string_truncate(GString* baseString, size_t newLength)
+{
+	if (newLength < baseString->currentStringLength)
+	{
+		baseString->currentStringLength = newLength;
+		baseString->str[newLength] = '\0';
+	}
+}
+
+/* Send the string's text to flush in pieces of about threshold bytes as it
+   is appended, rather than collecting all of it; pass NULL to go back to
+   collecting.  Prepending and truncating only affect text not yet flushed. */
+void g_string_set_flush(GString* baseString, bool (*flush)(void *context, const char *data, size_t length), void* context, size_t threshold)
+{
+	baseString->flush = flush;
+	baseString->flushContext = context;
+	baseString->flushThreshold = (threshold > 0) ? threshold : 1;
+	baseString->flushFailed = false;
+}
+
+/* Flush whatever is buffered; returns false if any flush has failed */
+bool g_string_flush(GString* baseString)
+{
+	if (baseString->flush != NULL)
+		flushStringBuffer(baseString);
+	return !baseString->flushFailed;
+}
+
 /* GSList */
 
 void g_slist_free(GSList* ripList)
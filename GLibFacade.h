@@ -40,18 +40,33 @@ typedef struct
 	/* or append new strings? */
 	unsigned long currentStringBufferSize;
 	unsigned long currentStringLength;
+
+	/* If set, the buffered text is passed to flush whenever it would grow
+	   past flushThreshold bytes, and the buffer is emptied */
+	bool (*flush)(void *context, const char *data, size_t length);
+	void* flushContext;
+	size_t flushThreshold;
+	bool flushFailed;
 } GString;
 
 GString* g_string_new(char *startingString);
+GString* g_string_sized_new(size_t reservedSize);
 char* g_string_free(GString* ripString, bool freeCharacterData);
 
 void g_string_append_c(GString* baseString, char appendedCharacter);
 void g_string_append(GString* baseString, char *appendedString);
+void g_string_append_len(GString* baseString, const char *appendedString, size_t appendedLength);
 
 void g_string_prepend(GString* baseString, char* prependedString);
 
+void g_string_truncate(GString* baseString, size_t newLength);
+void g_string_reserve(GString* baseString, size_t extraLength);
+
 void g_string_append_printf(GString* baseString, char* format, ...);
 
+void g_string_set_flush(GString* baseString, bool (*flush)(void *context, const char *data, size_t length), void* context, size_t threshold);
+bool g_string_flush(GString* baseString);
+
 /* Just implement a very simple singly linked list. */
 
 typedef struct _GSList
@@ -15,6 +15,7 @@ BEGIN {
                           EXT_COMPLETE
                           EXT_FILTER_HTML
                           EXT_FILTER_STYLES
+                          EXT_LINEAR_INLINES
                           EXT_NOTES     
                           EXT_NO_LABELS
                           EXT_NO_METADATA
@@ -37,16 +38,21 @@ BEGIN {
 use subs @constants;
 
 our @EXPORT  = ( 'markdown', '$mmd_version', @constants );
+our @EXPORT_OK = ( 'markdown_many', 'markdown_inline', 'markdown_with_meta', 'markdown_to', 'markdown_stream',
+                   'markdown_document', 'metadata', 'cache_size', 'cache_stats', 'cache_flush', 'cache_file',
+                   'serialize_tree', 'deserialize_tree', 'map_tree' );
 
 __PACKAGE__->bootstrap($VERSION);
 
 my $format_re = qr{ ^ (?: HTML | TEXT | LATEX | MEMOIR | BEAMER | MAN | ODF | OPML | RTF ) }x;
 my $false_re  = qr{^(?:|0|false|off)$}i;
 
-my %option_defs = ( smart        => [ bool    => EXT_SMART ],
-		    complete     => [ bool    => EXT_COMPLETE ],
-		    obfuscate    => [ bool    => EXT_OBFUSCATE ],
-		    use_metadata => [ invbool => EXT_NO_METADATA ],
+my %option_defs = ( smart          => [ bool    => EXT_SMART ],
+		    complete       => [ bool    => EXT_COMPLETE ],
+		    obfuscate      => [ bool    => EXT_OBFUSCATE ],
+		    notes          => [ bool    => EXT_NOTES ],
+		    use_metadata   => [ invbool => EXT_NO_METADATA ],
+		    linear_inlines => [ bool    => EXT_LINEAR_INLINES ],
     );
 
 
@@ -59,7 +65,13 @@ sub new {
     else {
 	$options = { @_ };
     }
-    return bless $options, ref($class) || $class;
+    my $self = bless $options, ref($class) || $class;
+
+    # Options are compiled once; the converter keeps its parser and output
+    # buffers between calls to markdown()
+    $self->{_converter} = Text::MultiMarkdown::XS::Converter->new(_compile_options($self));
+
+    return $self;
 }
 
 
@@ -69,9 +81,8 @@ sub markdown {
     # Detect functional mode, and create an instance for this run..
     unless (ref $self) {
         if ( $self ne __PACKAGE__ ) {
-            my $ob = __PACKAGE__->new();
-                                # $self is text, $text is options
-            return $ob->markdown($self, @_);
+                                # $self is text, $_[0] is options
+            return _markdown($self, _compile_options($_[0]));
         }
         else {
             croak('Calling ' . $self . '->markdown (as a class method) is not supported.');
@@ -80,6 +91,277 @@ sub markdown {
 
     my ($text, $options) = @_;
 
+    # Per-call options are combined with those given to new(); while the
+    # converter is busy (see markdown_to) it can't be used either
+    if ($options and %$options or $self->{_busy}) {
+        return _markdown($text, _compile_options({ %$self, %{ $options || {} } }));
+    }
+
+    return $self->{_converter}->convert($text);
+}
+
+
+sub markdown_inline {
+    my $self = shift;
+
+    # Detect functional mode
+    unless (ref $self) {
+        if ( $self ne __PACKAGE__ ) {
+                                # $self is text, $_[0] is options
+            return _markdown_inline($self, _compile_options($_[0]));
+        }
+        else {
+            croak('Calling ' . $self . '->markdown_inline (as a class method) is not supported.');
+        }
+    }
+
+    my ($text, $options) = @_;
+
+    if ($options and %$options or $self->{_busy}) {
+        return _markdown_inline($text, _compile_options({ %$self, %{ $options || {} } }));
+    }
+
+    return $self->{_converter}->convert_inline($text);
+}
+
+
+sub markdown_with_meta {
+    my $self = shift;
+
+    # Detect functional mode
+    unless (ref $self) {
+        if ( $self ne __PACKAGE__ ) {
+                                # $self is text, $_[0] is options
+            return _markdown_with_meta($self, _compile_options($_[0]));
+        }
+        else {
+            croak('Calling ' . $self . '->markdown_with_meta (as a class method) is not supported.');
+        }
+    }
+
+    my ($text, $options) = @_;
+
+    if ($options and %$options or $self->{_busy}) {
+        return _markdown_with_meta($text, _compile_options({ %$self, %{ $options || {} } }));
+    }
+
+    return $self->{_converter}->convert_with_meta($text);
+}
+
+
+sub markdown_to {
+    my $self = shift;
+
+    # Detect functional mode
+    unless (ref $self) {
+        if ( $self ne __PACKAGE__ ) {
+                                # $self is text, $_[0] is the output, $_[1] options
+            my $convert = _streaming($_[1]) ? \&_markdown_stream_to : \&_markdown_to;
+            $convert->($self, $_[0], _compile_options($_[1]));
+            return 1;
+        }
+        else {
+            croak('Calling ' . $self . '->markdown_to (as a class method) is not supported.');
+        }
+    }
+
+    my ($text, $out, $options) = @_;
+
+    if ($options and %$options or $self->{_busy}) {
+        $options = { %$self, %{ $options || {} } };
+        my $convert = _streaming($options) ? \&_markdown_stream_to : \&_markdown_to;
+        $convert->($text, $out, _compile_options($options));
+        return 1;
+    }
+
+    # The converter is busy until the conversion is over, so a callback
+    # that converts other texts with this object must not use it
+    local $self->{_busy} = 1;
+    if (_streaming($self)) {
+        $self->{_converter}->stream_to($text, $out);
+    }
+    else {
+        $self->{_converter}->convert_to($text, $out);
+    }
+    return 1;
+}
+
+
+# Whether the streaming option of markdown_to is set
+
+sub _streaming {
+    my $options = shift || {};
+
+    return (($options->{streaming} || '') !~ $false_re);
+}
+
+
+sub markdown_stream {
+    my $self = shift;
+
+    # Allow both functional and method call styles; the output may itself
+    # be an object
+    unless (ref $self and eval { $self->isa(__PACKAGE__) }) {
+        unshift @_, $self;
+        undef $self;
+    }
+
+    my ($out, $options) = @_;
+
+    $options ||= {};
+    $options = { %$self, %$options } if ref $self;
+
+    return Text::MultiMarkdown::XS::Stream->_new($out, _compile_options($options));
+}
+
+
+sub markdown_document {
+    my $self = shift;
+
+    # Allow both functional and method call styles
+    unless (ref $self and eval { $self->isa(__PACKAGE__) }) {
+        unshift @_, $self;
+        undef $self;
+    }
+
+    my ($options) = @_;
+
+    $options ||= {};
+    $options = { %$self, %$options } if ref $self;
+
+    return Text::MultiMarkdown::XS::Document->_new(_compile_options($options));
+}
+
+
+sub serialize_tree {
+    my $self = shift;
+
+    # Allow both functional and method call styles
+    unless (ref $self) {
+        if ( $self ne __PACKAGE__ ) {
+            unshift @_, $self;
+            undef $self;
+        }
+    }
+
+    my ($text, $options) = @_;
+
+    $options ||= {};
+    $options = { %$self, %$options } if ref $self;
+
+    return _serialize_tree($text, _compile_options($options));
+}
+
+
+sub deserialize_tree {
+    # Allow both functional and class method call styles
+    shift if @_ > 1 and (ref $_[0] or $_[0] eq __PACKAGE__);
+
+    my ($image) = @_;
+
+    return Text::MultiMarkdown::XS::Tree->_deserialize($image)
+        || croak('not a parse tree image this version can read');
+}
+
+
+sub map_tree {
+    # Allow both functional and class method call styles
+    shift if @_ > 1 and (ref $_[0] or $_[0] eq __PACKAGE__);
+
+    my ($path) = @_;
+
+    return Text::MultiMarkdown::XS::Tree->_map($path)
+        || croak("cannot map '$path' as a parse tree: $!");
+}
+
+
+sub metadata {
+    my $self = shift;
+
+    # Allow both functional and method call styles
+    unless (ref $self) {
+        if ( $self ne __PACKAGE__ ) {
+            unshift @_, $self;
+            undef $self;
+        }
+    }
+
+    my ($text, $options) = @_;
+
+    $options ||= {};
+    $options = { %$self, %$options } if ref $self;
+
+    my ($extensions) = _compile_options($options);
+
+    return _metadata($text, $extensions);
+}
+
+
+sub markdown_many {
+    # Allow both functional and method call styles
+    my $self = ref $_[0] eq 'ARRAY' ? undef : shift;
+
+    my ($texts, $options) = @_;
+
+    croak('markdown_many expects an array reference of texts')
+        unless ref $texts eq 'ARRAY';
+
+    $options ||= {};
+    $options = { %$self, %$options } if ref $self;
+
+    my $threads = $options->{threads} || 0;
+    croak("invalid value for threads option: '$threads'")
+        unless $threads =~ /^\d+$/;
+
+    return _markdown_many($texts, _compile_options($options), $threads);
+}
+
+
+sub cache_size {
+    # Allow both functional and class method call styles
+    shift if @_ and (ref $_[0] or $_[0] eq __PACKAGE__);
+
+    my ($bytes) = @_;
+
+    if (defined $bytes) {
+        croak("invalid cache size: '$bytes'")
+            unless $bytes =~ /^\d+$/;
+        _cache_set_limit($bytes);
+    }
+
+    return cache_stats()->{limit};
+}
+
+
+sub cache_file {
+    # Allow both functional and class method call styles
+    shift if @_ and (ref $_[0] or $_[0] eq __PACKAGE__);
+
+    return _cache_shared_path() unless @_;
+
+    my ($path, $bytes) = @_;
+
+    if (!defined $path) {
+        _cache_unshare();
+        return;
+    }
+
+    $bytes = 64 * 1024 * 1024 unless defined $bytes;
+    croak("invalid cache size: '$bytes'")
+        unless $bytes =~ /^\d+$/;
+    _cache_share($path, $bytes)
+        or croak("cannot use '$path' as a cache file: $!");
+
+    return $path;
+}
+
+
+# Translate an options hash into the ($extensions, $output_format) pair
+# expected by the library
+
+sub _compile_options {
+    my $options = shift;
+
     my $extensions    = EXT_SMART;
     my $output_format = HTML_FORMAT;
 
@@ -114,12 +396,42 @@ sub markdown {
 	}
     }
 
-    return _markdown($text, $extensions, $output_format);
+    return ($extensions, $output_format);
 }
 
 
 sub DESTROY {}
 
+
+package Text::MultiMarkdown::XS::Converter;
+
+# The native converter can't be shared between threads
+sub CLONE_SKIP { 1 }
+
+package Text::MultiMarkdown::XS::Stream;
+
+sub CLONE_SKIP { 1 }
+
+package Text::MultiMarkdown::XS::Document;
+
+sub CLONE_SKIP { 1 }
+
+package Text::MultiMarkdown::XS::Tree;
+
+sub CLONE_SKIP { 1 }
+
+sub markdown {
+    my ($self, $options) = @_;
+
+    my $output = $self->_export(Text::MultiMarkdown::XS::_compile_options($options));
+    Carp::croak('a tree parsed for OPML only converts to OPML, and the other way about')
+        unless defined $output;
+
+    return $output;
+}
+
+package Text::MultiMarkdown::XS;
+
 sub AUTOLOAD {
     # This AUTOLOAD is used to 'autoload' constants from the constant()
     # XS function.
@@ -161,6 +473,234 @@ change without notice.
 C<Text::MultiMarkdown::XS> is a wrapper around Fletcher T. Penney's MultiMarkdown library
 (version 4).
 
+=head1 OBJECT INTERFACE
+
+  my $mmd  = Text::MultiMarkdown::XS->new(output => 'html', smart => 0);
+
+  my $html = $mmd->markdown($text);
+
+An object holds a native converter that is set up once, when the object is created:
+the options given to C<new()> are compiled at that point, and the parser stacks and
+buffers are kept and reused from one call to the next.  This makes repeated
+conversion of many short texts considerably cheaper than calling the C<markdown()>
+function.  Changing the object's options after it has been created has no effect.
+
+Options passed to the C<markdown()> method override those given to C<new()> for that
+call only, and bypass the cached converter.
+
+=head1 FUNCTIONS
+
+=over 4
+
+=item C<markdown($text, \%options)>
+
+converts a single document and returns the result as a string.
+
+=item C<markdown_inline($text, \%options)>
+
+converts a text that contains only inline Markdown (emphasis, code spans, links and so
+on), such as a title or a caption.  The text is not treated as a document: there is no
+metadata, block structure or paragraph wrapping, so C<markdown_inline("*a* b")> returns
+C<< <em>a</em> b >> rather than C<< <p><em>a</em> b</p> >>.  Line ends are kept as they
+are, including those before a line that would start a block, so C<markdown_inline("a\n# b")>
+returns C<"a\n# b">.  Blank lines are treated as spaces, and the C<complete> option is ignored.  This is also faster than C<markdown()>.
+
+C<markdown_inline> is not exported by default.
+
+=item C<markdown_with_meta($text, \%options)>
+
+converts C<$text> as C<markdown()> does and returns a list of the output and a
+reference to a hash of the document's metadata, as returned by C<metadata()>:
+
+    my ($html, $meta) = markdown_with_meta($text);
+    print $meta->{title};
+
+The document is parsed only once, so this is cheaper than calling C<markdown()> and
+C<metadata()> separately.  It can also be called as a method.
+
+C<markdown_with_meta> is not exported by default.
+
+=item C<markdown_to($text, $out, \%options)>
+
+converts C<$text> as C<markdown()> does, but writes the output to C<$out> as it is
+produced instead of returning it, so that the whole of a large document's output
+is never held in memory at once.  C<$out> is either a filehandle open for writing,
+or a code reference that is called with successive pieces of the output (of up to
+about 64KB each):
+
+    markdown_to($text, \*STDOUT);
+    markdown_to($text, sub { $socket->send($_[0]) });
+
+The output is written to a filehandle as bytes, as C<markdown()> would return
+them, so a handle that output from a character string is written to should have
+a C<:utf8> layer.  The function returns true, and croaks if a write fails or the
+code reference dies.  It can also be called as a method.
+
+With the C<streaming> option the document is also parsed and converted a block at
+a time, so that memory use depends on the size of the largest block rather than
+on the length of the document (see L</OPTIONS>).
+
+C<markdown_to> is not exported by default.
+
+=item C<markdown_stream($out, \%options)>
+
+starts a document that is fed to the converter a piece at a time, for instance as it
+is read from a socket, and returns an object with two methods: C<feed($text)> adds
+the next piece, and C<finish()> ends the document.  The output is written to C<$out>
+as C<markdown_to()> writes it, each block as soon as the text after it shows where
+the block ends:
+
+    my $stream = markdown_stream(\*STDOUT);
+    while (read($socket, my $text, 65536)) {
+        $stream->feed($text);
+    }
+    $stream->finish;
+
+A piece may end anywhere, even inside a line.  The first piece decides whether the
+output is characters or bytes, as the text does for C<markdown()>.
+
+As the definitions further on in the document haven't been read yet, a block whose
+links, footnotes or citations can't all be resolved is held back, with the blocks
+after it, until the definitions arrive or the stream is finished.  The output is
+the same as C<markdown()> gives, except that a link defined more than once takes
+the definition read by the time the link is written rather than the last one.
+OPML output and Critic Markup accept or reject need the whole document, so for them
+nothing is written until the stream is finished.  A stream that is dropped without
+being finished writes nothing more.  It can also be called as a method.
+
+C<markdown_stream> is not exported by default.
+
+=item C<markdown_document(\%options)>
+
+returns an object for a document that is rendered again and again as it is edited,
+for instance a wiki page.  Its C<render($text)> method converts the document as it
+now stands and returns the output, which is the same as C<markdown()> gives, but
+only the top-level blocks (paragraphs, lists, headings and so on) whose output may
+have changed since the last render are written again; the output of the others is
+reused.  A block is written again when its text, or the definition of a link or
+footnote it refers to, or the number its footnotes get, has changed.
+
+After a render, C<changed()> returns the indexes of the blocks that were written
+again, in order, and C<blocks()> returns the output of every block, so that a page
+already shown can be patched rather than replaced:
+
+    my $doc = markdown_document({ output => 'html' });
+    my $html = $doc->render($text);
+    ...
+    $doc->render($edited_text);
+    my @blocks = $doc->blocks;
+    update_block($_, $blocks[$_]) for $doc->changed;
+
+The output is made of what comes before the first block (a complete document's
+head), then the blocks, then what comes after them (the footnotes, and the end of a
+complete document), which is written afresh each time.  Formats that gather the
+blocks under their headings (OPML, plain text and beamer) and Critic Markup accept
+or reject are rendered whole, as a single block.  It can also be called as a method.
+
+C<markdown_document> is not exported by default.
+
+=item C<serialize_tree($text, \%options)>
+
+parses C<$text> and returns the parse tree as a binary image (a byte string), which
+can be kept, for instance in a file beside the text, so that the document can be
+converted again later, into another format or with other options, without parsing
+it again.  C<deserialize_tree($image)> and C<map_tree($path)> give back the tree,
+the second by mapping a file holding an image rather than reading it, and croak if
+the image isn't one this version of the module can read, or has been damaged
+since it was written.  That check is not proof against an image edited on
+purpose, which can crash the converter, so images should only be read from
+where the text itself would be trusted.  The tree's
+C<markdown(\%options)> method converts it, with the same output as C<markdown()>
+gives for the text:
+
+    my $image = serialize_tree($text, { notes => 1 });
+    ...
+    my $tree = deserialize_tree($image);
+    my $html  = $tree->markdown({ notes => 1 });
+    my $latex = $tree->markdown({ notes => 1, output => 'latex' });
+
+Options that change how the text is parsed (C<smart>, C<notes>, C<use_metadata>
+and C<linear_inlines>) are those given to C<serialize_tree>; the others, and the
+output format, are those given to C<markdown>.  OPML is parsed differently from the
+other formats, so a tree made for OPML only converts to OPML, and a tree made for
+another format doesn't convert to OPML.  Images are in the byte order of the machine
+that made them and are only read by the version of the module that wrote them (or
+one with the same image format).  The output is a byte string, encoded in UTF-8
+where the text was a character string.
+
+These functions are not exported by default.
+
+=item C<metadata($text)>
+
+returns a reference to a hash of the metadata at the start of C<$text>, without
+converting the rest of the document.  Only the leading metadata block is parsed, so
+this is much cheaper than C<markdown()> for reading titles, dates and the like from
+many documents.  Keys are normalized the way MultiMarkdown matches metadata keys
+(lower case, with spaces and most punctuation removed), so C<Base Header Level>
+becomes C<baseheaderlevel>.  Values have trailing whitespace removed.  If
+C<use_metadata> is false the hash is empty.
+
+C<metadata> is not exported by default.
+
+=item C<markdown_many(\@texts, \%options)>
+
+converts a list of documents and returns a reference to an array of results in the
+same order as the input.  The conversions are run in parallel on a pool of native
+threads, outside the Perl interpreter, so this is much faster than calling
+C<markdown()> in a loop on a multi-core machine.  An undefined element in C<@texts>
+produces an undefined result.  The same options apply to every document; in addition
+the C<threads> option sets the number of worker threads (the default is one per CPU).
+
+C<markdown_many> is not exported by default.
+
+=item C<cache_size($bytes)>
+
+sets the size of the cache of converted documents and returns it; without an
+argument it just returns it.  The cache is off (size 0) until it is given a size.
+While it is on, converting a document that was converted recently with the same
+options returns the stored output without parsing the document again.  Every
+function and object that returns the whole output uses the cache, on all threads;
+C<markdown_to()> and C<markdown_stream()> do not.  Documents are looked up by a
+128 bit hash of the text, the options and the MultiMarkdown version.  The size
+counts the stored output and a little bookkeeping for each document; when it is
+full the least recently used documents are dropped.  Setting a smaller size drops
+what no longer fits, and 0 turns the cache off and empties it.
+
+Masked email addresses (the C<obfuscate> option) are the same each time a
+document is converted, so they don't stop the cache from working.
+
+=item C<cache_stats()>
+
+returns a reference to a hash describing the cache: C<limit> (its size),
+C<bytes> and C<entries> (what it holds), and C<hits>, C<misses> and C<evictions>
+(counted since the program started).
+
+=item C<cache_flush()>
+
+empties the cache, leaving its size and the counters as they are.
+
+=item C<cache_file($path, $bytes)>
+
+keeps the cache in the file C<$path>, mapped into memory, instead of in the
+process, so that every process using the same file shares one cache: the
+workers of a preforking server, or a series of short-lived scripts.  A new file
+is made C<$bytes> long (64MB by default); an existing cache file keeps its size
+and whatever it holds, and any other file that isn't empty is refused.  Outputs
+are appended to the file as to a ring, overwriting the oldest, so the cache
+needs no room of its own and C<cache_size> has no effect on it; C<cache_stats>
+then describes the shared cache, with C<limit> the room there is for outputs
+and the counters kept across all the processes, and C<cache_flush> empties it
+for all of them.
+
+Without arguments it returns the file in use, or C<undef>; C<cache_file(undef)>
+goes back to the process's own cache.  It dies, with the reason, if the file
+can't be used.  Call it before starting any threads of C<markdown_many>, not
+while they are running.
+
+C<cache_size>, C<cache_stats>, C<cache_flush> and C<cache_file> are not exported by default.
+
+=back
+
 =head1 OPTIONS
 
 The C<markdown()> function takes a number of options:
@@ -188,6 +728,68 @@ boolean value to specify whether a complete document or a fragment should be gen
 
 boolean value to specify whether I<smart> quotes should be enabled.
 
+=item C<notes>
+
+boolean value to specify whether footnotes and citations should be processed
+(default is false).
+
+=item C<linear_inlines>
+
+boolean value to specify whether emphasis, links, images and smart quotes
+should be paired up with a delimiter stack after parsing, rather than by
+backtracking while parsing.  The ends of spans found by scanning ahead
+(citations, footnote references, autolinks, HTML comments and math) are
+found once for all the openers before them.  This takes time linear in the
+length of a paragraph however many delimiters or spans are left unclosed.
+Link labels and reference definitions are matched as without the option,
+nested brackets included, and so is emphasis whose delimiters pair up in
+order.  The output differs in these cases:
+
+=over 4
+
+=item *
+
+a line followed by a setext underline (C<===> or C<--->) or by a definition
+(C<: text>) becomes a heading or a definition term even when emphasis, a
+link or a quote opened on it closes after that line; without the option the
+lines stay one paragraph, so C<a *b\n: c* d> is C<< <p>a <em>b\n: c</em>
+d</p> >> rather than a definition list;
+
+=item *
+
+brackets bind before quotes or emphasis that cross them, so
+C<[a *b](/u) c*> is a link, and C<[a *b]: /u*x> is a reference definition;
+
+=item *
+
+runs of C<*> and C<_> that interleave, or a closing run that could also open
+strong emphasis later in the paragraph, may be split differently;
+
+=item *
+
+emphasis or a reference link is not continued across a line break inside a
+heading or a list item's first line;
+
+=item *
+
+a C<[label]> ending a heading after another C<[label]> is taken as the
+heading's label rather than as a reference link.
+
+=back
+
+=item C<threads>
+
+the number of worker threads used by C<markdown_many()> (ignored by C<markdown()>).
+
+=item C<streaming>
+
+boolean value to specify whether C<markdown_to()> parses, converts and writes the
+document a block at a time, so that memory use stays bounded however long the
+document is.  The output is the same.  Where a document has link or footnote
+references, it is parsed twice: first for the definitions, which may come after
+the references to them, and then for the output.  OPML output needs the whole
+document, so this option has no effect on it; other functions ignore it.
+
 =back
 
 The following values are accepted as boolean false values: C<undef>, 0, 'false' or 'off'
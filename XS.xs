@@ -6,6 +6,216 @@
 #include "const-defs.inc"
 #include "const-c.inc"
 
+/* Hand a malloc'ed, NUL terminated result buffer over to a new SV.  Where
+   Perl's allocator is the system malloc the SV takes ownership of the
+   buffer as is; otherwise the buffer is copied and freed. */
+static SV *
+mmd_adopt_result(pTHX_ char *result, size_t len)
+{
+    SV *sv;
+#if defined(MYMALLOC) || defined(PERL_IMPLICIT_SYS) || defined(PERL_TRACK_MEMPOOL)
+    sv = newSVpvn(result, len);
+    free(result);
+#else
+    sv = newSV_type(SVt_PV);
+    sv_usepvn_flags(sv, result, len, SV_HAS_TRAILING_NUL);
+#endif
+    return sv;
+}
+
+/* Build a hash from a key/value array as returned by extract_metadata, and
+   free the array */
+static HV *
+mmd_metadata_hash(pTHX_ char **pairs, bool utf8)
+{
+    HV    *hv = newHV();
+    char **step;
+
+    for (step = pairs; *step != NULL; step += 2) {
+        SV *value = newSVpv(step[1], 0);
+        if (utf8)
+            SvUTF8_on(value);
+        (void) hv_store(hv, step[0], strlen(step[0]), value, 0);
+    }
+    free_metadata(pairs);
+    return hv;
+}
+
+/* Where streamed output goes: a Perl filehandle or a code reference that is
+   called with each piece of the output */
+typedef struct {
+    PerlIO *fp;
+    SV     *code;
+    bool    utf8;
+    SV     *error;          /* the exception if the code reference died */
+    char    held[3];        /* the start of a character split by a flush */
+    size_t  held_len;
+} mmd_perl_sink;
+
+/* The number of bytes at the end of the len bytes at s that start a UTF-8
+   character without finishing it */
+static size_t
+mmd_utf8_partial(const char *s, size_t len)
+{
+    size_t i;
+    unsigned char c;
+
+    for (i = 1; i <= 3 && i <= len; i++) {
+        c = (unsigned char) s[len - i];
+        if ((c & 0xC0) == 0x80)
+            continue;
+        if (c < 0xC0)
+            return 0;
+        return (i < (size_t) ((c >= 0xF0) ? 4 : (c >= 0xE0) ? 3 : 2)) ? i : 0;
+    }
+    return 0;
+}
+
+/* Pass chunk to the sink's code reference */
+static bool
+mmd_perl_call(pTHX_ mmd_perl_sink *sink, SV *chunk)
+{
+    dSP;
+    bool ok;
+
+    ENTER;
+    SAVETMPS;
+    PUSHMARK(SP);
+    XPUSHs(chunk);
+    PUTBACK;
+
+    /* an exception must not unwind through the converter, so it is
+       caught here and rethrown once the conversion is over */
+    call_sv(sink->code, G_DISCARD | G_EVAL);
+    ok = !SvTRUE(ERRSV);
+    if (!ok)
+        sink->error = newSVsv(ERRSV);
+
+    FREETMPS;
+    LEAVE;
+    return ok;
+}
+
+static bool
+mmd_perl_write(void *context, const char *data, size_t len)
+{
+    dTHX;
+    mmd_perl_sink *sink = (mmd_perl_sink *) context;
+    SV *chunk;
+    size_t partial;
+
+    if (sink->fp != NULL)
+        return PerlIO_write(sink->fp, data, len) == (SSize_t) len;
+    if (!sink->utf8)
+        return mmd_perl_call(aTHX_ sink, sv_2mortal(newSVpvn(data, len)));
+
+    /* the output is flushed wherever its buffer fills, which can be in the
+       middle of a character; each chunk of characters must be whole, so
+       the start of a split character is held for the next one */
+    chunk = sv_2mortal(newSV(sink->held_len + len + 1));
+    sv_setpvn(chunk, sink->held, sink->held_len);
+    sv_catpvn(chunk, data, len);
+    partial = mmd_utf8_partial(SvPVX(chunk), SvCUR(chunk));
+    sink->held_len = partial;
+    if (partial > 0) {
+        Copy(SvEND(chunk) - partial, sink->held, partial, char);
+        SvCUR_set(chunk, SvCUR(chunk) - partial);
+        *SvEND(chunk) = '\0';
+    }
+    if (SvCUR(chunk) == 0)
+        return true;
+    SvUTF8_on(chunk);
+    return mmd_perl_call(aTHX_ sink, chunk);
+}
+
+/* A sink that appends to an SV */
+static bool
+mmd_perl_append(void *context, const char *data, size_t len)
+{
+    dTHX;
+    sv_catpvn((SV *) context, data, len);
+    return true;
+}
+
+static void
+mmd_perl_sink_init(pTHX_ mmd_perl_sink *sink, SV *target, bool utf8)
+{
+    sink->fp    = NULL;
+    sink->code  = NULL;
+    sink->utf8  = utf8;
+    sink->error = NULL;
+    sink->held_len = 0;
+
+    if (SvROK(target) && SvTYPE(SvRV(target)) == SVt_PVCV) {
+        sink->code = target;
+    }
+    else {
+        sink->fp = IoOFP(sv_2io(target));
+        if (sink->fp == NULL)
+            croak("Filehandle is not open for output");
+    }
+}
+
+/* Pass on anything held back at the end of the output, which can only be
+   there if the output ends in the middle of a character */
+static bool
+mmd_perl_sink_close(pTHX_ mmd_perl_sink *sink)
+{
+    SV *chunk;
+
+    if (sink->held_len == 0 || sink->error != NULL)
+        return true;
+    chunk = sv_2mortal(newSVpvn(sink->held, sink->held_len));
+    sink->held_len = 0;
+    SvUTF8_on(chunk);
+    return mmd_perl_call(aTHX_ sink, chunk);
+}
+
+static void
+mmd_perl_sink_finish(pTHX_ mmd_perl_sink *sink, bool ok)
+{
+    SV *error = sink->error;
+
+    if (error != NULL) {
+        sink->error = NULL;
+        croak_sv(sv_2mortal(error));
+    }
+    if (!ok)
+        croak("Error writing output: %s", Strerror(errno));
+}
+
+/* Converter results at least this long are handed over to Perl rather than
+   copied out of the converter's output buffer */
+#define MMD_ADOPT_THRESHOLD (64 * 1024)
+
+/* A document fed a piece at a time, and where its output goes */
+typedef struct {
+    mmd_stream    *stream;      /* NULL once finished */
+    mmd_perl_sink  sink;
+    SV            *target;      /* kept alive as long as the stream */
+    bool           fed;         /* sink.utf8 is set by the first piece */
+    bool           busy;        /* in the middle of a feed or finish */
+} mmd_perl_stream;
+
+/* A document rendered again and again, and whether its last text was
+   characters or bytes */
+typedef struct {
+    mmd_document  *document;
+    bool           utf8;
+} mmd_perl_document;
+
+/* A parse tree loaded from its image, and the copy of the image it uses
+   (NULL if the tree maps a file) */
+typedef struct {
+    mmd_tree      *tree;
+    SV            *image;
+} mmd_perl_tree;
+
+typedef mmd_converter * Text__MultiMarkdown__XS__Converter;
+typedef mmd_perl_stream * Text__MultiMarkdown__XS__Stream;
+typedef mmd_perl_document * Text__MultiMarkdown__XS__Document;
+typedef mmd_perl_tree * Text__MultiMarkdown__XS__Tree;
+
 MODULE = Text::MultiMarkdown::XS          PACKAGE = Text::MultiMarkdown::XS
 
 PROTOTYPES: DISABLE
@@ -18,18 +228,261 @@ BOOT:
 
 SV *
 _markdown(text, extensions=0, output_format=0)
-    char *text;
+    SV  *text;
     int  extensions;
     int  output_format;
 
  INIT:
-    char *result;
+    const char *source;
+    STRLEN      source_len;
+    char       *result;
+    size_t      result_len;
 
  CODE:
-    /* markdown_to_string returns a malloc'ed string */
-    result = markdown_to_string(text, extensions, output_format);
-    RETVAL = newSVpv(result, 0);
-    free(result);
+    source = SvPV_const(text, source_len);
+
+    /* markdown_to_string_len returns a malloc'ed string */
+    result = markdown_to_string_len(source, source_len, extensions, output_format, &result_len);
+    RETVAL = mmd_adopt_result(aTHX_ result, result_len);
+    if (SvUTF8(text))
+        SvUTF8_on(RETVAL);
+
+ OUTPUT:
+    RETVAL
+
+SV *
+_markdown_inline(text, extensions=0, output_format=0)
+    SV  *text;
+    int  extensions;
+    int  output_format;
+
+ INIT:
+    const char *source;
+    STRLEN      source_len;
+    char       *result;
+    size_t      result_len;
+
+ CODE:
+    source = SvPV_const(text, source_len);
+
+    /* markdown_inline_to_string_len returns a malloc'ed string */
+    result = markdown_inline_to_string_len(source, source_len, extensions, output_format, &result_len);
+    RETVAL = mmd_adopt_result(aTHX_ result, result_len);
+    if (SvUTF8(text))
+        SvUTF8_on(RETVAL);
+
+ OUTPUT:
+    RETVAL
+
+SV *
+_metadata(text, extensions=0)
+    SV  *text;
+    int  extensions;
+
+ INIT:
+    const char *source;
+    STRLEN      source_len;
+    char      **pairs;
+
+ CODE:
+    source = SvPV_const(text, source_len);
+
+    /* extract_metadata returns a NULL terminated array of keys and values */
+    pairs  = extract_metadata(source, source_len, extensions);
+    RETVAL = newRV_noinc((SV *) mmd_metadata_hash(aTHX_ pairs, SvUTF8(text)));
+
+ OUTPUT:
+    RETVAL
+
+void
+_markdown_with_meta(text, extensions=0, output_format=0)
+    SV  *text;
+    int  extensions;
+    int  output_format;
+
+ INIT:
+    const char *source;
+    STRLEN      source_len;
+    char       *result;
+    size_t      result_len;
+    char      **pairs;
+    SV         *html;
+
+ PPCODE:
+    source = SvPV_const(text, source_len);
+
+    /* the output and the metadata both come from a single parse */
+    result = markdown_with_metadata_len(source, source_len, extensions, output_format, &result_len, &pairs);
+    html   = mmd_adopt_result(aTHX_ result, result_len);
+    if (SvUTF8(text))
+        SvUTF8_on(html);
+
+    EXTEND(SP, 2);
+    PUSHs(sv_2mortal(html));
+    PUSHs(sv_2mortal(newRV_noinc((SV *) mmd_metadata_hash(aTHX_ pairs, SvUTF8(text)))));
+
+SV *
+_markdown_many(texts, extensions=0, output_format=0, threads=0)
+    AV  *texts;
+    int  extensions;
+    int  output_format;
+    int  threads;
+
+ INIT:
+    char   **sources;
+    size_t  *lens;
+    char   **results;
+    size_t  *result_lens;
+    AV      *av;
+    SSize_t  count, i;
+
+ CODE:
+    /* Collect the string buffers up front on this thread; the worker threads
+       only ever see plain C strings and never touch the interpreter */
+    count   = av_len(texts) + 1;
+    sources     = (char **) safecalloc(count ? count : 1, sizeof(char *));
+    lens        = (size_t *) safecalloc(count ? count : 1, sizeof(size_t));
+    result_lens = (size_t *) safecalloc(count ? count : 1, sizeof(size_t));
+    for (i = 0; i < count; i++) {
+        SV **svp = av_fetch(texts, i, 0);
+        STRLEN len;
+        if (svp && SvOK(*svp)) {
+            sources[i] = SvPV(*svp, len);
+            lens[i]    = len;
+        }
+    }
+
+    /* markdown_to_strings_len returns a malloc'ed array of malloc'ed strings */
+    results = markdown_to_strings_len(sources, lens, (int) count, extensions, output_format, threads, result_lens);
+
+    av = newAV();
+    av_extend(av, count);
+    for (i = 0; i < count; i++) {
+        SV **svp = av_fetch(texts, i, 0);
+        SV  *sv;
+        if (results[i]) {
+            sv = mmd_adopt_result(aTHX_ results[i], result_lens[i]);
+            if (SvUTF8(*svp))
+                SvUTF8_on(sv);
+        }
+        else {
+            sv = newSV(0);
+        }
+        av_push(av, sv);
+    }
+    free(results);
+    safefree(sources);
+    safefree(lens);
+    safefree(result_lens);
+    RETVAL = newRV_noinc((SV *) av);
+
+ OUTPUT:
+    RETVAL
+
+void
+_markdown_to(text, target, extensions=0, output_format=0)
+    SV  *text;
+    SV  *target;
+    int  extensions;
+    int  output_format;
+
+ ALIAS:
+    _markdown_stream_to = 1
+
+ INIT:
+    const char   *source;
+    STRLEN        source_len;
+    mmd_perl_sink sink;
+    bool          ok;
+
+ CODE:
+    source = SvPV_const(text, source_len);
+    mmd_perl_sink_init(aTHX_ &sink, target, SvUTF8(text));
+    if (ix == 1)
+        ok = markdown_stream_to_sink(source, source_len, extensions, output_format, mmd_perl_write, &sink);
+    else
+        ok = markdown_to_sink(source, source_len, extensions, output_format, mmd_perl_write, &sink);
+    ok = mmd_perl_sink_close(aTHX_ &sink) && ok;
+    mmd_perl_sink_finish(aTHX_ &sink, ok);
+
+void
+_cache_set_limit(bytes)
+    UV  bytes;
+
+ CODE:
+    mmd_cache_set_limit((size_t) bytes);
+
+void
+cache_flush(...)
+
+ CODE:
+    mmd_cache_flush();
+
+SV *
+cache_stats(...)
+
+ INIT:
+    mmd_cache_stats stats;
+    HV             *hv;
+
+ CODE:
+    mmd_cache_get_stats(&stats);
+    hv = newHV();
+    (void) hv_store(hv, "limit",     5, newSVuv((UV) stats.limit), 0);
+    (void) hv_store(hv, "bytes",     5, newSVuv((UV) stats.bytes), 0);
+    (void) hv_store(hv, "entries",   7, newSVuv((UV) stats.entries), 0);
+    (void) hv_store(hv, "hits",      4, newSVuv((UV) stats.hits), 0);
+    (void) hv_store(hv, "misses",    6, newSVuv((UV) stats.misses), 0);
+    (void) hv_store(hv, "evictions", 9, newSVuv((UV) stats.evictions), 0);
+    RETVAL = newRV_noinc((SV *) hv);
+
+ OUTPUT:
+    RETVAL
+
+bool
+_cache_share(path, bytes)
+    const char *path;
+    UV  bytes;
+
+ CODE:
+    RETVAL = mmd_cache_share(path, (size_t) bytes);
+
+ OUTPUT:
+    RETVAL
+
+void
+_cache_unshare()
+
+ CODE:
+    mmd_cache_unshare();
+
+SV *
+_cache_shared_path()
+
+ INIT:
+    const char *path;
+
+ CODE:
+    path = mmd_cache_shared_path();
+    RETVAL = (path != NULL) ? newSVpv(path, 0) : &PL_sv_undef;
+
+ OUTPUT:
+    RETVAL
+
+SV *
+_serialize_tree(text, extensions=0, output_format=0)
+    SV  *text;
+    int  extensions;
+    int  output_format;
+
+ INIT:
+    const char *source;
+    STRLEN      source_len;
+
+ CODE:
+    source = SvPV_const(text, source_len);
+    RETVAL = newSVpvn("", 0);
+    mmd_serialize(source, source_len, extensions, output_format, mmd_perl_append, RETVAL);
 
  OUTPUT:
     RETVAL
@@ -37,5 +490,398 @@ _markdown(text, extensions=0, output_format=0)
 INCLUDE: const-xs.inc
 
 
+MODULE = Text::MultiMarkdown::XS          PACKAGE = Text::MultiMarkdown::XS::Converter
+
+Text::MultiMarkdown::XS::Converter
+new(class, extensions=0, output_format=0)
+    const char *class;
+    int  extensions;
+    int  output_format;
 
+ CODE:
+    PERL_UNUSED_VAR(class);
+    RETVAL = mmd_converter_new(extensions, output_format);
 
+ OUTPUT:
+    RETVAL
+
+SV *
+convert(self, text)
+    Text::MultiMarkdown::XS::Converter self;
+    SV  *text;
+
+ INIT:
+    const char *source;
+    STRLEN      source_len;
+    const char *result;
+    size_t      result_len;
+
+ CODE:
+    source = SvPV_const(text, source_len);
+
+    /* the result stays in the converter's buffer for reuse by the next
+       call unless it is large enough to be worth taking over */
+    result = mmd_converter_convert(self, source, source_len, &result_len);
+    if (result_len >= MMD_ADOPT_THRESHOLD)
+        RETVAL = mmd_adopt_result(aTHX_ mmd_converter_detach_output(self), result_len);
+    else
+        RETVAL = newSVpvn(result, result_len);
+    if (SvUTF8(text))
+        SvUTF8_on(RETVAL);
+
+ OUTPUT:
+    RETVAL
+
+SV *
+convert_inline(self, text)
+    Text::MultiMarkdown::XS::Converter self;
+    SV  *text;
+
+ INIT:
+    const char *source;
+    STRLEN      source_len;
+    const char *result;
+    size_t      result_len;
+
+ CODE:
+    source = SvPV_const(text, source_len);
+    result = mmd_converter_convert_inline(self, source, source_len, &result_len);
+    if (result_len >= MMD_ADOPT_THRESHOLD)
+        RETVAL = mmd_adopt_result(aTHX_ mmd_converter_detach_output(self), result_len);
+    else
+        RETVAL = newSVpvn(result, result_len);
+    if (SvUTF8(text))
+        SvUTF8_on(RETVAL);
+
+ OUTPUT:
+    RETVAL
+
+void
+convert_with_meta(self, text)
+    Text::MultiMarkdown::XS::Converter self;
+    SV  *text;
+
+ INIT:
+    const char *source;
+    STRLEN      source_len;
+    const char *result;
+    size_t      result_len;
+    char      **pairs;
+    SV         *html;
+
+ PPCODE:
+    source = SvPV_const(text, source_len);
+    result = mmd_converter_convert_with_metadata(self, source, source_len, &result_len, &pairs);
+    if (result_len >= MMD_ADOPT_THRESHOLD)
+        html = mmd_adopt_result(aTHX_ mmd_converter_detach_output(self), result_len);
+    else
+        html = newSVpvn(result, result_len);
+    if (SvUTF8(text))
+        SvUTF8_on(html);
+
+    EXTEND(SP, 2);
+    PUSHs(sv_2mortal(html));
+    PUSHs(sv_2mortal(newRV_noinc((SV *) mmd_metadata_hash(aTHX_ pairs, SvUTF8(text)))));
+
+void
+convert_to(self, text, target)
+    Text::MultiMarkdown::XS::Converter self;
+    SV  *text;
+    SV  *target;
+
+ ALIAS:
+    stream_to = 1
+
+ INIT:
+    const char   *source;
+    STRLEN        source_len;
+    mmd_perl_sink sink;
+    bool          ok;
+
+ CODE:
+    source = SvPV_const(text, source_len);
+    mmd_perl_sink_init(aTHX_ &sink, target, SvUTF8(text));
+    if (ix == 1)
+        ok = mmd_converter_stream_to(self, source, source_len, mmd_perl_write, &sink);
+    else
+        ok = mmd_converter_convert_to(self, source, source_len, mmd_perl_write, &sink);
+    ok = mmd_perl_sink_close(aTHX_ &sink) && ok;
+    mmd_perl_sink_finish(aTHX_ &sink, ok);
+
+void
+DESTROY(self)
+    Text::MultiMarkdown::XS::Converter self;
+
+ CODE:
+    mmd_converter_free(self);
+
+
+MODULE = Text::MultiMarkdown::XS          PACKAGE = Text::MultiMarkdown::XS::Stream
+
+Text::MultiMarkdown::XS::Stream
+_new(class, target, extensions=0, output_format=0)
+    const char *class;
+    SV  *target;
+    int  extensions;
+    int  output_format;
+
+ INIT:
+    mmd_perl_sink sink;
+
+ CODE:
+    PERL_UNUSED_VAR(class);
+    target = newSVsv(target);
+    mmd_perl_sink_init(aTHX_ &sink, sv_2mortal(target), false);
+
+    RETVAL = (mmd_perl_stream *) safemalloc(sizeof(mmd_perl_stream));
+    RETVAL->sink   = sink;
+    RETVAL->target = SvREFCNT_inc_simple_NN(target);
+    RETVAL->fed    = false;
+    RETVAL->busy   = false;
+    RETVAL->stream = mmd_stream_new(extensions, output_format, mmd_perl_write, &RETVAL->sink);
+
+ OUTPUT:
+    RETVAL
+
+void
+feed(self, text)
+    Text::MultiMarkdown::XS::Stream self;
+    SV  *text;
+
+ INIT:
+    const char *source;
+    STRLEN      source_len;
+    bool        ok;
+
+ CODE:
+    if (self->stream == NULL)
+        croak("The stream has been finished");
+    if (self->busy)
+        croak("The stream can't be fed from its own output");
+
+    source = SvPV_const(text, source_len);
+
+    /* the first piece decides whether the output is characters or bytes,
+       and the later pieces are made to match */
+    if (!self->fed) {
+        self->sink.utf8 = SvUTF8(text) ? true : false;
+        self->fed = true;
+    }
+    else if (!SvUTF8(text) != !self->sink.utf8) {
+        text = sv_2mortal(newSVpvn_flags(source, source_len, SvUTF8(text)));
+        if (self->sink.utf8)
+            sv_utf8_upgrade(text);
+        else if (!sv_utf8_downgrade(text, TRUE))
+            croak("Wide character fed to a stream of bytes");
+        source = SvPV_const(text, source_len);
+    }
+
+    self->busy = true;
+    ok = mmd_stream_feed(self->stream, source, source_len);
+    self->busy = false;
+    mmd_perl_sink_finish(aTHX_ &self->sink, ok);
+
+void
+finish(self)
+    Text::MultiMarkdown::XS::Stream self;
+
+ INIT:
+    mmd_stream *stream;
+    bool        ok;
+
+ CODE:
+    if (self->stream == NULL)
+        croak("The stream has been finished");
+    if (self->busy)
+        croak("The stream can't be finished from its own output");
+
+    stream = self->stream;
+    self->stream = NULL;
+    self->busy = true;
+    ok = mmd_stream_finish(stream);
+    ok = mmd_perl_sink_close(aTHX_ &self->sink) && ok;
+    self->busy = false;
+    mmd_perl_sink_finish(aTHX_ &self->sink, ok);
+
+void
+DESTROY(self)
+    Text::MultiMarkdown::XS::Stream self;
+
+ CODE:
+    /* a stream that wasn't finished is abandoned */
+    mmd_stream_free(self->stream);
+    SvREFCNT_dec(self->target);
+    safefree(self);
+
+
+MODULE = Text::MultiMarkdown::XS          PACKAGE = Text::MultiMarkdown::XS::Document
+
+Text::MultiMarkdown::XS::Document
+_new(class, extensions=0, output_format=0)
+    const char *class;
+    int  extensions;
+    int  output_format;
+
+ CODE:
+    PERL_UNUSED_VAR(class);
+    RETVAL = (mmd_perl_document *) safemalloc(sizeof(mmd_perl_document));
+    RETVAL->document = mmd_document_new(extensions, output_format);
+    RETVAL->utf8     = false;
+
+ OUTPUT:
+    RETVAL
+
+SV *
+render(self, text)
+    Text::MultiMarkdown::XS::Document self;
+    SV  *text;
+
+ INIT:
+    const char *source;
+    STRLEN      source_len;
+    const char *result;
+    size_t      result_len;
+
+ CODE:
+    source = SvPV_const(text, source_len);
+    result = mmd_document_render(self->document, source, source_len, &result_len);
+    self->utf8 = SvUTF8(text) ? true : false;
+    RETVAL = newSVpvn(result, result_len);
+    if (self->utf8)
+        SvUTF8_on(RETVAL);
+
+ OUTPUT:
+    RETVAL
+
+void
+changed(self)
+    Text::MultiMarkdown::XS::Document self;
+
+ INIT:
+    const size_t *changed;
+    size_t        count;
+    size_t        i;
+
+ PPCODE:
+    count = mmd_document_changed(self->document, &changed);
+    EXTEND(SP, count);
+    for (i = 0; i < count; i++)
+        PUSHs(sv_2mortal(newSVuv((UV) changed[i])));
+
+void
+blocks(self)
+    Text::MultiMarkdown::XS::Document self;
+
+ INIT:
+    const char *block;
+    size_t      count;
+    size_t      len;
+    size_t      i;
+    SV         *sv;
+
+ PPCODE:
+    count = mmd_document_blocks(self->document);
+    EXTEND(SP, count);
+    for (i = 0; i < count; i++) {
+        block = mmd_document_block(self->document, i, &len);
+        sv = newSVpvn(block, len);
+        if (self->utf8)
+            SvUTF8_on(sv);
+        PUSHs(sv_2mortal(sv));
+    }
+
+void
+DESTROY(self)
+    Text::MultiMarkdown::XS::Document self;
+
+ CODE:
+    mmd_document_free(self->document);
+    safefree(self);
+
+
+MODULE = Text::MultiMarkdown::XS          PACKAGE = Text::MultiMarkdown::XS::Tree
+
+SV *
+_deserialize(class, image)
+    const char *class;
+    SV  *image;
+
+ INIT:
+    const char    *data;
+    STRLEN         len;
+    SV            *copy;
+    mmd_tree      *tree;
+    mmd_perl_tree *self;
+
+ CODE:
+    /* the tree uses the image where it lies, so it gets a copy of its own
+       that the caller can't change */
+    copy = newSVsv(image);
+    if (SvUTF8(copy) && !sv_utf8_downgrade(copy, TRUE)) {
+        SvREFCNT_dec(copy);
+        XSRETURN_UNDEF;
+    }
+    data = SvPV_const(copy, len);
+    tree = mmd_deserialize(data, len);
+    if (tree == NULL) {
+        SvREFCNT_dec(copy);
+        XSRETURN_UNDEF;
+    }
+    self = (mmd_perl_tree *) safemalloc(sizeof(mmd_perl_tree));
+    self->tree  = tree;
+    self->image = copy;
+    RETVAL = sv_setref_pv(newSV(0), class, (void *) self);
+
+ OUTPUT:
+    RETVAL
+
+SV *
+_map(class, path)
+    const char *class;
+    const char *path;
+
+ INIT:
+    mmd_tree      *tree;
+    mmd_perl_tree *self;
+
+ CODE:
+    tree = mmd_tree_map(path);
+    if (tree == NULL)
+        XSRETURN_UNDEF;
+    self = (mmd_perl_tree *) safemalloc(sizeof(mmd_perl_tree));
+    self->tree  = tree;
+    self->image = NULL;
+    RETVAL = sv_setref_pv(newSV(0), class, (void *) self);
+
+ OUTPUT:
+    RETVAL
+
+SV *
+_export(self, extensions=0, output_format=0)
+    Text::MultiMarkdown::XS::Tree self;
+    int  extensions;
+    int  output_format;
+
+ INIT:
+    char   *result;
+    size_t  result_len;
+
+ CODE:
+    /* mmd_tree_export returns a malloc'ed string */
+    result = mmd_tree_export(self->tree, extensions, output_format, &result_len);
+    if (result == NULL)
+        XSRETURN_UNDEF;
+    RETVAL = mmd_adopt_result(aTHX_ result, result_len);
+
+ OUTPUT:
+    RETVAL
+
+void
+DESTROY(self)
+    Text::MultiMarkdown::XS::Tree self;
+
+ CODE:
+    mmd_tree_free(self->tree);
+    if (self->image != NULL)
+        SvREFCNT_dec(self->image);
+    safefree(self);
@@ -0,0 +1,150 @@
+/*
+
+	batch.c -- convert many documents at once on a pool of worker threads
+
+	(c) 2013 Fletcher T. Penney (http://fletcherpenney.net/).
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License or the MIT
+	license.  See LICENSE for details.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+*/
+
+#include <pthread.h>
+#include "batch.h"
+
+/* Shared state for one call to batch_run; workers claim the next
+	unclaimed item until the list is exhausted */
+typedef struct {
+	int             count;
+	int             next;
+	int             extensions;
+	int             format;
+	batch_work      work;
+	void           *context;
+	pthread_mutex_t lock;
+} batch_job;
+
+/* batch_worker -- thread body: do items until none are left, with a
+	converter of the thread's own that is kept from one item to the next */
+static void * batch_worker(void *arg) {
+	batch_job *job = (batch_job *)arg;
+	mmd_converter *c = mmd_converter_new(job->extensions, job->format);
+	int i;
+
+	while (1) {
+		pthread_mutex_lock(&job->lock);
+		i = job->next++;
+		pthread_mutex_unlock(&job->lock);
+
+		if (i >= job->count)
+			break;
+
+		job->work(c, job->context, i);
+	}
+	mmd_converter_free(c);
+	return NULL;
+}
+
+/* batch_thread_count -- number of online CPUs, used when no size is requested */
+int batch_thread_count(void) {
+	long cpus = -1;
+#ifdef _SC_NPROCESSORS_ONLN
+	cpus = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+	if (cpus < 1)
+		cpus = 1;
+	if (cpus > MAX_BATCH_THREADS)
+		cpus = MAX_BATCH_THREADS;
+	return (int) cpus;
+}
+
+/* batch_run -- call work for each item from 0 to count - 1 on a pool of
+	threads (threads <= 0 means one per CPU), passing each thread's own
+	converter for extensions and format.  The items are started in order. */
+void batch_run(int count, int threads, int extensions, int format, batch_work work, void *context) {
+	batch_job job;
+	pthread_t *workers;
+	int started = 0;
+	int i;
+
+	if (count <= 0)
+		return;
+
+	job.count      = count;
+	job.next       = 0;
+	job.extensions = extensions;
+	job.format     = format;
+	job.work       = work;
+	job.context    = context;
+	pthread_mutex_init(&job.lock, NULL);
+
+	if (threads <= 0)
+		threads = batch_thread_count();
+	if (threads > MAX_BATCH_THREADS)
+		threads = MAX_BATCH_THREADS;
+	if (threads > count)
+		threads = count;
+
+	/* The calling thread always works as well, so spawn one fewer */
+	workers = (pthread_t *)malloc(sizeof(pthread_t) * threads);
+	for (i = 1; i < threads; i++) {
+		if (pthread_create(&workers[started], NULL, batch_worker, &job) != 0)
+			break;
+		started++;
+	}
+
+	batch_worker(&job);
+
+	for (i = 0; i < started; i++)
+		pthread_join(workers[i], NULL);
+
+	free(workers);
+	pthread_mutex_destroy(&job.lock);
+}
+
+/* The sources and results of one call to markdown_to_strings_len */
+typedef struct {
+	char         **sources;
+	const size_t  *lens;          /* NULL if the sources are NUL terminated */
+	char         **results;
+	size_t        *result_lens;   /* or NULL */
+} string_batch;
+
+/* convert_string -- batch_run work for markdown_to_strings_len */
+static void convert_string(mmd_converter *c, void *context, int i) {
+	string_batch *batch = (string_batch *)context;
+	size_t len;
+
+	if (batch->sources[i] == NULL)
+		return;
+	len = (batch->lens != NULL) ? batch->lens[i] : strlen(batch->sources[i]);
+	mmd_converter_convert(c, batch->sources[i], len, (batch->result_lens != NULL) ? &batch->result_lens[i] : NULL);
+	batch->results[i] = mmd_converter_detach_output(c);
+}
+
+/* markdown_to_strings -- convert each of count sources in parallel, returning
+	a malloc'ed array of malloc'ed strings in input order (NULL sources give
+	NULL results).  threads <= 0 means one thread per CPU. */
+char ** markdown_to_strings(char **sources, int count, int extensions, int format, int threads) {
+	return markdown_to_strings_len(sources, NULL, count, extensions, format, threads, NULL);
+}
+
+/* markdown_to_strings_len -- as markdown_to_strings, for sources of lens[i]
+	bytes that need not be NUL terminated (lens may be NULL if they are); the
+	length of each result is stored in result_lens (if not NULL) */
+char ** markdown_to_strings_len(char **sources, const size_t *lens, int count, int extensions, int format, int threads, size_t *result_lens) {
+	string_batch batch;
+
+	batch.sources     = sources;
+	batch.lens        = lens;
+	batch.results     = (char **)calloc((count > 0) ? count : 1, sizeof(char *));
+	batch.result_lens = result_lens;
+	batch_run(count, threads, extensions, format, convert_string, &batch);
+	return batch.results;
+}
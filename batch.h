@@ -0,0 +1,15 @@
+#ifndef BATCH_PARSER_H
+#define BATCH_PARSER_H
+
+#include "parser.h"
+
+/* Upper bound on worker threads for a single batch */
+#define MAX_BATCH_THREADS 256
+
+/* One item of a batch, done with the calling thread's converter */
+typedef void (*batch_work)(mmd_converter *c, void *context, int i);
+
+int    batch_thread_count(void);
+void   batch_run(int count, int threads, int extensions, int format, batch_work work, void *context);
+
+#endif
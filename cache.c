@@ -0,0 +1,407 @@
+/*
+
+	cache.c -- keep recent conversions, so that converting the same
+		document again with the same options costs a lookup
+
+	(c) 2013 Fletcher T. Penney (http://fletcherpenney.net/).
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License or the MIT
+	license.  See LICENSE for details.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+*/
+
+#include <pthread.h>
+#include "cache.h"
+
+/* One cached output, kept in its shard's hash chain and in the shard's
+	list from most to least recently used; the output follows the entry */
+typedef struct cache_entry {
+	cache_key           key;
+	size_t              len;
+	struct cache_entry *chain;
+	struct cache_entry *newer;
+	struct cache_entry *older;
+} cache_entry;
+
+#define entry_data(e) ((char *)((e) + 1))
+#define entry_cost(len) (sizeof(cache_entry) + (len) + 1)
+
+/* A part of the cache with a lock, a table and a byte limit of its own,
+	so that threads working on different documents seldom wait for each
+	other */
+typedef struct {
+	pthread_mutex_t      lock;
+	cache_entry        **buckets;
+	size_t               bucket_count;     /* a power of two, or 0 */
+	size_t               entries;
+	size_t               bytes;
+	size_t               limit;
+	cache_entry         *newest;
+	cache_entry         *oldest;
+	unsigned long long   hits;
+	unsigned long long   misses;
+	unsigned long long   evictions;
+} cache_shard;
+
+static cache_shard    shards[CACHE_SHARDS];
+static size_t         cache_limit = 0;
+static uint64_t       version_seed;
+static pthread_once_t cache_once = PTHREAD_ONCE_INIT;
+
+static void murmur3_128(const char *source, size_t len, uint64_t seed, cache_key *key);
+
+static void init_cache(void) {
+	cache_key version;
+	int i;
+
+	for (i = 0; i < CACHE_SHARDS; i++)
+		pthread_mutex_init(&shards[i].lock, NULL);
+
+	/* keys are seeded with the library version, so that a cache can't hand
+		out what another version made */
+	murmur3_128(MMD_VERSION, strlen(MMD_VERSION), 0, &version);
+	version_seed = version.h1;
+}
+
+/* MurmurHash3 x64 128 by Austin Appleby (public domain) */
+
+static inline uint64_t rotl64(uint64_t x, int r) {
+	return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t fmix64(uint64_t k) {
+	k ^= k >> 33;
+	k *= 0xff51afd7ed558ccdULL;
+	k ^= k >> 33;
+	k *= 0xc4ceb9fe1a85ec53ULL;
+	k ^= k >> 33;
+	return k;
+}
+
+static inline uint64_t load64(const unsigned char *p) {
+	uint64_t k;
+
+	memcpy(&k, p, sizeof(k));
+	return k;
+}
+
+static void murmur3_128(const char *source, size_t len, uint64_t seed, cache_key *key) {
+	const unsigned char *data = (const unsigned char *)source;
+	const unsigned char *tail;
+	const uint64_t c1 = 0x87c37b91114253d5ULL;
+	const uint64_t c2 = 0x4cf5ad432745937fULL;
+	uint64_t h1 = seed;
+	uint64_t h2 = seed;
+	uint64_t k1;
+	uint64_t k2;
+	size_t blocks = len / 16;
+	size_t i;
+
+	for (i = 0; i < blocks; i++) {
+		k1 = load64(data + i * 16);
+		k2 = load64(data + i * 16 + 8);
+
+		k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+		h1 = rotl64(h1, 27); h1 += h2; h1 = h1 * 5 + 0x52dce729;
+
+		k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+		h2 = rotl64(h2, 31); h2 += h1; h2 = h2 * 5 + 0x38495ab5;
+	}
+
+	tail = data + blocks * 16;
+	k1 = k2 = 0;
+	for (i = len & 15; i > 0; i--) {
+		if (i > 8)
+			k2 ^= ((uint64_t) tail[i - 1]) << ((i - 9) * 8);
+		else
+			k1 ^= ((uint64_t) tail[i - 1]) << ((i - 1) * 8);
+	}
+	if ((len & 15) > 8) {
+		k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+	}
+	if ((len & 15) > 0) {
+		k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+	}
+
+	h1 ^= len;
+	h2 ^= len;
+	h1 += h2;
+	h2 += h1;
+	h1 = fmix64(h1);
+	h2 = fmix64(h2);
+	h1 += h2;
+	h2 += h1;
+
+	key->h1 = h1;
+	key->h2 = h2;
+}
+
+/* cache_key_for -- the key for converting len bytes of source with the
+	given options */
+void cache_key_for(cache_key *key, const char *source, size_t len, int extensions, int format, bool inline_only) {
+	pthread_once(&cache_once, init_cache);
+	murmur3_128(source, len, version_seed, key);
+	key->h1 = fmix64(key->h1 ^ (((uint64_t)(unsigned int) extensions << 32) | ((uint64_t)(unsigned int) format << 1) | inline_only));
+	key->h2 = fmix64(key->h2 + key->h1);
+}
+
+/* cache_key_mix -- fold len more bytes of data into key */
+void cache_key_mix(cache_key *key, const void *data, size_t len) {
+	cache_key more;
+
+	murmur3_128((const char *)data, len, key->h1 ^ rotl64(key->h2, 17), &more);
+	key->h1 = fmix64(key->h1 ^ more.h1);
+	key->h2 = fmix64(key->h2 + more.h2 + key->h1);
+}
+
+/* mix_string -- fold a string into key, telling NULL apart from "" */
+static void mix_string(cache_key *key, const char *s) {
+	uint64_t none = ~(uint64_t) 0;
+
+	if (s == NULL)
+		cache_key_mix(key, &none, sizeof(none));
+	else
+		cache_key_mix(key, s, strlen(s) + 1);
+}
+
+/* cache_key_mix_tree -- fold a node tree into key: the type, text and
+	link data of every node, and where each list of children begins and
+	ends */
+void cache_key_mix_tree(cache_key *key, node *list) {
+	uint64_t mark;
+
+	for (; list != NULL; list = list->next) {
+		mark = (uint64_t) list->key;
+		cache_key_mix(key, &mark, sizeof(mark));
+		mix_string(key, list->str);
+		if (list->link_data != NULL) {
+			mix_string(key, list->link_data->label);
+			mix_string(key, list->link_data->source);
+			mix_string(key, list->link_data->title);
+			cache_key_mix_tree(key, list->link_data->attr);
+		}
+		mark = ~(uint64_t) 1;	/* children */
+		cache_key_mix(key, &mark, sizeof(mark));
+		cache_key_mix_tree(key, list->children);
+		mark = ~(uint64_t) 2;	/* end of children */
+		cache_key_mix(key, &mark, sizeof(mark));
+	}
+}
+
+static inline cache_shard * shard_for(const cache_key *key) {
+	return &shards[key->h1 >> 60];
+}
+
+static cache_entry ** bucket_for(cache_shard *shard, const cache_key *key) {
+	return &shard->buckets[key->h2 & (shard->bucket_count - 1)];
+}
+
+static cache_entry * find_entry(cache_shard *shard, const cache_key *key) {
+	cache_entry *e;
+
+	if (shard->bucket_count == 0)
+		return NULL;
+	for (e = *bucket_for(shard, key); e != NULL; e = e->chain) {
+		if ((e->key.h1 == key->h1) && (e->key.h2 == key->h2))
+			return e;
+	}
+	return NULL;
+}
+
+static void unlink_recent(cache_shard *shard, cache_entry *e) {
+	if (e->newer != NULL)
+		e->newer->older = e->older;
+	else
+		shard->newest = e->older;
+	if (e->older != NULL)
+		e->older->newer = e->newer;
+	else
+		shard->oldest = e->newer;
+}
+
+static void link_newest(cache_shard *shard, cache_entry *e) {
+	e->newer = NULL;
+	e->older = shard->newest;
+	if (shard->newest != NULL)
+		shard->newest->newer = e;
+	else
+		shard->oldest = e;
+	shard->newest = e;
+}
+
+static void remove_entry(cache_shard *shard, cache_entry *e) {
+	cache_entry **link = bucket_for(shard, &e->key);
+
+	while (*link != e)
+		link = &(*link)->chain;
+	*link = e->chain;
+	unlink_recent(shard, e);
+	shard->entries--;
+	shard->bytes -= entry_cost(e->len);
+	free(e);
+}
+
+/* grow_buckets -- double the table when it is as full as it is long */
+static void grow_buckets(cache_shard *shard) {
+	size_t count = (shard->bucket_count > 0) ? shard->bucket_count * 2 : 64;
+	cache_entry **buckets = (cache_entry **)calloc(count, sizeof(cache_entry *));
+	cache_entry *e;
+	cache_entry *next;
+	size_t i;
+
+	if (buckets == NULL)
+		return;
+	for (i = 0; i < shard->bucket_count; i++) {
+		for (e = shard->buckets[i]; e != NULL; e = next) {
+			next = e->chain;
+			e->chain = buckets[e->key.h2 & (count - 1)];
+			buckets[e->key.h2 & (count - 1)] = e;
+		}
+	}
+	free(shard->buckets);
+	shard->buckets = buckets;
+	shard->bucket_count = count;
+}
+
+/* trim_shard -- drop the least recently used entries until the shard is
+	within its limit */
+static void trim_shard(cache_shard *shard) {
+	while ((shard->bytes > shard->limit) && (shard->oldest != NULL)) {
+		remove_entry(shard, shard->oldest);
+		shard->evictions++;
+	}
+	if (shard->entries == 0) {
+		free(shard->buckets);
+		shard->buckets = NULL;
+		shard->bucket_count = 0;
+	}
+}
+
+/* cache_enabled -- whether there is a cache to look in at all; checked
+	without a lock, so that conversions pay nothing while it is off */
+bool cache_enabled(void) {
+	return (__atomic_load_n(&cache_limit, __ATOMIC_RELAXED) > 0) || shared_cache_attached();
+}
+
+/* cache_fetch -- append the output filed under key to out, if there is one */
+bool cache_fetch(const cache_key *key, GString *out) {
+	cache_shard *shard = shard_for(key);
+	cache_entry *e;
+
+	if (shared_cache_attached())
+		return shared_cache_fetch(key, out);
+
+	pthread_once(&cache_once, init_cache);
+	pthread_mutex_lock(&shard->lock);
+	e = find_entry(shard, key);
+	if (e != NULL) {
+		unlink_recent(shard, e);
+		link_newest(shard, e);
+		g_string_append_len(out, entry_data(e), e->len);
+		shard->hits++;
+	} else {
+		shard->misses++;
+	}
+	pthread_mutex_unlock(&shard->lock);
+	return e != NULL;
+}
+
+/* cache_store -- file len bytes of output under key, making room for them
+	by dropping the least recently used entries.  Output that would take up
+	more than its shard's share of the cache isn't kept. */
+void cache_store(const cache_key *key, const char *data, size_t len) {
+	cache_shard *shard = shard_for(key);
+	cache_entry *e;
+
+	if (shared_cache_attached()) {
+		shared_cache_store(key, data, len);
+		return;
+	}
+
+	pthread_once(&cache_once, init_cache);
+	pthread_mutex_lock(&shard->lock);
+	if ((entry_cost(len) <= shard->limit) && (find_entry(shard, key) == NULL)
+		&& ((e = (cache_entry *)malloc(entry_cost(len))) != NULL)) {
+		e->key = *key;
+		e->len = len;
+		memcpy(entry_data(e), data, len);
+		entry_data(e)[len] = '\0';
+
+		if (shard->entries >= shard->bucket_count)
+			grow_buckets(shard);
+		if (shard->bucket_count > 0) {
+			e->chain = *bucket_for(shard, key);
+			*bucket_for(shard, key) = e;
+			link_newest(shard, e);
+			shard->entries++;
+			shard->bytes += entry_cost(len);
+			trim_shard(shard);
+		} else {
+			free(e);
+		}
+	}
+	pthread_mutex_unlock(&shard->lock);
+}
+
+/* mmd_cache_set_limit -- let the cache hold up to bytes of output and
+	bookkeeping, dropping what no longer fits; 0 turns it off and empties it */
+void mmd_cache_set_limit(size_t bytes) {
+	int i;
+
+	pthread_once(&cache_once, init_cache);
+	__atomic_store_n(&cache_limit, bytes, __ATOMIC_RELAXED);
+	for (i = 0; i < CACHE_SHARDS; i++) {
+		pthread_mutex_lock(&shards[i].lock);
+		shards[i].limit = bytes / CACHE_SHARDS;
+		trim_shard(&shards[i]);
+		pthread_mutex_unlock(&shards[i].lock);
+	}
+}
+
+/* mmd_cache_flush -- empty the cache, keeping its limit and counters; a
+	shared cache is emptied for every process using it */
+void mmd_cache_flush(void) {
+	int i;
+
+	if (shared_cache_attached())
+		shared_cache_flush();
+
+	pthread_once(&cache_once, init_cache);
+	for (i = 0; i < CACHE_SHARDS; i++) {
+		pthread_mutex_lock(&shards[i].lock);
+		while (shards[i].oldest != NULL)
+			remove_entry(&shards[i], shards[i].oldest);
+		trim_shard(&shards[i]);
+		pthread_mutex_unlock(&shards[i].lock);
+	}
+}
+
+/* mmd_cache_get_stats -- the limit, contents and counters of the cache in
+	use: the shared one if there is one, else this process's */
+void mmd_cache_get_stats(mmd_cache_stats *stats) {
+	int i;
+
+	memset(stats, 0, sizeof(*stats));
+	if (shared_cache_attached()) {
+		shared_cache_get_stats(stats);
+		return;
+	}
+
+	pthread_once(&cache_once, init_cache);
+	stats->limit = __atomic_load_n(&cache_limit, __ATOMIC_RELAXED);
+	for (i = 0; i < CACHE_SHARDS; i++) {
+		pthread_mutex_lock(&shards[i].lock);
+		stats->entries   += shards[i].entries;
+		stats->bytes     += shards[i].bytes;
+		stats->hits      += shards[i].hits;
+		stats->misses    += shards[i].misses;
+		stats->evictions += shards[i].evictions;
+		pthread_mutex_unlock(&shards[i].lock);
+	}
+}
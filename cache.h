@@ -0,0 +1,31 @@
+#ifndef CACHE_PARSER_H
+#define CACHE_PARSER_H
+
+#include <stdint.h>
+#include "parser.h"
+
+/* Number of independently locked parts of the cache */
+#define CACHE_SHARDS 16
+
+/* What a cached output is filed under: a 128 bit hash of the input and of
+	everything else that the output depends on */
+typedef struct {
+	uint64_t h1;
+	uint64_t h2;
+} cache_key;
+
+bool   cache_enabled(void);
+void   cache_key_for(cache_key *key, const char *source, size_t len, int extensions, int format, bool inline_only);
+void   cache_key_mix(cache_key *key, const void *data, size_t len);
+void   cache_key_mix_tree(cache_key *key, node *list);
+bool   cache_fetch(const cache_key *key, GString *out);
+void   cache_store(const cache_key *key, const char *data, size_t len);
+
+/* The cache kept in a file shared between processes (see shared_cache.c) */
+bool   shared_cache_attached(void);
+bool   shared_cache_fetch(const cache_key *key, GString *out);
+void   shared_cache_store(const cache_key *key, const char *data, size_t len);
+void   shared_cache_flush(void);
+void   shared_cache_get_stats(mmd_cache_stats *stats);
+
+#endif
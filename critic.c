@@ -109,3 +109,157 @@ void print_critic_html_highlight_node(GString *out, node *n, scratch_pad *scratc
 			break;
 	}
 }
+
+/* What to do with each kind of CriticMarkup when resolving it */
+enum critic_mode {
+	CRITIC_ACCEPT,
+	CRITIC_REJECT,
+	CRITIC_HIGHLIGHT
+};
+
+/* Closing markers, and where each was last found so that no part of the
+	input is searched twice for the same marker */
+enum critic_marker {
+	MARK_ADDITION,      /* ++} */
+	MARK_DELETION,      /* --} */
+	MARK_SUBSTITUTE,    /* ~>  */
+	MARK_SUBSTITUTION,  /* ~~} */
+	MARK_HIGHLIGHT,     /* ==} */
+	MARK_COMMENT,       /* <<} */
+	MARK_COUNT
+};
+
+static const char *critic_markers[MARK_COUNT] = { "++}", "--}", "~>", "~~}", "==}", "<<}" };
+
+typedef struct {
+	GString    *buf;
+	int         charstotab;
+	const char *end;
+	const char *found[MARK_COUNT];  /* NULL: not searched yet; end: none left */
+} critic_resolver;
+
+/* find_critic_marker -- next occurrence of marker at or after from */
+static const char * find_critic_marker(critic_resolver *r, int marker, const char *from) {
+	const char *text = critic_markers[marker];
+	size_t len = strlen(text);
+	const char *p = r->found[marker];
+
+	if (p == r->end)
+		return NULL;
+	if ((p != NULL) && (p >= from))
+		return p;
+
+	p = from;
+	while ((p = memchr(p, text[0], r->end - p)) != NULL) {
+		if (((size_t)(r->end - p) >= len) && (memcmp(p, text, len) == 0))
+			break;
+		p++;
+	}
+	r->found[marker] = (p == NULL) ? r->end : p;
+	return p;
+}
+
+/* critic_emit -- preformat text into the output, optionally wrapped in tags */
+static void critic_emit(critic_resolver *r, const char *open, const char *text, size_t len, const char *close) {
+	if (open != NULL)
+		preformat_text_append(r->buf, open, strlen(open), &r->charstotab);
+	preformat_text_append(r->buf, text, len, &r->charstotab);
+	if (close != NULL)
+		preformat_text_append(r->buf, close, strlen(close), &r->charstotab);
+}
+
+/* critic_preformat_into -- resolve CriticMarkup in len bytes of text and
+	preformat the result into buf, as preformat_text_into does, in a single
+	pass.  Changes are accepted or rejected according to EXT_CRITIC_ACCEPT
+	and EXT_CRITIC_REJECT; with both set, HTML output shows the changes
+	highlighted.  Markup that is never closed is left as it is. */
+void critic_preformat_into(GString *buf, const char *text, size_t len, int extensions, int format) {
+	critic_resolver r;
+	const char *p = text;
+	const char *run = text;
+	const char *body;
+	const char *close;
+	const char *split;
+	int mode = CRITIC_ACCEPT;
+	int i;
+
+	if (extensions & EXT_CRITIC_REJECT) {
+		if ((extensions & EXT_CRITIC_ACCEPT) && (format == HTML_FORMAT))
+			mode = CRITIC_HIGHLIGHT;
+		else
+			mode = CRITIC_REJECT;
+	}
+
+	r.buf = buf;
+	r.charstotab = TABSTOP;
+	r.end = text + len;
+	for (i = 0; i < MARK_COUNT; i++)
+		r.found[i] = NULL;
+
+	/* the byte order mark is dropped */
+	if ((len >= 3) && (memcmp(text, "\xEF\xBB\xBF", 3) == 0))
+		p = run = text + 3;
+
+	while ((p = memchr(p, '{', r.end - p)) != NULL) {
+		if (r.end - p < 3)
+			break;
+		body = p + 3;
+
+		if ((p[1] == '+') && (p[2] == '+')) {
+			if ((close = find_critic_marker(&r, MARK_ADDITION, body)) == NULL)
+				goto literal;
+			critic_emit(&r, NULL, run, p - run, NULL);
+			if (mode == CRITIC_ACCEPT)
+				critic_emit(&r, NULL, body, close - body, NULL);
+			else if (mode == CRITIC_HIGHLIGHT)
+				critic_emit(&r, "<ins>", body, close - body, "</ins>");
+		} else if ((p[1] == '-') && (p[2] == '-')) {
+			if ((close = find_critic_marker(&r, MARK_DELETION, body)) == NULL)
+				goto literal;
+			critic_emit(&r, NULL, run, p - run, NULL);
+			if (mode == CRITIC_REJECT)
+				critic_emit(&r, NULL, body, close - body, NULL);
+			else if (mode == CRITIC_HIGHLIGHT)
+				critic_emit(&r, "<del>", body, close - body, "</del>");
+		} else if ((p[1] == '~') && (p[2] == '~')) {
+			if ((split = find_critic_marker(&r, MARK_SUBSTITUTE, body)) == NULL)
+				goto literal;
+			if ((close = find_critic_marker(&r, MARK_SUBSTITUTION, split + 2)) == NULL)
+				goto literal;
+			critic_emit(&r, NULL, run, p - run, NULL);
+			if (mode == CRITIC_ACCEPT)
+				critic_emit(&r, NULL, split + 2, close - (split + 2), NULL);
+			else if (mode == CRITIC_REJECT)
+				critic_emit(&r, NULL, body, split - body, NULL);
+			else {
+				critic_emit(&r, "<del>", body, split - body, "</del>");
+				critic_emit(&r, "<ins>", split + 2, close - (split + 2), "</ins>");
+			}
+		} else if ((p[1] == '=') && (p[2] == '=')) {
+			if ((close = find_critic_marker(&r, MARK_HIGHLIGHT, body)) == NULL)
+				goto literal;
+			critic_emit(&r, NULL, run, p - run, NULL);
+			if (mode == CRITIC_HIGHLIGHT)
+				critic_emit(&r, "<mark>", body, close - body, "</mark>");
+			else
+				critic_emit(&r, NULL, body, close - body, NULL);
+		} else if ((p[1] == '>') && (p[2] == '>')) {
+			/* comments are always hidden */
+			if ((close = find_critic_marker(&r, MARK_COMMENT, body)) == NULL)
+				goto literal;
+			critic_emit(&r, NULL, run, p - run, NULL);
+		} else {
+			goto literal;
+		}
+
+		/* every closing marker except ~> is three characters */
+		p = run = close + 3;
+		continue;
+
+	literal:
+		p++;
+	}
+
+	critic_emit(&r, NULL, run, r.end - run, NULL);
+	g_string_append_len(buf, "\n\n", 2);
+}
@@ -12,4 +12,6 @@ void print_critic_accept_node(GString *out, node *list, scratch_pad *scratch);
 void print_critic_reject_node(GString *out, node *list, scratch_pad *scratch);
 void print_critic_html_highlight_node(GString *out, node *list, scratch_pad *scratch);
 
+void critic_preformat_into(GString *buf, const char *text, size_t len, int extensions, int format);
+
 #endif
@@ -0,0 +1,596 @@
+/*
+
+	delimiter.c -- pair up emphasis, link and quote delimiters in one pass
+
+	(c) 2013 Fletcher T. Penney (http://fletcherpenney.net/).
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License or the MIT
+	license.  See LICENSE for details.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+*/
+
+#include "delimiter.h"
+
+/* With EXT_LINEAR_INLINES the parser doesn't match emphasis, links, images
+	or smart quotes as it goes, since each opening delimiter that is never
+	closed sends it to the end of the paragraph and back.  Instead every
+	delimiter character is left in the tree as a DELIMITER node (the tail of
+	an inline link, "](source 'title')", is a single one carrying the link
+	data), and resolve_inline_delimiters pairs them up afterwards, walking
+	each list of inlines once and keeping the openers that are still waiting
+	for a closer on a stack. */
+
+enum opener_kind {
+	OPEN_STAR,
+	OPEN_UL,
+	OPEN_SINGLE,
+	OPEN_DOUBLE,
+	OPEN_BRACKET,               /* '[' or "![" */
+	OPEN_KINDS
+};
+
+typedef struct {
+	int  kind;
+	int  slot;                  /* slot of the first delimiter */
+	int  width;                 /* delimiters not yet used (up to 3 for emphasis) */
+	bool strong_only;           /* what is left after emphasis, which only "**" can close */
+	bool image;                 /* "![" rather than "[" */
+	int  below;                 /* next opener of the same kind down the stack, or -1 */
+} opener;
+
+/* One list of inlines being resolved.  The i'th node of the list is in slot
+	i; the slots still in the list are chained by next and prev, so that a
+	matched run of nodes can be moved into a new container in constant time. */
+typedef struct {
+	node   **nodes;             /* NULL once a node has been freed */
+	int     *next;              /* following slot, or count at the end */
+	int     *prev;              /* preceding slot, or -1 at the start */
+	int      count;
+	int     *match;             /* slot of the ']' or link tail closing a '[', or -1 */
+	opener  *stack;
+	int      depth;
+	int      top[OPEN_KINDS];   /* topmost opener of each kind, or -1 */
+	int      last_double[2];    /* slot of the last "**" and "__", or -1 */
+	int      last[OPEN_KINDS];  /* slot of the last delimiter of each kind, or -1 */
+	int      extensions;
+} inline_list;
+
+/* is_inline_delimiter -- whether the Symbol c is left for the delimiter stack */
+bool is_inline_delimiter(char c, int extensions) {
+	switch (c) {
+		case '*':
+		case '_':
+		case '[':
+		case ']':
+		case '!':
+			return true;
+		case '\'':
+		case '"':
+			return extension(EXT_SMART, extensions);
+		default:
+			return false;
+	}
+}
+
+/* delimiter_char -- the character of a delimiter node, or 0 for anything
+	else (including link tails) */
+static char delimiter_char(node *n) {
+	if ((n->key != DELIMITER) || (n->link_data != NULL))
+		return 0;
+	return n->str[0];
+}
+
+static bool is_link_tail(node *n) {
+	return (n->key == DELIMITER) && (n->link_data != NULL);
+}
+
+static bool is_space(char c) {
+	return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r');
+}
+
+/* Alphanumeric, as the grammar has it (any byte of a UTF-8 sequence counts) */
+static bool is_alnum(char c) {
+	return ((c >= '0') && (c <= '9')) || ((c >= 'A') && (c <= 'Z'))
+		|| ((c >= 'a') && (c <= 'z')) || ((unsigned char)c >= 0x80);
+}
+
+/* first_char -- the first character of the text in slot, '\n' past the end
+	of the list, or 0 for an inline that isn't plain text */
+static char first_char(inline_list *l, int slot) {
+	node *n;
+
+	if (slot >= l->count)
+		return '\n';
+	n = l->nodes[slot];
+	switch (n->key) {
+		case STR:
+		case SPACE:
+		case DELIMITER:
+			return n->str[0];
+		case APOSTROPHE:
+			return '\'';
+		case LINEBREAK:
+			return '\n';
+		default:
+			return 0;
+	}
+}
+
+/* chain -- link the nodes from slot first up to (not including) slot stop
+	into a list, returning its head */
+static node * chain(inline_list *l, int first, int stop) {
+	node *head = NULL;
+	node *tail = NULL;
+	int i;
+
+	for (i = first; i != stop; i = l->next[i]) {
+		if (tail == NULL)
+			head = l->nodes[i];
+		else
+			tail->next = l->nodes[i];
+		tail = l->nodes[i];
+	}
+	if (tail != NULL)
+		tail->next = NULL;
+	return head;
+}
+
+/* free_slots -- free the nodes in slots first through last */
+static void free_slots(inline_list *l, int first, int last) {
+	int i;
+
+	for (i = first; ; i = l->next[i]) {
+		free_node(l->nodes[i]);
+		l->nodes[i] = NULL;
+		if (i == last)
+			break;
+	}
+}
+
+/* replace_slots -- put n in place of slots first through last, whose nodes
+	have already been freed or moved */
+static void replace_slots(inline_list *l, int first, int last, node *n) {
+	int after = l->next[last];
+
+	l->nodes[first] = n;
+	l->next[first] = after;
+	if (after < l->count)
+		l->prev[after] = first;
+}
+
+static void push_opener(inline_list *l, int kind, int slot, int width, bool image) {
+	opener *o = &l->stack[l->depth];
+
+	o->kind  = kind;
+	o->slot  = slot;
+	o->width = width;
+	o->strong_only = false;
+	o->image = image;
+	o->below = l->top[kind];
+	l->top[kind] = l->depth++;
+}
+
+/* pop_openers -- drop the openers from index up; their delimiters stay text */
+static void pop_openers(inline_list *l, int index) {
+	opener *o;
+
+	while (l->depth > index) {
+		o = &l->stack[--l->depth];
+		l->top[o->kind] = o->below;
+	}
+}
+
+/* find_opener -- the topmost opener of kind, unless a bracket still waiting
+	for its ']' was opened after it; -1 if there is none */
+static int find_opener(inline_list *l, int kind) {
+	int index = l->top[kind];
+
+	if ((index < 0) || (index < l->top[OPEN_BRACKET]))
+		return -1;
+	return index;
+}
+
+/* crosses_open -- whether closing the opener at index with the delimiter in
+	slot would cross an opener above it, of one of kinds (a bit for each),
+	that a later delimiter may still close: the grammar matches that one
+	first, and this delimiter is then inside it */
+static bool crosses_open(inline_list *l, int index, int slot, unsigned int kinds) {
+	int kind;
+
+	for (kind = 0; kind < OPEN_KINDS; kind++) {
+		if ((kinds & (1u << kind)) && (l->top[kind] > index) && (l->last[kind] > slot))
+			return true;
+	}
+	return false;
+}
+
+/* opens_label -- whether the '[' in slot can start a link label (see Label) */
+static bool opens_label(inline_list *l, int slot) {
+	char following = first_char(l, l->next[slot]);
+
+	if ((l->next[slot] >= l->count) || (following == '['))
+		return false;
+	if (extension(EXT_NOTES, l->extensions) && ((following == '^') || (following == '#')))
+		return false;
+	return true;
+}
+
+/* resolve_emphasis -- close what earlier runs of c opened with the run of
+	delimiters starting at slot, then open with whatever is left; returns
+	the slot after the run */
+static int resolve_emphasis(inline_list *l, int slot, char c) {
+	int kind = (c == '*') ? OPEN_STAR : OPEN_UL;
+	int width = 1;
+	int last = slot;
+	int after, index, use, first_used, last_used, closer_last, i;
+	bool can_open, strong_later;
+	opener *o;
+	node *container;
+
+	while ((l->next[last] < l->count) && (delimiter_char(l->nodes[l->next[last]]) == c)) {
+		last = l->next[last];
+		width++;
+	}
+	after = l->next[last];
+	can_open = !is_space(first_char(l, after));
+	strong_later = (l->last_double[kind] >= after);
+
+	/* Inside emphasis the grammar closes at a '*' unless strong starts
+		there, and inside strong closes at "**", trying emphasis at a single
+		'*' or taking it as text.  Which of those works out depends on what
+		follows; a "**" further on is taken to mean that strong does. */
+	while ((width > 0) && ((index = find_opener(l, kind)) >= 0)) {
+		o = &l->stack[index];
+		if ((o->width == 2) && (width < 2) && (o->strong_only || strong_later))
+			break;
+		if ((o->width == 1) && (((width == 2) && can_open) || (width == 3)) && strong_later)
+			break;
+
+		if (crosses_open(l, index, slot, (1 << OPEN_STAR) | (1 << OPEN_UL) | (1 << OPEN_DOUBLE)))
+			break;
+
+		/* strong before emphasis, except that "***" closed by three or
+			more is emphasis inside strong, as the grammar has it */
+		use = ((o->width >= 2) && (width >= 2) && !((o->width == 3) && (width >= 3))) ? 2 : 1;
+
+		/* the innermost delimiters of the opener are the ones used */
+		first_used = o->slot;
+		for (i = o->width - use; i > 0; i--)
+			first_used = l->next[first_used];
+		last_used = (use == 2) ? l->next[first_used] : first_used;
+		if (l->next[last_used] == slot)
+			break;
+		closer_last = (use == 2) ? l->next[slot] : slot;
+
+		container = mk_node((use == 2) ? STRONG : EMPH);
+		container->children = chain(l, l->next[last_used], slot);
+		i = l->next[closer_last];
+		free_slots(l, first_used, last_used);
+		free_slots(l, slot, closer_last);
+		replace_slots(l, first_used, closer_last, container);
+
+		/* what emphasis leaves of an opener is followed by a delimiter, so
+			it can't open emphasis again: a single one is text, and two only
+			open strong */
+		pop_openers(l, index + 1);
+		o->width -= use;
+		if ((use == 1) && (o->width == 2))
+			o->strong_only = true;
+		if ((o->width == 0) || ((use == 1) && (o->width == 1)))
+			pop_openers(l, index);
+		width -= use;
+		slot = i;
+	}
+
+	if ((width > 0) && (width <= 3) && can_open) {
+		push_opener(l, kind, slot, width, false);
+	} else if (width == 3) {
+		/* "**" followed by the third opens strong, which starts with it */
+		push_opener(l, kind, slot, 2, false);
+		l->stack[l->depth - 1].strong_only = true;
+	}
+	return after;
+}
+
+/* resolve_quote -- a ' or " either closes the last quote of its kind or
+	opens a new one (see SingleQuoted and DoubleQuoted) */
+static int resolve_quote(inline_list *l, int slot, char c) {
+	int kind = (c == '"') ? OPEN_DOUBLE : OPEN_SINGLE;
+	char following = first_char(l, l->next[slot]);
+	int index = find_opener(l, kind);
+	int first;
+	node *container;
+
+	if ((index >= 0) && ((c == '"') || !is_alnum(following))
+		&& !crosses_open(l, index, slot, (1 << OPEN_STAR) | (1 << OPEN_UL))) {
+		first = l->stack[index].slot;
+		if (l->next[first] != slot) {
+			container = mk_node((c == '"') ? DOUBLEQUOTED : SINGLEQUOTED);
+			container->children = chain(l, l->next[first], slot);
+			free_slots(l, first, first);
+			free_slots(l, slot, slot);
+			replace_slots(l, first, slot, container);
+			pop_openers(l, index);
+			return l->next[first];
+		}
+	}
+
+	if (c == '"') {
+		if ((l->next[slot] < l->count) && (delimiter_char(l->nodes[l->next[slot]]) != '"'))
+			push_opener(l, kind, slot, 1, false);
+	} else if (!is_space(following)) {
+		push_opener(l, kind, slot, 1, false);
+	}
+	return l->next[slot];
+}
+
+/* take_closer -- the last slot taken by a label that the ']' or link tail in
+	slot closes; the "(source title)" of a link tail isn't part of it, and is
+	left as text */
+static int take_closer(inline_list *l, int slot) {
+	node *n = l->nodes[slot];
+	char *rest;
+
+	if (!is_link_tail(n))
+		return slot;
+	free_link_data(n->link_data);
+	n->link_data = NULL;
+	rest = strdup(n->str + 1);
+	free(n->str);
+	n->str = rest;
+	n->key = STR;
+	return l->prev[slot];
+}
+
+/* reference_link -- the link for a label closed by the ']' in slot without
+	an inline tail: "[text][ref]", "[text][]", "[text]" or, with a citation
+	after it, "[text][#ref]".  The nodes used after the label are freed and
+	*last set to the last slot they took. */
+static node * reference_link(inline_list *l, int slot, node *label, bool image, int *last) {
+	GString *raw;
+	node *result;
+	int newlines = 0;
+	int i, j, k;
+	char *text;
+
+	/* Spnl */
+	for (i = l->next[slot]; (i < l->count) && (l->nodes[i]->key == SPACE); i = l->next[i]) {
+		if (strchr(l->nodes[i]->str, '\n') && (++newlines > 1))
+			break;
+	}
+
+	if (!image && !extension(EXT_COMPATIBILITY, l->extensions) && (i < l->count)
+		&& (l->nodes[i]->key == CITATION) && (l->nodes[i]->children == NULL)) {
+		result = l->nodes[i];
+		result->children = label;
+		text = label_from_node_tree(label);
+		if (strcmp(text, "notcited") == 0)
+			result->key = NOCITATION;
+		free(text);
+		free_slots(l, slot, l->prev[i]);
+		l->nodes[i] = NULL;
+		*last = i;
+		return result;
+	}
+
+	if ((i < l->count) && (delimiter_char(l->nodes[i]) == '[')) {
+		j = l->next[i];
+		if ((j < l->count) && (is_link_tail(l->nodes[j]) || (delimiter_char(l->nodes[j]) == ']'))) {
+			/* "[text][]" keeps the raw "[]" for when there is no such reference */
+			raw = g_string_new("");
+			for (k = l->next[slot]; k != i; k = l->next[k])
+				g_string_append(raw, l->nodes[k]->str);
+			g_string_append(raw, "[]");
+			result = mk_link(label, NULL, NULL, NULL, NULL);
+			result->str = raw->str;
+			g_string_free(raw, false);
+			*last = take_closer(l, j);
+			free_slots(l, slot, *last);
+			return result;
+		}
+		k = l->match[i];
+		if (k >= 0) {
+			raw = g_string_new("");
+			for (; j != k; j = l->next[j])
+				print_raw_node(raw, l->nodes[j]);
+			result = mk_link(label, raw->str, NULL, NULL, NULL);
+			g_string_free(raw, true);
+			*last = take_closer(l, k);
+			free_slots(l, slot, *last);
+			return result;
+		}
+	}
+
+	result = mk_link(label, NULL, NULL, NULL, NULL);
+	result->str = strdup("");
+	free_slots(l, slot, slot);
+	*last = slot;
+	return result;
+}
+
+/* resolve_bracket -- close the last '[' or "![" with the ']' or link tail in
+	slot, turning the label into a link or image */
+static int resolve_bracket(inline_list *l, int slot) {
+	int index = l->top[OPEN_BRACKET];
+	opener *o;
+	node *label;
+	node *result;
+	int first, label_last, last;
+
+	if (index < 0)
+		return l->next[slot];
+	o = &l->stack[index];
+	first = o->slot;
+	label_last = o->image ? l->next[first] : first;
+
+	label = mk_node(LIST);
+	label->children = chain(l, l->next[label_last], slot);
+
+	if (is_link_tail(l->nodes[slot])) {
+		result = mk_node(LINK);
+		result->children = label;
+		result->link_data = l->nodes[slot]->link_data;
+		l->nodes[slot]->link_data = NULL;
+		free_slots(l, slot, slot);
+		last = slot;
+	} else {
+		result = reference_link(l, slot, label, o->image, &last);
+	}
+	if (o->image)
+		result->key = IMAGE;
+
+	free_slots(l, first, label_last);
+	replace_slots(l, first, last, result);
+	pop_openers(l, index);
+	return l->next[first];
+}
+
+/* match_brackets -- pair each '[' with the ']' or link tail that will close
+	it, as Label balances them; the others are text, as a Label that never
+	ends is to the grammar, and emphasis may cross them */
+static void match_brackets(inline_list *l) {
+	int *open = (int *)malloc(sizeof(int) * l->count);
+	int depth = 0;
+	int i;
+
+	for (i = 0; i < l->count; i++) {
+		l->match[i] = -1;
+		if (is_link_tail(l->nodes[i]) || (delimiter_char(l->nodes[i]) == ']')) {
+			if (depth > 0)
+				l->match[open[--depth]] = i;
+		} else if ((delimiter_char(l->nodes[i]) == '[') && opens_label(l, i)) {
+			open[depth++] = i;
+		}
+	}
+	free(open);
+}
+
+/* resolve_list -- resolve the delimiters of a list of inlines (and of any
+	lists below it), returning the new head of the list */
+static node * resolve_list(node *list, int extensions) {
+	inline_list l;
+	node *n;
+	bool found = false;
+	int slot, kind;
+	int i;
+
+	l.count = 0;
+	for (n = list; n != NULL; n = n->next) {
+		if (n->children != NULL)
+			n->children = resolve_list(n->children, extensions);
+		if (n->key == DELIMITER)
+			found = true;
+		l.count++;
+	}
+	if (!found)
+		return list;
+
+	l.nodes = (node **)malloc(sizeof(node *) * l.count);
+	l.next  = (int *)malloc(sizeof(int) * l.count);
+	l.prev  = (int *)malloc(sizeof(int) * l.count);
+	l.match = (int *)malloc(sizeof(int) * l.count);
+	l.stack = (opener *)malloc(sizeof(opener) * l.count);
+	l.depth = 0;
+	l.extensions = extensions;
+	for (i = 0; i < OPEN_KINDS; i++)
+		l.top[i] = -1;
+	for (i = 0, n = list; n != NULL; n = n->next, i++) {
+		l.nodes[i] = n;
+		l.next[i]  = i + 1;
+		l.prev[i]  = i - 1;
+	}
+	match_brackets(&l);
+	l.last_double[OPEN_STAR] = l.last_double[OPEN_UL] = -1;
+	for (i = 0; i < OPEN_KINDS; i++)
+		l.last[i] = -1;
+	for (i = 0; i < l.count; i++) {
+		switch (delimiter_char(l.nodes[i])) {
+			case '*':  kind = OPEN_STAR;   break;
+			case '_':  kind = OPEN_UL;     break;
+			case '"':  kind = OPEN_DOUBLE; break;
+			case '\'': kind = OPEN_SINGLE; break;
+			default:   continue;
+		}
+		l.last[kind] = i;
+		if ((kind <= OPEN_UL) && (i + 1 < l.count) && (delimiter_char(l.nodes[i + 1]) == l.nodes[i]->str[0]))
+			l.last_double[kind] = i;
+	}
+
+	slot = 0;
+	while (slot < l.count) {
+		n = l.nodes[slot];
+		if (is_link_tail(n)) {
+			slot = resolve_bracket(&l, slot);
+			continue;
+		}
+		switch (delimiter_char(n)) {
+			case '*':
+			case '_':
+				slot = resolve_emphasis(&l, slot, n->str[0]);
+				break;
+			case '\'':
+			case '"':
+				slot = resolve_quote(&l, slot, n->str[0]);
+				break;
+			case '[':
+				if (l.match[slot] >= 0)
+					push_opener(&l, OPEN_BRACKET, slot, 1, false);
+				slot = l.next[slot];
+				break;
+			case '!':
+				i = l.next[slot];
+				if ((i < l.count) && (delimiter_char(l.nodes[i]) == '[') && (l.match[i] >= 0)) {
+					push_opener(&l, OPEN_BRACKET, slot, 2, true);
+					slot = l.next[i];
+				} else {
+					slot = i;
+				}
+				break;
+			case ']':
+				slot = resolve_bracket(&l, slot);
+				break;
+			default:
+				slot = l.next[slot];
+		}
+	}
+
+	/* whatever is left unmatched is plain text again */
+	for (i = 0; i < l.count; i++) {
+		n = l.nodes[i];
+		if ((n == NULL) || (n->key != DELIMITER))
+			continue;
+		if (n->link_data != NULL) {
+			free_link_data(n->link_data);
+			n->link_data = NULL;
+			n->key = STR;
+		} else if (n->str[0] == '\'') {
+			free(n->str);
+			n->str = NULL;
+			n->key = APOSTROPHE;
+		} else {
+			n->key = STR;
+		}
+	}
+
+	list = chain(&l, 0, l.count);
+
+	free(l.nodes);
+	free(l.next);
+	free(l.prev);
+	free(l.match);
+	free(l.stack);
+	return list;
+}
+
+/* resolve_inline_delimiters -- turn the DELIMITER nodes left by the parser
+	under EXT_LINEAR_INLINES into emphasis, links, images and quotes, or
+	back into text where they don't pair up */
+node * resolve_inline_delimiters(node *list, int extensions) {
+	return resolve_list(list, extensions);
+}
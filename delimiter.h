@@ -0,0 +1,9 @@
+#ifndef DELIMITER_PARSER_H
+#define DELIMITER_PARSER_H
+
+#include "parser.h"
+
+bool   is_inline_delimiter(char c, int extensions);
+node * resolve_inline_delimiters(node *list, int extensions);
+
+#endif
@@ -32,6 +32,38 @@ void print_html_node_tree(GString *out, node *list, scratch_pad *scratch) {
 	}
 }
 
+/* Style attributes for table cells, by column alignment */
+static char html_align_left[]   = " style=\"text-align:left;\"";
+static char html_align_right[]  = " style=\"text-align:right;\"";
+static char html_align_center[] = " style=\"text-align:center;\"";
+
+/* set_html_column_styles -- pick the style attribute for the cells of each
+	column once per table, from the alignment string of its separator line */
+static void set_html_column_styles(scratch_pad *scratch, char *alignment) {
+	size_t i;
+	size_t count = strlen(alignment);
+
+	if (scratch->column_room < count) {
+		scratch->column_styles = (char **)realloc(scratch->column_styles, sizeof(char *) * count);
+		scratch->column_room = count;
+	}
+	for (i = 0; i < count; i++) {
+		switch (alignment[i]) {
+			case 'r':
+			case 'R':
+				scratch->column_styles[i] = html_align_right;
+				break;
+			case 'c':
+			case 'C':
+				scratch->column_styles[i] = html_align_center;
+				break;
+			default:
+				scratch->column_styles[i] = html_align_left;
+		}
+	}
+	scratch->column_count = count;
+}
+
 /* print_html_node -- convert given node to HTML and append */
 void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 	node *temp_node;
@@ -611,6 +643,7 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 			break;
 		case TABLESEPARATOR:
 			scratch->table_alignment = n->str;
+			set_html_column_styles(scratch, n->str);
 			break;
 		case TABLECAPTION:
 			if ((n->children != NULL) && (n->children->key == TABLELABEL)) {
@@ -663,26 +696,19 @@ void print_html_node(GString *out, node *n, scratch_pad *scratch) {
 			g_string_append_printf(out, "</tr>\n");
 			break;
 		case TABLECELL:
-			temp = scratch->table_alignment;
 			lev = scratch->table_column;
-			if ( strncmp(&temp[lev],"r",1) == 0) {
-				g_string_append_printf(out, "\t<t%c style=\"text-align:right;\"", scratch->cell_type);
-			} else if ( strncmp(&temp[lev],"R",1) == 0) {
-				g_string_append_printf(out, "\t<t%c style=\"text-align:right;\"", scratch->cell_type);
-			} else if ( strncmp(&temp[lev],"c",1) == 0) {
-				g_string_append_printf(out, "\t<t%c style=\"text-align:center;\"", scratch->cell_type);
-			} else if ( strncmp(&temp[lev],"C",1) == 0) {
-				g_string_append_printf(out, "\t<t%c style=\"text-align:center;\"", scratch->cell_type);
-			} else {
-				g_string_append_printf(out, "\t<t%c style=\"text-align:left;\"", scratch->cell_type);
-			}
+			g_string_append(out, "\t<t");
+			g_string_append_c(out, scratch->cell_type);
+			g_string_append(out, ((size_t)lev < scratch->column_count) ? scratch->column_styles[lev] : html_align_left);
 			if ((n->children != NULL) && (n->children->key == CELLSPAN)) {
 				g_string_append_printf(out, " colspan=\"%d\"",(int)strlen(n->children->str)+1);
 			}
-			g_string_append_printf(out, ">");
+			g_string_append_c(out, '>');
 			scratch->padded = 2;
 			print_html_node_tree(out, n->children, scratch);
-			g_string_append_printf(out, "</t%c>\n", scratch->cell_type);
+			g_string_append(out, "</t");
+			g_string_append_c(out, scratch->cell_type);
+			g_string_append(out, ">\n");
 			scratch->table_column++;
 			break;
 		case CELLSPAN:
@@ -881,26 +907,45 @@ void print_html_localized_typography(GString *out, int character, scratch_pad *s
 
 /* print_html_string - print string, escaping for HTML */
 void print_html_string(GString *out, char *str, scratch_pad *scratch) {
+	size_t run;
+	bool obfuscate;
+	unsigned int mix = 0;
+
 	if (str == NULL)
 		return;
+	obfuscate = (scratch->obfuscate == true) && (extension(EXT_OBFUSCATE, scratch->extensions));
+	if (obfuscate) {
+		/* the entity forms only have to look random, so they are picked from
+			the text itself and the same address always comes out the same */
+		for (run = 0; str[run] != '\0'; run++)
+			mix = mix * 31 + (unsigned char) str[run];
+	}
 	while (*str != '\0') {
+		/* copy the run of characters that need no escaping in one go */
+		if (!obfuscate) {
+			run = strcspn(str, "&<>\"");
+			g_string_append_len(out, str, run);
+			str += run;
+			if (*str == '\0')
+				break;
+		}
 		switch (*str) {
 			case '&':
-				g_string_append_printf(out, "&amp;");
+				g_string_append(out, "&amp;");
 				break;
 			case '<':
-				g_string_append_printf(out, "&lt;");
+				g_string_append(out, "&lt;");
 				break;
 			case '>':
-				g_string_append_printf(out, "&gt;");
+				g_string_append(out, "&gt;");
 				break;
 			case '"':
-				g_string_append_printf(out, "&quot;");
+				g_string_append(out, "&quot;");
 				break;
 			default:
-				if ((scratch->obfuscate == true) && (extension(EXT_OBFUSCATE, scratch->extensions))
-					&& ((int) *str == (((int) *str) & 127))) { 
-					if (rand() % 2 == 0)
+				if (obfuscate && ((int) *str == (((int) *str) & 127))) { 
+					mix = mix * 1103515245 + 12345;
+					if (((mix >> 16) & 1) == 0)
 						g_string_append_printf(out, "&#%d;", (int) *str);
 					else
 						g_string_append_printf(out, "&#x%x;", (unsigned int) *str);
@@ -20,10 +20,110 @@
 /* Main API commands */
 
 char * markdown_to_string(char * source, int extensions, int format);
+char * markdown_to_string_len(const char * source, size_t len, int extensions, int format, size_t *out_len);
+char * markdown_inline_to_string_len(const char * source, size_t len, int extensions, int format, size_t *out_len);
+char * markdown_with_metadata_len(const char * source, size_t len, int extensions, int format, size_t *out_len, char ***metadata);
 char * extract_metadata_value(char *source, int extensions, char *key);
+char * extract_metadata_value_len(const char *source, size_t len, int extensions, char *key, bool *found);
 bool   has_metadata(char *source, int extensions);
+char ** extract_metadata(const char *source, size_t len, int extensions);
+void   free_metadata(char **pairs);
 char * mmd_version(void);
 
+/* A reusable converter for a fixed set of extensions and output format */
+typedef struct mmd_converter mmd_converter;
+
+mmd_converter * mmd_converter_new(int extensions, int format);
+const char    * mmd_converter_convert(mmd_converter *c, const char *source, size_t len, size_t *out_len);
+const char    * mmd_converter_convert_inline(mmd_converter *c, const char *source, size_t len, size_t *out_len);
+const char    * mmd_converter_convert_with_metadata(mmd_converter *c, const char *source, size_t len, size_t *out_len, char ***metadata);
+char          * mmd_converter_detach_output(mmd_converter *c);
+void            mmd_converter_free(mmd_converter *c);
+
+/* Stream the output to a sink instead of collecting it: write is called
+	with successive pieces of about MMD_SINK_CHUNK bytes, and returns false
+	on failure, after which the rest of the output is discarded */
+typedef bool (*mmd_write_fn)(void *context, const char *data, size_t len);
+#define MMD_SINK_CHUNK (64 * 1024)
+
+bool mmd_converter_convert_to(mmd_converter *c, const char *source, size_t len, mmd_write_fn write, void *context);
+bool markdown_to_sink(const char *source, size_t len, int extensions, int format, mmd_write_fn write, void *context);
+
+/* As above, but the document is also parsed and converted a block at a time,
+	so memory use follows the largest block rather than the whole document */
+bool mmd_converter_stream_to(mmd_converter *c, const char *source, size_t len, mmd_write_fn write, void *context);
+bool markdown_stream_to_sink(const char *source, size_t len, int extensions, int format, mmd_write_fn write, void *context);
+
+/* A document fed a piece at a time, with each block written to the sink as
+	soon as the input shows where it ends.  mmd_stream_finish writes the rest
+	and frees the stream; mmd_stream_free abandons it. */
+typedef struct mmd_stream mmd_stream;
+
+mmd_stream * mmd_stream_new(int extensions, int format, mmd_write_fn write, void *context);
+bool         mmd_stream_feed(mmd_stream *s, const char *data, size_t len);
+bool         mmd_stream_finish(mmd_stream *s);
+void         mmd_stream_free(mmd_stream *s);
+
+/* A document rendered again and again as it is edited; each render writes
+	only the top-level blocks whose output may have changed and reuses the
+	last render's output for the rest, and reports which blocks it wrote */
+typedef struct mmd_document mmd_document;
+
+mmd_document * mmd_document_new(int extensions, int format);
+const char   * mmd_document_render(mmd_document *d, const char *source, size_t len, size_t *out_len);
+size_t         mmd_document_changed(mmd_document *d, const size_t **changed);
+size_t         mmd_document_blocks(mmd_document *d);
+const char   * mmd_document_block(mmd_document *d, size_t i, size_t *len);
+void           mmd_document_free(mmd_document *d);
+
+/* Parse trees saved in a binary form, so that a document can be exported
+	again, in another format or with other options, without being parsed
+	(see serialize.c).  mmd_deserialize uses the image where it lies, so it
+	must outlive the tree; mmd_tree_map maps a file holding one instead.
+	A tree parsed for OPML can only be exported as OPML, and the other way
+	about; mmd_tree_export returns NULL for those.  Images are checked for
+	damage, not for tampering, so only trusted ones are to be loaded. */
+typedef struct mmd_tree mmd_tree;
+
+bool       mmd_converter_serialize(mmd_converter *c, const char *source, size_t len, mmd_write_fn write, void *context);
+bool       mmd_serialize(const char *source, size_t len, int extensions, int format, mmd_write_fn write, void *context);
+mmd_tree * mmd_deserialize(const void *data, size_t len);
+mmd_tree * mmd_tree_map(const char *path);
+char     * mmd_tree_export(mmd_tree *t, int extensions, int format, size_t *out_len);
+void       mmd_tree_free(mmd_tree *t);
+
+/* Stock sinks; the context is a GString *, a pointer to an int file
+	descriptor, or a FILE * respectively */
+bool mmd_write_gstring(void *context, const char *data, size_t len);
+bool mmd_write_fd(void *context, const char *data, size_t len);
+bool mmd_write_file(void *context, const char *data, size_t len);
+
+/* Convert several documents in parallel (see batch.c) */
+char ** markdown_to_strings(char **sources, int count, int extensions, int format, int threads);
+char ** markdown_to_strings_len(char **sources, const size_t *lens, int count, int extensions, int format, int threads, size_t *result_lens);
+
+/* A cache of recent outputs, shared by every conversion that collects its
+	output in memory, keyed by a hash of the input, options and library
+	version (see cache.c).  It is off until given a limit in bytes. */
+typedef struct {
+	size_t             limit;
+	size_t             bytes;
+	size_t             entries;
+	unsigned long long hits;
+	unsigned long long misses;
+	unsigned long long evictions;
+} mmd_cache_stats;
+
+void mmd_cache_set_limit(size_t bytes);
+void mmd_cache_flush(void);
+void mmd_cache_get_stats(mmd_cache_stats *stats);
+
+/* Keep the cache in a file mapped by every process that uses it, rather
+	than in each process (see shared_cache.c) */
+bool         mmd_cache_share(const char *path, size_t size);
+void         mmd_cache_unshare(void);
+const char * mmd_cache_shared_path(void);
+
 
 /* These are the basic extensions */
 enum parser_extensions {
@@ -41,6 +141,7 @@ enum parser_extensions {
 	EXT_CRITIC          = 1 << 11,   /* Critic Markup Support */
 	EXT_CRITIC_ACCEPT   = 1 << 12,   /* Accept all proposed changes */
 	EXT_CRITIC_REJECT   = 1 << 13,   /* Reject all proposed changes */
+	EXT_LINEAR_INLINES  = 1 << 14,   /* Resolve emphasis and links with a delimiter stack */
 	EXT_FAKE            = 1 << 15,   /* 15 is highest number allowed */
 };
 
@@ -133,6 +234,7 @@ enum keys {
 	CRITICSUBSTITUTION,
 	CRITICHIGHLIGHT,
 	CRITICCOMMENT,
+	DELIMITER,                       /* Unresolved emphasis, link or quote delimiter */
 	KEY_COUNTER                      /* This *MUST* be the last item in the list */
 };
 
@@ -19,8 +19,561 @@
 	GNU General Public License for more details.
 */
 
+#include <ctype.h>
 #include <getopt.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <signal.h>
+#include <pthread.h>
 #include "parser.h"
+#include "batch.h"
+
+/* The contents of an input file, mapped into memory where it can be */
+typedef struct {
+	char   *data;
+	size_t  len;
+	size_t  size;           /* allocated, when not mapped */
+	bool    mapped;
+} input_file;
+
+/* read_input -- append all that is left of fd to in, in large blocks,
+	making room for size_hint more bytes first */
+static bool read_input(int fd, input_file *in, size_t size_hint) {
+	ssize_t got;
+
+	if ((in->data == NULL) || (in->size < in->len + size_hint + 1)) {
+		in->size = in->len + ((size_hint > 0) ? size_hint + 1 : 64 * 1024);
+		in->data = (char *)realloc(in->data, in->size);
+	}
+	while (1) {
+		if (in->len == in->size) {
+			in->size *= 2;
+			in->data = (char *)realloc(in->data, in->size);
+		}
+		got = read(fd, in->data + in->len, in->size - in->len);
+		if (got == 0)
+			return true;
+		if (got < 0) {
+			if (errno == EINTR)
+				continue;
+			return false;
+		}
+		in->len += got;
+	}
+}
+
+/* map_input -- map the whole of fd into an empty in, or read it if it
+	isn't a regular file or in already holds something */
+static bool map_input(int fd, input_file *in) {
+	struct stat st;
+
+	if (fstat(fd, &st) != 0)
+		st.st_size = 0, st.st_mode = 0;
+
+	if ((in->data == NULL) && S_ISREG(st.st_mode) && (st.st_size > 0)) {
+		in->data = (char *)mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (in->data != MAP_FAILED) {
+			in->len = st.st_size;
+			in->mapped = true;
+			return true;
+		}
+		in->data = NULL;
+	}
+	return read_input(fd, in, S_ISREG(st.st_mode) ? st.st_size : 0);
+}
+
+/* open_input -- map or append the file name to in; false with errno set
+	if it can't be read */
+static bool open_input(const char *name, input_file *in) {
+	bool ok;
+	int fd = open(name, O_RDONLY);
+
+	if (fd < 0)
+		return false;
+	ok = map_input(fd, in);
+	close(fd);
+	return ok;
+}
+
+static void close_input(input_file *in) {
+	if (in->mapped)
+		munmap(in->data, in->len);
+	else
+		free(in->data);
+	in->data = NULL;
+}
+
+/* write_all -- write count blocks to fd, in one call unless it is cut short */
+static bool write_all(int fd, struct iovec *iov, int count) {
+	int first = 0;
+	ssize_t done;
+
+	while (first < count) {
+		done = writev(fd, iov + first, count - first);
+		if (done < 0) {
+			if (errno == EINTR)
+				continue;
+			return false;
+		}
+		while ((first < count) && ((size_t)done >= iov[first].iov_len))
+			done -= iov[first++].iov_len;
+		if (first < count) {
+			iov[first].iov_base = (char *)iov[first].iov_base + done;
+			iov[first].iov_len -= done;
+		}
+	}
+	return true;
+}
+
+/* write_line -- write len bytes of data and a newline to fd */
+static bool write_line(int fd, const char *data, size_t len) {
+	struct iovec iov[2];
+
+	iov[0].iov_base = (void *)data;
+	iov[0].iov_len = len;
+	iov[1].iov_base = (void *)"\n";
+	iov[1].iov_len = 1;
+	return write_all(fd, iov, 2);
+}
+
+/* The file name extension for each output format, in export_formats order */
+static const char *format_extensions[] = {
+	".html", ".txt", ".tex", ".tex", ".tex", ".opml", ".fodt", ".txt", ".man"
+};
+
+/* output_name -- the file that the output for input name goes to: name
+	with its extension replaced by the format's */
+static GString * output_name(char *name, int format) {
+	GString *result = g_string_new(name);
+	char *dot = strrchr(result->str, '.');
+
+	if ((dot != NULL) && (dot != result->str))
+		g_string_truncate(result, dot - result->str);
+
+	if ((format >= 0) && (format < (int)(sizeof(format_extensions) / sizeof(format_extensions[0]))))
+		g_string_append(result, (char *)format_extensions[format]);
+	else
+		g_string_append(result, ".txt");
+	return result;
+}
+
+/* --serve and --client
+
+	A request is a line "<extensions> <format> <length>" followed by length
+	bytes of Markdown, and its reply is a line "<length>" followed by length
+	bytes of output.  A connection, or stdin, carries any number of requests,
+	which are answered in turn. */
+
+#define MAX_REQUEST_LINE 64
+
+/* Requests, and replies, longer than this are refused */
+#define MAX_REQUEST ((size_t)1 << 30)
+
+/* parse_length -- read a length of at most MAX_REQUEST bytes that ends the
+	line at text.  It must be digits only: sscanf and strtoull would take a
+	sign, and turn "-1" into SIZE_MAX. */
+static bool parse_length(const char *text, size_t *len) {
+	unsigned long long n;
+	char *end;
+
+	if (!isdigit((unsigned char)*text))
+		return false;
+	errno = 0;
+	n = strtoull(text, &end, 10);
+	if ((errno != 0) || (*end != '\n') || (n > MAX_REQUEST))
+		return false;
+	*len = (size_t)n;
+	return true;
+}
+
+/* parse_request -- read the extensions, format and length of a request
+	line; false if it is malformed */
+static bool parse_request(const char *line, int *extensions, int *format, size_t *len) {
+	int used = 0;
+
+	if ((strchr(line, '\n') == NULL)
+		|| (sscanf(line, "%d %d%n", extensions, format, &used) != 2)
+		|| (line[used] != ' ')
+		|| (*format < 0) || (*format > CRITIC_HTML_HIGHLIGHT_FORMAT))
+		return false;
+	return parse_length(line + used + 1, len);
+}
+
+/* A serving thread's converter, kept from one request to the next while
+	the extensions and format stay the same */
+typedef struct {
+	mmd_converter *c;
+	int            extensions;
+	int            format;
+} warm_converter;
+
+/* serve_requests -- answer the requests read from in on out, until in ends
+	or a request is malformed */
+static void serve_requests(FILE *in, FILE *out, warm_converter *warm) {
+	char line[MAX_REQUEST_LINE];
+	char *source = NULL;
+	size_t size = 0;
+	size_t len;
+	size_t out_len;
+	const char *result;
+	int extensions;
+	int format;
+
+	while (fgets(line, sizeof(line), in) != NULL) {
+		if (!parse_request(line, &extensions, &format, &len))
+			break;
+
+		if (len >= size) {
+			free(source);
+			size = len + 1;
+			if ((source = (char *)malloc(size)) == NULL)
+				break;
+		}
+		if (fread(source, 1, len, in) != len)
+			break;
+
+		if ((warm->c == NULL) || (warm->extensions != extensions) || (warm->format != format)) {
+			if (warm->c != NULL)
+				mmd_converter_free(warm->c);
+			warm->c = mmd_converter_new(extensions, format);
+			warm->extensions = extensions;
+			warm->format = format;
+		}
+		result = mmd_converter_convert(warm->c, source, len, &out_len);
+
+		if ((fprintf(out, "%zu\n", out_len) < 0)
+			|| (fwrite(result, 1, out_len, out) != out_len)
+			|| (fflush(out) != 0))
+			break;
+	}
+	free(source);
+}
+
+/* serve_thread -- answer the connections made to the listening socket,
+	one at a time */
+static void * serve_thread(void *arg) {
+	int listener = *(int *)arg;
+	warm_converter warm = {NULL, 0, 0};
+	FILE *in;
+	FILE *out;
+	int fd;
+
+	while (1) {
+		fd = accept(listener, NULL, NULL);
+		if (fd < 0) {
+			if ((errno == EINTR) || (errno == ECONNABORTED))
+				continue;
+			perror("accept");
+			break;
+		}
+
+		in = fdopen(fd, "r");
+		out = fdopen(dup(fd), "w");
+		if ((in != NULL) && (out != NULL))
+			serve_requests(in, out, &warm);
+		if (in != NULL)
+			fclose(in);
+		else
+			close(fd);
+		if (out != NULL)
+			fclose(out);
+	}
+
+	if (warm.c != NULL)
+		mmd_converter_free(warm.c);
+	return NULL;
+}
+
+/* connect_server -- a connection to the server on the socket at path, or -1 */
+static int connect_server(const char *path) {
+	struct sockaddr_un addr;
+	int fd;
+
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		errno = ENAMETOOLONG;
+		return -1;
+	}
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, path);
+
+	if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+		return -1;
+	if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+/* The socket being served, removed when the server is stopped */
+static const char *serving_path;
+
+static void stop_serving(int sig) {
+	unlink(serving_path);
+	signal(sig, SIG_DFL);
+	raise(sig);
+}
+
+/* serve -- answer requests on the Unix socket at path with threads threads
+	(one per CPU by default), or on stdin if path is NULL */
+static int serve(const char *path, int threads) {
+	struct sockaddr_un addr;
+	struct stat st;
+	warm_converter warm = {NULL, 0, 0};
+	pthread_t thread;
+	int listener;
+	int fd;
+	int i;
+
+	/* a client that goes away doesn't stop the server */
+	signal(SIGPIPE, SIG_IGN);
+
+	if (path == NULL) {
+		serve_requests(stdin, stdout, &warm);
+		if (warm.c != NULL)
+			mmd_converter_free(warm.c);
+		return EXIT_SUCCESS;
+	}
+
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		fprintf(stderr, "%s: Socket path is too long\n", path);
+		return EXIT_FAILURE;
+	}
+
+	/* a socket left behind by a server that was killed is replaced, but
+		not one that is still being served */
+	if ((lstat(path, &st) == 0) && S_ISSOCK(st.st_mode)) {
+		if ((fd = connect_server(path)) >= 0) {
+			close(fd);
+			fprintf(stderr, "%s: Already being served\n", path);
+			return EXIT_FAILURE;
+		}
+		unlink(path);
+	}
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, path);
+
+	listener = socket(AF_UNIX, SOCK_STREAM, 0);
+	if ((listener < 0)
+		|| (bind(listener, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+		|| (listen(listener, SOMAXCONN) != 0)) {
+		perror(path);
+		return EXIT_FAILURE;
+	}
+	serving_path = path;
+	signal(SIGINT, stop_serving);
+	signal(SIGTERM, stop_serving);
+
+	if (threads <= 0)
+		threads = batch_thread_count();
+	if (threads > MAX_BATCH_THREADS)
+		threads = MAX_BATCH_THREADS;
+
+	/* The calling thread serves as well, so spawn one fewer */
+	for (i = 1; i < threads; i++) {
+		if (pthread_create(&thread, NULL, serve_thread, &listener) != 0)
+			break;
+		pthread_detach(thread);
+	}
+	serve_thread(&listener);
+
+	unlink(path);
+	return EXIT_FAILURE;
+}
+
+/* read_all -- read exactly len bytes from fd into data */
+static bool read_all(int fd, char *data, size_t len) {
+	ssize_t got;
+
+	while (len > 0) {
+		got = read(fd, data, len);
+		if (got < 0) {
+			if (errno == EINTR)
+				continue;
+			return false;
+		}
+		if (got == 0)
+			return false;
+		data += got;
+		len -= got;
+	}
+	return true;
+}
+
+/* remote_convert -- have the server on the socket at path convert len bytes
+	of source; the malloc'ed output, or NULL if the source is too long to
+	send, there is no server there or it failed */
+static char * remote_convert(const char *path, const char *source, size_t len, int extensions, int format, size_t *out_len) {
+	char line[MAX_REQUEST_LINE];
+	struct iovec iov[2];
+	char *out = NULL;
+	size_t have = 0;
+	int fd;
+
+	if (len > MAX_REQUEST)
+		return NULL;
+	fd = connect_server(path);
+	if (fd < 0)
+		return NULL;
+
+	iov[0].iov_base = line;
+	iov[0].iov_len = snprintf(line, sizeof(line), "%d %d %zu\n", extensions, format, len);
+	iov[1].iov_base = (void *)source;
+	iov[1].iov_len = len;
+	if (write_all(fd, iov, 2)) {
+		/* the length line a byte at a time, so as not to read past it */
+		while ((have < sizeof(line) - 1) && read_all(fd, line + have, 1)) {
+			if (line[have++] == '\n')
+				break;
+		}
+		line[have] = '\0';
+
+		if ((have > 0) && (line[have - 1] == '\n') && parse_length(line, out_len)) {
+			out = (char *)malloc(*out_len + 1);
+			if ((out != NULL) && read_all(fd, out, *out_len)) {
+				out[*out_len] = '\0';
+			} else {
+				free(out);
+				out = NULL;
+			}
+		}
+	}
+	close(fd);
+	return out;
+}
+
+/* The files of a --batch run */
+typedef struct {
+	char  **names;
+	int    *order;          /* indices into names, largest file first */
+	int     extensions;
+	int     format;
+	char   *meta_key;       /* the key to --extract, or NULL to convert */
+	char   *server;         /* the socket of a server to convert with, or NULL */
+	char  **meta;           /* what --extract prints for each file */
+	bool   *failed;         /* the file couldn't be read */
+} file_batch;
+
+typedef struct {
+	off_t size;
+	int   index;
+} file_size;
+
+static int larger_first(const void *a, const void *b) {
+	off_t x = ((const file_size *)a)->size;
+	off_t y = ((const file_size *)b)->size;
+
+	if (x != y)
+		return (x > y) ? -1 : 1;
+	return ((const file_size *)a)->index - ((const file_size *)b)->index;
+}
+
+/* convert_file -- batch_run work: convert one file of the batch to its
+	output file, or extract its metadata */
+static void convert_file(mmd_converter *c, void *context, int i) {
+	file_batch *batch = (file_batch *)context;
+	int n = batch->order[i];
+	input_file in;
+	const char *out;
+	char *remote = NULL;
+	size_t out_len;
+	GString *name;
+	GString *text;
+	char *value;
+	bool found;
+	int fd;
+
+	memset(&in, 0, sizeof(in));
+	if (!open_input(batch->names[n], &in)) {
+		perror(batch->names[n]);
+		close_input(&in);
+		batch->failed[n] = true;
+		return;
+	}
+
+	if (batch->meta_key != NULL) {
+		value = extract_metadata_value_len(in.data, in.len, batch->extensions, batch->meta_key, &found);
+		text = g_string_new(found ? "+ meta\n" : "- meta\n");
+		if (value != NULL) {
+			g_string_append(text, value);
+			g_string_append_c(text, '\n');
+			free(value);
+		}
+		batch->meta[n] = g_string_free(text, false);
+		close_input(&in);
+		return;
+	}
+
+	if (batch->server != NULL)
+		remote = remote_convert(batch->server, in.data, in.len, batch->extensions, batch->format, &out_len);
+	out = (remote != NULL) ? remote : mmd_converter_convert(c, in.data, in.len, &out_len);
+	close_input(&in);
+
+	name = output_name(batch->names[n], batch->format);
+	fd = open(name->str, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	if ((fd < 0) || !write_line(fd, out, out_len))
+		perror(name->str);
+	if (fd >= 0)
+		close(fd);
+	g_string_free(name, true);
+	free(remote);
+}
+
+/* convert_batch -- convert each of the count files in names to a file of
+	its own (or extract their metadata), jobs at a time */
+static int convert_batch(char **names, int count, int extensions, int format, char *meta_key, char *server, int jobs) {
+	file_batch batch;
+	file_size *sizes;
+	struct stat st;
+	int status = EXIT_SUCCESS;
+	int i;
+
+	/* the largest files are started first, so that one of them isn't left
+		running on its own at the end */
+	sizes = (file_size *)malloc(sizeof(file_size) * count);
+	for (i = 0; i < count; i++) {
+		sizes[i].size = (stat(names[i], &st) == 0) ? st.st_size : 0;
+		sizes[i].index = i;
+	}
+	qsort(sizes, count, sizeof(file_size), larger_first);
+
+	batch.names = names;
+	batch.order = (int *)malloc(sizeof(int) * count);
+	for (i = 0; i < count; i++)
+		batch.order[i] = sizes[i].index;
+	batch.extensions = extensions;
+	batch.format = format;
+	batch.meta_key = meta_key;
+	batch.server = server;
+	batch.meta = (char **)calloc(count, sizeof(char *));
+	batch.failed = (bool *)calloc(count, sizeof(bool));
+
+	batch_run(count, jobs, extensions, format, convert_file, &batch);
+
+	for (i = 0; i < count; i++) {
+		if (batch.meta[i] != NULL) {
+			fputs(batch.meta[i], stdout);
+			free(batch.meta[i]);
+		}
+		if (batch.failed[i])
+			status = EXIT_FAILURE;
+	}
+
+	free(batch.failed);
+	free(batch.meta);
+	free(batch.order);
+	free(sizes);
+	return status;
+}
 
 int main(int argc, char **argv)
 {
@@ -39,10 +592,18 @@ int main(int argc, char **argv)
 	static int obfuscate_flag = 0;
 	static int no_obfuscate_flag = 0;
 	static int process_html_flag = 0;
+	static int linear_flag = 0;
+	int jobs = 0;
+	bool serving = false;
+	char *serve_socket = NULL;
+	char *client_socket = NULL;
 	char *target_meta_key = FALSE;
 		
 	static struct option long_options[] = {
 		{"batch", no_argument, &batch_flag, 1},                    /* process each file separately */
+		{"jobs", required_argument, 0, 'j'},                       /* how many files to process at once */
+		{"serve", optional_argument, 0, 'S'},                      /* convert requests until stopped */
+		{"client", required_argument, 0, 'C'},                     /* have a server convert */
 		{"to", required_argument, 0, 't'},                         /* which output format to use */
 		{"full", no_argument, &complete_flag, 1},                  /* complete document */
 		{"output", required_argument, 0, 'o'},                     /* which output format to use */
@@ -56,6 +617,7 @@ int main(int argc, char **argv)
 		{"nolabels", no_argument, &no_label_flag, 1},              /* don't generate labels */
 		{"compatibility", no_argument, &compatibility_flag, 1},    /* compatibility mode */
 		{"process-html", no_argument, &process_html_flag, 1},      /* process Markdown inside HTML */
+		{"linear", no_argument, &linear_flag, 1},                  /* pair emphasis and links with a delimiter stack */
 		{"accept", no_argument, 0, 'a'},                           /* Accept all proposed CriticMarkup changes */
 		{"reject", no_argument, 0, 'r'},                           /* Reject all proposed CriticMarkup changes */
 		{"extract", required_argument, 0, 'e'},                    /* show value of specified metadata */
@@ -64,14 +626,13 @@ int main(int argc, char **argv)
 		{NULL, 0, NULL, 0}
 	};
 	
-	GString *inputbuf;
-	FILE *input;
-	FILE *output;
-	int curchar;
+	input_file in;
+	struct stat st;
+	int output;
 	GString *filename = NULL;
-	char *temp;
 	
 	char *out;
+	size_t out_len;
 	
 	/* set up my data for the parser */
 	int output_format = 0;
@@ -82,7 +643,7 @@ int main(int argc, char **argv)
 	while (1) {
 		int option_index = 0;
 
-		c = getopt_long (argc, argv, "vhco:bft:e:ar", long_options, &option_index);
+		c = getopt_long (argc, argv, "vhco:bj:ft:e:ar", long_options, &option_index);
 		
 		if (c == -1)
 			break;
@@ -99,6 +660,23 @@ int main(int argc, char **argv)
 				batch_flag = 1;
 				break;
 			
+			case 'j':	/* parallel batch */
+				jobs = atoi(optarg);
+				if (jobs < 1) {
+					fprintf(stderr, "%s: Invalid number of jobs '%s'\n",argv[0], optarg);
+					exit(EXIT_FAILURE);
+				}
+				break;
+			
+			case 'S':	/* serve requests */
+				serving = true;
+				serve_socket = optarg;
+				break;
+			
+			case 'C':	/* use a server */
+				client_socket = optarg;
+				break;
+			
 			case 'c':	/* compatibility */
 				compatibility_flag = 1;
 				break;
@@ -122,9 +700,13 @@ int main(int argc, char **argv)
 				"    -o, --output=FILE      Send output to FILE\n"
 				"    -t, --to=FORMAT        Convert to FORMAT\n"
 				"    -b, --batch            Process each file separately\n"
+				"    -j, --jobs=N           Process N files at once (default: one per CPU)\n"
+				"    --serve[=SOCKET]       Convert requests on SOCKET, or stdin, until stopped\n"
+				"    --client=SOCKET        Convert with the server on SOCKET if it is running\n"
 				"    -c, --compatibility    Markdown compatibility mode\n"
 				"    -f, --full             Force a complete document\n"
 				"    --process-html         Process Markdown inside of raw HTML\n"
+				"    --linear               Resolve emphasis and links in linear time\n"
 				"    -e, --extract          Extract specified metadata\n"
 				"    -a, --accept           Accept all CriticMarkup changes\n"
 				"    -r, --reject           Reject all CriticMarkup changes\n"
@@ -224,6 +806,9 @@ int main(int argc, char **argv)
 	if (process_html_flag)
 		extensions = extensions | EXT_PROCESS_HTML;
 
+	if (linear_flag)
+		extensions = extensions | EXT_LINEAR_INLINES;
+
 	/* fix numbering to account for options */
 	argc -= optind;
 	argv += optind;
@@ -235,134 +820,76 @@ int main(int argc, char **argv)
 	/* any filenames */
 	numargs = argc -1;
 
+	if (serving) {
+		i = serve(serve_socket, jobs);
+		g_string_free(filename, true);
+		free(target_meta_key);
+		return(i);
+	}
+
+	/* a client carries on when the server has gone away */
+	if (client_socket != NULL)
+		signal(SIGPIPE, SIG_IGN);
+
 	if (batch_flag && (numargs != 0)) {
 		/* we have multiple file names -- handle individually */
-		
-		for (i = 0; i < numargs; i++) {
-			inputbuf = g_string_new("");
-			
-			/* Read file */
-			if ((input = fopen(argv[i+1], "r")) == NULL ) {
-				perror(argv[i+1]);
-				g_string_free(inputbuf, true);
-				g_string_free(filename, true);
-				exit(EXIT_FAILURE);
-			}
-			
-			while ((curchar = fgetc(input)) != EOF)
-				g_string_append_c(inputbuf, curchar);
-			fclose(input);
-			
-			/* extract metadata */
-			if (target_meta_key) {
-				if (has_metadata(inputbuf->str, extensions)) {
-					fprintf(stdout, "+ meta\n");
-				} else {
-					fprintf(stdout, "- meta\n");
-				}
-				
-				out = extract_metadata_value(inputbuf->str, extensions, target_meta_key);
-				if (out != NULL)
-					fprintf(stdout, "%s\n", out);
-				free(out);
-				g_string_free(inputbuf, true);
-				free(target_meta_key);
-				return(EXIT_SUCCESS);
-			}
-			
-			out = markdown_to_string(inputbuf->str,  extensions, output_format);
-			
-			g_string_free(inputbuf, true);
-			
-			/* set up for output */
-			temp = argv[i+1];	/* get current filename */
-			if (strrchr(temp,'.') != NULL) {
-				long count = strrchr(temp,'.') - temp;
-				if (count != 0) {
-					/* truncate string at "." */
-					temp[count] = '\0';
-				}
-			}
-			
-			filename = g_string_new(temp);
-			
-			if (output_format == TEXT_FORMAT) {
-				g_string_append(filename,".txt");
-			} else if (output_format == HTML_FORMAT) {
-				g_string_append(filename,".html");
-			} else if (output_format == LATEX_FORMAT) {
-				g_string_append(filename,".tex");
-			} else if (output_format == BEAMER_FORMAT) {
-				g_string_append(filename,".tex");
-			} else if (output_format == MEMOIR_FORMAT) {
-				g_string_append(filename,".tex");
-			} else if (output_format == ODF_FORMAT) {
-				g_string_append(filename,".fodt");
-			} else if (output_format == OPML_FORMAT) {
-				g_string_append(filename,".opml");
-			} else if (output_format == MAN_FORMAT) {
-				g_string_append(filename,".man");
-			} else {
-				/* default extension -- in this case we only have 1 */
-				g_string_append(filename,".txt");
-			}
-			
-			if (!(output = fopen(filename->str, "w"))) {
-				perror(filename->str);
-			} else {
-				fprintf(output, "%s\n",out);
-				fclose(output);
-			}
-			
-			g_string_free(filename,true);
-			
-			if (out != NULL)
-				free(out);
-		}
+		i = convert_batch(argv + 1, numargs, extensions, output_format, target_meta_key, client_socket, jobs);
+		g_string_free(filename, true);
+		free(target_meta_key);
+		return(i);
 	} else {
 		/* get input from stdin or concat all files */
-		inputbuf = g_string_new("");
+		memset(&in, 0, sizeof(in));
 		
 		if (numargs == 0) {
 			/* get stdin */
-			while ((curchar = fgetc(stdin)) != EOF)
-				g_string_append_c(inputbuf, curchar);
-			fclose(stdin);
+			if (!map_input(STDIN_FILENO, &in)) {
+				perror("stdin");
+				exit(EXIT_FAILURE);
+			}
 		} else {
-			/* get files */
+			/* get files -- a single file is mapped, several are read
+				one after the other into a buffer big enough for them all */
+			if (numargs > 1) {
+				for (i = 0; i < numargs; i++) {
+					if (stat(argv[i+1], &st) == 0)
+						in.size += st.st_size;
+				}
+				in.data = (char *)malloc(++in.size);
+			}
 			for (i = 0; i < numargs; i++) {
-				if ((input = fopen(argv[i+1], "r")) == NULL ) {
+				if (!open_input(argv[i+1], &in)) {
 					perror(argv[i+1]);
-					g_string_free(inputbuf, true);
+					close_input(&in);
 					g_string_free(filename, true);
 					exit(EXIT_FAILURE);
 				}
-				
-				while ((curchar = fgetc(input)) != EOF)
-					g_string_append_c(inputbuf, curchar);
-				fclose(input);
 			}
 		}
 		
 		/* extract metadata */
 		if (target_meta_key) {
-			out = extract_metadata_value(inputbuf->str, extensions, target_meta_key);
+			out = extract_metadata_value_len(in.data, in.len, extensions, target_meta_key, NULL);
 			if (out != NULL)
-				fprintf(stdout, "%s\n", out);
+				write_line(STDOUT_FILENO, out, strlen(out));
 			free(out);
-			g_string_free(inputbuf, true);
+			close_input(&in);
 			free(target_meta_key);
 			return(EXIT_SUCCESS);
 		}
 
-		out = markdown_to_string(inputbuf->str, extensions, output_format);
+		out = NULL;
+		if (client_socket != NULL)
+			out = remote_convert(client_socket, in.data, in.len, extensions, output_format, &out_len);
+		if (out == NULL)
+			out = markdown_to_string_len(in.data, in.len, extensions, output_format, &out_len);
 		
-		g_string_free(inputbuf, true);
+		close_input(&in);
 		
 		/* did we specify an output filename; "-" equals stdout */
 		if ((filename == NULL) || (strcmp(filename->str, "-") == 0)) {
-			output = stdout;
-		} else if (!(output = fopen(filename->str, "w"))) {
+			output = STDOUT_FILENO;
+		} else if ((output = open(filename->str, O_WRONLY | O_CREAT | O_TRUNC, 0666)) < 0) {
 			perror(filename->str);
 			if (out != NULL)
 				free(out);
@@ -370,13 +897,20 @@ int main(int argc, char **argv)
 			return 1;
 		}
 		
-		fprintf(output, "%s\n",out);
-		fclose(output);
+		if (!write_line(output, out, out_len)) {
+			perror((output == STDOUT_FILENO) ? "stdout" : filename->str);
+			i = EXIT_FAILURE;
+		} else {
+			i = EXIT_SUCCESS;
+		}
+		close(output);
 		
-		g_string_free(filename, false);
+		if (filename != NULL)
+			g_string_free(filename, true);
 		
 		if (out != NULL)
 			free(out);
+		return(i);
 	}
 	
 	return(EXIT_SUCCESS);
@@ -19,6 +19,7 @@
 
 */
 
+#include <stdint.h>
 #include "parser.h"
 
 #pragma mark - Parse Tree
@@ -202,24 +203,57 @@ void append_list(node *new, node *list) {
 
 #pragma mark - Parser Data
 
+/* parser_clock -- CPU time used by the calling thread, in clock() units.
+	clock() is process-wide, so with several documents being parsed on
+	different threads it would charge each parse for all of them. */
+clock_t parser_clock(void) {
+#if defined(_POSIX_THREAD_CPUTIME) && (_POSIX_THREAD_CPUTIME >= 0)
+	struct timespec ts;
+	if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+		return (clock_t) ts.tv_sec * CLOCKS_PER_SEC
+			+ (clock_t) (ts.tv_nsec / (1000000000 / CLOCKS_PER_SEC));
+#endif
+	return clock();
+}
+
 /* Create parser data - this is where you stash stuff to communicate 
 	into and out of the parser */
 parser_data * mk_parser_data(char *charbuf, int extensions) {
-	clock_t start = clock();
-
 	parser_data *result = (parser_data *)malloc(sizeof(parser_data));
-	result->extensions = extensions;
-	result->charbuf    = charbuf;
-	result->original   = charbuf;
-	result->autolabels = NULL;
-	result->result     = NULL;
-	
-	result->parse_aborted = 0;
-	result->stop_time = start + 3 * CLOCKS_PER_SEC;	/* 3 second timeout */
+	init_parser_data(result, charbuf, extensions);
 	
 	return result;
 }
 
+/* init_parser_data -- (re)initialize parser data in place */
+void init_parser_data(parser_data *data, char *charbuf, int extensions) {
+	init_parser_data_len(data, charbuf, strlen(charbuf), "", extensions);
+}
+
+/* init_parser_data_len -- as init_parser_data, for len bytes of input
+	(which need not be NUL terminated) followed by trailer */
+void init_parser_data_len(parser_data *data, const char *input, size_t len, const char *trailer, int extensions) {
+	clock_t start = parser_clock();
+
+	data->extensions = extensions;
+	data->charbuf    = (char *)input;
+	data->charbuf_end = input + len;
+	data->trailer    = trailer;
+	data->refill     = NULL;
+	data->stream     = NULL;
+	data->lines      = NULL;
+	data->tails      = NULL;
+	data->blocks     = NULL;
+	data->original   = (char *)input;
+	data->autolabels = NULL;
+	data->result     = NULL;
+	
+	data->parse_aborted = 0;
+	data->stop_time = start + 3 * CLOCKS_PER_SEC;	/* 3 second timeout */
+	data->flat_sections = 0;
+	data->starved = 0;
+}
+
 void free_parser_data(parser_data *data) {
 	free_node_tree(data->result);
 	free_node_tree(data->autolabels);
@@ -247,11 +281,69 @@ scratch_pad * mk_scratch_pad(int extensions) {
 	result->obfuscate  = 0;
 	result->no_latex_footnote = 0;
 	result->latex_footer = NULL;
+	result->table_alignment = NULL;
+	result->table_column = 0;
+	result->cell_type = 0;
+	result->column_styles = NULL;
+	result->column_count = 0;
+	result->column_room = 0;
+	result->odf_para_type = PARA;
 	result->odf_list_needs_end_p = FALSE;
 	
 	return result;
 }
 
+/* trim_to_sentinel -- free every node of a scratch list except the
+	KEY_COUNTER sentinel (which writers may have moved to the front) */
+static node * trim_to_sentinel(node *list) {
+	node *sentinel = NULL;
+	node *next;
+
+	while (list != NULL) {
+		next = list->next;
+		if ((sentinel == NULL) && (list->key == KEY_COUNTER)) {
+			sentinel = list;
+			sentinel->next = NULL;
+		} else {
+			free_node(list);
+		}
+		list = next;
+	}
+	if (sentinel == NULL)
+		sentinel = mk_node(KEY_COUNTER);
+	return sentinel;
+}
+
+/* reset_scratch_pad -- return a used scratch pad to its freshly made state,
+	keeping the KEY_COUNTER sentinel at the end of each list */
+void reset_scratch_pad(scratch_pad *scratch, int extensions) {
+	scratch->notes      = trim_to_sentinel(scratch->notes);
+	scratch->used_notes = trim_to_sentinel(scratch->used_notes);
+	scratch->links      = trim_to_sentinel(scratch->links);
+	scratch->glossary   = trim_to_sentinel(scratch->glossary);
+	scratch->citations  = trim_to_sentinel(scratch->citations);
+
+	if (scratch->latex_footer != NULL) {
+		free(scratch->latex_footer);
+		scratch->latex_footer = NULL;
+	}
+
+	scratch->extensions = extensions;
+	scratch->language = 0;
+	scratch->baseheaderlevel = 1;
+	scratch->padded     = 2;
+	scratch->footnote_to_print = 0;
+	scratch->max_footnote_num = 0;
+	scratch->obfuscate  = 0;
+	scratch->no_latex_footnote = 0;
+	scratch->table_alignment = NULL;
+	scratch->table_column = 0;
+	scratch->cell_type = 0;
+	scratch->column_count = 0;
+	scratch->odf_para_type = PARA;
+	scratch->odf_list_needs_end_p = FALSE;
+}
+
 void free_scratch_pad(scratch_pad *scratch) {
 #ifdef DEBUG_ON
 	fprintf(stderr, "free scratch pad\n");
@@ -265,6 +357,8 @@ void free_scratch_pad(scratch_pad *scratch) {
 	
 	if (scratch->latex_footer != NULL)
 		free(scratch->latex_footer);
+
+	free(scratch->column_styles);
 	
 	free (scratch);
 #ifdef DEBUG_ON
@@ -451,35 +545,331 @@ void print_raw_node_tree(GString *out, node *n) {
 /* preformat_text - allocate and copy text buffer while
  * performing tab expansion. */
 char * preformat_text(char *text) {
+	return preformat_text_len(text, strlen(text));
+}
+
+/* preformat_text_len - as preformat_text, but the input is given by
+ * length and need not be NUL terminated.  Embedded NUL characters
+ * would end the document early, so they are replaced with U+FFFD. */
+char * preformat_text_len(const char *text, size_t len) {
 	GString *buf;
-	char next_char;
-	int charstotab;
 	char *out;
 
-	int len = 0;
+	buf = g_string_sized_new(len + 2);
+	preformat_text_into(buf, text, len);
+	out = buf->str;
+	g_string_free(buf,false);
+	return(out);
+}
+
+/* Preformatting only has to change tabs, carriage returns and NULs; runs
+ * of any other bytes are copied as they are.  The input is searched for
+ * those bytes a word at a time. */
+#define ONE_BYTES  ((uint64_t)0x0101010101010101ULL)
+#define HIGH_BITS  ((uint64_t)0x8080808080808080ULL)
+#define HAS_ZERO_BYTE(word)  (((word) - ONE_BYTES) & ~(word) & HIGH_BITS)
+#define HAS_BYTE(word, c)    HAS_ZERO_BYTE((word) ^ (ONE_BYTES * (uint8_t)(c)))
+
+#define PREFORMAT_SPECIAL(c) (((c) == '\t') || ((c) == '\r') || ((c) == '\0'))
+
+/* find_preformat_special - first tab, CR or NUL in text, or end */
+static const char * find_preformat_special(const char *text, const char *end) {
+	uint64_t word;
+
+	while (end - text >= 8) {
+		memcpy(&word, text, 8);
+		if (HAS_ZERO_BYTE(word) || HAS_BYTE(word, '\t') || HAS_BYTE(word, '\r'))
+			break;
+		text += 8;
+	}
+	while ((text < end) && !PREFORMAT_SPECIAL(*text))
+		text++;
+	return text;
+}
+
+/* has_bom - does text start with a UTF-8 byte order mark? */
+static bool has_bom(const char *text, size_t len) {
+	return (len >= 3) && (memcmp(text, "\xEF\xBB\xBF", 3) == 0);
+}
+
+/* needs_preformat - would preformat_text change anything other than
+ * adding the trailing newlines?  If not the text can be parsed as is. */
+bool needs_preformat(const char *text, size_t len) {
+	return has_bom(text, len) || (find_preformat_special(text, text + len) != text + len);
+}
+
+/* preformat_text_into - as preformat_text_len, but append to an
+ * existing buffer so that it can be reused from one document to the next */
+void preformat_text_into(GString *buf, const char *text, size_t len) {
+	int charstotab = TABSTOP;
+
+	/* the byte order mark is dropped */
+	if (has_bom(text, len))
+		text += 3, len -= 3;
+
+	g_string_reserve(buf, len + 2);
+	preformat_text_append(buf, text, len, &charstotab);
+	g_string_append_len(buf, "\n\n", 2);
+}
+
+/* preformat_text_append - expand tabs, normalize line endings to \n and
+ * replace NULs in one piece of a document; charstotab carries the tab
+ * position from one piece to the next, so a document can be preformatted
+ * a piece at a time */
+void preformat_text_append(GString *buf, const char *text, size_t len, int *charstotab) {
+	const char *end = text + len;
+	const char *run;
+	const char *line;
+
+	while (text < end) {
+		run = text;
+		text = find_preformat_special(text, end);
 
-	buf = g_string_new("");
+		if (text > run) {
+			g_string_append_len(buf, run, text - run);
 
-	charstotab = TABSTOP;
-	while ((next_char = *text++) != '\0') {
-		switch (next_char) {
+			/* the tab position depends only on the last line of the run */
+			line = text;
+			while ((line > run) && (line[-1] != '\n'))
+				line--;
+			if (line > run)
+				*charstotab = TABSTOP - ((text - line) % TABSTOP);
+			else
+				*charstotab = TABSTOP - ((TABSTOP - *charstotab + (text - run)) % TABSTOP);
+		}
+
+		if (text == end)
+			break;
+
+		switch (*text++) {
 			case '\t':
-				while (charstotab > 0)
-					g_string_append_c(buf, ' '), len++, charstotab--;
+				while (*charstotab > 0)
+					g_string_append_c(buf, ' '), (*charstotab)--;
 				break;
-			case '\n':
-				g_string_append_c(buf, '\n'), len++, charstotab = TABSTOP;
+			case '\r':
+				/* \r\n and a lone \r both end a line */
+				if ((text < end) && (*text == '\n'))
+					continue;
+				g_string_append_c(buf, '\n'), *charstotab = TABSTOP;
+				break;
+			case '\0':
+				g_string_append_len(buf, "\xEF\xBF\xBD", 3), (*charstotab)--;
 				break;
-			default:
-				g_string_append_c(buf, next_char), len++, charstotab--;
 		}
-		if (charstotab == 0)
-			charstotab = TABSTOP;
+		if (*charstotab == 0)
+			*charstotab = TABSTOP;
 	}
-	g_string_append_printf(buf, "\n\n");
-	out = buf->str;
-	g_string_free(buf,false);
-	return(out);
+}
+
+/* The input to classify_lines is the text followed by a trailer, as the
+	parser reads it */
+typedef struct {
+	const char *text;
+	size_t      len;
+	const char *trailer;
+	size_t      total;
+} line_source;
+
+static inline int source_char(const line_source *src, size_t i) {
+	if (i < src->len)
+		return (unsigned char) src->text[i];
+	if (i < src->total)
+		return (unsigned char) src->trailer[i - src->len];
+	return -1;
+}
+
+/* classify_line - work out the LINE_* classes of the line starting at
+	start, and return the offset of the next line (after \n, \r\n or \r,
+	the same line endings as the Newline rule) */
+static size_t classify_line(const line_source *src, size_t start, unsigned short *flags) {
+	unsigned short f = 0;
+	size_t i = start;
+	size_t n;
+	int c;
+	int first = source_char(src, start);
+	bool blank = true;
+	bool underline = (first == '=') || (first == '-');
+
+	/* NonindentSpace takes up to three spaces, and never gives them back */
+	for (n = 0; (n < 3) && (source_char(src, start + n) == ' '); n++);
+	c = source_char(src, start + n);
+
+	if ((first == '\t') || ((n == 3) && (c == ' ')))
+		f |= LINE_INDENTED;
+	if (first == '>')
+		f |= LINE_QUOTE;
+	if (first == '#')
+		f |= LINE_ATX;
+	if (first == '<')
+		f |= LINE_HTML;
+	if (first == '!')
+		f |= LINE_BANG;
+	if ((c == '*') || (c == '-') || (c == '_'))
+		f |= LINE_RULE;
+	if (c == '[')
+		f |= LINE_BRACKET;
+	if (c == ':')
+		f |= LINE_COLON;
+	if (((c == '+') || (c == '*') || (c == '-')) &&
+		((source_char(src, start + n + 1) == ' ') || (source_char(src, start + n + 1) == '\t')))
+		f |= LINE_BULLET;
+	if ((c >= '0') && (c <= '9')) {
+		for (i = start + n; ((c = source_char(src, i)) >= '0') && (c <= '9'); i++);
+		if ((c == '.') && ((source_char(src, i + 1) == ' ') || (source_char(src, i + 1) == '\t')))
+			f |= LINE_ORDERED;
+	}
+
+	for (i = start; (c = source_char(src, i)) == ' ' || (c == '\t'); i++);
+	if (c == '<')
+		f |= LINE_SP_HTML;
+
+	/* the rest of the line */
+	for (i = start; ((c = source_char(src, i)) != -1) && (c != '\n') && (c != '\r'); i++) {
+		if (c == '|')
+			f |= LINE_PIPE;
+		if ((c != ' ') && (c != '\t'))
+			blank = false;
+		if (c != first)
+			underline = false;
+	}
+	if (blank)
+		f |= LINE_BLANK;
+
+	/* an underline has to end with a newline */
+	if (c == -1) {
+		*flags = f;
+		return i;
+	}
+	if (underline)
+		f |= LINE_UNDERLINE;
+	*flags = f;
+
+	i++;
+	if ((c == '\r') && (source_char(src, i) == '\n'))
+		i++;
+	return i;
+}
+
+/* classify_lines - one pass over the parser input (len bytes of text and
+	then the trailer), recording the classes of each line in map */
+void classify_lines(line_map *map, const char *text, size_t len, const char *trailer) {
+	line_source src;
+	size_t start = 0;
+	size_t i;
+	unsigned short flags;
+
+	src.text    = text;
+	src.len     = len;
+	src.trailer = trailer;
+	src.total   = len + strlen(trailer);
+
+	map->count  = 0;
+	map->cursor = 0;
+
+	while (start < src.total) {
+		if (map->count == map->capacity) {
+			map->capacity = (map->capacity < 64) ? 64 : map->capacity * 2;
+			map->lines = (line_info *)realloc(map->lines, map->capacity * sizeof(line_info));
+		}
+		map->lines[map->count].start = start;
+		start = classify_line(&src, start, &flags);
+		map->lines[map->count].flags = flags;
+
+		if ((flags & LINE_UNDERLINE) && (map->count > 0))
+			map->lines[map->count - 1].flags |= LINE_SETEXT;
+		map->count++;
+	}
+
+	/* A definition list needs a run of term lines followed, after at most
+		one blank line, by a line starting with ':' */
+	for (i = map->count; i-- > 1;) {
+		flags = map->lines[i].flags;
+		if ((flags & LINE_COLON) ||
+			((flags & LINE_BLANK) && (i + 1 < map->count) && (map->lines[i + 1].flags & LINE_COLON)) ||
+			(!(flags & LINE_BLANK) && (flags & LINE_TERM)))
+			map->lines[i - 1].flags |= LINE_TERM;
+	}
+}
+
+/* line_class_at - the classes of the line starting at offset, or LINE_ANY
+	if offset is not the start of a line */
+unsigned int line_class_at(line_map *map, size_t offset) {
+	size_t lo, hi, mid;
+
+	if ((map == NULL) || (map->count == 0))
+		return LINE_ANY;
+
+	/* the parser mostly moves forward a line or so at a time */
+	mid = map->cursor;
+	if (map->lines[mid].start != offset) {
+		if ((mid + 1 < map->count) && (map->lines[mid + 1].start == offset)) {
+			mid++;
+		} else {
+			lo = 0;
+			hi = map->count;
+			while (lo < hi) {
+				mid = lo + (hi - lo) / 2;
+				if (map->lines[mid].start < offset)
+					lo = mid + 1;
+				else
+					hi = mid;
+			}
+			if ((lo == map->count) || (map->lines[lo].start != offset))
+				return LINE_ANY;
+			mid = lo;
+		}
+		map->cursor = mid;
+	}
+	return map->lines[mid].flags;
+}
+
+/* free_line_map - release the storage of a line map (not the map itself) */
+void free_line_map(line_map *map) {
+	free(map->lines);
+	map->lines = NULL;
+	map->count = map->capacity = map->cursor = 0;
+}
+
+/* reset_link_scan - forget earlier link tail scans before a new parse,
+	keeping the storage */
+void reset_link_scan(link_scan *scan) {
+	int i;
+
+	scan->from = scan->count = 0;
+	scan->title_from[0] = scan->title_from[1] = NO_SCAN_END;
+	scan->title_end[0] = scan->title_end[1] = NO_SCAN_END;
+	for (i = 0; i < SPAN_KINDS; i++)
+		scan->span_from[i] = scan->span_end[i] = NO_SCAN_END;
+}
+
+/* free_link_scan - release the storage of a link scan (not the scan itself) */
+void free_link_scan(link_scan *scan) {
+	free(scan->source_end);
+	free(scan->pending);
+	scan->source_end = NULL;
+	scan->pending = NULL;
+	scan->capacity = 0;
+	reset_link_scan(scan);
+}
+
+/* reset_html_scan - forget earlier HTML block scans before a new parse,
+	keeping the storage */
+void reset_html_scan(html_scan *scan) {
+	size_t i;
+
+	for (i = 0; i < scan->capacity; i++)
+		scan->entries[i].tag = -1;
+	scan->count = 0;
+}
+
+/* free_html_scan - release the storage of an HTML block scan (not the scan
+	itself) */
+void free_html_scan(html_scan *scan) {
+	free(scan->entries);
+	free(scan->pending);
+	scan->entries = NULL;
+	scan->pending = NULL;
+	scan->count = scan->capacity = scan->room = 0;
 }
 
 /* Don't let us get caught in "infinite" loop;
@@ -489,7 +879,7 @@ bool check_timeout(parser_data *data) {
 	/* Once we abort, keep aborting */
 	if (data->parse_aborted)
 		return 0;
-	if (clock() > data->stop_time) {
+	if (parser_clock() > data->stop_time) {
 		data->parse_aborted = 1;
 		return 0;
 	}
@@ -27,8 +27,12 @@ struct _GREG;
 	GNU General Public License for more details.
 */
 
+#include <pthread.h>
 #include "parser.h"
 #include "writer.h"
+#include "delimiter.h"
+#include "cache.h"
+#include "serialize.h"
 
 
 /* Define shortcuts to adding nodes, etc. */
@@ -41,16 +45,38 @@ struct _GREG;
 #define YY_INPUT(buf, result, max_size, D) yy_input_func(buf, &result, max_size, (parser_data *)G->data)
 
 /* redefine input buffer so that we draw from the specified source string 
-	to make it thread/reentrant safe */
+	to make it thread/reentrant safe.  As much input as fits is handed over
+	at once; when it runs out refill (if any) supplies the next piece, and
+	the trailer follows once the source is used up.  If refill has nothing
+	yet the input ends for now and the parse is marked as starved. */
 void yy_input_func(char *buf, int *result, int max_size, parser_data *data)
-{                                                      \
-	int yyc;                                           \
-	if (data->charbuf && (*(data->charbuf) != '\0')) { \
-		yyc = *(data->charbuf)++;                      \
-	} else {                                           \
-		yyc= EOF;                                      \
-	}                                                  \
-	(*result) = (EOF == yyc) ? 0 : (*(buf)= yyc, 1);   \
+{
+	size_t available;
+
+	if ((data->charbuf == NULL) || (max_size <= 0)) {
+		(*result) = 0;
+		return;
+	}
+	while ((data->charbuf == data->charbuf_end) && (data->refill != NULL)) {
+		if (!data->refill(data->stream, &data->charbuf, &data->charbuf_end))
+			data->refill = NULL;
+		else if (data->charbuf == data->charbuf_end) {
+			data->starved = true;
+			(*result) = 0;
+			return;
+		}
+	}
+	if ((data->charbuf == data->charbuf_end) && (*(data->trailer) != '\0')) {
+		data->charbuf     = (char *)data->trailer;
+		data->charbuf_end = data->trailer + strlen(data->trailer);
+		data->trailer     = "";
+	}
+	available = data->charbuf_end - data->charbuf;
+	if (available > (size_t)max_size)
+		available = max_size;
+	memcpy(buf, data->charbuf, available);
+	data->charbuf += available;
+	(*result) = (int)available;
 }
 
 
@@ -346,9 +372,447 @@ YY_LOCAL(void) yySet(GREG *G, char *text, int count, yythunk *thunk, YY_XTYPE YY
 
 #define YYACCEPT        yyAccept(G, yythunkpos0)
 
-YY_RULE(int) yy_RawString(GREG *G); /* 343 */
-YY_RULE(int) yy_CriticString(GREG *G); /* 342 */
-YY_RULE(int) yy_DocForCritic(GREG *G); /* 341 */
+/* Bytes that end a run of NormalChar, and the extensions under which they
+	do (see the SpecialChar, ExtendedSpecialChar, Spacechar and Newline rules) */
+#define STOP_ALWAYS  1
+#define STOP_SMART   2
+#define STOP_NOTES   4
+#define STOP_CRITIC  8
+
+static const unsigned char normal_char_stop[256] = {
+	['*']  = STOP_ALWAYS, ['_']  = STOP_ALWAYS, ['`']  = STOP_ALWAYS, ['&']  = STOP_ALWAYS,
+	['[']  = STOP_ALWAYS, [']']  = STOP_ALWAYS, ['(']  = STOP_ALWAYS, [')']  = STOP_ALWAYS,
+	['<']  = STOP_ALWAYS, ['!']  = STOP_ALWAYS, ['#']  = STOP_ALWAYS, ['\\'] = STOP_ALWAYS,
+	['\''] = STOP_ALWAYS, ['"']  = STOP_ALWAYS, [' ']  = STOP_ALWAYS, ['\t'] = STOP_ALWAYS,
+	['\n'] = STOP_ALWAYS, ['\r'] = STOP_ALWAYS,
+	['.']  = STOP_SMART,  ['-']  = STOP_SMART,
+	['^']  = STOP_NOTES,
+	['{']  = STOP_CRITIC,
+};
+
+/* yyNormalCharStops -- the normal_char_stop bits in force for this parse */
+YY_LOCAL(unsigned char) yyNormalCharStops(GREG *G)
+{
+  int extensions = ((parser_data *)G->data)->extensions;
+  unsigned char stop = STOP_ALWAYS;
+
+  if (extensions & EXT_SMART)
+    stop |= STOP_SMART;
+  if (extensions & EXT_NOTES)
+    stop |= STOP_NOTES;
+  if (extensions & EXT_CRITIC)
+    stop |= STOP_CRITIC;
+  return stop;
+}
+
+/* yyNormalChars -- NormalChar*, consuming the whole run with a table
+	lookup per byte instead of a rule call per character.  Always succeeds. */
+YY_LOCAL(int) yyNormalChars(GREG *G)
+{
+  unsigned char stop = yyNormalCharStops(G);
+
+  for (;;)
+    {
+      while ((G->pos < G->limit) && !(normal_char_stop[(unsigned char)G->buf[G->pos]] & stop))
+        ++G->pos;
+      if ((G->pos < G->limit) || !yyrefill(G))
+        return 1;
+    }
+}
+
+/* yyLineClass -- the LINE_* classes of the line starting at the current
+	position, from the pre-pass over the input; LINE_ANY if not known */
+YY_LOCAL(unsigned int) yyLineClass(GREG *G)
+{
+  return line_class_at(((parser_data *)G->data)->lines, G->offset + G->pos);
+}
+
+/* yyByteAt -- the byte at buffer index i, reading more input as needed;
+	-1 past the end of the input */
+YY_LOCAL(int) yyByteAt(GREG *G, int i)
+{
+  while (i >= G->limit)
+    {
+      int pos= G->pos;
+      G->pos= G->limit;           /* yyrefill appends at pos */
+      if (!yyrefill(G))
+        {
+          G->pos= pos;
+          return -1;
+        }
+      G->pos= pos;
+    }
+  return (unsigned char)G->buf[i];
+}
+
+/* yyLabelOpens -- whether the '[' at buffer index i, taken by Inline as a
+	Symbol under EXT_LINEAR_INLINES, is one where the grammar would have
+	started the Label of a nested Link */
+YY_LOCAL(int) yyLabelOpens(GREG *G, int i)
+{
+  int c= yyByteAt(G, i + 1);
+
+  if ((c == -1) || (c == '['))
+    return 0;
+  return !(((c == '^') || (c == '#')) && ext(EXT_NOTES));
+}
+
+/* yySourceEnd -- buffer index where SourceContents starting at index i
+	ends.  The ends for the rest of the run of characters a source may
+	contain are worked out together (a '(' skips to just past its matching
+	')', an unmatched one ends the source, as does a ')' at the top level)
+	and kept for the next link that starts inside the same run. */
+YY_LOCAL(int) yySourceEnd(GREG *G, int i)
+{
+  link_scan *scan= ((parser_data *)G->data)->tails;
+  link_scan local= { NULL, NULL, 0, 0, 0, { NO_SCAN_END, NO_SCAN_END }, { NO_SCAN_END, NO_SCAN_END } };
+  size_t at= G->offset + i;
+  size_t end;
+  int run, c, k, depth;
+
+  if (scan == NULL)
+    scan= &local;
+  else if ((at >= scan->from) && (at < scan->from + scan->count))
+    return (int)(scan->source_end[at - scan->from] - G->offset);
+
+  for (run= i; ((c= yyByteAt(G, run)) != -1) && (c != ' ') && (c != '\t') && (c != '\n') && (c != '\r') && (c != '>'); ++run)
+    ;
+
+  if (scan->capacity < (size_t)(run - i + 1))
+    {
+      scan->capacity= run - i + 1;
+      scan->source_end= (size_t *)realloc(scan->source_end, sizeof(size_t) * scan->capacity);
+      scan->pending= (int *)realloc(scan->pending, sizeof(int) * scan->capacity);
+    }
+  scan->from= at;
+  scan->count= run - i + 1;
+
+  /* right to left, pairing each '(' with the nearest unmatched ')' */
+  scan->source_end[run - i]= G->offset + run;
+  for (depth= 0, k= run - i - 1; k >= 0; --k)
+    {
+      c= G->buf[i + k];
+      if (c == ')')
+        {
+          scan->source_end[k]= at + k;
+          scan->pending[depth++]= k;
+        }
+      else if (c == '(')
+        scan->source_end[k]= depth ? scan->source_end[scan->pending[--depth] + 1] : at + k;
+      else
+        scan->source_end[k]= scan->source_end[k + 1];
+    }
+
+  end= scan->source_end[0];
+  if (scan == &local)
+    free_link_scan(&local);
+  return (int)(end - G->offset);
+}
+
+/* yyTitleEnd -- buffer index of the quote q that closes a title starting
+	at index i (q followed by Sp and ')' or a Newline), or -1 if there is
+	none.  The answer holds for any later start up to the quote found. */
+YY_LOCAL(int) yyTitleEnd(GREG *G, int i, int q)
+{
+  link_scan *scan= ((parser_data *)G->data)->tails;
+  size_t at= G->offset + i;
+  int which= (q == '"');
+  int j, k, c;
+
+  if ((scan != NULL) && (scan->title_from[which] != NO_SCAN_END) && (at >= scan->title_from[which])
+      && ((scan->title_end[which] == NO_SCAN_END) || (at <= scan->title_end[which])))
+    return (scan->title_end[which] == NO_SCAN_END) ? -1 : (int)(scan->title_end[which] - G->offset);
+
+  for (j= i; (c= yyByteAt(G, j)) != -1; ++j)
+    {
+      if (c != q)
+        continue;
+      for (k= j + 1; ((c= yyByteAt(G, k)) == ' ') || (c == '\t'); ++k)
+        ;
+      if ((c == ')') || (c == '\n') || (c == '\r'))
+        break;
+    }
+
+  if (scan != NULL)
+    {
+      scan->title_from[which]= at;
+      scan->title_end[which]= (c == -1) ? NO_SCAN_END : G->offset + j;
+    }
+  return (c == -1) ? -1 : j;
+}
+
+/* yyNonspace -- whether byte c (-1 past the end) is a Nonspacechar */
+YY_LOCAL(int) yyNonspace(int c)
+{
+  return (c != -1) && (c != ' ') && (c != '\t') && (c != '\n') && (c != '\r');
+}
+
+/* yyBlankLines -- whether BlankLine BlankLine matches at buffer index j */
+YY_LOCAL(int) yyBlankLines(GREG *G, int j)
+{
+  int n, c;
+
+  for (n= 0; n < 2; n++)
+    {
+      while (((c= yyByteAt(G, j)) == ' ') || (c == '\t'))
+        ++j;
+      if (c == '\n')
+        ++j;
+      else if (c == '\r')
+        j+= (yyByteAt(G, j + 1) == '\n') ? 2 : 1;
+      else
+        return 0;
+    }
+  return 1;
+}
+
+/* yySpanStop -- 1 if the closer of a span of the given kind starts at
+	buffer index j, 2 if the span is cut off there, 0 if it goes on */
+YY_LOCAL(int) yySpanStop(GREG *G, int kind, int j)
+{
+  int c= yyByteAt(G, j);
+
+  switch (kind)
+    {
+    case SPAN_REFERENCE:
+    case SPAN_AUTOLINK:
+      if (c == ((kind == SPAN_REFERENCE) ? ']' : '>'))
+        return 1;
+      return ((c == '\n') || (c == '\r')) ? 2 : 0;
+    case SPAN_COMMENT:
+      return (c == '-') && (yyByteAt(G, j + 1) == '-') && (yyByteAt(G, j + 2) == '>');
+    case SPAN_MATH_PAREN:
+    case SPAN_MATH_BRACKET:
+      return (c == '\\') && (yyByteAt(G, j + 1) == '\\')
+        && (yyByteAt(G, j + 2) == ((kind == SPAN_MATH_PAREN) ? ')' : ']'));
+    case SPAN_DOLLAR:
+      if ((c != '\\') && (c != '$') && yyNonspace(c) && (yyByteAt(G, j + 1) == '$')
+          && !yyNonspace(yyByteAt(G, j + 2)))
+        return 1;
+      return yyBlankLines(G, j) ? 2 : 0;
+    case SPAN_DOUBLE_DOLLAR:
+      if ((c != '\\') && yyNonspace(c) && (yyByteAt(G, j + 1) == '$') && (yyByteAt(G, j + 2) == '$')
+          && !yyNonspace(yyByteAt(G, j + 3)))
+        return 1;
+      return yyBlankLines(G, j) ? 2 : 0;
+    }
+  return 2;
+}
+
+/* yySpanEnd -- buffer index where the closer of a span of the given kind,
+	whose contents start at index i, starts; -1 if the span is cut off or
+	the input ends first.  Whether a span stops at an index doesn't depend
+	on where it started, so the answer holds for any later start up to
+	where the scan stopped. */
+YY_LOCAL(int) yySpanEnd(GREG *G, int kind, int i)
+{
+  link_scan *scan= ((parser_data *)G->data)->tails;
+  size_t at= G->offset + i;
+  int j, stop;
+
+  if ((scan != NULL) && (scan->span_from[kind] != NO_SCAN_END) && (at >= scan->span_from[kind])
+      && ((scan->span_end[kind] == NO_SCAN_END) || (at <= scan->span_end[kind])))
+    {
+      if (scan->span_end[kind] == NO_SCAN_END)
+        return -1;
+      j= (int)(scan->span_end[kind] - G->offset);
+      return (yySpanStop(G, kind, j) == 1) ? j : -1;
+    }
+
+  for (j= i; !(stop= yySpanStop(G, kind, j)) && (yyByteAt(G, j) != -1); ++j)
+    ;
+
+  if (scan != NULL)
+    {
+      scan->span_from[kind]= at;
+      scan->span_end[kind]= stop ? G->offset + j : NO_SCAN_END;
+    }
+  return (stop == 1) ? j : -1;
+}
+
+/* Block-level HTML tag names (see HtmlBlockInTags and HtmlBlockType), found
+	with a perfect hash on the length and the first, second and last letters
+	of a name.  in_tags and type give the name's place in the ordered choice
+	of those rules, or -1 where that rule does not take it. */
+#define HTML_TAG_SLOTS    128
+#define HTML_TAG_LONGEST  10
+
+typedef struct {
+  const char *lower;
+  const char *upper;
+  int         len;
+  int         in_tags;
+  int         type;
+} html_block_tag;
+
+static const unsigned char html_tag_asso[256] = {
+	['1'] =  30, ['2'] =   9, ['3'] =   7, ['4'] =  92, ['5'] = 117, ['6'] = 106,
+	['a'] =  65, ['b'] =  90, ['c'] =  34, ['d'] =  91, ['e'] = 126, ['f'] =  59,
+	['g'] = 124, ['h'] =  55, ['i'] =  34, ['k'] =  13, ['l'] = 109, ['m'] = 117,
+	['n'] = 122, ['o'] =  43, ['p'] =  19, ['q'] =  43, ['r'] =  60, ['s'] =  70,
+	['t'] =  22, ['u'] =  48, ['v'] =  61, ['x'] = 116, ['y'] =  36,
+};
+static const html_block_tag html_block_tags[HTML_TAG_SLOTS] = {
+	[  2] = { "article",    "ARTICLE",     7,  1, -1 },
+	[  4] = { "script",     "SCRIPT",      6, 42, 34 },
+	[  6] = { "th",         "TH",          2, 39, 31 },
+	[  7] = { "ol",         "OL",          2, 24, 19 },
+	[  9] = { "dt",         "DT",          2, 33, 25 },
+	[ 10] = { "aside",      "ASIDE",       5,  2, -1 },
+	[ 12] = { "ul",         "UL",          2, 30, 23 },
+	[ 13] = { "h6",         "H6",          2, 20, 13 },
+	[ 15] = { "video",      "VIDEO",       5, 31, -1 },
+	[ 16] = { "tr",         "TR",          2, 41, 33 },
+	[ 19] = { "dd",         "DD",          2, 32, 24 },
+	[ 21] = { "frameset",   "FRAMESET",    8, 34, 26 },
+	[ 25] = { "tbody",      "TBODY",       5, 36, 28 },
+	[ 29] = { "progress",   "PROGRESS",    8, 27, -1 },
+	[ 35] = { "h5",         "H5",          2, 19, 12 },
+	[ 39] = { "menu",       "MENU",        4, 21, 16 },
+	[ 40] = { "footer",     "FOOTER",      6, 11, -1 },
+	[ 45] = { "thead",      "THEAD",       5, 40, 32 },
+	[ 47] = { "canvas",     "CANVAS",      6,  3, -1 },
+	[ 49] = { "hr",         "HR",          2, -1, 14 },
+	[ 51] = { "li",         "LI",          2, 35, 27 },
+	[ 55] = { "dl",         "DL",          2,  8,  5 },
+	[ 58] = { "p",          "P",           1, 25, 20 },
+	[ 60] = { "dir",        "DIR",         3,  6,  3 },
+	[ 61] = { "div",        "DIV",         3,  7,  4 },
+	[ 67] = { "noscript",   "NOSCRIPT",    8, 23, 18 },
+	[ 69] = { "section",    "SECTION",     7, 28, -1 },
+	[ 71] = { "h3",         "H3",          2, 17, 10 },
+	[ 75] = { "h2",         "H2",          2, 16,  9 },
+	[ 76] = { "hgroup",     "HGROUP",      6, 14, -1 },
+	[ 78] = { "td",         "TD",          2, 37, 29 },
+	[ 79] = { "blockquote", "BLOCKQUOTE", 10,  4,  1 },
+	[ 80] = { "pre",        "PRE",         3, 26, 21 },
+	[ 90] = { "table",      "TABLE",       5, 29, 22 },
+	[ 95] = { "form",       "FORM",        4, 12,  7 },
+	[ 97] = { "figure",     "FIGURE",      6, 10, -1 },
+	[ 98] = { "center",     "CENTER",      6,  5,  2 },
+	[ 99] = { "isindex",    "ISINDEX",     7, -1, 15 },
+	[105] = { "address",    "ADDRESS",     7,  0,  0 },
+	[108] = { "tfoot",      "TFOOT",       5, 38, 30 },
+	[113] = { "h4",         "H4",          2, 18, 11 },
+	[115] = { "noframes",   "NOFRAMES",    8, 22, 17 },
+	[117] = { "h1",         "H1",          2, 15,  8 },
+	[119] = { "header",     "HEADER",      6, 13, -1 },
+	[123] = { "fieldset",   "FIELDSET",    8,  9,  6 },
+};
+
+#define HTML_TAG_SCRIPT   (&html_block_tags[4])
+
+/* yyHtmlTagName -- the length of the run of ASCII letters and digits at the
+	current position, looking no further than one past the longest tag */
+YY_LOCAL(int) yyHtmlTagName(GREG *G)
+{
+  int len, c;
+
+  for (len= 0; len <= HTML_TAG_LONGEST; ++len)
+    {
+      c= yyByteAt(G, G->pos + len);
+      if (!(((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >= '0') && (c <= '9'))))
+        break;
+    }
+  return len;
+}
+
+/* yyHtmlTag -- the tag spelled by the len bytes at the current position,
+	all in lower or all in upper case as the grammar has them; NULL if
+	there is none.  The bytes must already be in the buffer. */
+YY_LOCAL(const html_block_tag *) yyHtmlTag(GREG *G, int len)
+{
+  const unsigned char *s= (const unsigned char *)G->buf + G->pos;
+  const html_block_tag *tag;
+
+  if ((len < 1) || (len > HTML_TAG_LONGEST))
+    return NULL;
+  tag= &html_block_tags[(len + html_tag_asso[s[0] | 0x20] + html_tag_asso[s[len > 1] | 0x20]
+                         + html_tag_asso[s[len - 1] | 0x20]) % HTML_TAG_SLOTS];
+  if ((tag->len != len) || ((memcmp(s, tag->lower, len) != 0) && (memcmp(s, tag->upper, len) != 0)))
+    return NULL;
+  return tag;
+}
+
+/* yyHtmlTagAfter -- of the tags spelled by a prefix of the run bytes of
+	name at the current position, the first after `after' in the order of
+	HtmlBlockInTags (when in_tags is set) or of HtmlBlockType */
+YY_LOCAL(const html_block_tag *) yyHtmlTagAfter(GREG *G, int run, int in_tags, int after)
+{
+  const html_block_tag *tag, *best= NULL;
+  int len, order;
+
+  for (len= 1; len <= run; ++len)
+    if ((tag= yyHtmlTag(G, len)) != NULL)
+      {
+        order= in_tags ? tag->in_tags : tag->type;
+        if ((order > after) && ((best == NULL) || (order < (in_tags ? best->in_tags : best->type))))
+          best= tag;
+      }
+  return best;
+}
+
+/* yyHtmlScanEntry -- the entry for the block of tag opened at offset at, or
+	the unused entry where it would go */
+YY_LOCAL(html_scan_entry *) yyHtmlScanEntry(html_scan *scan, size_t at, int tag)
+{
+  size_t mask= scan->capacity - 1;
+  size_t i= (at * 31 + tag) & mask;
+
+  while ((scan->entries[i].tag != -1) && ((scan->entries[i].at != at) || (scan->entries[i].tag != tag)))
+    i= (i + 1) & mask;
+  return &scan->entries[i];
+}
+
+/* yyHtmlScanSet -- remember where the block of tag opened at offset at ends */
+YY_LOCAL(void) yyHtmlScanSet(html_scan *scan, size_t at, int tag, size_t end)
+{
+  html_scan_entry *old= scan->entries, *e;
+  size_t capacity= scan->capacity, i;
+
+  if (2 * (scan->count + 1) > scan->capacity)
+    {
+      scan->capacity= capacity ? 2 * capacity : 64;
+      scan->entries= (html_scan_entry *)malloc(sizeof(html_scan_entry) * scan->capacity);
+      scan->count= 0;
+      for (i= 0; i < scan->capacity; ++i)
+        scan->entries[i].tag= -1;
+      for (i= 0; i < capacity; ++i)
+        if (old[i].tag != -1)
+          {
+            *yyHtmlScanEntry(scan, old[i].at, old[i].tag)= old[i];
+            ++scan->count;
+          }
+      free(old);
+    }
+  e= yyHtmlScanEntry(scan, at, tag);
+  if (e->tag == -1)
+    ++scan->count;
+  e->at= at;
+  e->end= end;
+  e->tag= tag;
+}
+
+/* yyHtmlScanPrune -- forget the blocks opened before offset before, which a
+	parse that has committed the input up to there can't ask about again */
+YY_LOCAL(void) yyHtmlScanPrune(html_scan *scan, size_t before)
+{
+  html_scan_entry *old= scan->entries;
+  size_t i;
+
+  scan->entries= (html_scan_entry *)malloc(sizeof(html_scan_entry) * scan->capacity);
+  scan->count= 0;
+  for (i= 0; i < scan->capacity; ++i)
+    scan->entries[i].tag= -1;
+  for (i= 0; i < scan->capacity; ++i)
+    if ((old[i].tag != -1) && (old[i].at >= before))
+      {
+        *yyHtmlScanEntry(scan, old[i].at, old[i].tag)= old[i];
+        ++scan->count;
+      }
+  free(old);
+}
+
 YY_RULE(int) yy_CriticSubstAdd(GREG *G); /* 340 */
 YY_RULE(int) yy_CriticSubstDel(GREG *G); /* 339 */
 YY_RULE(int) yy_CriticComment(GREG *G); /* 338 */
@@ -390,134 +854,6 @@ YY_RULE(int) yy_StyleOpen(GREG *G); /* 303 */
 YY_RULE(int) yy_HtmlBlockType(GREG *G); /* 302 */
 YY_RULE(int) yy_MarkdownHtmlAttribute(GREG *G); /* 301 */
 YY_RULE(int) yy_HtmlBlockSelfClosing(GREG *G); /* 300 */
-YY_RULE(int) yy_HtmlBlockCloseScript(GREG *G); /* 299 */
-YY_RULE(int) yy_HtmlBlockOpenScript(GREG *G); /* 298 */
-YY_RULE(int) yy_HtmlBlockTr(GREG *G); /* 297 */
-YY_RULE(int) yy_HtmlBlockCloseTr(GREG *G); /* 296 */
-YY_RULE(int) yy_HtmlBlockOpenTr(GREG *G); /* 295 */
-YY_RULE(int) yy_HtmlBlockThead(GREG *G); /* 294 */
-YY_RULE(int) yy_HtmlBlockCloseThead(GREG *G); /* 293 */
-YY_RULE(int) yy_HtmlBlockOpenThead(GREG *G); /* 292 */
-YY_RULE(int) yy_HtmlBlockTh(GREG *G); /* 291 */
-YY_RULE(int) yy_HtmlBlockCloseTh(GREG *G); /* 290 */
-YY_RULE(int) yy_HtmlBlockOpenTh(GREG *G); /* 289 */
-YY_RULE(int) yy_HtmlBlockTfoot(GREG *G); /* 288 */
-YY_RULE(int) yy_HtmlBlockCloseTfoot(GREG *G); /* 287 */
-YY_RULE(int) yy_HtmlBlockOpenTfoot(GREG *G); /* 286 */
-YY_RULE(int) yy_HtmlBlockTd(GREG *G); /* 285 */
-YY_RULE(int) yy_HtmlBlockCloseTd(GREG *G); /* 284 */
-YY_RULE(int) yy_HtmlBlockOpenTd(GREG *G); /* 283 */
-YY_RULE(int) yy_HtmlBlockTbody(GREG *G); /* 282 */
-YY_RULE(int) yy_HtmlBlockCloseTbody(GREG *G); /* 281 */
-YY_RULE(int) yy_HtmlBlockOpenTbody(GREG *G); /* 280 */
-YY_RULE(int) yy_HtmlBlockLi(GREG *G); /* 279 */
-YY_RULE(int) yy_HtmlBlockCloseLi(GREG *G); /* 278 */
-YY_RULE(int) yy_HtmlBlockOpenLi(GREG *G); /* 277 */
-YY_RULE(int) yy_HtmlBlockFrameset(GREG *G); /* 276 */
-YY_RULE(int) yy_HtmlBlockCloseFrameset(GREG *G); /* 275 */
-YY_RULE(int) yy_HtmlBlockOpenFrameset(GREG *G); /* 274 */
-YY_RULE(int) yy_HtmlBlockDt(GREG *G); /* 273 */
-YY_RULE(int) yy_HtmlBlockCloseDt(GREG *G); /* 272 */
-YY_RULE(int) yy_HtmlBlockOpenDt(GREG *G); /* 271 */
-YY_RULE(int) yy_HtmlBlockDd(GREG *G); /* 270 */
-YY_RULE(int) yy_HtmlBlockCloseDd(GREG *G); /* 269 */
-YY_RULE(int) yy_HtmlBlockOpenDd(GREG *G); /* 268 */
-YY_RULE(int) yy_HtmlBlockVideo(GREG *G); /* 267 */
-YY_RULE(int) yy_HtmlBlockCloseVideo(GREG *G); /* 266 */
-YY_RULE(int) yy_HtmlBlockOpenVideo(GREG *G); /* 265 */
-YY_RULE(int) yy_HtmlBlockUl(GREG *G); /* 264 */
-YY_RULE(int) yy_HtmlBlockCloseUl(GREG *G); /* 263 */
-YY_RULE(int) yy_HtmlBlockOpenUl(GREG *G); /* 262 */
-YY_RULE(int) yy_HtmlBlockTable(GREG *G); /* 261 */
-YY_RULE(int) yy_HtmlBlockCloseTable(GREG *G); /* 260 */
-YY_RULE(int) yy_HtmlBlockOpenTable(GREG *G); /* 259 */
-YY_RULE(int) yy_HtmlBlockSection(GREG *G); /* 258 */
-YY_RULE(int) yy_HtmlBlockCloseSection(GREG *G); /* 257 */
-YY_RULE(int) yy_HtmlBlockOpenSection(GREG *G); /* 256 */
-YY_RULE(int) yy_HtmlBlockProgress(GREG *G); /* 255 */
-YY_RULE(int) yy_HtmlBlockCloseProgress(GREG *G); /* 254 */
-YY_RULE(int) yy_HtmlBlockOpenProgress(GREG *G); /* 253 */
-YY_RULE(int) yy_HtmlBlockPre(GREG *G); /* 252 */
-YY_RULE(int) yy_HtmlBlockClosePre(GREG *G); /* 251 */
-YY_RULE(int) yy_HtmlBlockOpenPre(GREG *G); /* 250 */
-YY_RULE(int) yy_HtmlBlockP(GREG *G); /* 249 */
-YY_RULE(int) yy_HtmlBlockCloseP(GREG *G); /* 248 */
-YY_RULE(int) yy_HtmlBlockOpenP(GREG *G); /* 247 */
-YY_RULE(int) yy_HtmlBlockOl(GREG *G); /* 246 */
-YY_RULE(int) yy_HtmlBlockCloseOl(GREG *G); /* 245 */
-YY_RULE(int) yy_HtmlBlockOpenOl(GREG *G); /* 244 */
-YY_RULE(int) yy_HtmlBlockNoscript(GREG *G); /* 243 */
-YY_RULE(int) yy_HtmlBlockCloseNoscript(GREG *G); /* 242 */
-YY_RULE(int) yy_HtmlBlockOpenNoscript(GREG *G); /* 241 */
-YY_RULE(int) yy_HtmlBlockNoframes(GREG *G); /* 240 */
-YY_RULE(int) yy_HtmlBlockCloseNoframes(GREG *G); /* 239 */
-YY_RULE(int) yy_HtmlBlockOpenNoframes(GREG *G); /* 238 */
-YY_RULE(int) yy_HtmlBlockMenu(GREG *G); /* 237 */
-YY_RULE(int) yy_HtmlBlockCloseMenu(GREG *G); /* 236 */
-YY_RULE(int) yy_HtmlBlockOpenMenu(GREG *G); /* 235 */
-YY_RULE(int) yy_HtmlBlockH6(GREG *G); /* 234 */
-YY_RULE(int) yy_HtmlBlockCloseH6(GREG *G); /* 233 */
-YY_RULE(int) yy_HtmlBlockOpenH6(GREG *G); /* 232 */
-YY_RULE(int) yy_HtmlBlockH5(GREG *G); /* 231 */
-YY_RULE(int) yy_HtmlBlockCloseH5(GREG *G); /* 230 */
-YY_RULE(int) yy_HtmlBlockOpenH5(GREG *G); /* 229 */
-YY_RULE(int) yy_HtmlBlockH4(GREG *G); /* 228 */
-YY_RULE(int) yy_HtmlBlockCloseH4(GREG *G); /* 227 */
-YY_RULE(int) yy_HtmlBlockOpenH4(GREG *G); /* 226 */
-YY_RULE(int) yy_HtmlBlockH3(GREG *G); /* 225 */
-YY_RULE(int) yy_HtmlBlockCloseH3(GREG *G); /* 224 */
-YY_RULE(int) yy_HtmlBlockOpenH3(GREG *G); /* 223 */
-YY_RULE(int) yy_HtmlBlockH2(GREG *G); /* 222 */
-YY_RULE(int) yy_HtmlBlockCloseH2(GREG *G); /* 221 */
-YY_RULE(int) yy_HtmlBlockOpenH2(GREG *G); /* 220 */
-YY_RULE(int) yy_HtmlBlockH1(GREG *G); /* 219 */
-YY_RULE(int) yy_HtmlBlockCloseH1(GREG *G); /* 218 */
-YY_RULE(int) yy_HtmlBlockOpenH1(GREG *G); /* 217 */
-YY_RULE(int) yy_HtmlBlockHgroup(GREG *G); /* 216 */
-YY_RULE(int) yy_HtmlBlockCloseHgroup(GREG *G); /* 215 */
-YY_RULE(int) yy_HtmlBlockOpenHgroup(GREG *G); /* 214 */
-YY_RULE(int) yy_HtmlBlockHeader(GREG *G); /* 213 */
-YY_RULE(int) yy_HtmlBlockCloseHeader(GREG *G); /* 212 */
-YY_RULE(int) yy_HtmlBlockOpenHeader(GREG *G); /* 211 */
-YY_RULE(int) yy_HtmlBlockForm(GREG *G); /* 210 */
-YY_RULE(int) yy_HtmlBlockCloseForm(GREG *G); /* 209 */
-YY_RULE(int) yy_HtmlBlockOpenForm(GREG *G); /* 208 */
-YY_RULE(int) yy_HtmlBlockFooter(GREG *G); /* 207 */
-YY_RULE(int) yy_HtmlBlockCloseFooter(GREG *G); /* 206 */
-YY_RULE(int) yy_HtmlBlockOpenFooter(GREG *G); /* 205 */
-YY_RULE(int) yy_HtmlBlockFigure(GREG *G); /* 204 */
-YY_RULE(int) yy_HtmlBlockCloseFigure(GREG *G); /* 203 */
-YY_RULE(int) yy_HtmlBlockOpenFigure(GREG *G); /* 202 */
-YY_RULE(int) yy_HtmlBlockFieldset(GREG *G); /* 201 */
-YY_RULE(int) yy_HtmlBlockCloseFieldset(GREG *G); /* 200 */
-YY_RULE(int) yy_HtmlBlockOpenFieldset(GREG *G); /* 199 */
-YY_RULE(int) yy_HtmlBlockDl(GREG *G); /* 198 */
-YY_RULE(int) yy_HtmlBlockCloseDl(GREG *G); /* 197 */
-YY_RULE(int) yy_HtmlBlockOpenDl(GREG *G); /* 196 */
-YY_RULE(int) yy_HtmlBlockDiv(GREG *G); /* 195 */
-YY_RULE(int) yy_HtmlBlockCloseDiv(GREG *G); /* 194 */
-YY_RULE(int) yy_HtmlBlockOpenDiv(GREG *G); /* 193 */
-YY_RULE(int) yy_HtmlBlockDir(GREG *G); /* 192 */
-YY_RULE(int) yy_HtmlBlockCloseDir(GREG *G); /* 191 */
-YY_RULE(int) yy_HtmlBlockOpenDir(GREG *G); /* 190 */
-YY_RULE(int) yy_HtmlBlockCenter(GREG *G); /* 189 */
-YY_RULE(int) yy_HtmlBlockCloseCenter(GREG *G); /* 188 */
-YY_RULE(int) yy_HtmlBlockOpenCenter(GREG *G); /* 187 */
-YY_RULE(int) yy_HtmlBlockCanvas(GREG *G); /* 186 */
-YY_RULE(int) yy_HtmlBlockCloseCanvas(GREG *G); /* 185 */
-YY_RULE(int) yy_HtmlBlockOpenCanvas(GREG *G); /* 184 */
-YY_RULE(int) yy_HtmlBlockBlockquote(GREG *G); /* 183 */
-YY_RULE(int) yy_HtmlBlockCloseBlockquote(GREG *G); /* 182 */
-YY_RULE(int) yy_HtmlBlockOpenBlockquote(GREG *G); /* 181 */
-YY_RULE(int) yy_HtmlBlockAside(GREG *G); /* 180 */
-YY_RULE(int) yy_HtmlBlockCloseAside(GREG *G); /* 179 */
-YY_RULE(int) yy_HtmlBlockOpenAside(GREG *G); /* 178 */
-YY_RULE(int) yy_HtmlBlockArticle(GREG *G); /* 177 */
-YY_RULE(int) yy_HtmlBlockCloseArticle(GREG *G); /* 176 */
-YY_RULE(int) yy_HtmlBlockOpenArticle(GREG *G); /* 175 */
-YY_RULE(int) yy_HtmlBlockAddress(GREG *G); /* 174 */
-YY_RULE(int) yy_HtmlBlockCloseAddress(GREG *G); /* 173 */
-YY_RULE(int) yy_HtmlBlockOpenAddress(GREG *G); /* 172 */
 YY_RULE(int) yy_ListBlockLine(GREG *G); /* 171 */
 YY_RULE(int) yy_ListContinuationBlock(GREG *G); /* 170 */
 YY_RULE(int) yy_ListBlock(GREG *G); /* 169 */
@@ -690,49 +1026,6 @@ YY_RULE(int) yy_StartList(GREG *G); /* 3 */
 YY_RULE(int) yy_BOM(GREG *G); /* 2 */
 YY_RULE(int) yy_Doc(GREG *G); /* 1 */
 
-YY_ACTION(void) yy_1_RawString(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
-{
-  yyprintf((stderr, "do yy_1_RawString"));
-  yyprintfvTcontext(yytext);
-  yyprintf((stderr, "\n  {yy = str(yytext); }\n"));
-  yy = str(yytext); ;
-}
-YY_ACTION(void) yy_4_DocForCritic(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
-{
-#define a G->val[-1]
-  yyprintf((stderr, "do yy_4_DocForCritic"));
-  yyprintfvTcontext(yytext);
-  yyprintf((stderr, "\n  {((parser_data *)G->data)->result = reverse_list(a); }\n"));
-  ((parser_data *)G->data)->result = reverse_list(a); ;
-#undef a
-}
-YY_ACTION(void) yy_3_DocForCritic(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
-{
-#define a G->val[-1]
-  yyprintf((stderr, "do yy_3_DocForCritic"));
-  yyprintfvTcontext(yytext);
-  yyprintf((stderr, "\n  {a = cons(yy, a); }\n"));
-  a = cons(yy, a); ;
-#undef a
-}
-YY_ACTION(void) yy_2_DocForCritic(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
-{
-#define a G->val[-1]
-  yyprintf((stderr, "do yy_2_DocForCritic"));
-  yyprintfvTcontext(yytext);
-  yyprintf((stderr, "\n  {a = cons(yy, a); }\n"));
-  a = cons(yy, a); ;
-#undef a
-}
-YY_ACTION(void) yy_1_DocForCritic(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
-{
-#define a G->val[-1]
-  yyprintf((stderr, "do yy_1_DocForCritic"));
-  yyprintfvTcontext(yytext);
-  yyprintf((stderr, "\n  {a = cons(yy, a); }\n"));
-  a = cons(yy, a); ;
-#undef a
-}
 YY_ACTION(void) yy_1_CriticComment(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
 {
   yyprintf((stderr, "do yy_1_CriticComment"));
@@ -2104,6 +2397,8 @@ YY_ACTION(void) yy_2_LinkReference(GREG *G, char *yytext, int yyleng, yythunk *t
 \t\t\t/* Get label for referencing */\n\
 \t\t\tGString *text = g_string_new(\"\");\n\
 \t\t\tchar *clean;\n\
+\t\t\tif (ext(EXT_LINEAR_INLINES))\n\
+\t\t\t\tl->children = resolve_inline_delimiters(l->children, ((parser_data *)G->data)->extensions);\n\
 \t\t\tprint_raw_node_tree(text, l->children);\n\
 \t\t\tclean = clean_string(text->str);\n\
 \t\t\t\n\
@@ -2124,6 +2419,8 @@ YY_ACTION(void) yy_2_LinkReference(GREG *G, char *yytext, int yyleng, yythunk *t
 			/* Get label for referencing */
 			GString *text = g_string_new("");
 			char *clean;
+			if (ext(EXT_LINEAR_INLINES))
+				l->children = resolve_inline_delimiters(l->children, ((parser_data *)G->data)->extensions);
 			print_raw_node_tree(text, l->children);
 			clean = clean_string(text->str);
 			
@@ -2202,6 +2499,29 @@ YY_ACTION(void) yy_1_Source(GREG *G, char *yytext, int yyleng, yythunk *thunk, Y
   yyprintf((stderr, "\n  {yy = str(yytext); yy->key = SOURCE; }\n"));
   yy = str(yytext); yy->key = SOURCE; ;
 }
+YY_ACTION(void) yy_1_LinkTail(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+#define t G->val[-1]
+#define s G->val[-2]
+  yyprintf((stderr, "do yy_1_LinkTail"));
+  yyprintfvTcontext(yytext);
+  yyprintf((stderr, "\n  {\n\
+\t\tyy = str(yytext);\n\
+\t\tyy->key = DELIMITER;\n\
+\t\tyy->link_data = mk_link_data(NULL, s->str, t->str, NULL);\n\
+\t\tfree_node_tree(s);\n\
+\t\tfree_node_tree(t);\n\
+\t}\n"));
+
+		yy = str(yytext);
+		yy->key = DELIMITER;
+		yy->link_data = mk_link_data(NULL, s->str, t->str, NULL);
+		free_node_tree(s);
+		free_node_tree(t);
+	;
+#undef t
+#undef s
+}
 YY_ACTION(void) yy_1_ExplicitLink(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
 {
 #define t G->val[-1]
@@ -2621,8 +2941,16 @@ YY_ACTION(void) yy_1_Symbol(GREG *G, char *yytext, int yyleng, yythunk *thunk, Y
 {
   yyprintf((stderr, "do yy_1_Symbol"));
   yyprintfvTcontext(yytext);
-  yyprintf((stderr, "\n  {yy = str(yytext); }\n"));
-  yy = str(yytext); ;
+  yyprintf((stderr, "\n  {\n\
+\t\tyy = str(yytext);\n\
+\t\tif (ext(EXT_LINEAR_INLINES) && is_inline_delimiter(yytext[0], ((parser_data *)G->data)->extensions))\n\
+\t\t\tyy->key = DELIMITER;\n\
+\t}\n"));
+
+		yy = str(yytext);
+		if (ext(EXT_LINEAR_INLINES) && is_inline_delimiter(yytext[0], ((parser_data *)G->data)->extensions))
+			yy->key = DELIMITER;
+	;
 }
 YY_ACTION(void) yy_1_RawHtml(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
 {
@@ -2995,109 +3323,6 @@ YY_ACTION(void) yy_1_Doc(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_X
 #undef a
 }
 
-YY_RULE(int) yy_RawString(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RawString"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1;
-  {  int yypos4= G->pos, yythunkpos4= G->thunkpos;
-  {  int yypos5= G->pos, yythunkpos5= G->thunkpos;  if (!yymatchString(G, "{++")) goto l6;
-  goto l5;
-  l6:;	  G->pos= yypos5; G->thunkpos= yythunkpos5;  if (!yymatchString(G, "{--")) goto l7;
-  goto l5;
-  l7:;	  G->pos= yypos5; G->thunkpos= yythunkpos5;  if (!yymatchString(G, "{~~")) goto l8;
-  goto l5;
-  l8:;	  G->pos= yypos5; G->thunkpos= yythunkpos5;  if (!yymatchString(G, "{==")) goto l9;
-  goto l5;
-  l9:;	  G->pos= yypos5; G->thunkpos= yythunkpos5;  if (!yymatchString(G, "{>>")) goto l4;
-
-  }
-  l5:;	  goto l1;
-  l4:;	  G->pos= yypos4; G->thunkpos= yythunkpos4;
-  }  if (!yymatchDot(G)) goto l1;
-  l2:;	
-  {  int yypos3= G->pos, yythunkpos3= G->thunkpos;
-  {  int yypos10= G->pos, yythunkpos10= G->thunkpos;
-  {  int yypos11= G->pos, yythunkpos11= G->thunkpos;  if (!yymatchString(G, "{++")) goto l12;
-  goto l11;
-  l12:;	  G->pos= yypos11; G->thunkpos= yythunkpos11;  if (!yymatchString(G, "{--")) goto l13;
-  goto l11;
-  l13:;	  G->pos= yypos11; G->thunkpos= yythunkpos11;  if (!yymatchString(G, "{~~")) goto l14;
-  goto l11;
-  l14:;	  G->pos= yypos11; G->thunkpos= yythunkpos11;  if (!yymatchString(G, "{==")) goto l15;
-  goto l11;
-  l15:;	  G->pos= yypos11; G->thunkpos= yythunkpos11;  if (!yymatchString(G, "{>>")) goto l10;
-
-  }
-  l11:;	  goto l3;
-  l10:;	  G->pos= yypos10; G->thunkpos= yythunkpos10;
-  }  if (!yymatchDot(G)) goto l3;  goto l2;
-  l3:;	  G->pos= yypos3; G->thunkpos= yythunkpos3;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1;  yyDo(G, yy_1_RawString, G->begin, G->end, "yy_1_RawString");
-  yyprintf((stderr, "  ok   RawString"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RawString"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_CriticString(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "CriticString"));
-  if (!yy_CriticMarkup(G))  goto l16;
-  yyprintf((stderr, "  ok   CriticString"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l16:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "CriticString"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_DocForCritic(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "DocForCritic"));
-
-  {  int yypos18= G->pos, yythunkpos18= G->thunkpos;  if (!yy_BOM(G))  goto l18;
-  goto l19;
-  l18:;	  G->pos= yypos18; G->thunkpos= yythunkpos18;
-  }
-  l19:;	  if (!yy_StartList(G))  goto l17;
-  yyDo(G, yySet, -1, 0, "yySet");
-
-  l20:;	
-  {  int yypos21= G->pos, yythunkpos21= G->thunkpos;
-  {  int yypos22= G->pos, yythunkpos22= G->thunkpos;  if (!yy_CriticString(G))  goto l23;
-  yyDo(G, yy_1_DocForCritic, G->begin, G->end, "yy_1_DocForCritic");
-  goto l22;
-  l23:;	  G->pos= yypos22; G->thunkpos= yythunkpos22;  if (!yy_RawString(G))  goto l21;
-  yyDo(G, yy_2_DocForCritic, G->begin, G->end, "yy_2_DocForCritic");
-
-  }
-  l22:;	  goto l20;
-  l21:;	  G->pos= yypos21; G->thunkpos= yythunkpos21;
-  }
-  l24:;	
-  {  int yypos25= G->pos, yythunkpos25= G->thunkpos;  if (!yy_RawString(G))  goto l25;
-  yyDo(G, yy_3_DocForCritic, G->begin, G->end, "yy_3_DocForCritic");
-  goto l24;
-  l25:;	  G->pos= yypos25; G->thunkpos= yythunkpos25;
-  }  if (!yy_Eof(G))  goto l17;
-  yyDo(G, yy_4_DocForCritic, G->begin, G->end, "yy_4_DocForCritic");
-  yyprintf((stderr, "  ok   DocForCritic"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
-  return 1;
-  l17:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DocForCritic"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
 YY_RULE(int) yy_CriticSubstAdd(GREG *G)
 {  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "CriticSubstAdd"));
   yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l26;
@@ -4062,6 +4287,134 @@ YY_RULE(int) yy_TableLine(GREG *G)
 
   return 0;
 }
+/* Table rows whose cells hold nothing but plain words are built in one
+	step instead of through TableCell.  The rules would give such a row a
+	TABLECELL per cell, holding a STR per run of NormalChar (CellStr) with a
+	SPACE between words (Space); with smart typography a lone '.' or '-'
+	inside a word is a Symbol of its own, or an ENDASH before a digit.  Rows
+	with anything else in them, empty or spanning cells, or spaces before
+	the newline after an open last cell (which Space or Endline takes
+	depending on the next line) are left to the rules. */
+YY_ACTION(void) yyTablePlainRow(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  char *p= yytext, *end= yytext + yyleng, *word, *after, save;
+  int smart= ext(EXT_SMART);
+  node *cells= NULL, *words;
+  yyprintf((stderr, "do yyTablePlainRow"));
+  yyprintfvTcontext(yytext);
+  yyprintf((stderr, "\n"));
+  if (*p == '|')
+    ++p;
+  for (;;)
+    {
+      while ((p < end) && ((*p == ' ') || (*p == '\t')))
+        ++p;
+      if (p == end)
+        break;
+      for (words= NULL;;)
+        {
+          if (smart && ((*p == '.') || (*p == '-')))
+            {
+              words= cons(str((*p == '.') ? "." : "-"), words);
+              if ((*p == '-') && (p[1] >= '0') && (p[1] <= '9'))
+                words->key= ENDASH;
+              ++p;
+            }
+          else
+            {
+              for (word= p; (p < end) && (*p != ' ') && (*p != '\t') && (*p != '|')
+                   && !(smart && ((*p == '.') || (*p == '-'))); ++p)
+                ;
+              save= *p;
+              *p= '\0';
+              words= cons(str(word), words);
+              *p= save;
+            }
+          for (after= p; (after < end) && ((*after == ' ') || (*after == '\t')); ++after)
+            ;
+          if ((after == end) || (*after == '|'))
+            break;
+          if (after > p)
+            {
+              words= cons(str(" "), words);
+              words->key= SPACE;
+            }
+          p= after;
+        }
+      cells= cons(list(TABLECELL, words), cells);
+      p= (after == end) ? end : after + 1;
+    }
+  yy= list(TABLEROW, cells);
+}
+
+/* yyTablePlainByte -- whether yyTablePlainRow takes the byte at buffer
+	index i (there is a newline somewhere after it) as part of a word */
+YY_LOCAL(int) yyTablePlainByte(GREG *G, int i, unsigned char stop)
+{
+  unsigned char c= G->buf[i];
+
+  if (c == '|')
+    return 0;
+  if (!(normal_char_stop[c] & stop))
+    return 1;
+  if (c == '.')                 /* not the start of an Ellipsis */
+    return (G->buf[i + 1] != '.') && ((G->buf[i + 1] != ' ') || (G->buf[i + 2] != '.'));
+  if (c == '-')                 /* not the start of an EmDash or EnDash "--" */
+    return G->buf[i + 1] != '-';
+  return 0;
+}
+
+/* yyTablePlainRowEnd -- buffer index of the newline ending the row at the
+	current position if yyTablePlainRow can build it, otherwise -1 */
+YY_LOCAL(int) yyTablePlainRowEnd(GREG *G)
+{
+  unsigned char stop= yyNormalCharStops(G);
+  int from= G->pos, i, cells= 0, dividers= 0, last;
+
+  while (!memchr(G->buf + from, '\n', G->limit - from))
+    {
+      from= G->limit;
+      if (yyByteAt(G, from) == -1)
+        return -1;
+    }
+
+  i= G->pos;
+  if (G->buf[i] == '|')
+    ++i, ++dividers;
+  for (;;)
+    {
+      while ((G->buf[i] == ' ') || (G->buf[i] == '\t'))
+        ++i;
+      if (G->buf[i] == '\n')
+        return (cells && dividers) ? i : -1;     /* TableLine wants a '|' */
+      if (!yyTablePlainByte(G, i, stop))
+        return -1;
+      for (;;)
+        {
+          while (yyTablePlainByte(G, i, stop))
+            ++i;
+          for (last= i; (G->buf[i] == ' ') || (G->buf[i] == '\t'); ++i)
+            ;
+          if (G->buf[i] == '|')
+            {
+              if (G->buf[++i] == '|')
+                return -1;
+              ++dividers;
+              break;
+            }
+          if (G->buf[i] == '\n')
+            {
+              if (i > last)
+                return -1;
+              break;
+            }
+          if ((i == last) || !yyTablePlainByte(G, i, stop))
+            return -1;
+        }
+      ++cells;
+    }
+}
+
 YY_RULE(int) yy_TableRow(GREG *G)
 {  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
   yyprintfv((stderr, "%s\n", "TableRow"));
@@ -4072,6 +4425,11 @@ YY_RULE(int) yy_TableRow(GREG *G)
   goto l216;
   l217:;	  G->pos= yypos217; G->thunkpos= yythunkpos217;
   }
+  {  int yyend= yyTablePlainRowEnd(G);  if (yyend < 0) goto l2246;
+  G->begin= G->pos;  G->end= yyend;  G->pos= yyend + 1;  yyDo(G, yyTablePlainRow, G->begin, G->end, "yyTablePlainRow");
+  goto l2247;
+  }
+  l2246:;	
   {  int yypos218= G->pos, yythunkpos218= G->thunkpos;  if (!yy_TableLine(G))  goto l216;
   G->pos= yypos218; G->thunkpos= yythunkpos218;
   }
@@ -4090,7 +4448,8 @@ YY_RULE(int) yy_TableRow(GREG *G)
   }  if (!yy_Sp(G))  goto l216;
   yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l216;  if (!yy_Newline(G))  goto l216;
   yyText(G, G->begin, G->end);  if (!(YY_END)) goto l216;  yyDo(G, yy_2_TableRow, G->begin, G->end, "yy_2_TableRow");
-  yyprintf((stderr, "  ok   TableRow"));
+
+  l2247:;	  yyprintf((stderr, "  ok   TableRow"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
   yyDo(G, yyPop, 1, 0, "yyPop");
@@ -4265,150 +4624,10 @@ YY_RULE(int) yy_StyleOpen(GREG *G)
   return 0;
 }
 YY_RULE(int) yy_HtmlBlockType(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockType"));
-
-  {  int yypos248= G->pos, yythunkpos248= G->thunkpos;  if (!yymatchString(G, "address")) goto l249;
-  goto l248;
-  l249:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "blockquote")) goto l250;
-  goto l248;
-  l250:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "center")) goto l251;
-  goto l248;
-  l251:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "dir")) goto l252;
-  goto l248;
-  l252:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "div")) goto l253;
-  goto l248;
-  l253:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "dl")) goto l254;
-  goto l248;
-  l254:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "fieldset")) goto l255;
-  goto l248;
-  l255:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "form")) goto l256;
-  goto l248;
-  l256:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "h1")) goto l257;
-  goto l248;
-  l257:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "h2")) goto l258;
-  goto l248;
-  l258:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "h3")) goto l259;
-  goto l248;
-  l259:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "h4")) goto l260;
-  goto l248;
-  l260:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "h5")) goto l261;
-  goto l248;
-  l261:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "h6")) goto l262;
-  goto l248;
-  l262:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "hr")) goto l263;
-  goto l248;
-  l263:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "isindex")) goto l264;
-  goto l248;
-  l264:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "menu")) goto l265;
-  goto l248;
-  l265:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "noframes")) goto l266;
-  goto l248;
-  l266:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "noscript")) goto l267;
-  goto l248;
-  l267:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "ol")) goto l268;
-  goto l248;
-  l268:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchChar(G, 'p')) goto l269;
-  goto l248;
-  l269:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "pre")) goto l270;
-  goto l248;
-  l270:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "table")) goto l271;
-  goto l248;
-  l271:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "ul")) goto l272;
-  goto l248;
-  l272:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "dd")) goto l273;
-  goto l248;
-  l273:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "dt")) goto l274;
-  goto l248;
-  l274:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "frameset")) goto l275;
-  goto l248;
-  l275:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "li")) goto l276;
-  goto l248;
-  l276:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "tbody")) goto l277;
-  goto l248;
-  l277:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "td")) goto l278;
-  goto l248;
-  l278:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "tfoot")) goto l279;
-  goto l248;
-  l279:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "th")) goto l280;
-  goto l248;
-  l280:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "thead")) goto l281;
-  goto l248;
-  l281:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "tr")) goto l282;
-  goto l248;
-  l282:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "script")) goto l283;
-  goto l248;
-  l283:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "ADDRESS")) goto l284;
-  goto l248;
-  l284:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "BLOCKQUOTE")) goto l285;
-  goto l248;
-  l285:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "CENTER")) goto l286;
-  goto l248;
-  l286:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "DIR")) goto l287;
-  goto l248;
-  l287:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "DIV")) goto l288;
-  goto l248;
-  l288:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "DL")) goto l289;
-  goto l248;
-  l289:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "FIELDSET")) goto l290;
-  goto l248;
-  l290:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "FORM")) goto l291;
-  goto l248;
-  l291:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "H1")) goto l292;
-  goto l248;
-  l292:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "H2")) goto l293;
-  goto l248;
-  l293:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "H3")) goto l294;
-  goto l248;
-  l294:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "H4")) goto l295;
-  goto l248;
-  l295:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "H5")) goto l296;
-  goto l248;
-  l296:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "H6")) goto l297;
-  goto l248;
-  l297:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "HR")) goto l298;
-  goto l248;
-  l298:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "ISINDEX")) goto l299;
-  goto l248;
-  l299:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "MENU")) goto l300;
-  goto l248;
-  l300:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "NOFRAMES")) goto l301;
-  goto l248;
-  l301:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "NOSCRIPT")) goto l302;
-  goto l248;
-  l302:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "OL")) goto l303;
-  goto l248;
-  l303:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchChar(G, 'P')) goto l304;
-  goto l248;
-  l304:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "PRE")) goto l305;
-  goto l248;
-  l305:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "TABLE")) goto l306;
-  goto l248;
-  l306:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "UL")) goto l307;
-  goto l248;
-  l307:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "DD")) goto l308;
-  goto l248;
-  l308:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "DT")) goto l309;
-  goto l248;
-  l309:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "FRAMESET")) goto l310;
-  goto l248;
-  l310:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "LI")) goto l311;
-  goto l248;
-  l311:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "TBODY")) goto l312;
-  goto l248;
-  l312:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "TD")) goto l313;
-  goto l248;
-  l313:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "TFOOT")) goto l314;
-  goto l248;
-  l314:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "TH")) goto l315;
-  goto l248;
-  l315:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "THEAD")) goto l316;
-  goto l248;
-  l316:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "TR")) goto l317;
-  goto l248;
-  l317:;	  G->pos= yypos248; G->thunkpos= yythunkpos248;  if (!yymatchString(G, "SCRIPT")) goto l247;
-
-  }
-  l248:;	  yyprintf((stderr, "  ok   HtmlBlockType"));
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  const html_block_tag *yytag;  yyprintfv((stderr, "%s\n", "HtmlBlockType"));
+  yytag= yyHtmlTagAfter(G, yyHtmlTagName(G), 0, -1);  if (!yytag) goto l247;
+  G->pos += yytag->len;
+  yyprintf((stderr, "  ok   HtmlBlockType"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
@@ -4480,6990 +4699,3499 @@ YY_RULE(int) yy_HtmlBlockSelfClosing(GREG *G)
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseScript(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseScript"));
-  if (!yymatchChar(G, '<')) goto l328;
-  if (!yy_Spnl(G))  goto l328;
-  if (!yymatchChar(G, '/')) goto l328;
-
-  {  int yypos329= G->pos, yythunkpos329= G->thunkpos;  if (!yymatchString(G, "script")) goto l330;
-  goto l329;
-  l330:;	  G->pos= yypos329; G->thunkpos= yythunkpos329;  if (!yymatchString(G, "SCRIPT")) goto l328;
+YY_RULE(int) yy_ListBlockLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "ListBlockLine"));
 
+  {  int yypos925= G->pos, yythunkpos925= G->thunkpos;  if (!yy_BlankLine(G))  goto l925;
+  goto l924;
+  l925:;	  G->pos= yypos925; G->thunkpos= yythunkpos925;
   }
-  l329:;	  if (!yy_Spnl(G))  goto l328;
-  if (!yymatchChar(G, '>')) goto l328;
-  yyprintf((stderr, "  ok   HtmlBlockCloseScript"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l328:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseScript"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockOpenScript(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenScript"));
-  if (!yymatchChar(G, '<')) goto l331;
-  if (!yy_Spnl(G))  goto l331;
-
-  {  int yypos332= G->pos, yythunkpos332= G->thunkpos;  if (!yymatchString(G, "script")) goto l333;
-  goto l332;
-  l333:;	  G->pos= yypos332; G->thunkpos= yythunkpos332;  if (!yymatchString(G, "SCRIPT")) goto l331;
-
+  {  int yypos926= G->pos, yythunkpos926= G->thunkpos;
+  {  int yypos927= G->pos, yythunkpos927= G->thunkpos;  if (!yy_Indent(G))  goto l927;
+  goto l928;
+  l927:;	  G->pos= yypos927; G->thunkpos= yythunkpos927;
   }
-  l332:;	  if (!yy_Spnl(G))  goto l331;
+  l928:;	
+  {  int yypos929= G->pos, yythunkpos929= G->thunkpos;  if (!yy_Bullet(G))  goto l930;
+  goto l929;
+  l930:;	  G->pos= yypos929; G->thunkpos= yythunkpos929;  if (!yy_Enumerator(G))  goto l926;
 
-  l334:;	
-  {  int yypos335= G->pos, yythunkpos335= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l335;
-  goto l334;
-  l335:;	  G->pos= yypos335; G->thunkpos= yythunkpos335;
-  }  if (!yymatchChar(G, '>')) goto l331;
-  yyprintf((stderr, "  ok   HtmlBlockOpenScript"));
+  }
+  l929:;	  goto l924;
+  l926:;	  G->pos= yypos926; G->thunkpos= yythunkpos926;
+  }
+  {  int yypos931= G->pos, yythunkpos931= G->thunkpos;  if (!yy_HorizontalRule(G))  goto l931;
+  goto l924;
+  l931:;	  G->pos= yypos931; G->thunkpos= yythunkpos931;
+  }  if (!yy_OptionallyIndentedLine(G))  goto l924;
+  yyprintf((stderr, "  ok   ListBlockLine"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l331:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenScript"));
+  l924:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ListBlockLine"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockTr(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockTr"));
-  if (!yy_HtmlBlockOpenTr(G))  goto l336;
-
-  l337:;	
-  {  int yypos338= G->pos, yythunkpos338= G->thunkpos;
-  {  int yypos339= G->pos, yythunkpos339= G->thunkpos;  if (!yy_HtmlBlockTr(G))  goto l340;
-  goto l339;
-  l340:;	  G->pos= yypos339; G->thunkpos= yythunkpos339;
-  {  int yypos341= G->pos, yythunkpos341= G->thunkpos;  if (!yy_HtmlBlockCloseTr(G))  goto l341;
-  goto l338;
-  l341:;	  G->pos= yypos341; G->thunkpos= yythunkpos341;
-  }  if (!yymatchDot(G)) goto l338;
-  }
-  l339:;	  goto l337;
-  l338:;	  G->pos= yypos338; G->thunkpos= yythunkpos338;
-  }  if (!yy_HtmlBlockCloseTr(G))  goto l336;
-  yyprintf((stderr, "  ok   HtmlBlockTr"));
+YY_RULE(int) yy_ListContinuationBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "ListContinuationBlock"));
+  if (!yy_StartList(G))  goto l932;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l932;
+  l933:;	
+  {  int yypos934= G->pos, yythunkpos934= G->thunkpos;  if (!yy_BlankLine(G))  goto l934;
+  goto l933;
+  l934:;	  G->pos= yypos934; G->thunkpos= yythunkpos934;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l932;  yyDo(G, yy_1_ListContinuationBlock, G->begin, G->end, "yy_1_ListContinuationBlock");
+  if (!yy_Indent(G))  goto l932;
+  if (!yy_ListBlock(G))  goto l932;
+  yyDo(G, yy_2_ListContinuationBlock, G->begin, G->end, "yy_2_ListContinuationBlock");
+
+  l935:;	
+  {  int yypos936= G->pos, yythunkpos936= G->thunkpos;  if (!yy_Indent(G))  goto l936;
+  if (!yy_ListBlock(G))  goto l936;
+  yyDo(G, yy_2_ListContinuationBlock, G->begin, G->end, "yy_2_ListContinuationBlock");
+  goto l935;
+  l936:;	  G->pos= yypos936; G->thunkpos= yythunkpos936;
+  }  yyDo(G, yy_3_ListContinuationBlock, G->begin, G->end, "yy_3_ListContinuationBlock");
+  yyprintf((stderr, "  ok   ListContinuationBlock"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l336:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockTr"));
+  l932:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ListContinuationBlock"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseTr(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseTr"));
-  if (!yymatchChar(G, '<')) goto l342;
-  if (!yy_Spnl(G))  goto l342;
-  if (!yymatchChar(G, '/')) goto l342;
+YY_RULE(int) yy_ListBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "ListBlock"));
+  if (!yy_StartList(G))  goto l937;
+  yyDo(G, yySet, -1, 0, "yySet");
 
-  {  int yypos343= G->pos, yythunkpos343= G->thunkpos;  if (!yymatchString(G, "tr")) goto l344;
-  goto l343;
-  l344:;	  G->pos= yypos343; G->thunkpos= yythunkpos343;  if (!yymatchString(G, "TR")) goto l342;
+  {  int yypos938= G->pos, yythunkpos938= G->thunkpos;  if (!yy_BlankLine(G))  goto l938;
+  goto l937;
+  l938:;	  G->pos= yypos938; G->thunkpos= yythunkpos938;
+  }  if (!yy_Line(G))  goto l937;
+  yyDo(G, yy_1_ListBlock, G->begin, G->end, "yy_1_ListBlock");
 
-  }
-  l343:;	  if (!yy_Spnl(G))  goto l342;
-  if (!yymatchChar(G, '>')) goto l342;
-  yyprintf((stderr, "  ok   HtmlBlockCloseTr"));
+  l939:;	
+  {  int yypos940= G->pos, yythunkpos940= G->thunkpos;  if (!yy_ListBlockLine(G))  goto l940;
+  yyDo(G, yy_2_ListBlock, G->begin, G->end, "yy_2_ListBlock");
+  goto l939;
+  l940:;	  G->pos= yypos940; G->thunkpos= yythunkpos940;
+  }  yyDo(G, yy_3_ListBlock, G->begin, G->end, "yy_3_ListBlock");
+  yyprintf((stderr, "  ok   ListBlock"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l342:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseTr"));
+  l937:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ListBlock"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenTr(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenTr"));
-  if (!yymatchChar(G, '<')) goto l345;
-  if (!yy_Spnl(G))  goto l345;
-
-  {  int yypos346= G->pos, yythunkpos346= G->thunkpos;  if (!yymatchString(G, "tr")) goto l347;
-  goto l346;
-  l347:;	  G->pos= yypos346; G->thunkpos= yythunkpos346;  if (!yymatchString(G, "TR")) goto l345;
+YY_RULE(int) yy_ListItem(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "ListItem"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l941;
+  {  int yypos942= G->pos, yythunkpos942= G->thunkpos;  if (!yy_Bullet(G))  goto l943;
+  goto l942;
+  l943:;	  G->pos= yypos942; G->thunkpos= yythunkpos942;  if (!yy_Enumerator(G))  goto l941;
 
   }
-  l346:;	  if (!yy_Spnl(G))  goto l345;
+  l942:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l941;  if (!yy_StartList(G))  goto l941;
+  yyDo(G, yySet, -1, 0, "yySet");
+  if (!yy_ListBlock(G))  goto l941;
+  yyDo(G, yy_1_ListItem, G->begin, G->end, "yy_1_ListItem");
 
-  l348:;	
-  {  int yypos349= G->pos, yythunkpos349= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l349;
-  goto l348;
-  l349:;	  G->pos= yypos349; G->thunkpos= yythunkpos349;
-  }  if (!yymatchChar(G, '>')) goto l345;
-  yyprintf((stderr, "  ok   HtmlBlockOpenTr"));
+  l944:;	
+  {  int yypos945= G->pos, yythunkpos945= G->thunkpos;  if (!yy_ListContinuationBlock(G))  goto l945;
+  yyDo(G, yy_2_ListItem, G->begin, G->end, "yy_2_ListItem");
+  goto l944;
+  l945:;	  G->pos= yypos945; G->thunkpos= yythunkpos945;
+  }  yyDo(G, yy_3_ListItem, G->begin, G->end, "yy_3_ListItem");
+  yyprintf((stderr, "  ok   ListItem"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l345:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenTr"));
+  l941:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ListItem"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockThead(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockThead"));
-  if (!yy_HtmlBlockOpenThead(G))  goto l350;
+YY_RULE(int) yy_Enumerator(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Enumerator"));
+  if (!yy_NonindentSpace(G))  goto l946;
+  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "0-9")) goto l946;
 
-  l351:;	
-  {  int yypos352= G->pos, yythunkpos352= G->thunkpos;
-  {  int yypos353= G->pos, yythunkpos353= G->thunkpos;  if (!yy_HtmlBlockThead(G))  goto l354;
-  goto l353;
-  l354:;	  G->pos= yypos353; G->thunkpos= yythunkpos353;
-  {  int yypos355= G->pos, yythunkpos355= G->thunkpos;  if (!yy_HtmlBlockCloseThead(G))  goto l355;
-  goto l352;
-  l355:;	  G->pos= yypos355; G->thunkpos= yythunkpos355;
-  }  if (!yymatchDot(G)) goto l352;
-  }
-  l353:;	  goto l351;
-  l352:;	  G->pos= yypos352; G->thunkpos= yythunkpos352;
-  }  if (!yy_HtmlBlockCloseThead(G))  goto l350;
-  yyprintf((stderr, "  ok   HtmlBlockThead"));
+  l947:;	
+  {  int yypos948= G->pos, yythunkpos948= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "0-9")) goto l948;
+  goto l947;
+  l948:;	  G->pos= yypos948; G->thunkpos= yythunkpos948;
+  }  if (!yymatchChar(G, '.')) goto l946;
+  if (!yy_Spacechar(G))  goto l946;
+
+  l949:;	
+  {  int yypos950= G->pos, yythunkpos950= G->thunkpos;  if (!yy_Spacechar(G))  goto l950;
+  goto l949;
+  l950:;	  G->pos= yypos950; G->thunkpos= yythunkpos950;
+  }  yyprintf((stderr, "  ok   Enumerator"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l350:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockThead"));
+  l946:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Enumerator"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseThead(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseThead"));
-  if (!yymatchChar(G, '<')) goto l356;
-  if (!yy_Spnl(G))  goto l356;
-  if (!yymatchChar(G, '/')) goto l356;
+YY_RULE(int) yy_ListItemTight(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "ListItemTight"));
+
+  {  int yypos952= G->pos, yythunkpos952= G->thunkpos;  if (!yy_Bullet(G))  goto l953;
+  goto l952;
+  l953:;	  G->pos= yypos952; G->thunkpos= yythunkpos952;  if (!yy_Enumerator(G))  goto l951;
 
-  {  int yypos357= G->pos, yythunkpos357= G->thunkpos;  if (!yymatchString(G, "thead")) goto l358;
-  goto l357;
-  l358:;	  G->pos= yypos357; G->thunkpos= yythunkpos357;  if (!yymatchString(G, "THEAD")) goto l356;
+  }
+  l952:;	  if (!yy_StartList(G))  goto l951;
+  yyDo(G, yySet, -1, 0, "yySet");
+  if (!yy_ListBlock(G))  goto l951;
+  yyDo(G, yy_1_ListItemTight, G->begin, G->end, "yy_1_ListItemTight");
 
+  l954:;	
+  {  int yypos955= G->pos, yythunkpos955= G->thunkpos;
+  {  int yypos956= G->pos, yythunkpos956= G->thunkpos;  if (!yy_BlankLine(G))  goto l956;
+  goto l955;
+  l956:;	  G->pos= yypos956; G->thunkpos= yythunkpos956;
+  }  if (!yy_ListContinuationBlock(G))  goto l955;
+  yyDo(G, yy_2_ListItemTight, G->begin, G->end, "yy_2_ListItemTight");
+  goto l954;
+  l955:;	  G->pos= yypos955; G->thunkpos= yythunkpos955;
   }
-  l357:;	  if (!yy_Spnl(G))  goto l356;
-  if (!yymatchChar(G, '>')) goto l356;
-  yyprintf((stderr, "  ok   HtmlBlockCloseThead"));
+  {  int yypos957= G->pos, yythunkpos957= G->thunkpos;  if (!yy_ListContinuationBlock(G))  goto l957;
+  goto l951;
+  l957:;	  G->pos= yypos957; G->thunkpos= yythunkpos957;
+  }  yyDo(G, yy_3_ListItemTight, G->begin, G->end, "yy_3_ListItemTight");
+  yyprintf((stderr, "  ok   ListItemTight"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l356:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseThead"));
+  l951:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ListItemTight"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenThead(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenThead"));
-  if (!yymatchChar(G, '<')) goto l359;
-  if (!yy_Spnl(G))  goto l359;
+YY_RULE(int) yy_ListLoose(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "ListLoose"));
+  if (!yy_StartList(G))  goto l958;
+  yyDo(G, yySet, -2, 0, "yySet");
+  if (!yy_ListItem(G))  goto l958;
+  yyDo(G, yySet, -1, 0, "yySet");
 
-  {  int yypos360= G->pos, yythunkpos360= G->thunkpos;  if (!yymatchString(G, "thead")) goto l361;
-  goto l360;
-  l361:;	  G->pos= yypos360; G->thunkpos= yythunkpos360;  if (!yymatchString(G, "THEAD")) goto l359;
+  l961:;	
+  {  int yypos962= G->pos, yythunkpos962= G->thunkpos;  if (!yy_BlankLine(G))  goto l962;
+  goto l961;
+  l962:;	  G->pos= yypos962; G->thunkpos= yythunkpos962;
+  }  yyDo(G, yy_1_ListLoose, G->begin, G->end, "yy_1_ListLoose");
 
-  }
-  l360:;	  if (!yy_Spnl(G))  goto l359;
+  l959:;	
+  {  int yypos960= G->pos, yythunkpos960= G->thunkpos;  if (!yy_ListItem(G))  goto l960;
+  yyDo(G, yySet, -1, 0, "yySet");
 
-  l362:;	
-  {  int yypos363= G->pos, yythunkpos363= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l363;
-  goto l362;
-  l363:;	  G->pos= yypos363; G->thunkpos= yythunkpos363;
-  }  if (!yymatchChar(G, '>')) goto l359;
-  yyprintf((stderr, "  ok   HtmlBlockOpenThead"));
+  l963:;	
+  {  int yypos964= G->pos, yythunkpos964= G->thunkpos;  if (!yy_BlankLine(G))  goto l964;
+  goto l963;
+  l964:;	  G->pos= yypos964; G->thunkpos= yythunkpos964;
+  }  yyDo(G, yy_1_ListLoose, G->begin, G->end, "yy_1_ListLoose");
+  goto l959;
+  l960:;	  G->pos= yypos960; G->thunkpos= yythunkpos960;
+  }  yyDo(G, yy_2_ListLoose, G->begin, G->end, "yy_2_ListLoose");
+  yyprintf((stderr, "  ok   ListLoose"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l359:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenThead"));
+  l958:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ListLoose"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockTh(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockTh"));
-  if (!yy_HtmlBlockOpenTh(G))  goto l364;
+YY_RULE(int) yy_ListTight(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "ListTight"));
+  if (!yy_StartList(G))  goto l965;
+  yyDo(G, yySet, -1, 0, "yySet");
+  if (!yy_ListItemTight(G))  goto l965;
+  yyDo(G, yy_1_ListTight, G->begin, G->end, "yy_1_ListTight");
+
+  l966:;	
+  {  int yypos967= G->pos, yythunkpos967= G->thunkpos;  if (!yy_ListItemTight(G))  goto l967;
+  yyDo(G, yy_1_ListTight, G->begin, G->end, "yy_1_ListTight");
+  goto l966;
+  l967:;	  G->pos= yypos967; G->thunkpos= yythunkpos967;
+  }
+  l968:;	
+  {  int yypos969= G->pos, yythunkpos969= G->thunkpos;  if (!yy_BlankLine(G))  goto l969;
+  goto l968;
+  l969:;	  G->pos= yypos969; G->thunkpos= yythunkpos969;
+  }
+  {  int yypos970= G->pos, yythunkpos970= G->thunkpos;
+  {  int yypos971= G->pos, yythunkpos971= G->thunkpos;  if (!yy_Bullet(G))  goto l972;
+  goto l971;
+  l972:;	  G->pos= yypos971; G->thunkpos= yythunkpos971;  if (!yy_Enumerator(G))  goto l970;
 
-  l365:;	
-  {  int yypos366= G->pos, yythunkpos366= G->thunkpos;
-  {  int yypos367= G->pos, yythunkpos367= G->thunkpos;  if (!yy_HtmlBlockTh(G))  goto l368;
-  goto l367;
-  l368:;	  G->pos= yypos367; G->thunkpos= yythunkpos367;
-  {  int yypos369= G->pos, yythunkpos369= G->thunkpos;  if (!yy_HtmlBlockCloseTh(G))  goto l369;
-  goto l366;
-  l369:;	  G->pos= yypos369; G->thunkpos= yythunkpos369;
-  }  if (!yymatchDot(G)) goto l366;
   }
-  l367:;	  goto l365;
-  l366:;	  G->pos= yypos366; G->thunkpos= yythunkpos366;
-  }  if (!yy_HtmlBlockCloseTh(G))  goto l364;
-  yyprintf((stderr, "  ok   HtmlBlockTh"));
+  l971:;	  goto l965;
+  l970:;	  G->pos= yypos970; G->thunkpos= yythunkpos970;
+  }  yyDo(G, yy_2_ListTight, G->begin, G->end, "yy_2_ListTight");
+  yyprintf((stderr, "  ok   ListTight"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l364:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockTh"));
+  l965:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ListTight"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseTh(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseTh"));
-  if (!yymatchChar(G, '<')) goto l370;
-  if (!yy_Spnl(G))  goto l370;
-  if (!yymatchChar(G, '/')) goto l370;
+YY_RULE(int) yy_Bullet(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Bullet"));
+
+  {  int yypos974= G->pos, yythunkpos974= G->thunkpos;  if (!yy_HorizontalRule(G))  goto l974;
+  goto l973;
+  l974:;	  G->pos= yypos974; G->thunkpos= yythunkpos974;
+  }  if (!yy_NonindentSpace(G))  goto l973;
 
-  {  int yypos371= G->pos, yythunkpos371= G->thunkpos;  if (!yymatchString(G, "th")) goto l372;
-  goto l371;
-  l372:;	  G->pos= yypos371; G->thunkpos= yythunkpos371;  if (!yymatchString(G, "TH")) goto l370;
+  {  int yypos975= G->pos, yythunkpos975= G->thunkpos;  if (!yymatchChar(G, '+')) goto l976;
+  goto l975;
+  l976:;	  G->pos= yypos975; G->thunkpos= yythunkpos975;  if (!yymatchChar(G, '*')) goto l977;
+  goto l975;
+  l977:;	  G->pos= yypos975; G->thunkpos= yythunkpos975;  if (!yymatchChar(G, '-')) goto l973;
 
   }
-  l371:;	  if (!yy_Spnl(G))  goto l370;
-  if (!yymatchChar(G, '>')) goto l370;
-  yyprintf((stderr, "  ok   HtmlBlockCloseTh"));
+  l975:;	  if (!yy_Spacechar(G))  goto l973;
+
+  l978:;	
+  {  int yypos979= G->pos, yythunkpos979= G->thunkpos;  if (!yy_Spacechar(G))  goto l979;
+  goto l978;
+  l979:;	  G->pos= yypos979; G->thunkpos= yythunkpos979;
+  }  yyprintf((stderr, "  ok   Bullet"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l370:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseTh"));
+  l973:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Bullet"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenTh(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenTh"));
-  if (!yymatchChar(G, '<')) goto l373;
-  if (!yy_Spnl(G))  goto l373;
+YY_RULE(int) yy_Definition(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "Definition"));
+  if (!yy_StartList(G))  goto l980;
+  yyDo(G, yySet, -2, 0, "yySet");
+  if (!yy_StartList(G))  goto l980;
+  yyDo(G, yySet, -1, 0, "yySet");
 
-  {  int yypos374= G->pos, yythunkpos374= G->thunkpos;  if (!yymatchString(G, "th")) goto l375;
-  goto l374;
-  l375:;	  G->pos= yypos374; G->thunkpos= yythunkpos374;  if (!yymatchString(G, "TH")) goto l373;
+  {  int yypos981= G->pos, yythunkpos981= G->thunkpos;  if (!yy_BlankLine(G))  goto l981;
+  yyDo(G, yy_1_Definition, G->begin, G->end, "yy_1_Definition");
+  goto l982;
+  l981:;	  G->pos= yypos981; G->thunkpos= yythunkpos981;
+  }
+  l982:;	  if (!yy_NonindentSpace(G))  goto l980;
+  if (!yymatchChar(G, ':')) goto l980;
+  if (!yy_Sp(G))  goto l980;
+  if (!yy_RawLine(G))  goto l980;
+  yyDo(G, yy_2_Definition, G->begin, G->end, "yy_2_Definition");
 
+  l983:;	
+  {  int yypos984= G->pos, yythunkpos984= G->thunkpos;
+  {  int yypos985= G->pos, yythunkpos985= G->thunkpos;  if (!yymatchChar(G, ':')) goto l985;
+  goto l984;
+  l985:;	  G->pos= yypos985; G->thunkpos= yythunkpos985;
+  }
+  {  int yypos986= G->pos, yythunkpos986= G->thunkpos;  if (!yy_BlankLine(G))  goto l986;
+  goto l984;
+  l986:;	  G->pos= yypos986; G->thunkpos= yythunkpos986;
+  }  if (!yy_RawLine(G))  goto l984;
+  yyDo(G, yy_3_Definition, G->begin, G->end, "yy_3_Definition");
+  goto l983;
+  l984:;	  G->pos= yypos984; G->thunkpos= yythunkpos984;
   }
-  l374:;	  if (!yy_Spnl(G))  goto l373;
+  l987:;	
+  {  int yypos988= G->pos, yythunkpos988= G->thunkpos;  if (!yy_BlankLine(G))  goto l988;
+  yyDo(G, yy_4_Definition, G->begin, G->end, "yy_4_Definition");
+  if (!yy_IndentedLine(G))  goto l988;
+  yyDo(G, yy_5_Definition, G->begin, G->end, "yy_5_Definition");
 
-  l376:;	
-  {  int yypos377= G->pos, yythunkpos377= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l377;
-  goto l376;
-  l377:;	  G->pos= yypos377; G->thunkpos= yythunkpos377;
-  }  if (!yymatchChar(G, '>')) goto l373;
-  yyprintf((stderr, "  ok   HtmlBlockOpenTh"));
+  l989:;	
+  {  int yypos990= G->pos, yythunkpos990= G->thunkpos;  if (!yy_IndentedLine(G))  goto l990;
+  yyDo(G, yy_5_Definition, G->begin, G->end, "yy_5_Definition");
+  goto l989;
+  l990:;	  G->pos= yypos990; G->thunkpos= yythunkpos990;
+  }  yyDo(G, yy_6_Definition, G->begin, G->end, "yy_6_Definition");
+  goto l987;
+  l988:;	  G->pos= yypos988; G->thunkpos= yythunkpos988;
+  }  yyDo(G, yy_7_Definition, G->begin, G->end, "yy_7_Definition");
+  yyprintf((stderr, "  ok   Definition"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l373:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenTh"));
+  l980:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Definition"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockTfoot(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockTfoot"));
-  if (!yy_HtmlBlockOpenTfoot(G))  goto l378;
+YY_RULE(int) yy_Term(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "Term"));
+  if (!yy_StartList(G))  goto l991;
+  yyDo(G, yySet, -1, 0, "yySet");
 
-  l379:;	
-  {  int yypos380= G->pos, yythunkpos380= G->thunkpos;
-  {  int yypos381= G->pos, yythunkpos381= G->thunkpos;  if (!yy_HtmlBlockTfoot(G))  goto l382;
-  goto l381;
-  l382:;	  G->pos= yypos381; G->thunkpos= yythunkpos381;
-  {  int yypos383= G->pos, yythunkpos383= G->thunkpos;  if (!yy_HtmlBlockCloseTfoot(G))  goto l383;
-  goto l380;
-  l383:;	  G->pos= yypos383; G->thunkpos= yythunkpos383;
-  }  if (!yymatchDot(G)) goto l380;
+  {  int yypos992= G->pos, yythunkpos992= G->thunkpos;  if (!yy_BlankLine(G))  goto l992;
+  goto l991;
+  l992:;	  G->pos= yypos992; G->thunkpos= yythunkpos992;
   }
-  l381:;	  goto l379;
-  l380:;	  G->pos= yypos380; G->thunkpos= yythunkpos380;
-  }  if (!yy_HtmlBlockCloseTfoot(G))  goto l378;
-  yyprintf((stderr, "  ok   HtmlBlockTfoot"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l378:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockTfoot"));
-  yyprintfvGcontext;
+  {  int yypos993= G->pos, yythunkpos993= G->thunkpos;  if (!yymatchChar(G, ':')) goto l993;
+  goto l991;
+  l993:;	  G->pos= yypos993; G->thunkpos= yythunkpos993;
+  }
+  {  int yypos996= G->pos, yythunkpos996= G->thunkpos;  if (!yy_Newline(G))  goto l996;
+  goto l991;
+  l996:;	  G->pos= yypos996; G->thunkpos= yythunkpos996;
+  }
+  {  int yypos997= G->pos, yythunkpos997= G->thunkpos;  if (!yy_Endline(G))  goto l997;
+  goto l991;
+  l997:;	  G->pos= yypos997; G->thunkpos= yythunkpos997;
+  }  if (!yy_Inline(G))  goto l991;
+  yyDo(G, yy_1_Term, G->begin, G->end, "yy_1_Term");
+
+  l994:;	
+  {  int yypos995= G->pos, yythunkpos995= G->thunkpos;
+  {  int yypos998= G->pos, yythunkpos998= G->thunkpos;  if (!yy_Newline(G))  goto l998;
+  goto l995;
+  l998:;	  G->pos= yypos998; G->thunkpos= yythunkpos998;
+  }
+  {  int yypos999= G->pos, yythunkpos999= G->thunkpos;  if (!yy_Endline(G))  goto l999;
+  goto l995;
+  l999:;	  G->pos= yypos999; G->thunkpos= yythunkpos999;
+  }  if (!yy_Inline(G))  goto l995;
+  yyDo(G, yy_1_Term, G->begin, G->end, "yy_1_Term");
+  goto l994;
+  l995:;	  G->pos= yypos995; G->thunkpos= yythunkpos995;
+  }  if (!yy_Newline(G))  goto l991;
+  yyDo(G, yy_2_Term, G->begin, G->end, "yy_2_Term");
+  yyprintf((stderr, "  ok   Term"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+  yyDo(G, yyPop, 1, 0, "yyPop");
+  return 1;
+  l991:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Term"));
+  yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseTfoot(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseTfoot"));
-  if (!yymatchChar(G, '<')) goto l384;
-  if (!yy_Spnl(G))  goto l384;
-  if (!yymatchChar(G, '/')) goto l384;
-
-  {  int yypos385= G->pos, yythunkpos385= G->thunkpos;  if (!yymatchString(G, "tfoot")) goto l386;
-  goto l385;
-  l386:;	  G->pos= yypos385; G->thunkpos= yythunkpos385;  if (!yymatchString(G, "TFOOT")) goto l384;
+YY_RULE(int) yy_TermLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "TermLine"));
 
+  {  int yypos1001= G->pos, yythunkpos1001= G->thunkpos;  if (!yymatchChar(G, ':')) goto l1001;
+  goto l1000;
+  l1001:;	  G->pos= yypos1001; G->thunkpos= yythunkpos1001;
+  }
+  {  int yypos1002= G->pos, yythunkpos1002= G->thunkpos;  if (!yy_BlankLine(G))  goto l1002;
+  goto l1000;
+  l1002:;	  G->pos= yypos1002; G->thunkpos= yythunkpos1002;
   }
-  l385:;	  if (!yy_Spnl(G))  goto l384;
-  if (!yymatchChar(G, '>')) goto l384;
-  yyprintf((stderr, "  ok   HtmlBlockCloseTfoot"));
+  l1003:;	
+  {  int yypos1004= G->pos, yythunkpos1004= G->thunkpos;
+  {  int yypos1005= G->pos, yythunkpos1005= G->thunkpos;  if (!yy_Newline(G))  goto l1005;
+  goto l1004;
+  l1005:;	  G->pos= yypos1005; G->thunkpos= yythunkpos1005;
+  }  if (!yymatchDot(G)) goto l1004;  goto l1003;
+  l1004:;	  G->pos= yypos1004; G->thunkpos= yythunkpos1004;
+  }  if (!yy_Newline(G))  goto l1000;
+  yyprintf((stderr, "  ok   TermLine"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l384:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseTfoot"));
+  l1000:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "TermLine"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenTfoot(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenTfoot"));
-  if (!yymatchChar(G, '<')) goto l387;
-  if (!yy_Spnl(G))  goto l387;
-
-  {  int yypos388= G->pos, yythunkpos388= G->thunkpos;  if (!yymatchString(G, "tfoot")) goto l389;
-  goto l388;
-  l389:;	  G->pos= yypos388; G->thunkpos= yythunkpos388;  if (!yymatchString(G, "TFOOT")) goto l387;
+YY_RULE(int) yy_VerbatimChunk(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "VerbatimChunk"));
+  if (!yy_StartList(G))  goto l1006;
+  yyDo(G, yySet, -1, 0, "yySet");
 
-  }
-  l388:;	  if (!yy_Spnl(G))  goto l387;
+  l1007:;	
+  {  int yypos1008= G->pos, yythunkpos1008= G->thunkpos;  if (!yy_BlankLine(G))  goto l1008;
+  yyDo(G, yy_1_VerbatimChunk, G->begin, G->end, "yy_1_VerbatimChunk");
+  goto l1007;
+  l1008:;	  G->pos= yypos1008; G->thunkpos= yythunkpos1008;
+  }  if (!yy_NonblankIndentedLine(G))  goto l1006;
+  yyDo(G, yy_2_VerbatimChunk, G->begin, G->end, "yy_2_VerbatimChunk");
 
-  l390:;	
-  {  int yypos391= G->pos, yythunkpos391= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l391;
-  goto l390;
-  l391:;	  G->pos= yypos391; G->thunkpos= yythunkpos391;
-  }  if (!yymatchChar(G, '>')) goto l387;
-  yyprintf((stderr, "  ok   HtmlBlockOpenTfoot"));
+  l1009:;	
+  {  int yypos1010= G->pos, yythunkpos1010= G->thunkpos;  if (!yy_NonblankIndentedLine(G))  goto l1010;
+  yyDo(G, yy_2_VerbatimChunk, G->begin, G->end, "yy_2_VerbatimChunk");
+  goto l1009;
+  l1010:;	  G->pos= yypos1010; G->thunkpos= yythunkpos1010;
+  }  yyDo(G, yy_3_VerbatimChunk, G->begin, G->end, "yy_3_VerbatimChunk");
+  yyprintf((stderr, "  ok   VerbatimChunk"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l387:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenTfoot"));
+  l1006:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "VerbatimChunk"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockTd(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockTd"));
-  if (!yy_HtmlBlockOpenTd(G))  goto l392;
+YY_RULE(int) yy_NonblankIndentedLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "NonblankIndentedLine"));
 
-  l393:;	
-  {  int yypos394= G->pos, yythunkpos394= G->thunkpos;
-  {  int yypos395= G->pos, yythunkpos395= G->thunkpos;  if (!yy_HtmlBlockTd(G))  goto l396;
-  goto l395;
-  l396:;	  G->pos= yypos395; G->thunkpos= yythunkpos395;
-  {  int yypos397= G->pos, yythunkpos397= G->thunkpos;  if (!yy_HtmlBlockCloseTd(G))  goto l397;
-  goto l394;
-  l397:;	  G->pos= yypos397; G->thunkpos= yythunkpos397;
-  }  if (!yymatchDot(G)) goto l394;
-  }
-  l395:;	  goto l393;
-  l394:;	  G->pos= yypos394; G->thunkpos= yythunkpos394;
-  }  if (!yy_HtmlBlockCloseTd(G))  goto l392;
-  yyprintf((stderr, "  ok   HtmlBlockTd"));
+  {  int yypos1012= G->pos, yythunkpos1012= G->thunkpos;  if (!yy_BlankLine(G))  goto l1012;
+  goto l1011;
+  l1012:;	  G->pos= yypos1012; G->thunkpos= yythunkpos1012;
+  }  if (!yy_IndentedLine(G))  goto l1011;
+  yyprintf((stderr, "  ok   NonblankIndentedLine"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l392:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockTd"));
+  l1011:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "NonblankIndentedLine"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseTd(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseTd"));
-  if (!yymatchChar(G, '<')) goto l398;
-  if (!yy_Spnl(G))  goto l398;
-  if (!yymatchChar(G, '/')) goto l398;
-
-  {  int yypos399= G->pos, yythunkpos399= G->thunkpos;  if (!yymatchString(G, "td")) goto l400;
-  goto l399;
-  l400:;	  G->pos= yypos399; G->thunkpos= yythunkpos399;  if (!yymatchString(G, "TD")) goto l398;
-
-  }
-  l399:;	  if (!yy_Spnl(G))  goto l398;
-  if (!yymatchChar(G, '>')) goto l398;
-  yyprintf((stderr, "  ok   HtmlBlockCloseTd"));
+YY_RULE(int) yy_DoubleQuoteEnd(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "DoubleQuoteEnd"));
+  if (!yymatchChar(G, '"')) goto l1013;
+  yyprintf((stderr, "  ok   DoubleQuoteEnd"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l398:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseTd"));
+  l1013:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DoubleQuoteEnd"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenTd(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenTd"));
-  if (!yymatchChar(G, '<')) goto l401;
-  if (!yy_Spnl(G))  goto l401;
-
-  {  int yypos402= G->pos, yythunkpos402= G->thunkpos;  if (!yymatchString(G, "td")) goto l403;
-  goto l402;
-  l403:;	  G->pos= yypos402; G->thunkpos= yythunkpos402;  if (!yymatchString(G, "TD")) goto l401;
-
-  }
-  l402:;	  if (!yy_Spnl(G))  goto l401;
-
-  l404:;	
-  {  int yypos405= G->pos, yythunkpos405= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l405;
-  goto l404;
-  l405:;	  G->pos= yypos405; G->thunkpos= yythunkpos405;
-  }  if (!yymatchChar(G, '>')) goto l401;
-  yyprintf((stderr, "  ok   HtmlBlockOpenTd"));
+YY_RULE(int) yy_DoubleQuoteStart(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "DoubleQuoteStart"));
+  if (!yymatchChar(G, '"')) goto l1014;
+  yyprintf((stderr, "  ok   DoubleQuoteStart"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l401:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenTd"));
+  l1014:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DoubleQuoteStart"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockTbody(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockTbody"));
-  if (!yy_HtmlBlockOpenTbody(G))  goto l406;
+YY_RULE(int) yy_SingleQuoteEnd(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SingleQuoteEnd"));
+  if (!yymatchChar(G, '\'')) goto l1015;
 
-  l407:;	
-  {  int yypos408= G->pos, yythunkpos408= G->thunkpos;
-  {  int yypos409= G->pos, yythunkpos409= G->thunkpos;  if (!yy_HtmlBlockTbody(G))  goto l410;
-  goto l409;
-  l410:;	  G->pos= yypos409; G->thunkpos= yythunkpos409;
-  {  int yypos411= G->pos, yythunkpos411= G->thunkpos;  if (!yy_HtmlBlockCloseTbody(G))  goto l411;
-  goto l408;
-  l411:;	  G->pos= yypos411; G->thunkpos= yythunkpos411;
-  }  if (!yymatchDot(G)) goto l408;
-  }
-  l409:;	  goto l407;
-  l408:;	  G->pos= yypos408; G->thunkpos= yythunkpos408;
-  }  if (!yy_HtmlBlockCloseTbody(G))  goto l406;
-  yyprintf((stderr, "  ok   HtmlBlockTbody"));
+  {  int yypos1016= G->pos, yythunkpos1016= G->thunkpos;  if (!yy_Alphanumeric(G))  goto l1016;
+  goto l1015;
+  l1016:;	  G->pos= yypos1016; G->thunkpos= yythunkpos1016;
+  }  yyprintf((stderr, "  ok   SingleQuoteEnd"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l406:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockTbody"));
+  l1015:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SingleQuoteEnd"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseTbody(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseTbody"));
-  if (!yymatchChar(G, '<')) goto l412;
-  if (!yy_Spnl(G))  goto l412;
-  if (!yymatchChar(G, '/')) goto l412;
+YY_RULE(int) yy_SingleQuoteStart(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SingleQuoteStart"));
+  if (!yymatchChar(G, '\'')) goto l1017;
 
-  {  int yypos413= G->pos, yythunkpos413= G->thunkpos;  if (!yymatchString(G, "tbody")) goto l414;
-  goto l413;
-  l414:;	  G->pos= yypos413; G->thunkpos= yythunkpos413;  if (!yymatchString(G, "TBODY")) goto l412;
+  {  int yypos1018= G->pos, yythunkpos1018= G->thunkpos;
+  {  int yypos1019= G->pos, yythunkpos1019= G->thunkpos;  if (!yy_Spacechar(G))  goto l1020;
+  goto l1019;
+  l1020:;	  G->pos= yypos1019; G->thunkpos= yythunkpos1019;  if (!yy_Newline(G))  goto l1018;
 
   }
-  l413:;	  if (!yy_Spnl(G))  goto l412;
-  if (!yymatchChar(G, '>')) goto l412;
-  yyprintf((stderr, "  ok   HtmlBlockCloseTbody"));
+  l1019:;	  goto l1017;
+  l1018:;	  G->pos= yypos1018; G->thunkpos= yythunkpos1018;
+  }  yyprintf((stderr, "  ok   SingleQuoteStart"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l412:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseTbody"));
+  l1017:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SingleQuoteStart"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenTbody(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenTbody"));
-  if (!yymatchChar(G, '<')) goto l415;
-  if (!yy_Spnl(G))  goto l415;
-
-  {  int yypos416= G->pos, yythunkpos416= G->thunkpos;  if (!yymatchString(G, "tbody")) goto l417;
-  goto l416;
-  l417:;	  G->pos= yypos416; G->thunkpos= yythunkpos416;  if (!yymatchString(G, "TBODY")) goto l415;
+YY_RULE(int) yy_EnDash(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "EnDash"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1021;
+  {  int yypos1022= G->pos, yythunkpos1022= G->thunkpos;  if (!yymatchString(G, "--")) goto l1023;
+  goto l1022;
+  l1023:;	  G->pos= yypos1022; G->thunkpos= yythunkpos1022;  if (!yymatchChar(G, '-')) goto l1021;
 
+  {  int yypos1024= G->pos, yythunkpos1024= G->thunkpos;  if (!yy_Digit(G))  goto l1021;
+  G->pos= yypos1024; G->thunkpos= yythunkpos1024;
   }
-  l416:;	  if (!yy_Spnl(G))  goto l415;
-
-  l418:;	
-  {  int yypos419= G->pos, yythunkpos419= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l419;
-  goto l418;
-  l419:;	  G->pos= yypos419; G->thunkpos= yythunkpos419;
-  }  if (!yymatchChar(G, '>')) goto l415;
-  yyprintf((stderr, "  ok   HtmlBlockOpenTbody"));
+  }
+  l1022:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1021;  yyDo(G, yy_1_EnDash, G->begin, G->end, "yy_1_EnDash");
+  yyprintf((stderr, "  ok   EnDash"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l415:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenTbody"));
+  l1021:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "EnDash"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockLi(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockLi"));
-  if (!yy_HtmlBlockOpenLi(G))  goto l420;
-
-  l421:;	
-  {  int yypos422= G->pos, yythunkpos422= G->thunkpos;
-  {  int yypos423= G->pos, yythunkpos423= G->thunkpos;  if (!yy_HtmlBlockLi(G))  goto l424;
-  goto l423;
-  l424:;	  G->pos= yypos423; G->thunkpos= yythunkpos423;
-  {  int yypos425= G->pos, yythunkpos425= G->thunkpos;  if (!yy_HtmlBlockCloseLi(G))  goto l425;
-  goto l422;
-  l425:;	  G->pos= yypos425; G->thunkpos= yythunkpos425;
-  }  if (!yymatchDot(G)) goto l422;
-  }
-  l423:;	  goto l421;
-  l422:;	  G->pos= yypos422; G->thunkpos= yythunkpos422;
-  }  if (!yy_HtmlBlockCloseLi(G))  goto l420;
-  yyprintf((stderr, "  ok   HtmlBlockLi"));
+YY_RULE(int) yy_EmDash(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "EmDash"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1025;  if (!yymatchString(G, "---")) goto l1025;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1025;  yyDo(G, yy_1_EmDash, G->begin, G->end, "yy_1_EmDash");
+  yyprintf((stderr, "  ok   EmDash"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l420:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockLi"));
+  l1025:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "EmDash"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseLi(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseLi"));
-  if (!yymatchChar(G, '<')) goto l426;
-  if (!yy_Spnl(G))  goto l426;
-  if (!yymatchChar(G, '/')) goto l426;
-
-  {  int yypos427= G->pos, yythunkpos427= G->thunkpos;  if (!yymatchString(G, "li")) goto l428;
-  goto l427;
-  l428:;	  G->pos= yypos427; G->thunkpos= yythunkpos427;  if (!yymatchString(G, "LI")) goto l426;
-
-  }
-  l427:;	  if (!yy_Spnl(G))  goto l426;
-  if (!yymatchChar(G, '>')) goto l426;
-  yyprintf((stderr, "  ok   HtmlBlockCloseLi"));
+YY_RULE(int) yy_Apostrophe(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Apostrophe"));
+  if (!yymatchChar(G, '\'')) goto l1026;
+  yyDo(G, yy_1_Apostrophe, G->begin, G->end, "yy_1_Apostrophe");
+  yyprintf((stderr, "  ok   Apostrophe"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l426:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseLi"));
+  l1026:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Apostrophe"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenLi(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenLi"));
-  if (!yymatchChar(G, '<')) goto l429;
-  if (!yy_Spnl(G))  goto l429;
-
-  {  int yypos430= G->pos, yythunkpos430= G->thunkpos;  if (!yymatchString(G, "li")) goto l431;
-  goto l430;
-  l431:;	  G->pos= yypos430; G->thunkpos= yythunkpos430;  if (!yymatchString(G, "LI")) goto l429;
+YY_RULE(int) yy_DoubleQuoted(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "DoubleQuoted"));
+  if (!yy_DoubleQuoteStart(G))  goto l1027;
+  if (!yy_StartList(G))  goto l1027;
+  yyDo(G, yySet, -2, 0, "yySet");
 
-  }
-  l430:;	  if (!yy_Spnl(G))  goto l429;
+  {  int yypos1030= G->pos, yythunkpos1030= G->thunkpos;  if (!yy_DoubleQuoteEnd(G))  goto l1030;
+  goto l1027;
+  l1030:;	  G->pos= yypos1030; G->thunkpos= yythunkpos1030;
+  }  if (!yy_Inline(G))  goto l1027;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_DoubleQuoted, G->begin, G->end, "yy_1_DoubleQuoted");
 
-  l432:;	
-  {  int yypos433= G->pos, yythunkpos433= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l433;
-  goto l432;
-  l433:;	  G->pos= yypos433; G->thunkpos= yythunkpos433;
-  }  if (!yymatchChar(G, '>')) goto l429;
-  yyprintf((stderr, "  ok   HtmlBlockOpenLi"));
+  l1028:;	
+  {  int yypos1029= G->pos, yythunkpos1029= G->thunkpos;
+  {  int yypos1031= G->pos, yythunkpos1031= G->thunkpos;  if (!yy_DoubleQuoteEnd(G))  goto l1031;
+  goto l1029;
+  l1031:;	  G->pos= yypos1031; G->thunkpos= yythunkpos1031;
+  }  if (!yy_Inline(G))  goto l1029;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_DoubleQuoted, G->begin, G->end, "yy_1_DoubleQuoted");
+  goto l1028;
+  l1029:;	  G->pos= yypos1029; G->thunkpos= yythunkpos1029;
+  }  if (!yy_DoubleQuoteEnd(G))  goto l1027;
+  yyDo(G, yy_2_DoubleQuoted, G->begin, G->end, "yy_2_DoubleQuoted");
+  yyprintf((stderr, "  ok   DoubleQuoted"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l429:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenLi"));
+  l1027:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DoubleQuoted"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockFrameset(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockFrameset"));
-  if (!yy_HtmlBlockOpenFrameset(G))  goto l434;
+YY_RULE(int) yy_SingleQuoted(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "SingleQuoted"));
+  if (!yy_SingleQuoteStart(G))  goto l1032;
+  if (!yy_StartList(G))  goto l1032;
+  yyDo(G, yySet, -2, 0, "yySet");
 
-  l435:;	
-  {  int yypos436= G->pos, yythunkpos436= G->thunkpos;
-  {  int yypos437= G->pos, yythunkpos437= G->thunkpos;  if (!yy_HtmlBlockFrameset(G))  goto l438;
-  goto l437;
-  l438:;	  G->pos= yypos437; G->thunkpos= yythunkpos437;
-  {  int yypos439= G->pos, yythunkpos439= G->thunkpos;  if (!yy_HtmlBlockCloseFrameset(G))  goto l439;
-  goto l436;
-  l439:;	  G->pos= yypos439; G->thunkpos= yythunkpos439;
-  }  if (!yymatchDot(G)) goto l436;
-  }
-  l437:;	  goto l435;
-  l436:;	  G->pos= yypos436; G->thunkpos= yythunkpos436;
-  }  if (!yy_HtmlBlockCloseFrameset(G))  goto l434;
-  yyprintf((stderr, "  ok   HtmlBlockFrameset"));
+  {  int yypos1035= G->pos, yythunkpos1035= G->thunkpos;  if (!yy_SingleQuoteEnd(G))  goto l1035;
+  goto l1032;
+  l1035:;	  G->pos= yypos1035; G->thunkpos= yythunkpos1035;
+  }  if (!yy_Inline(G))  goto l1032;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_SingleQuoted, G->begin, G->end, "yy_1_SingleQuoted");
+
+  l1033:;	
+  {  int yypos1034= G->pos, yythunkpos1034= G->thunkpos;
+  {  int yypos1036= G->pos, yythunkpos1036= G->thunkpos;  if (!yy_SingleQuoteEnd(G))  goto l1036;
+  goto l1034;
+  l1036:;	  G->pos= yypos1036; G->thunkpos= yythunkpos1036;
+  }  if (!yy_Inline(G))  goto l1034;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_SingleQuoted, G->begin, G->end, "yy_1_SingleQuoted");
+  goto l1033;
+  l1034:;	  G->pos= yypos1034; G->thunkpos= yythunkpos1034;
+  }  if (!yy_SingleQuoteEnd(G))  goto l1032;
+  yyDo(G, yy_2_SingleQuoted, G->begin, G->end, "yy_2_SingleQuoted");
+  yyprintf((stderr, "  ok   SingleQuoted"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l434:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockFrameset"));
+  l1032:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SingleQuoted"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseFrameset(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseFrameset"));
-  if (!yymatchChar(G, '<')) goto l440;
-  if (!yy_Spnl(G))  goto l440;
-  if (!yymatchChar(G, '/')) goto l440;
+YY_RULE(int) yy_Dash(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Dash"));
 
-  {  int yypos441= G->pos, yythunkpos441= G->thunkpos;  if (!yymatchString(G, "frameset")) goto l442;
-  goto l441;
-  l442:;	  G->pos= yypos441; G->thunkpos= yythunkpos441;  if (!yymatchString(G, "FRAMESET")) goto l440;
+  {  int yypos1038= G->pos, yythunkpos1038= G->thunkpos;  if (!yy_EmDash(G))  goto l1039;
+  goto l1038;
+  l1039:;	  G->pos= yypos1038; G->thunkpos= yythunkpos1038;  if (!yy_EnDash(G))  goto l1037;
 
   }
-  l441:;	  if (!yy_Spnl(G))  goto l440;
-  if (!yymatchChar(G, '>')) goto l440;
-  yyprintf((stderr, "  ok   HtmlBlockCloseFrameset"));
+  l1038:;	  yyprintf((stderr, "  ok   Dash"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l440:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseFrameset"));
+  l1037:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Dash"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenFrameset(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenFrameset"));
-  if (!yymatchChar(G, '<')) goto l443;
-  if (!yy_Spnl(G))  goto l443;
+YY_RULE(int) yy_Ellipsis(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Ellipsis"));
 
-  {  int yypos444= G->pos, yythunkpos444= G->thunkpos;  if (!yymatchString(G, "frameset")) goto l445;
-  goto l444;
-  l445:;	  G->pos= yypos444; G->thunkpos= yythunkpos444;  if (!yymatchString(G, "FRAMESET")) goto l443;
+  {  int yypos1041= G->pos, yythunkpos1041= G->thunkpos;  if (!yymatchString(G, "...")) goto l1042;
+  goto l1041;
+  l1042:;	  G->pos= yypos1041; G->thunkpos= yythunkpos1041;  if (!yymatchString(G, ". . .")) goto l1040;
 
   }
-  l444:;	  if (!yy_Spnl(G))  goto l443;
-
-  l446:;	
-  {  int yypos447= G->pos, yythunkpos447= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l447;
-  goto l446;
-  l447:;	  G->pos= yypos447; G->thunkpos= yythunkpos447;
-  }  if (!yymatchChar(G, '>')) goto l443;
-  yyprintf((stderr, "  ok   HtmlBlockOpenFrameset"));
+  l1041:;	  yyDo(G, yy_1_Ellipsis, G->begin, G->end, "yy_1_Ellipsis");
+  yyprintf((stderr, "  ok   Ellipsis"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l443:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenFrameset"));
+  l1040:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Ellipsis"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockDt(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockDt"));
-  if (!yy_HtmlBlockOpenDt(G))  goto l448;
+YY_RULE(int) yy_Ticks5(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Ticks5"));
+  if (!yymatchString(G, "`````")) goto l1043;
 
-  l449:;	
-  {  int yypos450= G->pos, yythunkpos450= G->thunkpos;
-  {  int yypos451= G->pos, yythunkpos451= G->thunkpos;  if (!yy_HtmlBlockDt(G))  goto l452;
-  goto l451;
-  l452:;	  G->pos= yypos451; G->thunkpos= yythunkpos451;
-  {  int yypos453= G->pos, yythunkpos453= G->thunkpos;  if (!yy_HtmlBlockCloseDt(G))  goto l453;
-  goto l450;
-  l453:;	  G->pos= yypos453; G->thunkpos= yythunkpos453;
-  }  if (!yymatchDot(G)) goto l450;
-  }
-  l451:;	  goto l449;
-  l450:;	  G->pos= yypos450; G->thunkpos= yythunkpos450;
-  }  if (!yy_HtmlBlockCloseDt(G))  goto l448;
-  yyprintf((stderr, "  ok   HtmlBlockDt"));
+  {  int yypos1044= G->pos, yythunkpos1044= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1044;
+  goto l1043;
+  l1044:;	  G->pos= yypos1044; G->thunkpos= yythunkpos1044;
+  }  yyprintf((stderr, "  ok   Ticks5"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l448:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockDt"));
+  l1043:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Ticks5"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseDt(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseDt"));
-  if (!yymatchChar(G, '<')) goto l454;
-  if (!yy_Spnl(G))  goto l454;
-  if (!yymatchChar(G, '/')) goto l454;
-
-  {  int yypos455= G->pos, yythunkpos455= G->thunkpos;  if (!yymatchString(G, "dt")) goto l456;
-  goto l455;
-  l456:;	  G->pos= yypos455; G->thunkpos= yythunkpos455;  if (!yymatchString(G, "DT")) goto l454;
+YY_RULE(int) yy_Ticks4(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Ticks4"));
+  if (!yymatchString(G, "````")) goto l1045;
 
-  }
-  l455:;	  if (!yy_Spnl(G))  goto l454;
-  if (!yymatchChar(G, '>')) goto l454;
-  yyprintf((stderr, "  ok   HtmlBlockCloseDt"));
+  {  int yypos1046= G->pos, yythunkpos1046= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1046;
+  goto l1045;
+  l1046:;	  G->pos= yypos1046; G->thunkpos= yythunkpos1046;
+  }  yyprintf((stderr, "  ok   Ticks4"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l454:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseDt"));
+  l1045:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Ticks4"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenDt(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenDt"));
-  if (!yymatchChar(G, '<')) goto l457;
-  if (!yy_Spnl(G))  goto l457;
-
-  {  int yypos458= G->pos, yythunkpos458= G->thunkpos;  if (!yymatchString(G, "dt")) goto l459;
-  goto l458;
-  l459:;	  G->pos= yypos458; G->thunkpos= yythunkpos458;  if (!yymatchString(G, "DT")) goto l457;
+YY_RULE(int) yy_Ticks3(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Ticks3"));
+  if (!yymatchString(G, "```")) goto l1047;
 
-  }
-  l458:;	  if (!yy_Spnl(G))  goto l457;
-
-  l460:;	
-  {  int yypos461= G->pos, yythunkpos461= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l461;
-  goto l460;
-  l461:;	  G->pos= yypos461; G->thunkpos= yythunkpos461;
-  }  if (!yymatchChar(G, '>')) goto l457;
-  yyprintf((stderr, "  ok   HtmlBlockOpenDt"));
+  {  int yypos1048= G->pos, yythunkpos1048= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1048;
+  goto l1047;
+  l1048:;	  G->pos= yypos1048; G->thunkpos= yythunkpos1048;
+  }  yyprintf((stderr, "  ok   Ticks3"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l457:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenDt"));
+  l1047:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Ticks3"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockDd(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockDd"));
-  if (!yy_HtmlBlockOpenDd(G))  goto l462;
+YY_RULE(int) yy_Ticks2(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Ticks2"));
+  if (!yymatchString(G, "``")) goto l1049;
 
-  l463:;	
-  {  int yypos464= G->pos, yythunkpos464= G->thunkpos;
-  {  int yypos465= G->pos, yythunkpos465= G->thunkpos;  if (!yy_HtmlBlockDd(G))  goto l466;
-  goto l465;
-  l466:;	  G->pos= yypos465; G->thunkpos= yythunkpos465;
-  {  int yypos467= G->pos, yythunkpos467= G->thunkpos;  if (!yy_HtmlBlockCloseDd(G))  goto l467;
-  goto l464;
-  l467:;	  G->pos= yypos467; G->thunkpos= yythunkpos467;
-  }  if (!yymatchDot(G)) goto l464;
-  }
-  l465:;	  goto l463;
-  l464:;	  G->pos= yypos464; G->thunkpos= yythunkpos464;
-  }  if (!yy_HtmlBlockCloseDd(G))  goto l462;
-  yyprintf((stderr, "  ok   HtmlBlockDd"));
+  {  int yypos1050= G->pos, yythunkpos1050= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1050;
+  goto l1049;
+  l1050:;	  G->pos= yypos1050; G->thunkpos= yythunkpos1050;
+  }  yyprintf((stderr, "  ok   Ticks2"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l462:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockDd"));
+  l1049:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Ticks2"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseDd(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseDd"));
-  if (!yymatchChar(G, '<')) goto l468;
-  if (!yy_Spnl(G))  goto l468;
-  if (!yymatchChar(G, '/')) goto l468;
-
-  {  int yypos469= G->pos, yythunkpos469= G->thunkpos;  if (!yymatchString(G, "dd")) goto l470;
-  goto l469;
-  l470:;	  G->pos= yypos469; G->thunkpos= yythunkpos469;  if (!yymatchString(G, "DD")) goto l468;
+YY_RULE(int) yy_Ticks1(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Ticks1"));
+  if (!yymatchChar(G, '`')) goto l1051;
 
-  }
-  l469:;	  if (!yy_Spnl(G))  goto l468;
-  if (!yymatchChar(G, '>')) goto l468;
-  yyprintf((stderr, "  ok   HtmlBlockCloseDd"));
+  {  int yypos1052= G->pos, yythunkpos1052= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1052;
+  goto l1051;
+  l1052:;	  G->pos= yypos1052; G->thunkpos= yythunkpos1052;
+  }  yyprintf((stderr, "  ok   Ticks1"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l468:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseDd"));
+  l1051:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Ticks1"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenDd(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenDd"));
-  if (!yymatchChar(G, '<')) goto l471;
-  if (!yy_Spnl(G))  goto l471;
-
-  {  int yypos472= G->pos, yythunkpos472= G->thunkpos;  if (!yymatchString(G, "dd")) goto l473;
-  goto l472;
-  l473:;	  G->pos= yypos472; G->thunkpos= yythunkpos472;  if (!yymatchString(G, "DD")) goto l471;
+YY_RULE(int) yy_RawNoteBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "RawNoteBlock"));
+  if (!yy_StartList(G))  goto l1053;
+  yyDo(G, yySet, -1, 0, "yySet");
 
+  {  int yypos1056= G->pos, yythunkpos1056= G->thunkpos;  if (!yy_BlankLine(G))  goto l1056;
+  goto l1053;
+  l1056:;	  G->pos= yypos1056; G->thunkpos= yythunkpos1056;
   }
-  l472:;	  if (!yy_Spnl(G))  goto l471;
+  {  int yypos1057= G->pos, yythunkpos1057= G->thunkpos;  if (!yy_NonindentSpace(G))  goto l1057;
+  if (!yy_RawNoteReference(G))  goto l1057;
+  goto l1053;
+  l1057:;	  G->pos= yypos1057; G->thunkpos= yythunkpos1057;
+  }  if (!yy_OptionallyIndentedLine(G))  goto l1053;
+  yyDo(G, yy_1_RawNoteBlock, G->begin, G->end, "yy_1_RawNoteBlock");
 
-  l474:;	
-  {  int yypos475= G->pos, yythunkpos475= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l475;
-  goto l474;
-  l475:;	  G->pos= yypos475; G->thunkpos= yythunkpos475;
-  }  if (!yymatchChar(G, '>')) goto l471;
-  yyprintf((stderr, "  ok   HtmlBlockOpenDd"));
+  l1054:;	
+  {  int yypos1055= G->pos, yythunkpos1055= G->thunkpos;
+  {  int yypos1058= G->pos, yythunkpos1058= G->thunkpos;  if (!yy_BlankLine(G))  goto l1058;
+  goto l1055;
+  l1058:;	  G->pos= yypos1058; G->thunkpos= yythunkpos1058;
+  }
+  {  int yypos1059= G->pos, yythunkpos1059= G->thunkpos;  if (!yy_NonindentSpace(G))  goto l1059;
+  if (!yy_RawNoteReference(G))  goto l1059;
+  goto l1055;
+  l1059:;	  G->pos= yypos1059; G->thunkpos= yythunkpos1059;
+  }  if (!yy_OptionallyIndentedLine(G))  goto l1055;
+  yyDo(G, yy_1_RawNoteBlock, G->begin, G->end, "yy_1_RawNoteBlock");
+  goto l1054;
+  l1055:;	  G->pos= yypos1055; G->thunkpos= yythunkpos1055;
+  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1053;
+  l1060:;	
+  {  int yypos1061= G->pos, yythunkpos1061= G->thunkpos;  if (!yy_BlankLine(G))  goto l1061;
+  goto l1060;
+  l1061:;	  G->pos= yypos1061; G->thunkpos= yythunkpos1061;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1053;  yyDo(G, yy_2_RawNoteBlock, G->begin, G->end, "yy_2_RawNoteBlock");
+  yyDo(G, yy_3_RawNoteBlock, G->begin, G->end, "yy_3_RawNoteBlock");
+  yyprintf((stderr, "  ok   RawNoteBlock"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l471:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenDd"));
+  l1053:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RawNoteBlock"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockVideo(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockVideo"));
-  if (!yy_HtmlBlockOpenVideo(G))  goto l476;
-
-  l477:;	
-  {  int yypos478= G->pos, yythunkpos478= G->thunkpos;
-  {  int yypos479= G->pos, yythunkpos479= G->thunkpos;  if (!yy_HtmlBlockVideo(G))  goto l480;
-  goto l479;
-  l480:;	  G->pos= yypos479; G->thunkpos= yythunkpos479;
-  {  int yypos481= G->pos, yythunkpos481= G->thunkpos;  if (!yy_HtmlBlockCloseVideo(G))  goto l481;
-  goto l478;
-  l481:;	  G->pos= yypos481; G->thunkpos= yythunkpos481;
-  }  if (!yymatchDot(G)) goto l478;
+YY_RULE(int) yy_GlossarySortKey(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "GlossarySortKey"));
+  if (!yymatchChar(G, '(')) goto l1062;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1062;
+  l1063:;	
+  {  int yypos1064= G->pos, yythunkpos1064= G->thunkpos;
+  {  int yypos1065= G->pos, yythunkpos1065= G->thunkpos;  if (!yymatchChar(G, ')')) goto l1065;
+  goto l1064;
+  l1065:;	  G->pos= yypos1065; G->thunkpos= yythunkpos1065;
   }
-  l479:;	  goto l477;
-  l478:;	  G->pos= yypos478; G->thunkpos= yythunkpos478;
-  }  if (!yy_HtmlBlockCloseVideo(G))  goto l476;
-  yyprintf((stderr, "  ok   HtmlBlockVideo"));
+  {  int yypos1066= G->pos, yythunkpos1066= G->thunkpos;  if (!yy_Newline(G))  goto l1066;
+  goto l1064;
+  l1066:;	  G->pos= yypos1066; G->thunkpos= yythunkpos1066;
+  }  if (!yymatchDot(G)) goto l1064;  goto l1063;
+  l1064:;	  G->pos= yypos1064; G->thunkpos= yythunkpos1064;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1062;  if (!yymatchChar(G, ')')) goto l1062;
+  yyDo(G, yy_1_GlossarySortKey, G->begin, G->end, "yy_1_GlossarySortKey");
+  yyprintf((stderr, "  ok   GlossarySortKey"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l476:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockVideo"));
+  l1062:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "GlossarySortKey"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseVideo(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseVideo"));
-  if (!yymatchChar(G, '<')) goto l482;
-  if (!yy_Spnl(G))  goto l482;
-  if (!yymatchChar(G, '/')) goto l482;
-
-  {  int yypos483= G->pos, yythunkpos483= G->thunkpos;  if (!yymatchString(G, "video")) goto l484;
-  goto l483;
-  l484:;	  G->pos= yypos483; G->thunkpos= yythunkpos483;  if (!yymatchString(G, "VIDEO")) goto l482;
-
+YY_RULE(int) yy_GlossaryTerm(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "GlossaryTerm"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1067;
+  {  int yypos1070= G->pos, yythunkpos1070= G->thunkpos;  if (!yy_Newline(G))  goto l1070;
+  goto l1067;
+  l1070:;	  G->pos= yypos1070; G->thunkpos= yythunkpos1070;
+  }
+  {  int yypos1071= G->pos, yythunkpos1071= G->thunkpos;  if (!yymatchChar(G, '(')) goto l1071;
+  goto l1067;
+  l1071:;	  G->pos= yypos1071; G->thunkpos= yythunkpos1071;
+  }  if (!yymatchDot(G)) goto l1067;
+  l1068:;	
+  {  int yypos1069= G->pos, yythunkpos1069= G->thunkpos;
+  {  int yypos1072= G->pos, yythunkpos1072= G->thunkpos;  if (!yy_Newline(G))  goto l1072;
+  goto l1069;
+  l1072:;	  G->pos= yypos1072; G->thunkpos= yythunkpos1072;
   }
-  l483:;	  if (!yy_Spnl(G))  goto l482;
-  if (!yymatchChar(G, '>')) goto l482;
-  yyprintf((stderr, "  ok   HtmlBlockCloseVideo"));
+  {  int yypos1073= G->pos, yythunkpos1073= G->thunkpos;  if (!yymatchChar(G, '(')) goto l1073;
+  goto l1069;
+  l1073:;	  G->pos= yypos1073; G->thunkpos= yythunkpos1073;
+  }  if (!yymatchDot(G)) goto l1069;  goto l1068;
+  l1069:;	  G->pos= yypos1069; G->thunkpos= yythunkpos1069;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1067;  yyDo(G, yy_1_GlossaryTerm, G->begin, G->end, "yy_1_GlossaryTerm");
+  yyprintf((stderr, "  ok   GlossaryTerm"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l482:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseVideo"));
+  l1067:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "GlossaryTerm"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenVideo(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenVideo"));
-  if (!yymatchChar(G, '<')) goto l485;
-  if (!yy_Spnl(G))  goto l485;
+YY_RULE(int) yy_RawNoteReference(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RawNoteReference"));
 
-  {  int yypos486= G->pos, yythunkpos486= G->thunkpos;  if (!yymatchString(G, "video")) goto l487;
-  goto l486;
-  l487:;	  G->pos= yypos486; G->thunkpos= yythunkpos486;  if (!yymatchString(G, "VIDEO")) goto l485;
+  {  int yypos1075= G->pos, yythunkpos1075= G->thunkpos;  if (!yymatchString(G, "[^")) goto l1076;
+  goto l1075;
+  l1076:;	  G->pos= yypos1075; G->thunkpos= yythunkpos1075;  if (!yymatchString(G, "[#")) goto l1074;
 
   }
-  l486:;	  if (!yy_Spnl(G))  goto l485;
-
-  l488:;	
-  {  int yypos489= G->pos, yythunkpos489= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l489;
-  goto l488;
-  l489:;	  G->pos= yypos489; G->thunkpos= yythunkpos489;
-  }  if (!yymatchChar(G, '>')) goto l485;
-  yyprintf((stderr, "  ok   HtmlBlockOpenVideo"));
+  l1075:;	  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1074;
+  {  int yypos1079= G->pos, yythunkpos1079= G->thunkpos;  if (!yy_Newline(G))  goto l1079;
+  goto l1074;
+  l1079:;	  G->pos= yypos1079; G->thunkpos= yythunkpos1079;
+  }
+  {  int yypos1080= G->pos, yythunkpos1080= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1080;
+  goto l1074;
+  l1080:;	  G->pos= yypos1080; G->thunkpos= yythunkpos1080;
+  }  if (!yymatchDot(G)) goto l1074;
+  l1077:;	
+  {  int yypos1078= G->pos, yythunkpos1078= G->thunkpos;
+  {  int yypos1081= G->pos, yythunkpos1081= G->thunkpos;  if (!yy_Newline(G))  goto l1081;
+  goto l1078;
+  l1081:;	  G->pos= yypos1081; G->thunkpos= yythunkpos1081;
+  }
+  {  int yypos1082= G->pos, yythunkpos1082= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1082;
+  goto l1078;
+  l1082:;	  G->pos= yypos1082; G->thunkpos= yythunkpos1082;
+  }  if (!yymatchDot(G)) goto l1078;  goto l1077;
+  l1078:;	  G->pos= yypos1078; G->thunkpos= yythunkpos1078;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1074;  if (!yymatchChar(G, ']')) goto l1074;
+  yyDo(G, yy_1_RawNoteReference, G->begin, G->end, "yy_1_RawNoteReference");
+  yyprintf((stderr, "  ok   RawNoteReference"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l485:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenVideo"));
+  l1074:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RawNoteReference"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockUl(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockUl"));
-  if (!yy_HtmlBlockOpenUl(G))  goto l490;
-
-  l491:;	
-  {  int yypos492= G->pos, yythunkpos492= G->thunkpos;
-  {  int yypos493= G->pos, yythunkpos493= G->thunkpos;  if (!yy_HtmlBlockUl(G))  goto l494;
-  goto l493;
-  l494:;	  G->pos= yypos493; G->thunkpos= yythunkpos493;
-  {  int yypos495= G->pos, yythunkpos495= G->thunkpos;  if (!yy_HtmlBlockCloseUl(G))  goto l495;
-  goto l492;
-  l495:;	  G->pos= yypos495; G->thunkpos= yythunkpos495;
-  }  if (!yymatchDot(G)) goto l492;
-  }
-  l493:;	  goto l491;
-  l492:;	  G->pos= yypos492; G->thunkpos= yythunkpos492;
-  }  if (!yy_HtmlBlockCloseUl(G))  goto l490;
-  yyprintf((stderr, "  ok   HtmlBlockUl"));
+YY_RULE(int) yy_EmptyTitle(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "EmptyTitle"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1083;  if (!yymatchString(G, "")) goto l1083;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1083;  yyprintf((stderr, "  ok   EmptyTitle"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l490:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockUl"));
+  l1083:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "EmptyTitle"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseUl(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseUl"));
-  if (!yymatchChar(G, '<')) goto l496;
-  if (!yy_Spnl(G))  goto l496;
-  if (!yymatchChar(G, '/')) goto l496;
+YY_RULE(int) yy_RefTitleParens(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RefTitleParens"));
+  if (!yy_Spnl(G))  goto l1084;
+  if (!yymatchChar(G, '(')) goto l1084;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1084;
+  l1085:;	
+  {  int yypos1086= G->pos, yythunkpos1086= G->thunkpos;
+  {  int yypos1087= G->pos, yythunkpos1087= G->thunkpos;
+  {  int yypos1088= G->pos, yythunkpos1088= G->thunkpos;  if (!yymatchChar(G, ')')) goto l1089;
+  if (!yy_Sp(G))  goto l1089;
+  if (!yy_Newline(G))  goto l1089;
+  goto l1088;
+  l1089:;	  G->pos= yypos1088; G->thunkpos= yythunkpos1088;  if (!yy_Newline(G))  goto l1090;
+  goto l1088;
+  l1090:;	  G->pos= yypos1088; G->thunkpos= yythunkpos1088;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1087;  if (!yymatchChar(G, ')')) goto l1087;
+  if (!yy_Sp(G))  goto l1087;
+  if (!yy_AlphanumericAscii(G))  goto l1087;
 
-  {  int yypos497= G->pos, yythunkpos497= G->thunkpos;  if (!yymatchString(G, "ul")) goto l498;
-  goto l497;
-  l498:;	  G->pos= yypos497; G->thunkpos= yythunkpos497;  if (!yymatchString(G, "UL")) goto l496;
+  l1091:;	
+  {  int yypos1092= G->pos, yythunkpos1092= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1092;
+  goto l1091;
+  l1092:;	  G->pos= yypos1092; G->thunkpos= yythunkpos1092;
+  }  if (!yymatchChar(G, '=')) goto l1087;
 
   }
-  l497:;	  if (!yy_Spnl(G))  goto l496;
-  if (!yymatchChar(G, '>')) goto l496;
-  yyprintf((stderr, "  ok   HtmlBlockCloseUl"));
+  l1088:;	  goto l1086;
+  l1087:;	  G->pos= yypos1087; G->thunkpos= yythunkpos1087;
+  }  if (!yymatchDot(G)) goto l1086;  goto l1085;
+  l1086:;	  G->pos= yypos1086; G->thunkpos= yythunkpos1086;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1084;  if (!yymatchChar(G, ')')) goto l1084;
+  yyprintf((stderr, "  ok   RefTitleParens"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l496:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseUl"));
+  l1084:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RefTitleParens"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenUl(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenUl"));
-  if (!yymatchChar(G, '<')) goto l499;
-  if (!yy_Spnl(G))  goto l499;
+YY_RULE(int) yy_RefTitleDouble(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RefTitleDouble"));
+  if (!yy_Spnl(G))  goto l1093;
+  if (!yymatchChar(G, '"')) goto l1093;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1093;
+  l1094:;	
+  {  int yypos1095= G->pos, yythunkpos1095= G->thunkpos;
+  {  int yypos1096= G->pos, yythunkpos1096= G->thunkpos;
+  {  int yypos1097= G->pos, yythunkpos1097= G->thunkpos;  if (!yymatchChar(G, '"')) goto l1098;
+  if (!yy_Sp(G))  goto l1098;
+  if (!yy_Newline(G))  goto l1098;
+  goto l1097;
+  l1098:;	  G->pos= yypos1097; G->thunkpos= yythunkpos1097;  if (!yy_Newline(G))  goto l1099;
+  goto l1097;
+  l1099:;	  G->pos= yypos1097; G->thunkpos= yythunkpos1097;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1096;  if (!yymatchChar(G, '"')) goto l1096;
+  if (!yy_Sp(G))  goto l1096;
+  if (!yy_AlphanumericAscii(G))  goto l1096;
 
-  {  int yypos500= G->pos, yythunkpos500= G->thunkpos;  if (!yymatchString(G, "ul")) goto l501;
-  goto l500;
-  l501:;	  G->pos= yypos500; G->thunkpos= yythunkpos500;  if (!yymatchString(G, "UL")) goto l499;
+  l1100:;	
+  {  int yypos1101= G->pos, yythunkpos1101= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1101;
+  goto l1100;
+  l1101:;	  G->pos= yypos1101; G->thunkpos= yythunkpos1101;
+  }  if (!yymatchChar(G, '=')) goto l1096;
 
   }
-  l500:;	  if (!yy_Spnl(G))  goto l499;
-
-  l502:;	
-  {  int yypos503= G->pos, yythunkpos503= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l503;
-  goto l502;
-  l503:;	  G->pos= yypos503; G->thunkpos= yythunkpos503;
-  }  if (!yymatchChar(G, '>')) goto l499;
-  yyprintf((stderr, "  ok   HtmlBlockOpenUl"));
+  l1097:;	  goto l1095;
+  l1096:;	  G->pos= yypos1096; G->thunkpos= yythunkpos1096;
+  }  if (!yymatchDot(G)) goto l1095;  goto l1094;
+  l1095:;	  G->pos= yypos1095; G->thunkpos= yythunkpos1095;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1093;  if (!yymatchChar(G, '"')) goto l1093;
+  yyprintf((stderr, "  ok   RefTitleDouble"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l499:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenUl"));
+  l1093:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RefTitleDouble"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockTable(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockTable"));
-  if (!yy_HtmlBlockOpenTable(G))  goto l504;
+YY_RULE(int) yy_RefTitleSingle(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RefTitleSingle"));
+  if (!yy_Spnl(G))  goto l1102;
+  if (!yymatchChar(G, '\'')) goto l1102;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1102;
+  l1103:;	
+  {  int yypos1104= G->pos, yythunkpos1104= G->thunkpos;
+  {  int yypos1105= G->pos, yythunkpos1105= G->thunkpos;
+  {  int yypos1106= G->pos, yythunkpos1106= G->thunkpos;  if (!yymatchChar(G, '\'')) goto l1107;
+  if (!yy_Sp(G))  goto l1107;
+  if (!yy_Newline(G))  goto l1107;
+  goto l1106;
+  l1107:;	  G->pos= yypos1106; G->thunkpos= yythunkpos1106;  if (!yy_Newline(G))  goto l1108;
+  goto l1106;
+  l1108:;	  G->pos= yypos1106; G->thunkpos= yythunkpos1106;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1105;  if (!yymatchChar(G, '\'')) goto l1105;
+  if (!yy_Sp(G))  goto l1105;
+  if (!yy_AlphanumericAscii(G))  goto l1105;
+
+  l1109:;	
+  {  int yypos1110= G->pos, yythunkpos1110= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1110;
+  goto l1109;
+  l1110:;	  G->pos= yypos1110; G->thunkpos= yythunkpos1110;
+  }  if (!yymatchChar(G, '=')) goto l1105;
 
-  l505:;	
-  {  int yypos506= G->pos, yythunkpos506= G->thunkpos;
-  {  int yypos507= G->pos, yythunkpos507= G->thunkpos;  if (!yy_HtmlBlockTable(G))  goto l508;
-  goto l507;
-  l508:;	  G->pos= yypos507; G->thunkpos= yythunkpos507;
-  {  int yypos509= G->pos, yythunkpos509= G->thunkpos;  if (!yy_HtmlBlockCloseTable(G))  goto l509;
-  goto l506;
-  l509:;	  G->pos= yypos509; G->thunkpos= yythunkpos509;
-  }  if (!yymatchDot(G)) goto l506;
   }
-  l507:;	  goto l505;
-  l506:;	  G->pos= yypos506; G->thunkpos= yythunkpos506;
-  }  if (!yy_HtmlBlockCloseTable(G))  goto l504;
-  yyprintf((stderr, "  ok   HtmlBlockTable"));
+  l1106:;	  goto l1104;
+  l1105:;	  G->pos= yypos1105; G->thunkpos= yythunkpos1105;
+  }  if (!yymatchDot(G)) goto l1104;  goto l1103;
+  l1104:;	  G->pos= yypos1104; G->thunkpos= yythunkpos1104;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1102;  if (!yymatchChar(G, '\'')) goto l1102;
+  yyprintf((stderr, "  ok   RefTitleSingle"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l504:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockTable"));
+  l1102:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RefTitleSingle"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseTable(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseTable"));
-  if (!yymatchChar(G, '<')) goto l510;
-  if (!yy_Spnl(G))  goto l510;
-  if (!yymatchChar(G, '/')) goto l510;
+YY_RULE(int) yy_UnQuotedValue(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "UnQuotedValue"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1111;
+  {  int yypos1114= G->pos, yythunkpos1114= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1115;
+  goto l1114;
+  l1115:;	  G->pos= yypos1114; G->thunkpos= yythunkpos1114;  if (!yymatchChar(G, '.')) goto l1111;
 
-  {  int yypos511= G->pos, yythunkpos511= G->thunkpos;  if (!yymatchString(G, "table")) goto l512;
-  goto l511;
-  l512:;	  G->pos= yypos511; G->thunkpos= yythunkpos511;  if (!yymatchString(G, "TABLE")) goto l510;
+  }
+  l1114:;	
+  l1112:;	
+  {  int yypos1113= G->pos, yythunkpos1113= G->thunkpos;
+  {  int yypos1116= G->pos, yythunkpos1116= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1117;
+  goto l1116;
+  l1117:;	  G->pos= yypos1116; G->thunkpos= yythunkpos1116;  if (!yymatchChar(G, '.')) goto l1113;
 
   }
-  l511:;	  if (!yy_Spnl(G))  goto l510;
-  if (!yymatchChar(G, '>')) goto l510;
-  yyprintf((stderr, "  ok   HtmlBlockCloseTable"));
+  l1116:;	  goto l1112;
+  l1113:;	  G->pos= yypos1113; G->thunkpos= yythunkpos1113;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1111;  yyprintf((stderr, "  ok   UnQuotedValue"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l510:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseTable"));
+  l1111:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "UnQuotedValue"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenTable(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenTable"));
-  if (!yymatchChar(G, '<')) goto l513;
-  if (!yy_Spnl(G))  goto l513;
-
-  {  int yypos514= G->pos, yythunkpos514= G->thunkpos;  if (!yymatchString(G, "table")) goto l515;
-  goto l514;
-  l515:;	  G->pos= yypos514; G->thunkpos= yythunkpos514;  if (!yymatchString(G, "TABLE")) goto l513;
-
-  }
-  l514:;	  if (!yy_Spnl(G))  goto l513;
-
-  l516:;	
-  {  int yypos517= G->pos, yythunkpos517= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l517;
-  goto l516;
-  l517:;	  G->pos= yypos517; G->thunkpos= yythunkpos517;
-  }  if (!yymatchChar(G, '>')) goto l513;
-  yyprintf((stderr, "  ok   HtmlBlockOpenTable"));
+YY_RULE(int) yy_QuotedValue(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "QuotedValue"));
+  if (!yymatchChar(G, '"')) goto l1118;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1118;
+  l1119:;	
+  {  int yypos1120= G->pos, yythunkpos1120= G->thunkpos;
+  {  int yypos1121= G->pos, yythunkpos1121= G->thunkpos;  if (!yymatchChar(G, '"')) goto l1121;
+  goto l1120;
+  l1121:;	  G->pos= yypos1121; G->thunkpos= yythunkpos1121;
+  }  if (!yymatchDot(G)) goto l1120;  goto l1119;
+  l1120:;	  G->pos= yypos1120; G->thunkpos= yythunkpos1120;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1118;  if (!yymatchChar(G, '"')) goto l1118;
+  yyprintf((stderr, "  ok   QuotedValue"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l513:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenTable"));
+  l1118:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "QuotedValue"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockSection(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockSection"));
-  if (!yy_HtmlBlockOpenSection(G))  goto l518;
+YY_RULE(int) yy_AttrValue(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AttrValue"));
+
+  {  int yypos1123= G->pos, yythunkpos1123= G->thunkpos;  if (!yy_QuotedValue(G))  goto l1124;
+  goto l1123;
+  l1124:;	  G->pos= yypos1123; G->thunkpos= yythunkpos1123;  if (!yy_UnQuotedValue(G))  goto l1122;
 
-  l519:;	
-  {  int yypos520= G->pos, yythunkpos520= G->thunkpos;
-  {  int yypos521= G->pos, yythunkpos521= G->thunkpos;  if (!yy_HtmlBlockSection(G))  goto l522;
-  goto l521;
-  l522:;	  G->pos= yypos521; G->thunkpos= yythunkpos521;
-  {  int yypos523= G->pos, yythunkpos523= G->thunkpos;  if (!yy_HtmlBlockCloseSection(G))  goto l523;
-  goto l520;
-  l523:;	  G->pos= yypos523; G->thunkpos= yythunkpos523;
-  }  if (!yymatchDot(G)) goto l520;
   }
-  l521:;	  goto l519;
-  l520:;	  G->pos= yypos520; G->thunkpos= yythunkpos520;
-  }  if (!yy_HtmlBlockCloseSection(G))  goto l518;
-  yyprintf((stderr, "  ok   HtmlBlockSection"));
+  l1123:;	  yyDo(G, yy_1_AttrValue, G->begin, G->end, "yy_1_AttrValue");
+  yyprintf((stderr, "  ok   AttrValue"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l518:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockSection"));
+  l1122:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AttrValue"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseSection(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseSection"));
-  if (!yymatchChar(G, '<')) goto l524;
-  if (!yy_Spnl(G))  goto l524;
-  if (!yymatchChar(G, '/')) goto l524;
-
-  {  int yypos525= G->pos, yythunkpos525= G->thunkpos;  if (!yymatchString(G, "section")) goto l526;
-  goto l525;
-  l526:;	  G->pos= yypos525; G->thunkpos= yythunkpos525;  if (!yymatchString(G, "SECTION")) goto l524;
+YY_RULE(int) yy_AttrKey(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AttrKey"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1125;  if (!yy_AlphanumericAscii(G))  goto l1125;
 
-  }
-  l525:;	  if (!yy_Spnl(G))  goto l524;
-  if (!yymatchChar(G, '>')) goto l524;
-  yyprintf((stderr, "  ok   HtmlBlockCloseSection"));
+  l1126:;	
+  {  int yypos1127= G->pos, yythunkpos1127= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1127;
+  goto l1126;
+  l1127:;	  G->pos= yypos1127; G->thunkpos= yythunkpos1127;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1125;  yyDo(G, yy_1_AttrKey, G->begin, G->end, "yy_1_AttrKey");
+  yyprintf((stderr, "  ok   AttrKey"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l524:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseSection"));
+  l1125:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AttrKey"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenSection(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenSection"));
-  if (!yymatchChar(G, '<')) goto l527;
-  if (!yy_Spnl(G))  goto l527;
-
-  {  int yypos528= G->pos, yythunkpos528= G->thunkpos;  if (!yymatchString(G, "section")) goto l529;
-  goto l528;
-  l529:;	  G->pos= yypos528; G->thunkpos= yythunkpos528;  if (!yymatchString(G, "SECTION")) goto l527;
-
-  }
-  l528:;	  if (!yy_Spnl(G))  goto l527;
-
-  l530:;	
-  {  int yypos531= G->pos, yythunkpos531= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l531;
-  goto l530;
-  l531:;	  G->pos= yypos531; G->thunkpos= yythunkpos531;
-  }  if (!yymatchChar(G, '>')) goto l527;
-  yyprintf((stderr, "  ok   HtmlBlockOpenSection"));
+YY_RULE(int) yy_Attribute(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "Attribute"));
+  if (!yy_Spnl(G))  goto l1128;
+  if (!yy_AttrKey(G))  goto l1128;
+  yyDo(G, yySet, -2, 0, "yySet");
+  if (!yymatchChar(G, '=')) goto l1128;
+  if (!yy_AttrValue(G))  goto l1128;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_Attribute, G->begin, G->end, "yy_1_Attribute");
+  yyprintf((stderr, "  ok   Attribute"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l527:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenSection"));
+  l1128:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Attribute"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockProgress(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockProgress"));
-  if (!yy_HtmlBlockOpenProgress(G))  goto l532;
+YY_RULE(int) yy_Attributes(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "Attributes"));
+  if (!yy_StartList(G))  goto l1129;
+  yyDo(G, yySet, -1, 0, "yySet");
+  if (!yy_Attribute(G))  goto l1129;
+  yyDo(G, yy_1_Attributes, G->begin, G->end, "yy_1_Attributes");
 
-  l533:;	
-  {  int yypos534= G->pos, yythunkpos534= G->thunkpos;
-  {  int yypos535= G->pos, yythunkpos535= G->thunkpos;  if (!yy_HtmlBlockProgress(G))  goto l536;
-  goto l535;
-  l536:;	  G->pos= yypos535; G->thunkpos= yythunkpos535;
-  {  int yypos537= G->pos, yythunkpos537= G->thunkpos;  if (!yy_HtmlBlockCloseProgress(G))  goto l537;
-  goto l534;
-  l537:;	  G->pos= yypos537; G->thunkpos= yythunkpos537;
-  }  if (!yymatchDot(G)) goto l534;
-  }
-  l535:;	  goto l533;
-  l534:;	  G->pos= yypos534; G->thunkpos= yythunkpos534;
-  }  if (!yy_HtmlBlockCloseProgress(G))  goto l532;
-  yyprintf((stderr, "  ok   HtmlBlockProgress"));
+  l1130:;	
+  {  int yypos1131= G->pos, yythunkpos1131= G->thunkpos;  if (!yy_Attribute(G))  goto l1131;
+  yyDo(G, yy_1_Attributes, G->begin, G->end, "yy_1_Attributes");
+  goto l1130;
+  l1131:;	  G->pos= yypos1131; G->thunkpos= yythunkpos1131;
+  }  yyDo(G, yy_2_Attributes, G->begin, G->end, "yy_2_Attributes");
+  yyprintf((stderr, "  ok   Attributes"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l532:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockProgress"));
+  l1129:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Attributes"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseProgress(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseProgress"));
-  if (!yymatchChar(G, '<')) goto l538;
-  if (!yy_Spnl(G))  goto l538;
-  if (!yymatchChar(G, '/')) goto l538;
+YY_RULE(int) yy_RefTitle(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RefTitle"));
 
-  {  int yypos539= G->pos, yythunkpos539= G->thunkpos;  if (!yymatchString(G, "progress")) goto l540;
-  goto l539;
-  l540:;	  G->pos= yypos539; G->thunkpos= yythunkpos539;  if (!yymatchString(G, "PROGRESS")) goto l538;
+  {  int yypos1133= G->pos, yythunkpos1133= G->thunkpos;  if (!yy_RefTitleSingle(G))  goto l1134;
+  goto l1133;
+  l1134:;	  G->pos= yypos1133; G->thunkpos= yythunkpos1133;  if (!yy_RefTitleDouble(G))  goto l1135;
+  goto l1133;
+  l1135:;	  G->pos= yypos1133; G->thunkpos= yythunkpos1133;  if (!yy_RefTitleParens(G))  goto l1136;
+  goto l1133;
+  l1136:;	  G->pos= yypos1133; G->thunkpos= yythunkpos1133;  if (!yy_EmptyTitle(G))  goto l1132;
 
   }
-  l539:;	  if (!yy_Spnl(G))  goto l538;
-  if (!yymatchChar(G, '>')) goto l538;
-  yyprintf((stderr, "  ok   HtmlBlockCloseProgress"));
+  l1133:;	  yyDo(G, yy_1_RefTitle, G->begin, G->end, "yy_1_RefTitle");
+  yyprintf((stderr, "  ok   RefTitle"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l538:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseProgress"));
+  l1132:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RefTitle"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenProgress(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenProgress"));
-  if (!yymatchChar(G, '<')) goto l541;
-  if (!yy_Spnl(G))  goto l541;
-
-  {  int yypos542= G->pos, yythunkpos542= G->thunkpos;  if (!yymatchString(G, "progress")) goto l543;
-  goto l542;
-  l543:;	  G->pos= yypos542; G->thunkpos= yythunkpos542;  if (!yymatchString(G, "PROGRESS")) goto l541;
-
-  }
-  l542:;	  if (!yy_Spnl(G))  goto l541;
+YY_RULE(int) yy_RefSrc(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RefSrc"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1137;  if (!yy_Nonspacechar(G))  goto l1137;
 
-  l544:;	
-  {  int yypos545= G->pos, yythunkpos545= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l545;
-  goto l544;
-  l545:;	  G->pos= yypos545; G->thunkpos= yythunkpos545;
-  }  if (!yymatchChar(G, '>')) goto l541;
-  yyprintf((stderr, "  ok   HtmlBlockOpenProgress"));
+  l1138:;	
+  {  int yypos1139= G->pos, yythunkpos1139= G->thunkpos;  if (!yy_Nonspacechar(G))  goto l1139;
+  goto l1138;
+  l1139:;	  G->pos= yypos1139; G->thunkpos= yythunkpos1139;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1137;  yyDo(G, yy_1_RefSrc, G->begin, G->end, "yy_1_RefSrc");
+  yyprintf((stderr, "  ok   RefSrc"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l541:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenProgress"));
+  l1137:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RefSrc"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockPre(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockPre"));
-  if (!yy_HtmlBlockOpenPre(G))  goto l546;
+/* AutoLinkEmail -- '<' "mailto:"? [-A-Za-z0-9+_./!%~$]+ '@'
+	(!Newline !'>' .)+ '>', ended by yySpanEnd */
+YY_RULE(int) yy_AutoLinkEmail(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  int yyend;  yyprintfv((stderr, "%s\n", "AutoLinkEmail"));
+  if (!yymatchChar(G, '<')) goto l1140;
 
-  l547:;	
-  {  int yypos548= G->pos, yythunkpos548= G->thunkpos;
-  {  int yypos549= G->pos, yythunkpos549= G->thunkpos;  if (!yy_HtmlBlockPre(G))  goto l550;
-  goto l549;
-  l550:;	  G->pos= yypos549; G->thunkpos= yythunkpos549;
-  {  int yypos551= G->pos, yythunkpos551= G->thunkpos;  if (!yy_HtmlBlockClosePre(G))  goto l551;
-  goto l548;
-  l551:;	  G->pos= yypos551; G->thunkpos= yythunkpos551;
-  }  if (!yymatchDot(G)) goto l548;
+  {  int yypos1141= G->pos, yythunkpos1141= G->thunkpos;  if (!yymatchString(G, "mailto:")) goto l1141;
+  goto l1142;
+  l1141:;	  G->pos= yypos1141; G->thunkpos= yythunkpos1141;
   }
-  l549:;	  goto l547;
-  l548:;	  G->pos= yypos548; G->thunkpos= yythunkpos548;
-  }  if (!yy_HtmlBlockClosePre(G))  goto l546;
-  yyprintf((stderr, "  ok   HtmlBlockPre"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l546:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockPre"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockClosePre(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockClosePre"));
-  if (!yymatchChar(G, '<')) goto l552;
-  if (!yy_Spnl(G))  goto l552;
-  if (!yymatchChar(G, '/')) goto l552;
+  l1142:;	  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1140;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\062\350\377\003\376\377\377\207\376\377\377\107\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "-A-Za-z0-9+_./!%%~$")) goto l1140;
 
-  {  int yypos553= G->pos, yythunkpos553= G->thunkpos;  if (!yymatchString(G, "pre")) goto l554;
-  goto l553;
-  l554:;	  G->pos= yypos553; G->thunkpos= yythunkpos553;  if (!yymatchString(G, "PRE")) goto l552;
+  l1143:;	
+  {  int yypos1144= G->pos, yythunkpos1144= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\062\350\377\003\376\377\377\207\376\377\377\107\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "-A-Za-z0-9+_./!%%~$")) goto l1144;
+  goto l1143;
+  l1144:;	  G->pos= yypos1144; G->thunkpos= yythunkpos1144;
+  }  if (!yymatchChar(G, '@')) goto l1140;
 
-  }
-  l553:;	  if (!yy_Spnl(G))  goto l552;
-  if (!yymatchChar(G, '>')) goto l552;
-  yyprintf((stderr, "  ok   HtmlBlockClosePre"));
+  if ((yyend= yySpanEnd(G, SPAN_AUTOLINK, G->pos)) <= G->pos) goto l1140;
+  G->pos= yyend;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1140;  if (!yymatchChar(G, '>')) goto l1140;
+  yyDo(G, yy_1_AutoLinkEmail, G->begin, G->end, "yy_1_AutoLinkEmail");
+  yyprintf((stderr, "  ok   AutoLinkEmail"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l552:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockClosePre"));
+  l1140:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AutoLinkEmail"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenPre(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenPre"));
-  if (!yymatchChar(G, '<')) goto l555;
-  if (!yy_Spnl(G))  goto l555;
-
-  {  int yypos556= G->pos, yythunkpos556= G->thunkpos;  if (!yymatchString(G, "pre")) goto l557;
-  goto l556;
-  l557:;	  G->pos= yypos556; G->thunkpos= yythunkpos556;  if (!yymatchString(G, "PRE")) goto l555;
+/* AutoLinkUrl -- '<' [A-Za-z]+ "://" (!Newline !'>' .)+ '>', ended by
+	yySpanEnd */
+YY_RULE(int) yy_AutoLinkUrl(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  int yyend;  yyprintfv((stderr, "%s\n", "AutoLinkUrl"));
+  if (!yymatchChar(G, '<')) goto l1151;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1151;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z")) goto l1151;
 
-  }
-  l556:;	  if (!yy_Spnl(G))  goto l555;
+  l1152:;	
+  {  int yypos1153= G->pos, yythunkpos1153= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z")) goto l1153;
+  goto l1152;
+  l1153:;	  G->pos= yypos1153; G->thunkpos= yythunkpos1153;
+  }  if (!yymatchString(G, "://")) goto l1151;
 
-  l558:;	
-  {  int yypos559= G->pos, yythunkpos559= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l559;
-  goto l558;
-  l559:;	  G->pos= yypos559; G->thunkpos= yythunkpos559;
-  }  if (!yymatchChar(G, '>')) goto l555;
-  yyprintf((stderr, "  ok   HtmlBlockOpenPre"));
+  if ((yyend= yySpanEnd(G, SPAN_AUTOLINK, G->pos)) <= G->pos) goto l1151;
+  G->pos= yyend;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1151;  if (!yymatchChar(G, '>')) goto l1151;
+  yyDo(G, yy_1_AutoLinkUrl, G->begin, G->end, "yy_1_AutoLinkUrl");
+  yyprintf((stderr, "  ok   AutoLinkUrl"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l555:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenPre"));
+  l1151:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AutoLinkUrl"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockP(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockP"));
-  if (!yy_HtmlBlockOpenP(G))  goto l560;
+YY_RULE(int) yy_TitleDouble(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "TitleDouble"));
+  if (!yymatchChar(G, '"')) goto l1160;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1160;
+  l1161:;	
+  {  int yypos1162= G->pos, yythunkpos1162= G->thunkpos;
+  {  int yypos1163= G->pos, yythunkpos1163= G->thunkpos;  if (!yymatchChar(G, '"')) goto l1163;
+  if (!yy_Sp(G))  goto l1163;
+
+  {  int yypos1164= G->pos, yythunkpos1164= G->thunkpos;  if (!yymatchChar(G, ')')) goto l1165;
+  goto l1164;
+  l1165:;	  G->pos= yypos1164; G->thunkpos= yythunkpos1164;  if (!yy_Newline(G))  goto l1163;
 
-  l561:;	
-  {  int yypos562= G->pos, yythunkpos562= G->thunkpos;
-  {  int yypos563= G->pos, yythunkpos563= G->thunkpos;  if (!yy_HtmlBlockP(G))  goto l564;
-  goto l563;
-  l564:;	  G->pos= yypos563; G->thunkpos= yythunkpos563;
-  {  int yypos565= G->pos, yythunkpos565= G->thunkpos;  if (!yy_HtmlBlockCloseP(G))  goto l565;
-  goto l562;
-  l565:;	  G->pos= yypos565; G->thunkpos= yythunkpos565;
-  }  if (!yymatchDot(G)) goto l562;
   }
-  l563:;	  goto l561;
-  l562:;	  G->pos= yypos562; G->thunkpos= yythunkpos562;
-  }  if (!yy_HtmlBlockCloseP(G))  goto l560;
-  yyprintf((stderr, "  ok   HtmlBlockP"));
+  l1164:;	  goto l1162;
+  l1163:;	  G->pos= yypos1163; G->thunkpos= yythunkpos1163;
+  }  if (!yymatchDot(G)) goto l1162;  goto l1161;
+  l1162:;	  G->pos= yypos1162; G->thunkpos= yythunkpos1162;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1160;  if (!yymatchChar(G, '"')) goto l1160;
+  yyprintf((stderr, "  ok   TitleDouble"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l560:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockP"));
+  l1160:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "TitleDouble"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseP(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseP"));
-  if (!yymatchChar(G, '<')) goto l566;
-  if (!yy_Spnl(G))  goto l566;
-  if (!yymatchChar(G, '/')) goto l566;
+YY_RULE(int) yy_TitleSingle(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "TitleSingle"));
+  if (!yymatchChar(G, '\'')) goto l1166;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1166;
+  l1167:;	
+  {  int yypos1168= G->pos, yythunkpos1168= G->thunkpos;
+  {  int yypos1169= G->pos, yythunkpos1169= G->thunkpos;  if (!yymatchChar(G, '\'')) goto l1169;
+  if (!yy_Sp(G))  goto l1169;
 
-  {  int yypos567= G->pos, yythunkpos567= G->thunkpos;  if (!yymatchChar(G, 'p')) goto l568;
-  goto l567;
-  l568:;	  G->pos= yypos567; G->thunkpos= yythunkpos567;  if (!yymatchChar(G, 'P')) goto l566;
+  {  int yypos1170= G->pos, yythunkpos1170= G->thunkpos;  if (!yymatchChar(G, ')')) goto l1171;
+  goto l1170;
+  l1171:;	  G->pos= yypos1170; G->thunkpos= yythunkpos1170;  if (!yy_Newline(G))  goto l1169;
 
   }
-  l567:;	  if (!yy_Spnl(G))  goto l566;
-  if (!yymatchChar(G, '>')) goto l566;
-  yyprintf((stderr, "  ok   HtmlBlockCloseP"));
+  l1170:;	  goto l1168;
+  l1169:;	  G->pos= yypos1169; G->thunkpos= yythunkpos1169;
+  }  if (!yymatchDot(G)) goto l1168;  goto l1167;
+  l1168:;	  G->pos= yypos1168; G->thunkpos= yythunkpos1168;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1166;  if (!yymatchChar(G, '\'')) goto l1166;
+  yyprintf((stderr, "  ok   TitleSingle"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l566:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseP"));
+  l1166:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "TitleSingle"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenP(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenP"));
-  if (!yymatchChar(G, '<')) goto l569;
-  if (!yy_Spnl(G))  goto l569;
+YY_RULE(int) yy_SourceContents(GREG *G)
+{  yyprintfv((stderr, "%s\n", "SourceContents"));
 
-  {  int yypos570= G->pos, yythunkpos570= G->thunkpos;  if (!yymatchChar(G, 'p')) goto l571;
-  goto l570;
-  l571:;	  G->pos= yypos570; G->thunkpos= yythunkpos570;  if (!yymatchChar(G, 'P')) goto l569;
+  l1173:;	
+  {  int yypos1174= G->pos, yythunkpos1174= G->thunkpos;
+  {  int yypos1175= G->pos, yythunkpos1175= G->thunkpos;
+  {  int yypos1179= G->pos, yythunkpos1179= G->thunkpos;  if (!yymatchChar(G, '(')) goto l1179;
+  goto l1176;
+  l1179:;	  G->pos= yypos1179; G->thunkpos= yythunkpos1179;
+  }
+  {  int yypos1180= G->pos, yythunkpos1180= G->thunkpos;  if (!yymatchChar(G, ')')) goto l1180;
+  goto l1176;
+  l1180:;	  G->pos= yypos1180; G->thunkpos= yythunkpos1180;
+  }
+  {  int yypos1181= G->pos, yythunkpos1181= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1181;
+  goto l1176;
+  l1181:;	  G->pos= yypos1181; G->thunkpos= yythunkpos1181;
+  }  if (!yy_Nonspacechar(G))  goto l1176;
 
+  l1177:;	
+  {  int yypos1178= G->pos, yythunkpos1178= G->thunkpos;
+  {  int yypos1182= G->pos, yythunkpos1182= G->thunkpos;  if (!yymatchChar(G, '(')) goto l1182;
+  goto l1178;
+  l1182:;	  G->pos= yypos1182; G->thunkpos= yythunkpos1182;
+  }
+  {  int yypos1183= G->pos, yythunkpos1183= G->thunkpos;  if (!yymatchChar(G, ')')) goto l1183;
+  goto l1178;
+  l1183:;	  G->pos= yypos1183; G->thunkpos= yythunkpos1183;
   }
-  l570:;	  if (!yy_Spnl(G))  goto l569;
+  {  int yypos1184= G->pos, yythunkpos1184= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1184;
+  goto l1178;
+  l1184:;	  G->pos= yypos1184; G->thunkpos= yythunkpos1184;
+  }  if (!yy_Nonspacechar(G))  goto l1178;
+  goto l1177;
+  l1178:;	  G->pos= yypos1178; G->thunkpos= yythunkpos1178;
+  }  goto l1175;
+  l1176:;	  G->pos= yypos1175; G->thunkpos= yythunkpos1175;  if (!yymatchChar(G, '(')) goto l1174;
+  if (!yy_SourceContents(G))  goto l1174;
+  if (!yymatchChar(G, ')')) goto l1174;
 
-  l572:;	
-  {  int yypos573= G->pos, yythunkpos573= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l573;
-  goto l572;
-  l573:;	  G->pos= yypos573; G->thunkpos= yythunkpos573;
-  }  if (!yymatchChar(G, '>')) goto l569;
-  yyprintf((stderr, "  ok   HtmlBlockOpenP"));
+  }
+  l1175:;	  goto l1173;
+  l1174:;	  G->pos= yypos1174; G->thunkpos= yythunkpos1174;
+  }  yyprintf((stderr, "  ok   SourceContents"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l569:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenP"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
 }
-YY_RULE(int) yy_HtmlBlockOl(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOl"));
-  if (!yy_HtmlBlockOpenOl(G))  goto l574;
+YY_RULE(int) yy_Title(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Title"));
 
-  l575:;	
-  {  int yypos576= G->pos, yythunkpos576= G->thunkpos;
-  {  int yypos577= G->pos, yythunkpos577= G->thunkpos;  if (!yy_HtmlBlockOl(G))  goto l578;
-  goto l577;
-  l578:;	  G->pos= yypos577; G->thunkpos= yythunkpos577;
-  {  int yypos579= G->pos, yythunkpos579= G->thunkpos;  if (!yy_HtmlBlockCloseOl(G))  goto l579;
-  goto l576;
-  l579:;	  G->pos= yypos579; G->thunkpos= yythunkpos579;
-  }  if (!yymatchDot(G)) goto l576;
+  {  int yypos1186= G->pos, yythunkpos1186= G->thunkpos;  if (!yy_TitleSingle(G))  goto l1187;
+  goto l1186;
+  l1187:;	  G->pos= yypos1186; G->thunkpos= yythunkpos1186;  if (!yy_TitleDouble(G))  goto l1188;
+  goto l1186;
+  l1188:;	  G->pos= yypos1186; G->thunkpos= yythunkpos1186;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1185;  if (!yymatchString(G, "")) goto l1185;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1185;
   }
-  l577:;	  goto l575;
-  l576:;	  G->pos= yypos576; G->thunkpos= yythunkpos576;
-  }  if (!yy_HtmlBlockCloseOl(G))  goto l574;
-  yyprintf((stderr, "  ok   HtmlBlockOl"));
+  l1186:;	  yyDo(G, yy_1_Title, G->begin, G->end, "yy_1_Title");
+  yyprintf((stderr, "  ok   Title"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l574:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOl"));
+  l1185:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Title"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseOl(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseOl"));
-  if (!yymatchChar(G, '<')) goto l580;
-  if (!yy_Spnl(G))  goto l580;
-  if (!yymatchChar(G, '/')) goto l580;
-
-  {  int yypos581= G->pos, yythunkpos581= G->thunkpos;  if (!yymatchString(G, "ol")) goto l582;
-  goto l581;
-  l582:;	  G->pos= yypos581; G->thunkpos= yythunkpos581;  if (!yymatchString(G, "OL")) goto l580;
+YY_RULE(int) yy_Source(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Source"));
 
+  {  int yypos1190= G->pos, yythunkpos1190= G->thunkpos;  if (!yymatchChar(G, '<')) goto l1191;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1191;  if (!yy_SourceContents(G))  goto l1191;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1191;  if (!yymatchChar(G, '>')) goto l1191;
+  goto l1190;
+  l1191:;	  G->pos= yypos1190; G->thunkpos= yythunkpos1190;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1189;  if (!yy_SourceContents(G))  goto l1189;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1189;
   }
-  l581:;	  if (!yy_Spnl(G))  goto l580;
-  if (!yymatchChar(G, '>')) goto l580;
-  yyprintf((stderr, "  ok   HtmlBlockCloseOl"));
+  l1190:;	  yyDo(G, yy_1_Source, G->begin, G->end, "yy_1_Source");
+  yyprintf((stderr, "  ok   Source"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l580:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseOl"));
+  l1189:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Source"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenOl(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenOl"));
-  if (!yymatchChar(G, '<')) goto l583;
-  if (!yy_Spnl(G))  goto l583;
-
-  {  int yypos584= G->pos, yythunkpos584= G->thunkpos;  if (!yymatchString(G, "ol")) goto l585;
-  goto l584;
-  l585:;	  G->pos= yypos584; G->thunkpos= yythunkpos584;  if (!yymatchString(G, "OL")) goto l583;
-
-  }
-  l584:;	  if (!yy_Spnl(G))  goto l583;
-
-  l586:;	
-  {  int yypos587= G->pos, yythunkpos587= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l587;
-  goto l586;
-  l587:;	  G->pos= yypos587; G->thunkpos= yythunkpos587;
-  }  if (!yymatchChar(G, '>')) goto l583;
-  yyprintf((stderr, "  ok   HtmlBlockOpenOl"));
+/* RawCitationReference -- "[#" (!Newline !']' .)+ ']', with the label's end
+	found by yySpanEnd, so that with EXT_LINEAR_INLINES a paragraph of
+	unclosed "[#" isn't scanned again from each one */
+YY_RULE(int) yy_RawCitationReference(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  int yyend;  yyprintfv((stderr, "%s\n", "RawCitationReference"));
+  if (!yymatchString(G, "[#")) goto l1192;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1192;
+  if ((yyend= yySpanEnd(G, SPAN_REFERENCE, G->pos)) <= G->pos) goto l1192;
+  G->pos= yyend;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1192;  if (!yymatchChar(G, ']')) goto l1192;
+  yyDo(G, yy_1_RawCitationReference, G->begin, G->end, "yy_1_RawCitationReference");
+  yyprintf((stderr, "  ok   RawCitationReference"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l583:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenOl"));
+  l1192:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RawCitationReference"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockNoscript(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockNoscript"));
-  if (!yy_HtmlBlockOpenNoscript(G))  goto l588;
-
-  l589:;	
-  {  int yypos590= G->pos, yythunkpos590= G->thunkpos;
-  {  int yypos591= G->pos, yythunkpos591= G->thunkpos;  if (!yy_HtmlBlockNoscript(G))  goto l592;
-  goto l591;
-  l592:;	  G->pos= yypos591; G->thunkpos= yythunkpos591;
-  {  int yypos593= G->pos, yythunkpos593= G->thunkpos;  if (!yy_HtmlBlockCloseNoscript(G))  goto l593;
-  goto l590;
-  l593:;	  G->pos= yypos593; G->thunkpos= yythunkpos593;
-  }  if (!yymatchDot(G)) goto l590;
-  }
-  l591:;	  goto l589;
-  l590:;	  G->pos= yypos590; G->thunkpos= yythunkpos590;
-  }  if (!yy_HtmlBlockCloseNoscript(G))  goto l588;
-  yyprintf((stderr, "  ok   HtmlBlockNoscript"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l588:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockNoscript"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockCloseNoscript(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseNoscript"));
-  if (!yymatchChar(G, '<')) goto l594;
-  if (!yy_Spnl(G))  goto l594;
-  if (!yymatchChar(G, '/')) goto l594;
-
-  {  int yypos595= G->pos, yythunkpos595= G->thunkpos;  if (!yymatchString(G, "noscript")) goto l596;
-  goto l595;
-  l596:;	  G->pos= yypos595; G->thunkpos= yythunkpos595;  if (!yymatchString(G, "NOSCRIPT")) goto l594;
+YY_RULE(int) yy_CitationReferenceSingle(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "CitationReferenceSingle"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1199;
+  {  int yypos1200= G->pos, yythunkpos1200= G->thunkpos;  if (!yymatchString(G, "[]")) goto l1201;
+  if (!yy_Spnl(G))  goto l1201;
+  if (!yy_RawCitationReference(G))  goto l1201;
+  yyDo(G, yySet, -1, 0, "yySet");
+  goto l1200;
+  l1201:;	  G->pos= yypos1200; G->thunkpos= yythunkpos1200;  if (!yy_RawCitationReference(G))  goto l1199;
+  yyDo(G, yySet, -1, 0, "yySet");
 
+  {  int yypos1202= G->pos, yythunkpos1202= G->thunkpos;  if (!yy_Spnl(G))  goto l1202;
+  if (!yymatchString(G, "[]")) goto l1202;
+  goto l1203;
+  l1202:;	  G->pos= yypos1202; G->thunkpos= yythunkpos1202;
   }
-  l595:;	  if (!yy_Spnl(G))  goto l594;
-  if (!yymatchChar(G, '>')) goto l594;
-  yyprintf((stderr, "  ok   HtmlBlockCloseNoscript"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l594:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseNoscript"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockOpenNoscript(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenNoscript"));
-  if (!yymatchChar(G, '<')) goto l597;
-  if (!yy_Spnl(G))  goto l597;
-
-  {  int yypos598= G->pos, yythunkpos598= G->thunkpos;  if (!yymatchString(G, "noscript")) goto l599;
-  goto l598;
-  l599:;	  G->pos= yypos598; G->thunkpos= yythunkpos598;  if (!yymatchString(G, "NOSCRIPT")) goto l597;
-
+  l1203:;	
   }
-  l598:;	  if (!yy_Spnl(G))  goto l597;
-
-  l600:;	
-  {  int yypos601= G->pos, yythunkpos601= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l601;
-  goto l600;
-  l601:;	  G->pos= yypos601; G->thunkpos= yythunkpos601;
-  }  if (!yymatchChar(G, '>')) goto l597;
-  yyprintf((stderr, "  ok   HtmlBlockOpenNoscript"));
+  l1200:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1199;  yyDo(G, yy_1_CitationReferenceSingle, G->begin, G->end, "yy_1_CitationReferenceSingle");
+  yyprintf((stderr, "  ok   CitationReferenceSingle"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l597:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenNoscript"));
+  l1199:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "CitationReferenceSingle"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockNoframes(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockNoframes"));
-  if (!yy_HtmlBlockOpenNoframes(G))  goto l602;
+YY_RULE(int) yy_CitationReferenceDouble(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "CitationReferenceDouble"));
 
-  l603:;	
-  {  int yypos604= G->pos, yythunkpos604= G->thunkpos;
-  {  int yypos605= G->pos, yythunkpos605= G->thunkpos;  if (!yy_HtmlBlockNoframes(G))  goto l606;
-  goto l605;
-  l606:;	  G->pos= yypos605; G->thunkpos= yythunkpos605;
-  {  int yypos607= G->pos, yythunkpos607= G->thunkpos;  if (!yy_HtmlBlockCloseNoframes(G))  goto l607;
-  goto l604;
-  l607:;	  G->pos= yypos607; G->thunkpos= yythunkpos607;
-  }  if (!yymatchDot(G)) goto l604;
-  }
-  l605:;	  goto l603;
-  l604:;	  G->pos= yypos604; G->thunkpos= yythunkpos604;
-  }  if (!yy_HtmlBlockCloseNoframes(G))  goto l602;
-  yyprintf((stderr, "  ok   HtmlBlockNoframes"));
+  {  int yypos1205= G->pos, yythunkpos1205= G->thunkpos;  if (!yymatchString(G, "[]")) goto l1205;
+  goto l1204;
+  l1205:;	  G->pos= yypos1205; G->thunkpos= yythunkpos1205;
+  }  if (!yy_Label(G))  goto l1204;
+  yyDo(G, yySet, -2, 0, "yySet");
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1204;  if (!yy_Spnl(G))  goto l1204;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1204;
+  {  int yypos1206= G->pos, yythunkpos1206= G->thunkpos;  if (!yymatchString(G, "[]")) goto l1206;
+  goto l1204;
+  l1206:;	  G->pos= yypos1206; G->thunkpos= yythunkpos1206;
+  }  if (!yy_RawCitationReference(G))  goto l1204;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_CitationReferenceDouble, G->begin, G->end, "yy_1_CitationReferenceDouble");
+  yyprintf((stderr, "  ok   CitationReferenceDouble"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l602:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockNoframes"));
+  l1204:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "CitationReferenceDouble"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseNoframes(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseNoframes"));
-  if (!yymatchChar(G, '<')) goto l608;
-  if (!yy_Spnl(G))  goto l608;
-  if (!yymatchChar(G, '/')) goto l608;
-
-  {  int yypos609= G->pos, yythunkpos609= G->thunkpos;  if (!yymatchString(G, "noframes")) goto l610;
-  goto l609;
-  l610:;	  G->pos= yypos609; G->thunkpos= yythunkpos609;  if (!yymatchString(G, "NOFRAMES")) goto l608;
+/* Label -- with EXT_LINEAR_INLINES, Inline doesn't match a Link inside the
+	label, which the grammar does (taking its brackets with it), so the
+	brackets are counted instead, and only a ']' at depth 0 ends the label. */
+YY_RULE(int) yy_Label(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  int yydepth= 0;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "Label"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1207;  if (!yymatchChar(G, '[')) goto l1207;
 
+  {  int yypos1208= G->pos, yythunkpos1208= G->thunkpos;  if (!yymatchChar(G, '[')) goto l1208;
+  goto l1207;
+  l1208:;	  G->pos= yypos1208; G->thunkpos= yythunkpos1208;
+  }
+  {  int yypos1209= G->pos, yythunkpos1209= G->thunkpos;
+  {  int yypos1211= G->pos, yythunkpos1211= G->thunkpos;  if (!yymatchChar(G, '^')) goto l1211;
+  goto l1210;
+  l1211:;	  G->pos= yypos1211; G->thunkpos= yythunkpos1211;
+  }
+  {  int yypos1212= G->pos, yythunkpos1212= G->thunkpos;  if (!yymatchChar(G, '#')) goto l1212;
+  goto l1210;
+  l1212:;	  G->pos= yypos1212; G->thunkpos= yythunkpos1212;
+  }  yyText(G, G->begin, G->end);  if (!( ext(EXT_NOTES) )) goto l1210;  goto l1209;
+  l1210:;	  G->pos= yypos1209; G->thunkpos= yythunkpos1209;
+  {  int yypos1213= G->pos, yythunkpos1213= G->thunkpos;  if (!yymatchDot(G)) goto l1207;  G->pos= yypos1213; G->thunkpos= yythunkpos1213;
+  }  yyText(G, G->begin, G->end);  if (!( !ext(EXT_NOTES) )) goto l1207;
   }
-  l609:;	  if (!yy_Spnl(G))  goto l608;
-  if (!yymatchChar(G, '>')) goto l608;
-  yyprintf((stderr, "  ok   HtmlBlockCloseNoframes"));
+  l1209:;	  if (!yy_StartList(G))  goto l1207;
+  yyDo(G, yySet, -1, 0, "yySet");
+
+  l1214:;	
+  {  int yypos1215= G->pos, yythunkpos1215= G->thunkpos;
+  {  int yypos1216= G->pos, yythunkpos1216= G->thunkpos;  if (yydepth > 0) goto l1216;  if (!yymatchChar(G, ']')) goto l1216;
+  goto l1215;
+  l1216:;	  G->pos= yypos1216; G->thunkpos= yythunkpos1216;
+  }  if (!yy_Inline(G))  goto l1215;
+  if (ext(EXT_LINEAR_INLINES))
+    {
+      if (yyByteAt(G, yypos1215) == ']')
+        --yydepth;
+      else if ((G->pos == yypos1215 + 1) && (yyByteAt(G, yypos1215) == '[') && yyLabelOpens(G, yypos1215))
+        ++yydepth;
+    }
+  yyDo(G, yy_1_Label, G->begin, G->end, "yy_1_Label");
+  goto l1214;
+  l1215:;	  G->pos= yypos1215; G->thunkpos= yythunkpos1215;
+  }  if (!yymatchChar(G, ']')) goto l1207;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1207;  yyDo(G, yy_2_Label, G->begin, G->end, "yy_2_Label");
+  yyprintf((stderr, "  ok   Label"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l608:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseNoframes"));
+  l1207:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Label"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenNoframes(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenNoframes"));
-  if (!yymatchChar(G, '<')) goto l611;
-  if (!yy_Spnl(G))  goto l611;
-
-  {  int yypos612= G->pos, yythunkpos612= G->thunkpos;  if (!yymatchString(G, "noframes")) goto l613;
-  goto l612;
-  l613:;	  G->pos= yypos612; G->thunkpos= yythunkpos612;  if (!yymatchString(G, "NOFRAMES")) goto l611;
-
+YY_RULE(int) yy_ReferenceLinkSingle(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "ReferenceLinkSingle"));
+  if (!yy_Label(G))  goto l1217;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1217;
+  {  int yypos1218= G->pos, yythunkpos1218= G->thunkpos;  if (!yy_Spnl(G))  goto l1218;
+  if (!yymatchString(G, "[]")) goto l1218;
+  goto l1219;
+  l1218:;	  G->pos= yypos1218; G->thunkpos= yythunkpos1218;
   }
-  l612:;	  if (!yy_Spnl(G))  goto l611;
-
-  l614:;	
-  {  int yypos615= G->pos, yythunkpos615= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l615;
-  goto l614;
-  l615:;	  G->pos= yypos615; G->thunkpos= yythunkpos615;
-  }  if (!yymatchChar(G, '>')) goto l611;
-  yyprintf((stderr, "  ok   HtmlBlockOpenNoframes"));
+  l1219:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1217;  yyDo(G, yy_1_ReferenceLinkSingle, G->begin, G->end, "yy_1_ReferenceLinkSingle");
+  yyprintf((stderr, "  ok   ReferenceLinkSingle"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l611:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenNoframes"));
+  l1217:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ReferenceLinkSingle"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockMenu(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockMenu"));
-  if (!yy_HtmlBlockOpenMenu(G))  goto l616;
-
-  l617:;	
-  {  int yypos618= G->pos, yythunkpos618= G->thunkpos;
-  {  int yypos619= G->pos, yythunkpos619= G->thunkpos;  if (!yy_HtmlBlockMenu(G))  goto l620;
-  goto l619;
-  l620:;	  G->pos= yypos619; G->thunkpos= yythunkpos619;
-  {  int yypos621= G->pos, yythunkpos621= G->thunkpos;  if (!yy_HtmlBlockCloseMenu(G))  goto l621;
-  goto l618;
-  l621:;	  G->pos= yypos621; G->thunkpos= yythunkpos621;
-  }  if (!yymatchDot(G)) goto l618;
-  }
-  l619:;	  goto l617;
-  l618:;	  G->pos= yypos618; G->thunkpos= yythunkpos618;
-  }  if (!yy_HtmlBlockCloseMenu(G))  goto l616;
-  yyprintf((stderr, "  ok   HtmlBlockMenu"));
+YY_RULE(int) yy_ReferenceLinkDouble(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "ReferenceLinkDouble"));
+  if (!yy_Label(G))  goto l1220;
+  yyDo(G, yySet, -2, 0, "yySet");
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1220;  if (!yy_Spnl(G))  goto l1220;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1220;
+  {  int yypos1221= G->pos, yythunkpos1221= G->thunkpos;  if (!yymatchString(G, "[]")) goto l1221;
+  goto l1220;
+  l1221:;	  G->pos= yypos1221; G->thunkpos= yythunkpos1221;
+  }  if (!yy_Label(G))  goto l1220;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_ReferenceLinkDouble, G->begin, G->end, "yy_1_ReferenceLinkDouble");
+  yyprintf((stderr, "  ok   ReferenceLinkDouble"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l616:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockMenu"));
+  l1220:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ReferenceLinkDouble"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseMenu(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseMenu"));
-  if (!yymatchChar(G, '<')) goto l622;
-  if (!yy_Spnl(G))  goto l622;
-  if (!yymatchChar(G, '/')) goto l622;
+YY_RULE(int) yy_AutoLink(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AutoLink"));
 
-  {  int yypos623= G->pos, yythunkpos623= G->thunkpos;  if (!yymatchString(G, "menu")) goto l624;
-  goto l623;
-  l624:;	  G->pos= yypos623; G->thunkpos= yythunkpos623;  if (!yymatchString(G, "MENU")) goto l622;
+  {  int yypos1223= G->pos, yythunkpos1223= G->thunkpos;  if (!yy_AutoLinkUrl(G))  goto l1224;
+  goto l1223;
+  l1224:;	  G->pos= yypos1223; G->thunkpos= yythunkpos1223;  if (!yy_AutoLinkEmail(G))  goto l1222;
 
   }
-  l623:;	  if (!yy_Spnl(G))  goto l622;
-  if (!yymatchChar(G, '>')) goto l622;
-  yyprintf((stderr, "  ok   HtmlBlockCloseMenu"));
+  l1223:;	  yyprintf((stderr, "  ok   AutoLink"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l622:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseMenu"));
+  l1222:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AutoLink"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenMenu(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenMenu"));
-  if (!yymatchChar(G, '<')) goto l625;
-  if (!yy_Spnl(G))  goto l625;
+YY_RULE(int) yy_ReferenceLink(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "ReferenceLink"));
 
-  {  int yypos626= G->pos, yythunkpos626= G->thunkpos;  if (!yymatchString(G, "menu")) goto l627;
-  goto l626;
-  l627:;	  G->pos= yypos626; G->thunkpos= yythunkpos626;  if (!yymatchString(G, "MENU")) goto l625;
+  {  int yypos1226= G->pos, yythunkpos1226= G->thunkpos;  if (!yy_ReferenceLinkDouble(G))  goto l1227;
+  goto l1226;
+  l1227:;	  G->pos= yypos1226; G->thunkpos= yythunkpos1226;  if (!yy_ReferenceLinkSingle(G))  goto l1225;
 
   }
-  l626:;	  if (!yy_Spnl(G))  goto l625;
-
-  l628:;	
-  {  int yypos629= G->pos, yythunkpos629= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l629;
-  goto l628;
-  l629:;	  G->pos= yypos629; G->thunkpos= yythunkpos629;
-  }  if (!yymatchChar(G, '>')) goto l625;
-  yyprintf((stderr, "  ok   HtmlBlockOpenMenu"));
+  l1226:;	  yyprintf((stderr, "  ok   ReferenceLink"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l625:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenMenu"));
+  l1225:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ReferenceLink"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockH6(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockH6"));
-  if (!yy_HtmlBlockOpenH6(G))  goto l630;
-
-  l631:;	
-  {  int yypos632= G->pos, yythunkpos632= G->thunkpos;
-  {  int yypos633= G->pos, yythunkpos633= G->thunkpos;  if (!yy_HtmlBlockH6(G))  goto l634;
-  goto l633;
-  l634:;	  G->pos= yypos633; G->thunkpos= yythunkpos633;
-  {  int yypos635= G->pos, yythunkpos635= G->thunkpos;  if (!yy_HtmlBlockCloseH6(G))  goto l635;
-  goto l632;
-  l635:;	  G->pos= yypos635; G->thunkpos= yythunkpos635;
-  }  if (!yymatchDot(G)) goto l632;
-  }
-  l633:;	  goto l631;
-  l632:;	  G->pos= yypos632; G->thunkpos= yythunkpos632;
-  }  if (!yy_HtmlBlockCloseH6(G))  goto l630;
-  yyprintf((stderr, "  ok   HtmlBlockH6"));
+YY_RULE(int) yy_ExplicitLink(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 3, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "ExplicitLink"));
+  if (!yy_Label(G))  goto l1228;
+  yyDo(G, yySet, -3, 0, "yySet");
+  if (!yymatchChar(G, '(')) goto l1228;
+  if (!yy_Sp(G))  goto l1228;
+  if (!yy_Source(G))  goto l1228;
+  yyDo(G, yySet, -2, 0, "yySet");
+  if (!yy_Spnl(G))  goto l1228;
+  if (!yy_Title(G))  goto l1228;
+  yyDo(G, yySet, -1, 0, "yySet");
+  if (!yy_Sp(G))  goto l1228;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1228;  if (!yymatchChar(G, ')')) goto l1228;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1228;  yyDo(G, yy_1_ExplicitLink, G->begin, G->end, "yy_1_ExplicitLink");
+  yyprintf((stderr, "  ok   ExplicitLink"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 3, 0, "yyPop");
   return 1;
-  l630:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockH6"));
+  l1228:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ExplicitLink"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseH6(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseH6"));
-  if (!yymatchChar(G, '<')) goto l636;
-  if (!yy_Spnl(G))  goto l636;
-  if (!yymatchChar(G, '/')) goto l636;
+YY_RULE(int) yy_StrongUl(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "StrongUl"));
+  if (!yymatchString(G, "__")) goto l1229;
+
+  {  int yypos1230= G->pos, yythunkpos1230= G->thunkpos;  if (!yy_Whitespace(G))  goto l1230;
+  goto l1229;
+  l1230:;	  G->pos= yypos1230; G->thunkpos= yythunkpos1230;
+  }  if (!yy_StartList(G))  goto l1229;
+  yyDo(G, yySet, -2, 0, "yySet");
 
-  {  int yypos637= G->pos, yythunkpos637= G->thunkpos;  if (!yymatchString(G, "h6")) goto l638;
-  goto l637;
-  l638:;	  G->pos= yypos637; G->thunkpos= yythunkpos637;  if (!yymatchString(G, "H6")) goto l636;
+  {  int yypos1233= G->pos, yythunkpos1233= G->thunkpos;  if (!yymatchString(G, "__")) goto l1233;
+  goto l1229;
+  l1233:;	  G->pos= yypos1233; G->thunkpos= yythunkpos1233;
+  }  if (!yy_Inline(G))  goto l1229;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_StrongUl, G->begin, G->end, "yy_1_StrongUl");
 
-  }
-  l637:;	  if (!yy_Spnl(G))  goto l636;
-  if (!yymatchChar(G, '>')) goto l636;
-  yyprintf((stderr, "  ok   HtmlBlockCloseH6"));
+  l1231:;	
+  {  int yypos1232= G->pos, yythunkpos1232= G->thunkpos;
+  {  int yypos1234= G->pos, yythunkpos1234= G->thunkpos;  if (!yymatchString(G, "__")) goto l1234;
+  goto l1232;
+  l1234:;	  G->pos= yypos1234; G->thunkpos= yythunkpos1234;
+  }  if (!yy_Inline(G))  goto l1232;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_StrongUl, G->begin, G->end, "yy_1_StrongUl");
+  goto l1231;
+  l1232:;	  G->pos= yypos1232; G->thunkpos= yythunkpos1232;
+  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1229;  if (!yymatchString(G, "__")) goto l1229;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1229;  yyDo(G, yy_2_StrongUl, G->begin, G->end, "yy_2_StrongUl");
+  yyprintf((stderr, "  ok   StrongUl"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l636:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseH6"));
+  l1229:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "StrongUl"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenH6(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenH6"));
-  if (!yymatchChar(G, '<')) goto l639;
-  if (!yy_Spnl(G))  goto l639;
+YY_RULE(int) yy_StrongStar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "StrongStar"));
+  if (!yymatchString(G, "**")) goto l1235;
 
-  {  int yypos640= G->pos, yythunkpos640= G->thunkpos;  if (!yymatchString(G, "h6")) goto l641;
-  goto l640;
-  l641:;	  G->pos= yypos640; G->thunkpos= yythunkpos640;  if (!yymatchString(G, "H6")) goto l639;
+  {  int yypos1236= G->pos, yythunkpos1236= G->thunkpos;  if (!yy_Whitespace(G))  goto l1236;
+  goto l1235;
+  l1236:;	  G->pos= yypos1236; G->thunkpos= yythunkpos1236;
+  }  if (!yy_StartList(G))  goto l1235;
+  yyDo(G, yySet, -2, 0, "yySet");
 
-  }
-  l640:;	  if (!yy_Spnl(G))  goto l639;
+  {  int yypos1239= G->pos, yythunkpos1239= G->thunkpos;  if (!yymatchString(G, "**")) goto l1239;
+  goto l1235;
+  l1239:;	  G->pos= yypos1239; G->thunkpos= yythunkpos1239;
+  }  if (!yy_Inline(G))  goto l1235;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_StrongStar, G->begin, G->end, "yy_1_StrongStar");
 
-  l642:;	
-  {  int yypos643= G->pos, yythunkpos643= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l643;
-  goto l642;
-  l643:;	  G->pos= yypos643; G->thunkpos= yythunkpos643;
-  }  if (!yymatchChar(G, '>')) goto l639;
-  yyprintf((stderr, "  ok   HtmlBlockOpenH6"));
+  l1237:;	
+  {  int yypos1238= G->pos, yythunkpos1238= G->thunkpos;
+  {  int yypos1240= G->pos, yythunkpos1240= G->thunkpos;  if (!yymatchString(G, "**")) goto l1240;
+  goto l1238;
+  l1240:;	  G->pos= yypos1240; G->thunkpos= yythunkpos1240;
+  }  if (!yy_Inline(G))  goto l1238;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_StrongStar, G->begin, G->end, "yy_1_StrongStar");
+  goto l1237;
+  l1238:;	  G->pos= yypos1238; G->thunkpos= yythunkpos1238;
+  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1235;  if (!yymatchString(G, "**")) goto l1235;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1235;  yyDo(G, yy_2_StrongStar, G->begin, G->end, "yy_2_StrongStar");
+  yyprintf((stderr, "  ok   StrongStar"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l639:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenH6"));
+  l1235:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "StrongStar"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockH5(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockH5"));
-  if (!yy_HtmlBlockOpenH5(G))  goto l644;
+YY_RULE(int) yy_Whitespace(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Whitespace"));
+
+  {  int yypos1242= G->pos, yythunkpos1242= G->thunkpos;  if (!yy_Spacechar(G))  goto l1243;
+  goto l1242;
+  l1243:;	  G->pos= yypos1242; G->thunkpos= yythunkpos1242;  if (!yy_Newline(G))  goto l1241;
 
-  l645:;	
-  {  int yypos646= G->pos, yythunkpos646= G->thunkpos;
-  {  int yypos647= G->pos, yythunkpos647= G->thunkpos;  if (!yy_HtmlBlockH5(G))  goto l648;
-  goto l647;
-  l648:;	  G->pos= yypos647; G->thunkpos= yythunkpos647;
-  {  int yypos649= G->pos, yythunkpos649= G->thunkpos;  if (!yy_HtmlBlockCloseH5(G))  goto l649;
-  goto l646;
-  l649:;	  G->pos= yypos649; G->thunkpos= yythunkpos649;
-  }  if (!yymatchDot(G)) goto l646;
   }
-  l647:;	  goto l645;
-  l646:;	  G->pos= yypos646; G->thunkpos= yythunkpos646;
-  }  if (!yy_HtmlBlockCloseH5(G))  goto l644;
-  yyprintf((stderr, "  ok   HtmlBlockH5"));
+  l1242:;	  yyprintf((stderr, "  ok   Whitespace"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l644:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockH5"));
+  l1241:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Whitespace"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseH5(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseH5"));
-  if (!yymatchChar(G, '<')) goto l650;
-  if (!yy_Spnl(G))  goto l650;
-  if (!yymatchChar(G, '/')) goto l650;
+YY_RULE(int) yy_EmphUl(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "EmphUl"));
+  if (!yymatchChar(G, '_')) goto l1244;
 
-  {  int yypos651= G->pos, yythunkpos651= G->thunkpos;  if (!yymatchString(G, "h5")) goto l652;
-  goto l651;
-  l652:;	  G->pos= yypos651; G->thunkpos= yythunkpos651;  if (!yymatchString(G, "H5")) goto l650;
+  {  int yypos1245= G->pos, yythunkpos1245= G->thunkpos;  if (!yy_Whitespace(G))  goto l1245;
+  goto l1244;
+  l1245:;	  G->pos= yypos1245; G->thunkpos= yythunkpos1245;
+  }  if (!yy_StartList(G))  goto l1244;
+  yyDo(G, yySet, -2, 0, "yySet");
 
-  }
-  l651:;	  if (!yy_Spnl(G))  goto l650;
-  if (!yymatchChar(G, '>')) goto l650;
-  yyprintf((stderr, "  ok   HtmlBlockCloseH5"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l650:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseH5"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockOpenH5(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenH5"));
-  if (!yymatchChar(G, '<')) goto l653;
-  if (!yy_Spnl(G))  goto l653;
-
-  {  int yypos654= G->pos, yythunkpos654= G->thunkpos;  if (!yymatchString(G, "h5")) goto l655;
-  goto l654;
-  l655:;	  G->pos= yypos654; G->thunkpos= yythunkpos654;  if (!yymatchString(G, "H5")) goto l653;
+  {  int yypos1248= G->pos, yythunkpos1248= G->thunkpos;
+  {  int yypos1250= G->pos, yythunkpos1250= G->thunkpos;  if (!yymatchChar(G, '_')) goto l1250;
+  goto l1249;
+  l1250:;	  G->pos= yypos1250; G->thunkpos= yythunkpos1250;
+  }  if (!yy_Inline(G))  goto l1249;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_EmphUl, G->begin, G->end, "yy_1_EmphUl");
+  goto l1248;
+  l1249:;	  G->pos= yypos1248; G->thunkpos= yythunkpos1248;  if (!yy_StrongUl(G))  goto l1244;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_2_EmphUl, G->begin, G->end, "yy_2_EmphUl");
 
   }
-  l654:;	  if (!yy_Spnl(G))  goto l653;
+  l1248:;	
+  l1246:;	
+  {  int yypos1247= G->pos, yythunkpos1247= G->thunkpos;
+  {  int yypos1251= G->pos, yythunkpos1251= G->thunkpos;
+  {  int yypos1253= G->pos, yythunkpos1253= G->thunkpos;  if (!yymatchChar(G, '_')) goto l1253;
+  goto l1252;
+  l1253:;	  G->pos= yypos1253; G->thunkpos= yythunkpos1253;
+  }  if (!yy_Inline(G))  goto l1252;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_EmphUl, G->begin, G->end, "yy_1_EmphUl");
+  goto l1251;
+  l1252:;	  G->pos= yypos1251; G->thunkpos= yythunkpos1251;  if (!yy_StrongUl(G))  goto l1247;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_2_EmphUl, G->begin, G->end, "yy_2_EmphUl");
 
-  l656:;	
-  {  int yypos657= G->pos, yythunkpos657= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l657;
-  goto l656;
-  l657:;	  G->pos= yypos657; G->thunkpos= yythunkpos657;
-  }  if (!yymatchChar(G, '>')) goto l653;
-  yyprintf((stderr, "  ok   HtmlBlockOpenH5"));
+  }
+  l1251:;	  goto l1246;
+  l1247:;	  G->pos= yypos1247; G->thunkpos= yythunkpos1247;
+  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1244;  if (!yymatchChar(G, '_')) goto l1244;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1244;  yyDo(G, yy_3_EmphUl, G->begin, G->end, "yy_3_EmphUl");
+  yyprintf((stderr, "  ok   EmphUl"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l653:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenH5"));
+  l1244:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "EmphUl"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockH4(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockH4"));
-  if (!yy_HtmlBlockOpenH4(G))  goto l658;
+YY_RULE(int) yy_EmphStar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "EmphStar"));
+  if (!yymatchChar(G, '*')) goto l1254;
+
+  {  int yypos1255= G->pos, yythunkpos1255= G->thunkpos;  if (!yy_Whitespace(G))  goto l1255;
+  goto l1254;
+  l1255:;	  G->pos= yypos1255; G->thunkpos= yythunkpos1255;
+  }  if (!yy_StartList(G))  goto l1254;
+  yyDo(G, yySet, -2, 0, "yySet");
+
+  {  int yypos1258= G->pos, yythunkpos1258= G->thunkpos;
+  {  int yypos1260= G->pos, yythunkpos1260= G->thunkpos;  if (!yymatchChar(G, '*')) goto l1260;
+  goto l1259;
+  l1260:;	  G->pos= yypos1260; G->thunkpos= yythunkpos1260;
+  }  if (!yy_Inline(G))  goto l1259;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_EmphStar, G->begin, G->end, "yy_1_EmphStar");
+  goto l1258;
+  l1259:;	  G->pos= yypos1258; G->thunkpos= yythunkpos1258;  if (!yy_StrongStar(G))  goto l1254;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_2_EmphStar, G->begin, G->end, "yy_2_EmphStar");
 
-  l659:;	
-  {  int yypos660= G->pos, yythunkpos660= G->thunkpos;
-  {  int yypos661= G->pos, yythunkpos661= G->thunkpos;  if (!yy_HtmlBlockH4(G))  goto l662;
-  goto l661;
-  l662:;	  G->pos= yypos661; G->thunkpos= yythunkpos661;
-  {  int yypos663= G->pos, yythunkpos663= G->thunkpos;  if (!yy_HtmlBlockCloseH4(G))  goto l663;
-  goto l660;
-  l663:;	  G->pos= yypos663; G->thunkpos= yythunkpos663;
-  }  if (!yymatchDot(G)) goto l660;
   }
-  l661:;	  goto l659;
-  l660:;	  G->pos= yypos660; G->thunkpos= yythunkpos660;
-  }  if (!yy_HtmlBlockCloseH4(G))  goto l658;
-  yyprintf((stderr, "  ok   HtmlBlockH4"));
+  l1258:;	
+  l1256:;	
+  {  int yypos1257= G->pos, yythunkpos1257= G->thunkpos;
+  {  int yypos1261= G->pos, yythunkpos1261= G->thunkpos;
+  {  int yypos1263= G->pos, yythunkpos1263= G->thunkpos;  if (!yymatchChar(G, '*')) goto l1263;
+  goto l1262;
+  l1263:;	  G->pos= yypos1263; G->thunkpos= yythunkpos1263;
+  }  if (!yy_Inline(G))  goto l1262;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_EmphStar, G->begin, G->end, "yy_1_EmphStar");
+  goto l1261;
+  l1262:;	  G->pos= yypos1261; G->thunkpos= yythunkpos1261;  if (!yy_StrongStar(G))  goto l1257;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_2_EmphStar, G->begin, G->end, "yy_2_EmphStar");
+
+  }
+  l1261:;	  goto l1256;
+  l1257:;	  G->pos= yypos1257; G->thunkpos= yythunkpos1257;
+  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1254;  if (!yymatchChar(G, '*')) goto l1254;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1254;  yyDo(G, yy_3_EmphStar, G->begin, G->end, "yy_3_EmphStar");
+  yyprintf((stderr, "  ok   EmphStar"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l658:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockH4"));
+  l1254:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "EmphStar"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseH4(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseH4"));
-  if (!yymatchChar(G, '<')) goto l664;
-  if (!yy_Spnl(G))  goto l664;
-  if (!yymatchChar(G, '/')) goto l664;
+YY_RULE(int) yy_StarLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "StarLine"));
 
-  {  int yypos665= G->pos, yythunkpos665= G->thunkpos;  if (!yymatchString(G, "h4")) goto l666;
-  goto l665;
-  l666:;	  G->pos= yypos665; G->thunkpos= yythunkpos665;  if (!yymatchString(G, "H4")) goto l664;
+  {  int yypos1265= G->pos, yythunkpos1265= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_LINEAR_INLINES) )) goto l1266;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1266;  if (!yymatchString(G, "****")) goto l1266;
+
+  l1267:;	
+  {  int yypos1268= G->pos, yythunkpos1268= G->thunkpos;  if (!yymatchChar(G, '*')) goto l1268;
+  goto l1267;
+  l1268:;	  G->pos= yypos1268; G->thunkpos= yythunkpos1268;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1266;  goto l1265;
+  l1266:;	  G->pos= yypos1265; G->thunkpos= yythunkpos1265;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1264;  if (!yy_Spacechar(G))  goto l1264;
+  if (!yymatchChar(G, '*')) goto l1264;
 
+  l1269:;	
+  {  int yypos1270= G->pos, yythunkpos1270= G->thunkpos;  if (!yymatchChar(G, '*')) goto l1270;
+  goto l1269;
+  l1270:;	  G->pos= yypos1270; G->thunkpos= yythunkpos1270;
+  }
+  {  int yypos1271= G->pos, yythunkpos1271= G->thunkpos;  if (!yy_Spacechar(G))  goto l1264;
+  G->pos= yypos1271; G->thunkpos= yythunkpos1271;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1264;
   }
-  l665:;	  if (!yy_Spnl(G))  goto l664;
-  if (!yymatchChar(G, '>')) goto l664;
-  yyprintf((stderr, "  ok   HtmlBlockCloseH4"));
+  l1265:;	  yyprintf((stderr, "  ok   StarLine"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l664:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseH4"));
+  l1264:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "StarLine"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenH4(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenH4"));
-  if (!yymatchChar(G, '<')) goto l667;
-  if (!yy_Spnl(G))  goto l667;
+YY_RULE(int) yy_UlLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "UlLine"));
 
-  {  int yypos668= G->pos, yythunkpos668= G->thunkpos;  if (!yymatchString(G, "h4")) goto l669;
-  goto l668;
-  l669:;	  G->pos= yypos668; G->thunkpos= yythunkpos668;  if (!yymatchString(G, "H4")) goto l667;
+  {  int yypos1273= G->pos, yythunkpos1273= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_LINEAR_INLINES) )) goto l1274;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1274;  if (!yymatchString(G, "____")) goto l1274;
 
-  }
-  l668:;	  if (!yy_Spnl(G))  goto l667;
+  l1275:;	
+  {  int yypos1276= G->pos, yythunkpos1276= G->thunkpos;  if (!yymatchChar(G, '_')) goto l1276;
+  goto l1275;
+  l1276:;	  G->pos= yypos1276; G->thunkpos= yythunkpos1276;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1274;  goto l1273;
+  l1274:;	  G->pos= yypos1273; G->thunkpos= yythunkpos1273;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1272;  if (!yy_Spacechar(G))  goto l1272;
+  if (!yymatchChar(G, '_')) goto l1272;
 
-  l670:;	
-  {  int yypos671= G->pos, yythunkpos671= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l671;
-  goto l670;
-  l671:;	  G->pos= yypos671; G->thunkpos= yythunkpos671;
-  }  if (!yymatchChar(G, '>')) goto l667;
-  yyprintf((stderr, "  ok   HtmlBlockOpenH4"));
+  l1277:;	
+  {  int yypos1278= G->pos, yythunkpos1278= G->thunkpos;  if (!yymatchChar(G, '_')) goto l1278;
+  goto l1277;
+  l1278:;	  G->pos= yypos1278; G->thunkpos= yythunkpos1278;
+  }
+  {  int yypos1279= G->pos, yythunkpos1279= G->thunkpos;  if (!yy_Spacechar(G))  goto l1272;
+  G->pos= yypos1279; G->thunkpos= yythunkpos1279;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1272;
+  }
+  l1273:;	  yyprintf((stderr, "  ok   UlLine"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l667:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenH4"));
+  l1272:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "UlLine"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockH3(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockH3"));
-  if (!yy_HtmlBlockOpenH3(G))  goto l672;
-
-  l673:;	
-  {  int yypos674= G->pos, yythunkpos674= G->thunkpos;
-  {  int yypos675= G->pos, yythunkpos675= G->thunkpos;  if (!yy_HtmlBlockH3(G))  goto l676;
-  goto l675;
-  l676:;	  G->pos= yypos675; G->thunkpos= yythunkpos675;
-  {  int yypos677= G->pos, yythunkpos677= G->thunkpos;  if (!yy_HtmlBlockCloseH3(G))  goto l677;
-  goto l674;
-  l677:;	  G->pos= yypos677; G->thunkpos= yythunkpos677;
-  }  if (!yymatchDot(G)) goto l674;
-  }
-  l675:;	  goto l673;
-  l674:;	  G->pos= yypos674; G->thunkpos= yythunkpos674;
-  }  if (!yy_HtmlBlockCloseH3(G))  goto l672;
-  yyprintf((stderr, "  ok   HtmlBlockH3"));
+/* DoubleDollarMath -- DoubleDollarMathStart (!DoubleDollarMathEnd
+	!(BlankLine BlankLine) .)* DoubleDollarMathEnd, ended by yySpanEnd */
+YY_RULE(int) yy_DoubleDollarMath(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  int yyend;  yyprintfv((stderr, "%s\n", "DoubleDollarMath"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1280;  if (!yy_DoubleDollarMathStart(G))  goto l1280;
+  if ((yyend= yySpanEnd(G, SPAN_DOUBLE_DOLLAR, G->pos)) < 0) goto l1280;
+  G->pos= yyend;
+  if (!yy_DoubleDollarMathEnd(G))  goto l1280;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1280;  yyDo(G, yy_1_DoubleDollarMath, G->begin, G->end, "yy_1_DoubleDollarMath");
+  yyprintf((stderr, "  ok   DoubleDollarMath"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l672:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockH3"));
+  l1280:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DoubleDollarMath"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseH3(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseH3"));
-  if (!yymatchChar(G, '<')) goto l678;
-  if (!yy_Spnl(G))  goto l678;
-  if (!yymatchChar(G, '/')) goto l678;
+YY_RULE(int) yy_DoubleDollarMathEnd(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "DoubleDollarMathEnd"));
 
-  {  int yypos679= G->pos, yythunkpos679= G->thunkpos;  if (!yymatchString(G, "h3")) goto l680;
-  goto l679;
-  l680:;	  G->pos= yypos679; G->thunkpos= yythunkpos679;  if (!yymatchString(G, "H3")) goto l678;
+  {  int yypos1286= G->pos, yythunkpos1286= G->thunkpos;  if (!yymatchChar(G, '\\')) goto l1286;
+  goto l1285;
+  l1286:;	  G->pos= yypos1286; G->thunkpos= yythunkpos1286;
+  }  if (!yy_Nonspacechar(G))  goto l1285;
+  if (!yymatchChar(G, '$')) goto l1285;
+  if (!yymatchChar(G, '$')) goto l1285;
 
-  }
-  l679:;	  if (!yy_Spnl(G))  goto l678;
-  if (!yymatchChar(G, '>')) goto l678;
-  yyprintf((stderr, "  ok   HtmlBlockCloseH3"));
+  {  int yypos1287= G->pos, yythunkpos1287= G->thunkpos;  if (!yy_Nonspacechar(G))  goto l1287;
+  goto l1285;
+  l1287:;	  G->pos= yypos1287; G->thunkpos= yythunkpos1287;
+  }  yyprintf((stderr, "  ok   DoubleDollarMathEnd"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l678:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseH3"));
+  l1285:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DoubleDollarMathEnd"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenH3(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenH3"));
-  if (!yymatchChar(G, '<')) goto l681;
-  if (!yy_Spnl(G))  goto l681;
+YY_RULE(int) yy_DoubleDollarMathStart(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "DoubleDollarMathStart"));
+  if (!yymatchChar(G, '$')) goto l1288;
+  if (!yymatchChar(G, '$')) goto l1288;
 
-  {  int yypos682= G->pos, yythunkpos682= G->thunkpos;  if (!yymatchString(G, "h3")) goto l683;
-  goto l682;
-  l683:;	  G->pos= yypos682; G->thunkpos= yythunkpos682;  if (!yymatchString(G, "H3")) goto l681;
+  {  int yypos1289= G->pos, yythunkpos1289= G->thunkpos;
+  {  int yypos1290= G->pos, yythunkpos1290= G->thunkpos;  if (!yy_Spacechar(G))  goto l1291;
+  goto l1290;
+  l1291:;	  G->pos= yypos1290; G->thunkpos= yythunkpos1290;  if (!yy_Newline(G))  goto l1289;
 
   }
-  l682:;	  if (!yy_Spnl(G))  goto l681;
-
-  l684:;	
-  {  int yypos685= G->pos, yythunkpos685= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l685;
-  goto l684;
-  l685:;	  G->pos= yypos685; G->thunkpos= yythunkpos685;
-  }  if (!yymatchChar(G, '>')) goto l681;
-  yyprintf((stderr, "  ok   HtmlBlockOpenH3"));
+  l1290:;	  goto l1288;
+  l1289:;	  G->pos= yypos1289; G->thunkpos= yythunkpos1289;
+  }  yyprintf((stderr, "  ok   DoubleDollarMathStart"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l681:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenH3"));
+  l1288:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DoubleDollarMathStart"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockH2(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockH2"));
-  if (!yy_HtmlBlockOpenH2(G))  goto l686;
-
-  l687:;	
-  {  int yypos688= G->pos, yythunkpos688= G->thunkpos;
-  {  int yypos689= G->pos, yythunkpos689= G->thunkpos;  if (!yy_HtmlBlockH2(G))  goto l690;
-  goto l689;
-  l690:;	  G->pos= yypos689; G->thunkpos= yythunkpos689;
-  {  int yypos691= G->pos, yythunkpos691= G->thunkpos;  if (!yy_HtmlBlockCloseH2(G))  goto l691;
-  goto l688;
-  l691:;	  G->pos= yypos691; G->thunkpos= yythunkpos691;
-  }  if (!yymatchDot(G)) goto l688;
-  }
-  l689:;	  goto l687;
-  l688:;	  G->pos= yypos688; G->thunkpos= yythunkpos688;
-  }  if (!yy_HtmlBlockCloseH2(G))  goto l686;
-  yyprintf((stderr, "  ok   HtmlBlockH2"));
+/* SingleDollarMath -- SingleDollarMathStart (!SingleDollarMathEnd
+	!(BlankLine BlankLine) .)* SingleDollarMathEnd, ended by yySpanEnd */
+YY_RULE(int) yy_SingleDollarMath(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  int yyend;  yyprintfv((stderr, "%s\n", "SingleDollarMath"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1292;  if (!yy_SingleDollarMathStart(G))  goto l1292;
+  if ((yyend= yySpanEnd(G, SPAN_DOLLAR, G->pos)) < 0) goto l1292;
+  G->pos= yyend;
+  if (!yy_SingleDollarMathEnd(G))  goto l1292;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1292;  yyDo(G, yy_1_SingleDollarMath, G->begin, G->end, "yy_1_SingleDollarMath");
+  yyprintf((stderr, "  ok   SingleDollarMath"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l686:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockH2"));
+  l1292:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SingleDollarMath"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseH2(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseH2"));
-  if (!yymatchChar(G, '<')) goto l692;
-  if (!yy_Spnl(G))  goto l692;
-  if (!yymatchChar(G, '/')) goto l692;
-
-  {  int yypos693= G->pos, yythunkpos693= G->thunkpos;  if (!yymatchString(G, "h2")) goto l694;
-  goto l693;
-  l694:;	  G->pos= yypos693; G->thunkpos= yythunkpos693;  if (!yymatchString(G, "H2")) goto l692;
+YY_RULE(int) yy_SingleDollarMathEnd(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SingleDollarMathEnd"));
 
+  {  int yypos1298= G->pos, yythunkpos1298= G->thunkpos;  if (!yymatchChar(G, '\\')) goto l1298;
+  goto l1297;
+  l1298:;	  G->pos= yypos1298; G->thunkpos= yythunkpos1298;
   }
-  l693:;	  if (!yy_Spnl(G))  goto l692;
-  if (!yymatchChar(G, '>')) goto l692;
-  yyprintf((stderr, "  ok   HtmlBlockCloseH2"));
+  {  int yypos1299= G->pos, yythunkpos1299= G->thunkpos;  if (!yymatchChar(G, '$')) goto l1299;
+  goto l1297;
+  l1299:;	  G->pos= yypos1299; G->thunkpos= yythunkpos1299;
+  }  if (!yy_Nonspacechar(G))  goto l1297;
+  if (!yymatchChar(G, '$')) goto l1297;
+
+  {  int yypos1300= G->pos, yythunkpos1300= G->thunkpos;  if (!yy_Nonspacechar(G))  goto l1300;
+  goto l1297;
+  l1300:;	  G->pos= yypos1300; G->thunkpos= yythunkpos1300;
+  }  yyprintf((stderr, "  ok   SingleDollarMathEnd"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l692:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseH2"));
+  l1297:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SingleDollarMathEnd"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenH2(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenH2"));
-  if (!yymatchChar(G, '<')) goto l695;
-  if (!yy_Spnl(G))  goto l695;
+YY_RULE(int) yy_SingleDollarMathStart(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SingleDollarMathStart"));
+  if (!yymatchChar(G, '$')) goto l1301;
 
-  {  int yypos696= G->pos, yythunkpos696= G->thunkpos;  if (!yymatchString(G, "h2")) goto l697;
-  goto l696;
-  l697:;	  G->pos= yypos696; G->thunkpos= yythunkpos696;  if (!yymatchString(G, "H2")) goto l695;
+  {  int yypos1302= G->pos, yythunkpos1302= G->thunkpos;
+  {  int yypos1303= G->pos, yythunkpos1303= G->thunkpos;  if (!yy_Spacechar(G))  goto l1304;
+  goto l1303;
+  l1304:;	  G->pos= yypos1303; G->thunkpos= yythunkpos1303;  if (!yy_Newline(G))  goto l1305;
+  goto l1303;
+  l1305:;	  G->pos= yypos1303; G->thunkpos= yythunkpos1303;  if (!yymatchChar(G, '$')) goto l1302;
 
   }
-  l696:;	  if (!yy_Spnl(G))  goto l695;
-
-  l698:;	
-  {  int yypos699= G->pos, yythunkpos699= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l699;
-  goto l698;
-  l699:;	  G->pos= yypos699; G->thunkpos= yythunkpos699;
-  }  if (!yymatchChar(G, '>')) goto l695;
-  yyprintf((stderr, "  ok   HtmlBlockOpenH2"));
+  l1303:;	  goto l1301;
+  l1302:;	  G->pos= yypos1302; G->thunkpos= yythunkpos1302;
+  }  yyprintf((stderr, "  ok   SingleDollarMathStart"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l695:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenH2"));
+  l1301:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SingleDollarMathStart"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockH1(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockH1"));
-  if (!yy_HtmlBlockOpenH1(G))  goto l700;
+YY_RULE(int) yy_AposChunk(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AposChunk"));
+  yyText(G, G->begin, G->end);  if (!( ext(EXT_SMART) )) goto l1306;  if (!yymatchChar(G, '\'')) goto l1306;
 
-  l701:;	
-  {  int yypos702= G->pos, yythunkpos702= G->thunkpos;
-  {  int yypos703= G->pos, yythunkpos703= G->thunkpos;  if (!yy_HtmlBlockH1(G))  goto l704;
-  goto l703;
-  l704:;	  G->pos= yypos703; G->thunkpos= yythunkpos703;
-  {  int yypos705= G->pos, yythunkpos705= G->thunkpos;  if (!yy_HtmlBlockCloseH1(G))  goto l705;
-  goto l702;
-  l705:;	  G->pos= yypos705; G->thunkpos= yythunkpos705;
-  }  if (!yymatchDot(G)) goto l702;
-  }
-  l703:;	  goto l701;
-  l702:;	  G->pos= yypos702; G->thunkpos= yythunkpos702;
-  }  if (!yy_HtmlBlockCloseH1(G))  goto l700;
-  yyprintf((stderr, "  ok   HtmlBlockH1"));
+  {  int yypos1307= G->pos, yythunkpos1307= G->thunkpos;  if (!yy_Alphanumeric(G))  goto l1306;
+  G->pos= yypos1307; G->thunkpos= yythunkpos1307;
+  }  yyDo(G, yy_1_AposChunk, G->begin, G->end, "yy_1_AposChunk");
+  yyprintf((stderr, "  ok   AposChunk"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l700:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockH1"));
+  l1306:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AposChunk"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseH1(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseH1"));
-  if (!yymatchChar(G, '<')) goto l706;
-  if (!yy_Spnl(G))  goto l706;
-  if (!yymatchChar(G, '/')) goto l706;
+YY_RULE(int) yy_StrChunk(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "StrChunk"));
 
-  {  int yypos707= G->pos, yythunkpos707= G->thunkpos;  if (!yymatchString(G, "h1")) goto l708;
-  goto l707;
-  l708:;	  G->pos= yypos707; G->thunkpos= yythunkpos707;  if (!yymatchString(G, "H1")) goto l706;
+  {  int yypos1309= G->pos, yythunkpos1309= G->thunkpos;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1310;
+  {  int yypos1313= G->pos, yythunkpos1313= G->thunkpos;  if (!yy_NormalChar(G))  goto l1314;
+  yyNormalChars(G);
+  goto l1313;
+  l1314:;	  G->pos= yypos1313; G->thunkpos= yythunkpos1313;  if (!yymatchChar(G, '_')) goto l1310;
 
+  l1315:;	
+  {  int yypos1316= G->pos, yythunkpos1316= G->thunkpos;  if (!yymatchChar(G, '_')) goto l1316;
+  goto l1315;
+  l1316:;	  G->pos= yypos1316; G->thunkpos= yythunkpos1316;
   }
-  l707:;	  if (!yy_Spnl(G))  goto l706;
-  if (!yymatchChar(G, '>')) goto l706;
-  yyprintf((stderr, "  ok   HtmlBlockCloseH1"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l706:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseH1"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockOpenH1(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenH1"));
-  if (!yymatchChar(G, '<')) goto l709;
-  if (!yy_Spnl(G))  goto l709;
-
-  {  int yypos710= G->pos, yythunkpos710= G->thunkpos;  if (!yymatchString(G, "h1")) goto l711;
-  goto l710;
-  l711:;	  G->pos= yypos710; G->thunkpos= yythunkpos710;  if (!yymatchString(G, "H1")) goto l709;
+  {  int yypos1317= G->pos, yythunkpos1317= G->thunkpos;  if (!yy_Alphanumeric(G))  goto l1310;
+  G->pos= yypos1317; G->thunkpos= yythunkpos1317;
+  }
+  }
+  l1313:;	
+  l1311:;	
+  {  int yypos1312= G->pos, yythunkpos1312= G->thunkpos;
+  {  int yypos1318= G->pos, yythunkpos1318= G->thunkpos;  if (!yy_NormalChar(G))  goto l1319;
+  yyNormalChars(G);
+  goto l1318;
+  l1319:;	  G->pos= yypos1318; G->thunkpos= yythunkpos1318;  if (!yymatchChar(G, '_')) goto l1312;
 
+  l1320:;	
+  {  int yypos1321= G->pos, yythunkpos1321= G->thunkpos;  if (!yymatchChar(G, '_')) goto l1321;
+  goto l1320;
+  l1321:;	  G->pos= yypos1321; G->thunkpos= yythunkpos1321;
+  }
+  {  int yypos1322= G->pos, yythunkpos1322= G->thunkpos;  if (!yy_Alphanumeric(G))  goto l1312;
+  G->pos= yypos1322; G->thunkpos= yythunkpos1322;
+  }
   }
-  l710:;	  if (!yy_Spnl(G))  goto l709;
+  l1318:;	  goto l1311;
+  l1312:;	  G->pos= yypos1312; G->thunkpos= yythunkpos1312;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1310;  yyDo(G, yy_1_StrChunk, G->begin, G->end, "yy_1_StrChunk");
+  goto l1309;
+  l1310:;	  G->pos= yypos1309; G->thunkpos= yythunkpos1309;  if (!yy_AposChunk(G))  goto l1308;
 
-  l712:;	
-  {  int yypos713= G->pos, yythunkpos713= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l713;
-  goto l712;
-  l713:;	  G->pos= yypos713; G->thunkpos= yythunkpos713;
-  }  if (!yymatchChar(G, '>')) goto l709;
-  yyprintf((stderr, "  ok   HtmlBlockOpenH1"));
+  }
+  l1309:;	  yyprintf((stderr, "  ok   StrChunk"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l709:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenH1"));
+  l1308:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "StrChunk"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockHgroup(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockHgroup"));
-  if (!yy_HtmlBlockOpenHgroup(G))  goto l714;
+YY_RULE(int) yy_voidNormalEndline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "voidNormalEndline"));
+  if (!yy_Sp(G))  goto l1323;
+  if (!yy_Newline(G))  goto l1323;
 
-  l715:;	
-  {  int yypos716= G->pos, yythunkpos716= G->thunkpos;
-  {  int yypos717= G->pos, yythunkpos717= G->thunkpos;  if (!yy_HtmlBlockHgroup(G))  goto l718;
-  goto l717;
-  l718:;	  G->pos= yypos717; G->thunkpos= yythunkpos717;
-  {  int yypos719= G->pos, yythunkpos719= G->thunkpos;  if (!yy_HtmlBlockCloseHgroup(G))  goto l719;
-  goto l716;
-  l719:;	  G->pos= yypos719; G->thunkpos= yythunkpos719;
-  }  if (!yymatchDot(G)) goto l716;
+  {  int yypos1324= G->pos, yythunkpos1324= G->thunkpos;  if (!yy_BlankLine(G))  goto l1324;
+  goto l1323;
+  l1324:;	  G->pos= yypos1324; G->thunkpos= yythunkpos1324;
   }
-  l717:;	  goto l715;
-  l716:;	  G->pos= yypos716; G->thunkpos= yythunkpos716;
-  }  if (!yy_HtmlBlockCloseHgroup(G))  goto l714;
-  yyprintf((stderr, "  ok   HtmlBlockHgroup"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l714:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockHgroup"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockCloseHgroup(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseHgroup"));
-  if (!yymatchChar(G, '<')) goto l720;
-  if (!yy_Spnl(G))  goto l720;
-  if (!yymatchChar(G, '/')) goto l720;
-
-  {  int yypos721= G->pos, yythunkpos721= G->thunkpos;  if (!yymatchString(G, "hgroup")) goto l722;
-  goto l721;
-  l722:;	  G->pos= yypos721; G->thunkpos= yythunkpos721;  if (!yymatchString(G, "HGROUP")) goto l720;
-
+  {  int yypos1325= G->pos, yythunkpos1325= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1325;
+  goto l1323;
+  l1325:;	  G->pos= yypos1325; G->thunkpos= yythunkpos1325;
   }
-  l721:;	  if (!yy_Spnl(G))  goto l720;
-  if (!yymatchChar(G, '>')) goto l720;
-  yyprintf((stderr, "  ok   HtmlBlockCloseHgroup"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l720:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseHgroup"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockOpenHgroup(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenHgroup"));
-  if (!yymatchChar(G, '<')) goto l723;
-  if (!yy_Spnl(G))  goto l723;
-
-  {  int yypos724= G->pos, yythunkpos724= G->thunkpos;  if (!yymatchString(G, "hgroup")) goto l725;
-  goto l724;
-  l725:;	  G->pos= yypos724; G->thunkpos= yythunkpos724;  if (!yymatchString(G, "HGROUP")) goto l723;
-
+  {  int yypos1326= G->pos, yythunkpos1326= G->thunkpos;  if (!yy_AtxStart(G))  goto l1326;
+  goto l1323;
+  l1326:;	  G->pos= yypos1326; G->thunkpos= yythunkpos1326;
   }
-  l724:;	  if (!yy_Spnl(G))  goto l723;
-
-  l726:;	
-  {  int yypos727= G->pos, yythunkpos727= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l727;
-  goto l726;
-  l727:;	  G->pos= yypos727; G->thunkpos= yythunkpos727;
-  }  if (!yymatchChar(G, '>')) goto l723;
-  yyprintf((stderr, "  ok   HtmlBlockOpenHgroup"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
+  {  int yypos1327= G->pos, yythunkpos1327= G->thunkpos;  if (!yy_Line(G))  goto l1327;
 
-  return 1;
-  l723:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenHgroup"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+  {  int yypos1328= G->pos, yythunkpos1328= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1329;
 
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockHeader(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockHeader"));
-  if (!yy_HtmlBlockOpenHeader(G))  goto l728;
+  l1330:;	
+  {  int yypos1331= G->pos, yythunkpos1331= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1331;
+  goto l1330;
+  l1331:;	  G->pos= yypos1331; G->thunkpos= yythunkpos1331;
+  }  goto l1328;
+  l1329:;	  G->pos= yypos1328; G->thunkpos= yythunkpos1328;  if (!yymatchChar(G, '-')) goto l1327;
 
-  l729:;	
-  {  int yypos730= G->pos, yythunkpos730= G->thunkpos;
-  {  int yypos731= G->pos, yythunkpos731= G->thunkpos;  if (!yy_HtmlBlockHeader(G))  goto l732;
-  goto l731;
-  l732:;	  G->pos= yypos731; G->thunkpos= yythunkpos731;
-  {  int yypos733= G->pos, yythunkpos733= G->thunkpos;  if (!yy_HtmlBlockCloseHeader(G))  goto l733;
-  goto l730;
-  l733:;	  G->pos= yypos733; G->thunkpos= yythunkpos733;
-  }  if (!yymatchDot(G)) goto l730;
+  l1332:;	
+  {  int yypos1333= G->pos, yythunkpos1333= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1333;
+  goto l1332;
+  l1333:;	  G->pos= yypos1333; G->thunkpos= yythunkpos1333;
   }
-  l731:;	  goto l729;
-  l730:;	  G->pos= yypos730; G->thunkpos= yythunkpos730;
-  }  if (!yy_HtmlBlockCloseHeader(G))  goto l728;
-  yyprintf((stderr, "  ok   HtmlBlockHeader"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l728:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockHeader"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockCloseHeader(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseHeader"));
-  if (!yymatchChar(G, '<')) goto l734;
-  if (!yy_Spnl(G))  goto l734;
-  if (!yymatchChar(G, '/')) goto l734;
-
-  {  int yypos735= G->pos, yythunkpos735= G->thunkpos;  if (!yymatchString(G, "header")) goto l736;
-  goto l735;
-  l736:;	  G->pos= yypos735; G->thunkpos= yythunkpos735;  if (!yymatchString(G, "HEADER")) goto l734;
-
   }
-  l735:;	  if (!yy_Spnl(G))  goto l734;
-  if (!yymatchChar(G, '>')) goto l734;
-  yyprintf((stderr, "  ok   HtmlBlockCloseHeader"));
+  l1328:;	  if (!yy_Newline(G))  goto l1327;
+  goto l1323;
+  l1327:;	  G->pos= yypos1327; G->thunkpos= yythunkpos1327;
+  }  yyprintf((stderr, "  ok   voidNormalEndline"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l734:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseHeader"));
+  l1323:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "voidNormalEndline"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenHeader(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenHeader"));
-  if (!yymatchChar(G, '<')) goto l737;
-  if (!yy_Spnl(G))  goto l737;
-
-  {  int yypos738= G->pos, yythunkpos738= G->thunkpos;  if (!yymatchString(G, "header")) goto l739;
-  goto l738;
-  l739:;	  G->pos= yypos738; G->thunkpos= yythunkpos738;  if (!yymatchString(G, "HEADER")) goto l737;
+YY_RULE(int) yy_NormalEndline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "NormalEndline"));
+  if (!yy_Sp(G))  goto l1334;
+  if (!yy_Newline(G))  goto l1334;
 
+  {  int yypos1335= G->pos, yythunkpos1335= G->thunkpos;  if (!yy_BlankLine(G))  goto l1335;
+  goto l1334;
+  l1335:;	  G->pos= yypos1335; G->thunkpos= yythunkpos1335;
   }
-  l738:;	  if (!yy_Spnl(G))  goto l737;
-
-  l740:;	
-  {  int yypos741= G->pos, yythunkpos741= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l741;
-  goto l740;
-  l741:;	  G->pos= yypos741; G->thunkpos= yythunkpos741;
-  }  if (!yymatchChar(G, '>')) goto l737;
-  yyprintf((stderr, "  ok   HtmlBlockOpenHeader"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l737:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenHeader"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockForm(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockForm"));
-  if (!yy_HtmlBlockOpenForm(G))  goto l742;
-
-  l743:;	
-  {  int yypos744= G->pos, yythunkpos744= G->thunkpos;
-  {  int yypos745= G->pos, yythunkpos745= G->thunkpos;  if (!yy_HtmlBlockForm(G))  goto l746;
-  goto l745;
-  l746:;	  G->pos= yypos745; G->thunkpos= yythunkpos745;
-  {  int yypos747= G->pos, yythunkpos747= G->thunkpos;  if (!yy_HtmlBlockCloseForm(G))  goto l747;
-  goto l744;
-  l747:;	  G->pos= yypos747; G->thunkpos= yythunkpos747;
-  }  if (!yymatchDot(G)) goto l744;
+  {  int yypos1336= G->pos, yythunkpos1336= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1336;
+  goto l1334;
+  l1336:;	  G->pos= yypos1336; G->thunkpos= yythunkpos1336;
   }
-  l745:;	  goto l743;
-  l744:;	  G->pos= yypos744; G->thunkpos= yythunkpos744;
-  }  if (!yy_HtmlBlockCloseForm(G))  goto l742;
-  yyprintf((stderr, "  ok   HtmlBlockForm"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l742:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockForm"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockCloseForm(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseForm"));
-  if (!yymatchChar(G, '<')) goto l748;
-  if (!yy_Spnl(G))  goto l748;
-  if (!yymatchChar(G, '/')) goto l748;
-
-  {  int yypos749= G->pos, yythunkpos749= G->thunkpos;  if (!yymatchString(G, "form")) goto l750;
-  goto l749;
-  l750:;	  G->pos= yypos749; G->thunkpos= yythunkpos749;  if (!yymatchString(G, "FORM")) goto l748;
-
+  {  int yypos1337= G->pos, yythunkpos1337= G->thunkpos;  if (!yy_AtxStart(G))  goto l1337;
+  goto l1334;
+  l1337:;	  G->pos= yypos1337; G->thunkpos= yythunkpos1337;
   }
-  l749:;	  if (!yy_Spnl(G))  goto l748;
-  if (!yymatchChar(G, '>')) goto l748;
-  yyprintf((stderr, "  ok   HtmlBlockCloseForm"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l748:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseForm"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+  {  int yypos1338= G->pos, yythunkpos1338= G->thunkpos;  if (!(yyLineClass(G) & LINE_SETEXT)) goto l1338;
+  if (!yy_Line(G))  goto l1338;
 
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockOpenForm(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenForm"));
-  if (!yymatchChar(G, '<')) goto l751;
-  if (!yy_Spnl(G))  goto l751;
+  {  int yypos1339= G->pos, yythunkpos1339= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1340;
 
-  {  int yypos752= G->pos, yythunkpos752= G->thunkpos;  if (!yymatchString(G, "form")) goto l753;
-  goto l752;
-  l753:;	  G->pos= yypos752; G->thunkpos= yythunkpos752;  if (!yymatchString(G, "FORM")) goto l751;
+  l1341:;	
+  {  int yypos1342= G->pos, yythunkpos1342= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1342;
+  goto l1341;
+  l1342:;	  G->pos= yypos1342; G->thunkpos= yythunkpos1342;
+  }  goto l1339;
+  l1340:;	  G->pos= yypos1339; G->thunkpos= yythunkpos1339;  if (!yymatchChar(G, '-')) goto l1338;
 
+  l1343:;	
+  {  int yypos1344= G->pos, yythunkpos1344= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1344;
+  goto l1343;
+  l1344:;	  G->pos= yypos1344; G->thunkpos= yythunkpos1344;
   }
-  l752:;	  if (!yy_Spnl(G))  goto l751;
-
-  l754:;	
-  {  int yypos755= G->pos, yythunkpos755= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l755;
-  goto l754;
-  l755:;	  G->pos= yypos755; G->thunkpos= yythunkpos755;
-  }  if (!yymatchChar(G, '>')) goto l751;
-  yyprintf((stderr, "  ok   HtmlBlockOpenForm"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l751:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenForm"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockFooter(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockFooter"));
-  if (!yy_HtmlBlockOpenFooter(G))  goto l756;
-
-  l757:;	
-  {  int yypos758= G->pos, yythunkpos758= G->thunkpos;
-  {  int yypos759= G->pos, yythunkpos759= G->thunkpos;  if (!yy_HtmlBlockFooter(G))  goto l760;
-  goto l759;
-  l760:;	  G->pos= yypos759; G->thunkpos= yythunkpos759;
-  {  int yypos761= G->pos, yythunkpos761= G->thunkpos;  if (!yy_HtmlBlockCloseFooter(G))  goto l761;
-  goto l758;
-  l761:;	  G->pos= yypos761; G->thunkpos= yythunkpos761;
-  }  if (!yymatchDot(G)) goto l758;
   }
-  l759:;	  goto l757;
-  l758:;	  G->pos= yypos758; G->thunkpos= yythunkpos758;
-  }  if (!yy_HtmlBlockCloseFooter(G))  goto l756;
-  yyprintf((stderr, "  ok   HtmlBlockFooter"));
+  l1339:;	  if (!yy_Newline(G))  goto l1338;
+  goto l1334;
+  l1338:;	  G->pos= yypos1338; G->thunkpos= yythunkpos1338;
+  }  yyDo(G, yy_1_NormalEndline, G->begin, G->end, "yy_1_NormalEndline");
+  yyprintf((stderr, "  ok   NormalEndline"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l756:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockFooter"));
+  l1334:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "NormalEndline"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseFooter(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseFooter"));
-  if (!yymatchChar(G, '<')) goto l762;
-  if (!yy_Spnl(G))  goto l762;
-  if (!yymatchChar(G, '/')) goto l762;
-
-  {  int yypos763= G->pos, yythunkpos763= G->thunkpos;  if (!yymatchString(G, "footer")) goto l764;
-  goto l763;
-  l764:;	  G->pos= yypos763; G->thunkpos= yythunkpos763;  if (!yymatchString(G, "FOOTER")) goto l762;
-
-  }
-  l763:;	  if (!yy_Spnl(G))  goto l762;
-  if (!yymatchChar(G, '>')) goto l762;
-  yyprintf((stderr, "  ok   HtmlBlockCloseFooter"));
+YY_RULE(int) yy_TerminalEndline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "TerminalEndline"));
+  if (!yy_Sp(G))  goto l1345;
+  if (!yy_Newline(G))  goto l1345;
+  if (!yy_Eof(G))  goto l1345;
+  yyDo(G, yy_1_TerminalEndline, G->begin, G->end, "yy_1_TerminalEndline");
+  yyprintf((stderr, "  ok   TerminalEndline"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l762:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseFooter"));
+  l1345:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "TerminalEndline"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenFooter(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenFooter"));
-  if (!yymatchChar(G, '<')) goto l765;
-  if (!yy_Spnl(G))  goto l765;
-
-  {  int yypos766= G->pos, yythunkpos766= G->thunkpos;  if (!yymatchString(G, "footer")) goto l767;
-  goto l766;
-  l767:;	  G->pos= yypos766; G->thunkpos= yythunkpos766;  if (!yymatchString(G, "FOOTER")) goto l765;
-
-  }
-  l766:;	  if (!yy_Spnl(G))  goto l765;
-
-  l768:;	
-  {  int yypos769= G->pos, yythunkpos769= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l769;
-  goto l768;
-  l769:;	  G->pos= yypos769; G->thunkpos= yythunkpos769;
-  }  if (!yymatchChar(G, '>')) goto l765;
-  yyprintf((stderr, "  ok   HtmlBlockOpenFooter"));
+YY_RULE(int) yy_LineBreak(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "LineBreak"));
+  if (!yymatchString(G, "  ")) goto l1346;
+  if (!yy_NormalEndline(G))  goto l1346;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_LineBreak, G->begin, G->end, "yy_1_LineBreak");
+  yyprintf((stderr, "  ok   LineBreak"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l765:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenFooter"));
+  l1346:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "LineBreak"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockFigure(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockFigure"));
-  if (!yy_HtmlBlockOpenFigure(G))  goto l770;
+YY_RULE(int) yy_Smart(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Smart"));
+  yyText(G, G->begin, G->end);  if (!( ext(EXT_SMART) )) goto l1347;
+  {  int yypos1348= G->pos, yythunkpos1348= G->thunkpos;  if (!yy_Ellipsis(G))  goto l1349;
+  goto l1348;
+  l1349:;	  G->pos= yypos1348; G->thunkpos= yythunkpos1348;  if (!yy_Dash(G))  goto l1350;
+  goto l1348;
+  l1350:;	  G->pos= yypos1348; G->thunkpos= yythunkpos1348;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_LINEAR_INLINES) )) goto l1347;  if (!yy_SingleQuoted(G))  goto l1351;
+  goto l1348;
+  l1351:;	  G->pos= yypos1348; G->thunkpos= yythunkpos1348;  if (!yy_DoubleQuoted(G))  goto l1352;
+  goto l1348;
+  l1352:;	  G->pos= yypos1348; G->thunkpos= yythunkpos1348;  if (!yy_Apostrophe(G))  goto l1347;
 
-  l771:;	
-  {  int yypos772= G->pos, yythunkpos772= G->thunkpos;
-  {  int yypos773= G->pos, yythunkpos773= G->thunkpos;  if (!yy_HtmlBlockFigure(G))  goto l774;
-  goto l773;
-  l774:;	  G->pos= yypos773; G->thunkpos= yythunkpos773;
-  {  int yypos775= G->pos, yythunkpos775= G->thunkpos;  if (!yy_HtmlBlockCloseFigure(G))  goto l775;
-  goto l772;
-  l775:;	  G->pos= yypos775; G->thunkpos= yythunkpos775;
-  }  if (!yymatchDot(G)) goto l772;
   }
-  l773:;	  goto l771;
-  l772:;	  G->pos= yypos772; G->thunkpos= yythunkpos772;
-  }  if (!yy_HtmlBlockCloseFigure(G))  goto l770;
-  yyprintf((stderr, "  ok   HtmlBlockFigure"));
+  l1348:;	  yyprintf((stderr, "  ok   Smart"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l770:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockFigure"));
+  l1347:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Smart"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseFigure(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseFigure"));
-  if (!yymatchChar(G, '<')) goto l776;
-  if (!yy_Spnl(G))  goto l776;
-  if (!yymatchChar(G, '/')) goto l776;
+YY_RULE(int) yy_MarkdownHtmlTagOpen(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "MarkdownHtmlTagOpen"));
+  if (!yy_StartList(G))  goto l1353;
+  yyDo(G, yySet, -1, 0, "yySet");
+  if (!yymatchChar(G, '<')) goto l1353;
+  yyDo(G, yy_1_MarkdownHtmlTagOpen, G->begin, G->end, "yy_1_MarkdownHtmlTagOpen");
+  if (!yy_Spnl(G))  goto l1353;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1353;  if (!yy_HtmlBlockType(G))  goto l1353;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1353;  yyDo(G, yy_2_MarkdownHtmlTagOpen, G->begin, G->end, "yy_2_MarkdownHtmlTagOpen");
+  if (!yy_Spnl(G))  goto l1353;
 
-  {  int yypos777= G->pos, yythunkpos777= G->thunkpos;  if (!yymatchString(G, "figure")) goto l778;
-  goto l777;
-  l778:;	  G->pos= yypos777; G->thunkpos= yythunkpos777;  if (!yymatchString(G, "FIGURE")) goto l776;
+  l1354:;	
+  {  int yypos1355= G->pos, yythunkpos1355= G->thunkpos;
+  {  int yypos1356= G->pos, yythunkpos1356= G->thunkpos;  if (!yy_MarkdownHtmlAttribute(G))  goto l1356;
+  goto l1355;
+  l1356:;	  G->pos= yypos1356; G->thunkpos= yythunkpos1356;
+  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1355;  if (!yy_HtmlAttribute(G))  goto l1355;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1355;  yyDo(G, yy_3_MarkdownHtmlTagOpen, G->begin, G->end, "yy_3_MarkdownHtmlTagOpen");
+  goto l1354;
+  l1355:;	  G->pos= yypos1355; G->thunkpos= yythunkpos1355;
+  }  if (!yy_MarkdownHtmlAttribute(G))  goto l1353;
 
-  }
-  l777:;	  if (!yy_Spnl(G))  goto l776;
-  if (!yymatchChar(G, '>')) goto l776;
-  yyprintf((stderr, "  ok   HtmlBlockCloseFigure"));
+  l1357:;	
+  {  int yypos1358= G->pos, yythunkpos1358= G->thunkpos;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1358;  if (!yy_HtmlAttribute(G))  goto l1358;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1358;  yyDo(G, yy_4_MarkdownHtmlTagOpen, G->begin, G->end, "yy_4_MarkdownHtmlTagOpen");
+  goto l1357;
+  l1358:;	  G->pos= yypos1358; G->thunkpos= yythunkpos1358;
+  }  if (!yymatchChar(G, '>')) goto l1353;
+  yyDo(G, yy_5_MarkdownHtmlTagOpen, G->begin, G->end, "yy_5_MarkdownHtmlTagOpen");
+  yyDo(G, yy_6_MarkdownHtmlTagOpen, G->begin, G->end, "yy_6_MarkdownHtmlTagOpen");
+  yyprintf((stderr, "  ok   MarkdownHtmlTagOpen"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l776:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseFigure"));
+  l1353:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "MarkdownHtmlTagOpen"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenFigure(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenFigure"));
-  if (!yymatchChar(G, '<')) goto l779;
-  if (!yy_Spnl(G))  goto l779;
+YY_RULE(int) yy_Code(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Code"));
+
+  {  int yypos1360= G->pos, yythunkpos1360= G->thunkpos;  if (!yy_Ticks1(G))  goto l1361;
+  if (!yy_Sp(G))  goto l1361;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1361;
+  {  int yypos1364= G->pos, yythunkpos1364= G->thunkpos;
+  {  int yypos1368= G->pos, yythunkpos1368= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1368;
+  goto l1365;
+  l1368:;	  G->pos= yypos1368; G->thunkpos= yythunkpos1368;
+  }  if (!yy_Nonspacechar(G))  goto l1365;
 
-  {  int yypos780= G->pos, yythunkpos780= G->thunkpos;  if (!yymatchString(G, "figure")) goto l781;
-  goto l780;
-  l781:;	  G->pos= yypos780; G->thunkpos= yythunkpos780;  if (!yymatchString(G, "FIGURE")) goto l779;
+  l1366:;	
+  {  int yypos1367= G->pos, yythunkpos1367= G->thunkpos;
+  {  int yypos1369= G->pos, yythunkpos1369= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1369;
+  goto l1367;
+  l1369:;	  G->pos= yypos1369; G->thunkpos= yythunkpos1369;
+  }  if (!yy_Nonspacechar(G))  goto l1367;
+  goto l1366;
+  l1367:;	  G->pos= yypos1367; G->thunkpos= yythunkpos1367;
+  }  goto l1364;
+  l1365:;	  G->pos= yypos1364; G->thunkpos= yythunkpos1364;
+  {  int yypos1371= G->pos, yythunkpos1371= G->thunkpos;  if (!yy_Ticks1(G))  goto l1371;
+  goto l1370;
+  l1371:;	  G->pos= yypos1371; G->thunkpos= yythunkpos1371;
+  }  if (!yymatchChar(G, '`')) goto l1370;
 
+  l1372:;	
+  {  int yypos1373= G->pos, yythunkpos1373= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1373;
+  goto l1372;
+  l1373:;	  G->pos= yypos1373; G->thunkpos= yythunkpos1373;
+  }  goto l1364;
+  l1370:;	  G->pos= yypos1364; G->thunkpos= yythunkpos1364;
+  {  int yypos1374= G->pos, yythunkpos1374= G->thunkpos;  if (!yy_Sp(G))  goto l1374;
+  if (!yy_Ticks1(G))  goto l1374;
+  goto l1361;
+  l1374:;	  G->pos= yypos1374; G->thunkpos= yythunkpos1374;
   }
-  l780:;	  if (!yy_Spnl(G))  goto l779;
+  {  int yypos1375= G->pos, yythunkpos1375= G->thunkpos;  if (!yy_Spacechar(G))  goto l1376;
+  goto l1375;
+  l1376:;	  G->pos= yypos1375; G->thunkpos= yythunkpos1375;  if (!yy_Newline(G))  goto l1361;
 
-  l782:;	
-  {  int yypos783= G->pos, yythunkpos783= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l783;
-  goto l782;
-  l783:;	  G->pos= yypos783; G->thunkpos= yythunkpos783;
-  }  if (!yymatchChar(G, '>')) goto l779;
-  yyprintf((stderr, "  ok   HtmlBlockOpenFigure"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l779:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenFigure"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockFieldset(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockFieldset"));
-  if (!yy_HtmlBlockOpenFieldset(G))  goto l784;
-
-  l785:;	
-  {  int yypos786= G->pos, yythunkpos786= G->thunkpos;
-  {  int yypos787= G->pos, yythunkpos787= G->thunkpos;  if (!yy_HtmlBlockFieldset(G))  goto l788;
-  goto l787;
-  l788:;	  G->pos= yypos787; G->thunkpos= yythunkpos787;
-  {  int yypos789= G->pos, yythunkpos789= G->thunkpos;  if (!yy_HtmlBlockCloseFieldset(G))  goto l789;
-  goto l786;
-  l789:;	  G->pos= yypos789; G->thunkpos= yythunkpos789;
-  }  if (!yymatchDot(G)) goto l786;
+  {  int yypos1377= G->pos, yythunkpos1377= G->thunkpos;  if (!yy_BlankLine(G))  goto l1377;
+  goto l1361;
+  l1377:;	  G->pos= yypos1377; G->thunkpos= yythunkpos1377;
   }
-  l787:;	  goto l785;
-  l786:;	  G->pos= yypos786; G->thunkpos= yythunkpos786;
-  }  if (!yy_HtmlBlockCloseFieldset(G))  goto l784;
-  yyprintf((stderr, "  ok   HtmlBlockFieldset"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l784:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockFieldset"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockCloseFieldset(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseFieldset"));
-  if (!yymatchChar(G, '<')) goto l790;
-  if (!yy_Spnl(G))  goto l790;
-  if (!yymatchChar(G, '/')) goto l790;
-
-  {  int yypos791= G->pos, yythunkpos791= G->thunkpos;  if (!yymatchString(G, "fieldset")) goto l792;
-  goto l791;
-  l792:;	  G->pos= yypos791; G->thunkpos= yythunkpos791;  if (!yymatchString(G, "FIELDSET")) goto l790;
-
   }
-  l791:;	  if (!yy_Spnl(G))  goto l790;
-  if (!yymatchChar(G, '>')) goto l790;
-  yyprintf((stderr, "  ok   HtmlBlockCloseFieldset"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l790:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseFieldset"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockOpenFieldset(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenFieldset"));
-  if (!yymatchChar(G, '<')) goto l793;
-  if (!yy_Spnl(G))  goto l793;
-
-  {  int yypos794= G->pos, yythunkpos794= G->thunkpos;  if (!yymatchString(G, "fieldset")) goto l795;
-  goto l794;
-  l795:;	  G->pos= yypos794; G->thunkpos= yythunkpos794;  if (!yymatchString(G, "FIELDSET")) goto l793;
-
+  l1375:;	
   }
-  l794:;	  if (!yy_Spnl(G))  goto l793;
-
-  l796:;	
-  {  int yypos797= G->pos, yythunkpos797= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l797;
-  goto l796;
-  l797:;	  G->pos= yypos797; G->thunkpos= yythunkpos797;
-  }  if (!yymatchChar(G, '>')) goto l793;
-  yyprintf((stderr, "  ok   HtmlBlockOpenFieldset"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l793:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenFieldset"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+  l1364:;	
+  l1362:;	
+  {  int yypos1363= G->pos, yythunkpos1363= G->thunkpos;
+  {  int yypos1378= G->pos, yythunkpos1378= G->thunkpos;
+  {  int yypos1382= G->pos, yythunkpos1382= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1382;
+  goto l1379;
+  l1382:;	  G->pos= yypos1382; G->thunkpos= yythunkpos1382;
+  }  if (!yy_Nonspacechar(G))  goto l1379;
 
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockDl(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockDl"));
-  if (!yy_HtmlBlockOpenDl(G))  goto l798;
+  l1380:;	
+  {  int yypos1381= G->pos, yythunkpos1381= G->thunkpos;
+  {  int yypos1383= G->pos, yythunkpos1383= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1383;
+  goto l1381;
+  l1383:;	  G->pos= yypos1383; G->thunkpos= yythunkpos1383;
+  }  if (!yy_Nonspacechar(G))  goto l1381;
+  goto l1380;
+  l1381:;	  G->pos= yypos1381; G->thunkpos= yythunkpos1381;
+  }  goto l1378;
+  l1379:;	  G->pos= yypos1378; G->thunkpos= yythunkpos1378;
+  {  int yypos1385= G->pos, yythunkpos1385= G->thunkpos;  if (!yy_Ticks1(G))  goto l1385;
+  goto l1384;
+  l1385:;	  G->pos= yypos1385; G->thunkpos= yythunkpos1385;
+  }  if (!yymatchChar(G, '`')) goto l1384;
 
-  l799:;	
-  {  int yypos800= G->pos, yythunkpos800= G->thunkpos;
-  {  int yypos801= G->pos, yythunkpos801= G->thunkpos;  if (!yy_HtmlBlockDl(G))  goto l802;
-  goto l801;
-  l802:;	  G->pos= yypos801; G->thunkpos= yythunkpos801;
-  {  int yypos803= G->pos, yythunkpos803= G->thunkpos;  if (!yy_HtmlBlockCloseDl(G))  goto l803;
-  goto l800;
-  l803:;	  G->pos= yypos803; G->thunkpos= yythunkpos803;
-  }  if (!yymatchDot(G)) goto l800;
+  l1386:;	
+  {  int yypos1387= G->pos, yythunkpos1387= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1387;
+  goto l1386;
+  l1387:;	  G->pos= yypos1387; G->thunkpos= yythunkpos1387;
+  }  goto l1378;
+  l1384:;	  G->pos= yypos1378; G->thunkpos= yythunkpos1378;
+  {  int yypos1388= G->pos, yythunkpos1388= G->thunkpos;  if (!yy_Sp(G))  goto l1388;
+  if (!yy_Ticks1(G))  goto l1388;
+  goto l1363;
+  l1388:;	  G->pos= yypos1388; G->thunkpos= yythunkpos1388;
   }
-  l801:;	  goto l799;
-  l800:;	  G->pos= yypos800; G->thunkpos= yythunkpos800;
-  }  if (!yy_HtmlBlockCloseDl(G))  goto l798;
-  yyprintf((stderr, "  ok   HtmlBlockDl"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l798:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockDl"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockCloseDl(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseDl"));
-  if (!yymatchChar(G, '<')) goto l804;
-  if (!yy_Spnl(G))  goto l804;
-  if (!yymatchChar(G, '/')) goto l804;
-
-  {  int yypos805= G->pos, yythunkpos805= G->thunkpos;  if (!yymatchString(G, "dl")) goto l806;
-  goto l805;
-  l806:;	  G->pos= yypos805; G->thunkpos= yythunkpos805;  if (!yymatchString(G, "DL")) goto l804;
+  {  int yypos1389= G->pos, yythunkpos1389= G->thunkpos;  if (!yy_Spacechar(G))  goto l1390;
+  goto l1389;
+  l1390:;	  G->pos= yypos1389; G->thunkpos= yythunkpos1389;  if (!yy_Newline(G))  goto l1363;
 
+  {  int yypos1391= G->pos, yythunkpos1391= G->thunkpos;  if (!yy_BlankLine(G))  goto l1391;
+  goto l1363;
+  l1391:;	  G->pos= yypos1391; G->thunkpos= yythunkpos1391;
   }
-  l805:;	  if (!yy_Spnl(G))  goto l804;
-  if (!yymatchChar(G, '>')) goto l804;
-  yyprintf((stderr, "  ok   HtmlBlockCloseDl"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l804:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseDl"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockOpenDl(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenDl"));
-  if (!yymatchChar(G, '<')) goto l807;
-  if (!yy_Spnl(G))  goto l807;
-
-  {  int yypos808= G->pos, yythunkpos808= G->thunkpos;  if (!yymatchString(G, "dl")) goto l809;
-  goto l808;
-  l809:;	  G->pos= yypos808; G->thunkpos= yythunkpos808;  if (!yymatchString(G, "DL")) goto l807;
-
   }
-  l808:;	  if (!yy_Spnl(G))  goto l807;
-
-  l810:;	
-  {  int yypos811= G->pos, yythunkpos811= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l811;
-  goto l810;
-  l811:;	  G->pos= yypos811; G->thunkpos= yythunkpos811;
-  }  if (!yymatchChar(G, '>')) goto l807;
-  yyprintf((stderr, "  ok   HtmlBlockOpenDl"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l807:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenDl"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockDiv(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockDiv"));
-  if (!yy_HtmlBlockOpenDiv(G))  goto l812;
-
-  l813:;	
-  {  int yypos814= G->pos, yythunkpos814= G->thunkpos;
-  {  int yypos815= G->pos, yythunkpos815= G->thunkpos;  if (!yy_HtmlBlockDiv(G))  goto l816;
-  goto l815;
-  l816:;	  G->pos= yypos815; G->thunkpos= yythunkpos815;
-  {  int yypos817= G->pos, yythunkpos817= G->thunkpos;  if (!yy_HtmlBlockCloseDiv(G))  goto l817;
-  goto l814;
-  l817:;	  G->pos= yypos817; G->thunkpos= yythunkpos817;
-  }  if (!yymatchDot(G)) goto l814;
+  l1389:;	
   }
-  l815:;	  goto l813;
-  l814:;	  G->pos= yypos814; G->thunkpos= yythunkpos814;
-  }  if (!yy_HtmlBlockCloseDiv(G))  goto l812;
-  yyprintf((stderr, "  ok   HtmlBlockDiv"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l812:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockDiv"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockCloseDiv(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseDiv"));
-  if (!yymatchChar(G, '<')) goto l818;
-  if (!yy_Spnl(G))  goto l818;
-  if (!yymatchChar(G, '/')) goto l818;
+  l1378:;	  goto l1362;
+  l1363:;	  G->pos= yypos1363; G->thunkpos= yythunkpos1363;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1361;  if (!yy_Sp(G))  goto l1361;
+  if (!yy_Ticks1(G))  goto l1361;
+  goto l1360;
+  l1361:;	  G->pos= yypos1360; G->thunkpos= yythunkpos1360;  if (!yy_Ticks2(G))  goto l1392;
+  if (!yy_Sp(G))  goto l1392;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1392;
+  {  int yypos1395= G->pos, yythunkpos1395= G->thunkpos;
+  {  int yypos1399= G->pos, yythunkpos1399= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1399;
+  goto l1396;
+  l1399:;	  G->pos= yypos1399; G->thunkpos= yythunkpos1399;
+  }  if (!yy_Nonspacechar(G))  goto l1396;
 
-  {  int yypos819= G->pos, yythunkpos819= G->thunkpos;  if (!yymatchString(G, "div")) goto l820;
-  goto l819;
-  l820:;	  G->pos= yypos819; G->thunkpos= yythunkpos819;  if (!yymatchString(G, "DIV")) goto l818;
+  l1397:;	
+  {  int yypos1398= G->pos, yythunkpos1398= G->thunkpos;
+  {  int yypos1400= G->pos, yythunkpos1400= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1400;
+  goto l1398;
+  l1400:;	  G->pos= yypos1400; G->thunkpos= yythunkpos1400;
+  }  if (!yy_Nonspacechar(G))  goto l1398;
+  goto l1397;
+  l1398:;	  G->pos= yypos1398; G->thunkpos= yythunkpos1398;
+  }  goto l1395;
+  l1396:;	  G->pos= yypos1395; G->thunkpos= yythunkpos1395;
+  {  int yypos1402= G->pos, yythunkpos1402= G->thunkpos;  if (!yy_Ticks2(G))  goto l1402;
+  goto l1401;
+  l1402:;	  G->pos= yypos1402; G->thunkpos= yythunkpos1402;
+  }  if (!yymatchChar(G, '`')) goto l1401;
 
+  l1403:;	
+  {  int yypos1404= G->pos, yythunkpos1404= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1404;
+  goto l1403;
+  l1404:;	  G->pos= yypos1404; G->thunkpos= yythunkpos1404;
+  }  goto l1395;
+  l1401:;	  G->pos= yypos1395; G->thunkpos= yythunkpos1395;
+  {  int yypos1405= G->pos, yythunkpos1405= G->thunkpos;  if (!yy_Sp(G))  goto l1405;
+  if (!yy_Ticks2(G))  goto l1405;
+  goto l1392;
+  l1405:;	  G->pos= yypos1405; G->thunkpos= yythunkpos1405;
   }
-  l819:;	  if (!yy_Spnl(G))  goto l818;
-  if (!yymatchChar(G, '>')) goto l818;
-  yyprintf((stderr, "  ok   HtmlBlockCloseDiv"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l818:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseDiv"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockOpenDiv(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenDiv"));
-  if (!yymatchChar(G, '<')) goto l821;
-  if (!yy_Spnl(G))  goto l821;
-
-  {  int yypos822= G->pos, yythunkpos822= G->thunkpos;  if (!yymatchString(G, "div")) goto l823;
-  goto l822;
-  l823:;	  G->pos= yypos822; G->thunkpos= yythunkpos822;  if (!yymatchString(G, "DIV")) goto l821;
+  {  int yypos1406= G->pos, yythunkpos1406= G->thunkpos;  if (!yy_Spacechar(G))  goto l1407;
+  goto l1406;
+  l1407:;	  G->pos= yypos1406; G->thunkpos= yythunkpos1406;  if (!yy_Newline(G))  goto l1392;
 
+  {  int yypos1408= G->pos, yythunkpos1408= G->thunkpos;  if (!yy_BlankLine(G))  goto l1408;
+  goto l1392;
+  l1408:;	  G->pos= yypos1408; G->thunkpos= yythunkpos1408;
   }
-  l822:;	  if (!yy_Spnl(G))  goto l821;
-
-  l824:;	
-  {  int yypos825= G->pos, yythunkpos825= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l825;
-  goto l824;
-  l825:;	  G->pos= yypos825; G->thunkpos= yythunkpos825;
-  }  if (!yymatchChar(G, '>')) goto l821;
-  yyprintf((stderr, "  ok   HtmlBlockOpenDiv"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l821:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenDiv"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockDir(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockDir"));
-  if (!yy_HtmlBlockOpenDir(G))  goto l826;
-
-  l827:;	
-  {  int yypos828= G->pos, yythunkpos828= G->thunkpos;
-  {  int yypos829= G->pos, yythunkpos829= G->thunkpos;  if (!yy_HtmlBlockDir(G))  goto l830;
-  goto l829;
-  l830:;	  G->pos= yypos829; G->thunkpos= yythunkpos829;
-  {  int yypos831= G->pos, yythunkpos831= G->thunkpos;  if (!yy_HtmlBlockCloseDir(G))  goto l831;
-  goto l828;
-  l831:;	  G->pos= yypos831; G->thunkpos= yythunkpos831;
-  }  if (!yymatchDot(G)) goto l828;
   }
-  l829:;	  goto l827;
-  l828:;	  G->pos= yypos828; G->thunkpos= yythunkpos828;
-  }  if (!yy_HtmlBlockCloseDir(G))  goto l826;
-  yyprintf((stderr, "  ok   HtmlBlockDir"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l826:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockDir"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockCloseDir(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseDir"));
-  if (!yymatchChar(G, '<')) goto l832;
-  if (!yy_Spnl(G))  goto l832;
-  if (!yymatchChar(G, '/')) goto l832;
-
-  {  int yypos833= G->pos, yythunkpos833= G->thunkpos;  if (!yymatchString(G, "dir")) goto l834;
-  goto l833;
-  l834:;	  G->pos= yypos833; G->thunkpos= yythunkpos833;  if (!yymatchString(G, "DIR")) goto l832;
-
+  l1406:;	
   }
-  l833:;	  if (!yy_Spnl(G))  goto l832;
-  if (!yymatchChar(G, '>')) goto l832;
-  yyprintf((stderr, "  ok   HtmlBlockCloseDir"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l832:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseDir"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockOpenDir(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenDir"));
-  if (!yymatchChar(G, '<')) goto l835;
-  if (!yy_Spnl(G))  goto l835;
+  l1395:;	
+  l1393:;	
+  {  int yypos1394= G->pos, yythunkpos1394= G->thunkpos;
+  {  int yypos1409= G->pos, yythunkpos1409= G->thunkpos;
+  {  int yypos1413= G->pos, yythunkpos1413= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1413;
+  goto l1410;
+  l1413:;	  G->pos= yypos1413; G->thunkpos= yythunkpos1413;
+  }  if (!yy_Nonspacechar(G))  goto l1410;
 
-  {  int yypos836= G->pos, yythunkpos836= G->thunkpos;  if (!yymatchString(G, "dir")) goto l837;
-  goto l836;
-  l837:;	  G->pos= yypos836; G->thunkpos= yythunkpos836;  if (!yymatchString(G, "DIR")) goto l835;
+  l1411:;	
+  {  int yypos1412= G->pos, yythunkpos1412= G->thunkpos;
+  {  int yypos1414= G->pos, yythunkpos1414= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1414;
+  goto l1412;
+  l1414:;	  G->pos= yypos1414; G->thunkpos= yythunkpos1414;
+  }  if (!yy_Nonspacechar(G))  goto l1412;
+  goto l1411;
+  l1412:;	  G->pos= yypos1412; G->thunkpos= yythunkpos1412;
+  }  goto l1409;
+  l1410:;	  G->pos= yypos1409; G->thunkpos= yythunkpos1409;
+  {  int yypos1416= G->pos, yythunkpos1416= G->thunkpos;  if (!yy_Ticks2(G))  goto l1416;
+  goto l1415;
+  l1416:;	  G->pos= yypos1416; G->thunkpos= yythunkpos1416;
+  }  if (!yymatchChar(G, '`')) goto l1415;
 
+  l1417:;	
+  {  int yypos1418= G->pos, yythunkpos1418= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1418;
+  goto l1417;
+  l1418:;	  G->pos= yypos1418; G->thunkpos= yythunkpos1418;
+  }  goto l1409;
+  l1415:;	  G->pos= yypos1409; G->thunkpos= yythunkpos1409;
+  {  int yypos1419= G->pos, yythunkpos1419= G->thunkpos;  if (!yy_Sp(G))  goto l1419;
+  if (!yy_Ticks2(G))  goto l1419;
+  goto l1394;
+  l1419:;	  G->pos= yypos1419; G->thunkpos= yythunkpos1419;
   }
-  l836:;	  if (!yy_Spnl(G))  goto l835;
-
-  l838:;	
-  {  int yypos839= G->pos, yythunkpos839= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l839;
-  goto l838;
-  l839:;	  G->pos= yypos839; G->thunkpos= yythunkpos839;
-  }  if (!yymatchChar(G, '>')) goto l835;
-  yyprintf((stderr, "  ok   HtmlBlockOpenDir"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l835:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenDir"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockCenter(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCenter"));
-  if (!yy_HtmlBlockOpenCenter(G))  goto l840;
+  {  int yypos1420= G->pos, yythunkpos1420= G->thunkpos;  if (!yy_Spacechar(G))  goto l1421;
+  goto l1420;
+  l1421:;	  G->pos= yypos1420; G->thunkpos= yythunkpos1420;  if (!yy_Newline(G))  goto l1394;
 
-  l841:;	
-  {  int yypos842= G->pos, yythunkpos842= G->thunkpos;
-  {  int yypos843= G->pos, yythunkpos843= G->thunkpos;  if (!yy_HtmlBlockCenter(G))  goto l844;
-  goto l843;
-  l844:;	  G->pos= yypos843; G->thunkpos= yythunkpos843;
-  {  int yypos845= G->pos, yythunkpos845= G->thunkpos;  if (!yy_HtmlBlockCloseCenter(G))  goto l845;
-  goto l842;
-  l845:;	  G->pos= yypos845; G->thunkpos= yythunkpos845;
-  }  if (!yymatchDot(G)) goto l842;
+  {  int yypos1422= G->pos, yythunkpos1422= G->thunkpos;  if (!yy_BlankLine(G))  goto l1422;
+  goto l1394;
+  l1422:;	  G->pos= yypos1422; G->thunkpos= yythunkpos1422;
   }
-  l843:;	  goto l841;
-  l842:;	  G->pos= yypos842; G->thunkpos= yythunkpos842;
-  }  if (!yy_HtmlBlockCloseCenter(G))  goto l840;
-  yyprintf((stderr, "  ok   HtmlBlockCenter"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l840:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCenter"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockCloseCenter(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseCenter"));
-  if (!yymatchChar(G, '<')) goto l846;
-  if (!yy_Spnl(G))  goto l846;
-  if (!yymatchChar(G, '/')) goto l846;
-
-  {  int yypos847= G->pos, yythunkpos847= G->thunkpos;  if (!yymatchString(G, "center")) goto l848;
-  goto l847;
-  l848:;	  G->pos= yypos847; G->thunkpos= yythunkpos847;  if (!yymatchString(G, "CENTER")) goto l846;
-
   }
-  l847:;	  if (!yy_Spnl(G))  goto l846;
-  if (!yymatchChar(G, '>')) goto l846;
-  yyprintf((stderr, "  ok   HtmlBlockCloseCenter"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l846:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseCenter"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockOpenCenter(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenCenter"));
-  if (!yymatchChar(G, '<')) goto l849;
-  if (!yy_Spnl(G))  goto l849;
-
-  {  int yypos850= G->pos, yythunkpos850= G->thunkpos;  if (!yymatchString(G, "center")) goto l851;
-  goto l850;
-  l851:;	  G->pos= yypos850; G->thunkpos= yythunkpos850;  if (!yymatchString(G, "CENTER")) goto l849;
-
+  l1420:;	
   }
-  l850:;	  if (!yy_Spnl(G))  goto l849;
-
-  l852:;	
-  {  int yypos853= G->pos, yythunkpos853= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l853;
-  goto l852;
-  l853:;	  G->pos= yypos853; G->thunkpos= yythunkpos853;
-  }  if (!yymatchChar(G, '>')) goto l849;
-  yyprintf((stderr, "  ok   HtmlBlockOpenCenter"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l849:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenCenter"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+  l1409:;	  goto l1393;
+  l1394:;	  G->pos= yypos1394; G->thunkpos= yythunkpos1394;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1392;  if (!yy_Sp(G))  goto l1392;
+  if (!yy_Ticks2(G))  goto l1392;
+  goto l1360;
+  l1392:;	  G->pos= yypos1360; G->thunkpos= yythunkpos1360;  if (!yy_Ticks3(G))  goto l1423;
+  if (!yy_Sp(G))  goto l1423;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1423;
+  {  int yypos1426= G->pos, yythunkpos1426= G->thunkpos;
+  {  int yypos1430= G->pos, yythunkpos1430= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1430;
+  goto l1427;
+  l1430:;	  G->pos= yypos1430; G->thunkpos= yythunkpos1430;
+  }  if (!yy_Nonspacechar(G))  goto l1427;
 
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockCanvas(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCanvas"));
-  if (!yy_HtmlBlockOpenCanvas(G))  goto l854;
+  l1428:;	
+  {  int yypos1429= G->pos, yythunkpos1429= G->thunkpos;
+  {  int yypos1431= G->pos, yythunkpos1431= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1431;
+  goto l1429;
+  l1431:;	  G->pos= yypos1431; G->thunkpos= yythunkpos1431;
+  }  if (!yy_Nonspacechar(G))  goto l1429;
+  goto l1428;
+  l1429:;	  G->pos= yypos1429; G->thunkpos= yythunkpos1429;
+  }  goto l1426;
+  l1427:;	  G->pos= yypos1426; G->thunkpos= yythunkpos1426;
+  {  int yypos1433= G->pos, yythunkpos1433= G->thunkpos;  if (!yy_Ticks3(G))  goto l1433;
+  goto l1432;
+  l1433:;	  G->pos= yypos1433; G->thunkpos= yythunkpos1433;
+  }  if (!yymatchChar(G, '`')) goto l1432;
 
-  l855:;	
-  {  int yypos856= G->pos, yythunkpos856= G->thunkpos;
-  {  int yypos857= G->pos, yythunkpos857= G->thunkpos;  if (!yy_HtmlBlockCanvas(G))  goto l858;
-  goto l857;
-  l858:;	  G->pos= yypos857; G->thunkpos= yythunkpos857;
-  {  int yypos859= G->pos, yythunkpos859= G->thunkpos;  if (!yy_HtmlBlockCloseCanvas(G))  goto l859;
-  goto l856;
-  l859:;	  G->pos= yypos859; G->thunkpos= yythunkpos859;
-  }  if (!yymatchDot(G)) goto l856;
+  l1434:;	
+  {  int yypos1435= G->pos, yythunkpos1435= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1435;
+  goto l1434;
+  l1435:;	  G->pos= yypos1435; G->thunkpos= yythunkpos1435;
+  }  goto l1426;
+  l1432:;	  G->pos= yypos1426; G->thunkpos= yythunkpos1426;
+  {  int yypos1436= G->pos, yythunkpos1436= G->thunkpos;  if (!yy_Sp(G))  goto l1436;
+  if (!yy_Ticks3(G))  goto l1436;
+  goto l1423;
+  l1436:;	  G->pos= yypos1436; G->thunkpos= yythunkpos1436;
   }
-  l857:;	  goto l855;
-  l856:;	  G->pos= yypos856; G->thunkpos= yythunkpos856;
-  }  if (!yy_HtmlBlockCloseCanvas(G))  goto l854;
-  yyprintf((stderr, "  ok   HtmlBlockCanvas"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l854:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCanvas"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockCloseCanvas(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseCanvas"));
-  if (!yymatchChar(G, '<')) goto l860;
-  if (!yy_Spnl(G))  goto l860;
-  if (!yymatchChar(G, '/')) goto l860;
-
-  {  int yypos861= G->pos, yythunkpos861= G->thunkpos;  if (!yymatchString(G, "canvas")) goto l862;
-  goto l861;
-  l862:;	  G->pos= yypos861; G->thunkpos= yythunkpos861;  if (!yymatchString(G, "CANVAS")) goto l860;
+  {  int yypos1437= G->pos, yythunkpos1437= G->thunkpos;  if (!yy_Spacechar(G))  goto l1438;
+  goto l1437;
+  l1438:;	  G->pos= yypos1437; G->thunkpos= yythunkpos1437;  if (!yy_Newline(G))  goto l1423;
 
+  {  int yypos1439= G->pos, yythunkpos1439= G->thunkpos;  if (!yy_BlankLine(G))  goto l1439;
+  goto l1423;
+  l1439:;	  G->pos= yypos1439; G->thunkpos= yythunkpos1439;
   }
-  l861:;	  if (!yy_Spnl(G))  goto l860;
-  if (!yymatchChar(G, '>')) goto l860;
-  yyprintf((stderr, "  ok   HtmlBlockCloseCanvas"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l860:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseCanvas"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockOpenCanvas(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenCanvas"));
-  if (!yymatchChar(G, '<')) goto l863;
-  if (!yy_Spnl(G))  goto l863;
-
-  {  int yypos864= G->pos, yythunkpos864= G->thunkpos;  if (!yymatchString(G, "canvas")) goto l865;
-  goto l864;
-  l865:;	  G->pos= yypos864; G->thunkpos= yythunkpos864;  if (!yymatchString(G, "CANVAS")) goto l863;
-
   }
-  l864:;	  if (!yy_Spnl(G))  goto l863;
-
-  l866:;	
-  {  int yypos867= G->pos, yythunkpos867= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l867;
-  goto l866;
-  l867:;	  G->pos= yypos867; G->thunkpos= yythunkpos867;
-  }  if (!yymatchChar(G, '>')) goto l863;
-  yyprintf((stderr, "  ok   HtmlBlockOpenCanvas"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l863:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenCanvas"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockBlockquote(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockBlockquote"));
-  if (!yy_HtmlBlockOpenBlockquote(G))  goto l868;
-
-  l869:;	
-  {  int yypos870= G->pos, yythunkpos870= G->thunkpos;
-  {  int yypos871= G->pos, yythunkpos871= G->thunkpos;  if (!yy_HtmlBlockBlockquote(G))  goto l872;
-  goto l871;
-  l872:;	  G->pos= yypos871; G->thunkpos= yythunkpos871;
-  {  int yypos873= G->pos, yythunkpos873= G->thunkpos;  if (!yy_HtmlBlockCloseBlockquote(G))  goto l873;
-  goto l870;
-  l873:;	  G->pos= yypos873; G->thunkpos= yythunkpos873;
-  }  if (!yymatchDot(G)) goto l870;
+  l1437:;	
   }
-  l871:;	  goto l869;
-  l870:;	  G->pos= yypos870; G->thunkpos= yythunkpos870;
-  }  if (!yy_HtmlBlockCloseBlockquote(G))  goto l868;
-  yyprintf((stderr, "  ok   HtmlBlockBlockquote"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l868:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockBlockquote"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockCloseBlockquote(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseBlockquote"));
-  if (!yymatchChar(G, '<')) goto l874;
-  if (!yy_Spnl(G))  goto l874;
-  if (!yymatchChar(G, '/')) goto l874;
+  l1426:;	
+  l1424:;	
+  {  int yypos1425= G->pos, yythunkpos1425= G->thunkpos;
+  {  int yypos1440= G->pos, yythunkpos1440= G->thunkpos;
+  {  int yypos1444= G->pos, yythunkpos1444= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1444;
+  goto l1441;
+  l1444:;	  G->pos= yypos1444; G->thunkpos= yythunkpos1444;
+  }  if (!yy_Nonspacechar(G))  goto l1441;
 
-  {  int yypos875= G->pos, yythunkpos875= G->thunkpos;  if (!yymatchString(G, "blockquote")) goto l876;
-  goto l875;
-  l876:;	  G->pos= yypos875; G->thunkpos= yythunkpos875;  if (!yymatchString(G, "BLOCKQUOTE")) goto l874;
+  l1442:;	
+  {  int yypos1443= G->pos, yythunkpos1443= G->thunkpos;
+  {  int yypos1445= G->pos, yythunkpos1445= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1445;
+  goto l1443;
+  l1445:;	  G->pos= yypos1445; G->thunkpos= yythunkpos1445;
+  }  if (!yy_Nonspacechar(G))  goto l1443;
+  goto l1442;
+  l1443:;	  G->pos= yypos1443; G->thunkpos= yythunkpos1443;
+  }  goto l1440;
+  l1441:;	  G->pos= yypos1440; G->thunkpos= yythunkpos1440;
+  {  int yypos1447= G->pos, yythunkpos1447= G->thunkpos;  if (!yy_Ticks3(G))  goto l1447;
+  goto l1446;
+  l1447:;	  G->pos= yypos1447; G->thunkpos= yythunkpos1447;
+  }  if (!yymatchChar(G, '`')) goto l1446;
 
+  l1448:;	
+  {  int yypos1449= G->pos, yythunkpos1449= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1449;
+  goto l1448;
+  l1449:;	  G->pos= yypos1449; G->thunkpos= yythunkpos1449;
+  }  goto l1440;
+  l1446:;	  G->pos= yypos1440; G->thunkpos= yythunkpos1440;
+  {  int yypos1450= G->pos, yythunkpos1450= G->thunkpos;  if (!yy_Sp(G))  goto l1450;
+  if (!yy_Ticks3(G))  goto l1450;
+  goto l1425;
+  l1450:;	  G->pos= yypos1450; G->thunkpos= yythunkpos1450;
   }
-  l875:;	  if (!yy_Spnl(G))  goto l874;
-  if (!yymatchChar(G, '>')) goto l874;
-  yyprintf((stderr, "  ok   HtmlBlockCloseBlockquote"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l874:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseBlockquote"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockOpenBlockquote(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenBlockquote"));
-  if (!yymatchChar(G, '<')) goto l877;
-  if (!yy_Spnl(G))  goto l877;
-
-  {  int yypos878= G->pos, yythunkpos878= G->thunkpos;  if (!yymatchString(G, "blockquote")) goto l879;
-  goto l878;
-  l879:;	  G->pos= yypos878; G->thunkpos= yythunkpos878;  if (!yymatchString(G, "BLOCKQUOTE")) goto l877;
+  {  int yypos1451= G->pos, yythunkpos1451= G->thunkpos;  if (!yy_Spacechar(G))  goto l1452;
+  goto l1451;
+  l1452:;	  G->pos= yypos1451; G->thunkpos= yythunkpos1451;  if (!yy_Newline(G))  goto l1425;
 
+  {  int yypos1453= G->pos, yythunkpos1453= G->thunkpos;  if (!yy_BlankLine(G))  goto l1453;
+  goto l1425;
+  l1453:;	  G->pos= yypos1453; G->thunkpos= yythunkpos1453;
   }
-  l878:;	  if (!yy_Spnl(G))  goto l877;
-
-  l880:;	
-  {  int yypos881= G->pos, yythunkpos881= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l881;
-  goto l880;
-  l881:;	  G->pos= yypos881; G->thunkpos= yythunkpos881;
-  }  if (!yymatchChar(G, '>')) goto l877;
-  yyprintf((stderr, "  ok   HtmlBlockOpenBlockquote"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l877:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenBlockquote"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockAside(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockAside"));
-  if (!yy_HtmlBlockOpenAside(G))  goto l882;
-
-  l883:;	
-  {  int yypos884= G->pos, yythunkpos884= G->thunkpos;
-  {  int yypos885= G->pos, yythunkpos885= G->thunkpos;  if (!yy_HtmlBlockAside(G))  goto l886;
-  goto l885;
-  l886:;	  G->pos= yypos885; G->thunkpos= yythunkpos885;
-  {  int yypos887= G->pos, yythunkpos887= G->thunkpos;  if (!yy_HtmlBlockCloseAside(G))  goto l887;
-  goto l884;
-  l887:;	  G->pos= yypos887; G->thunkpos= yythunkpos887;
-  }  if (!yymatchDot(G)) goto l884;
   }
-  l885:;	  goto l883;
-  l884:;	  G->pos= yypos884; G->thunkpos= yythunkpos884;
-  }  if (!yy_HtmlBlockCloseAside(G))  goto l882;
-  yyprintf((stderr, "  ok   HtmlBlockAside"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l882:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockAside"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockCloseAside(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseAside"));
-  if (!yymatchChar(G, '<')) goto l888;
-  if (!yy_Spnl(G))  goto l888;
-  if (!yymatchChar(G, '/')) goto l888;
-
-  {  int yypos889= G->pos, yythunkpos889= G->thunkpos;  if (!yymatchString(G, "aside")) goto l890;
-  goto l889;
-  l890:;	  G->pos= yypos889; G->thunkpos= yythunkpos889;  if (!yymatchString(G, "ASIDE")) goto l888;
-
+  l1451:;	
   }
-  l889:;	  if (!yy_Spnl(G))  goto l888;
-  if (!yymatchChar(G, '>')) goto l888;
-  yyprintf((stderr, "  ok   HtmlBlockCloseAside"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l888:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseAside"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockOpenAside(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenAside"));
-  if (!yymatchChar(G, '<')) goto l891;
-  if (!yy_Spnl(G))  goto l891;
+  l1440:;	  goto l1424;
+  l1425:;	  G->pos= yypos1425; G->thunkpos= yythunkpos1425;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1423;  if (!yy_Sp(G))  goto l1423;
+  if (!yy_Ticks3(G))  goto l1423;
+  goto l1360;
+  l1423:;	  G->pos= yypos1360; G->thunkpos= yythunkpos1360;  if (!yy_Ticks4(G))  goto l1454;
+  if (!yy_Sp(G))  goto l1454;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1454;
+  {  int yypos1457= G->pos, yythunkpos1457= G->thunkpos;
+  {  int yypos1461= G->pos, yythunkpos1461= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1461;
+  goto l1458;
+  l1461:;	  G->pos= yypos1461; G->thunkpos= yythunkpos1461;
+  }  if (!yy_Nonspacechar(G))  goto l1458;
 
-  {  int yypos892= G->pos, yythunkpos892= G->thunkpos;  if (!yymatchString(G, "aside")) goto l893;
-  goto l892;
-  l893:;	  G->pos= yypos892; G->thunkpos= yythunkpos892;  if (!yymatchString(G, "ASIDE")) goto l891;
+  l1459:;	
+  {  int yypos1460= G->pos, yythunkpos1460= G->thunkpos;
+  {  int yypos1462= G->pos, yythunkpos1462= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1462;
+  goto l1460;
+  l1462:;	  G->pos= yypos1462; G->thunkpos= yythunkpos1462;
+  }  if (!yy_Nonspacechar(G))  goto l1460;
+  goto l1459;
+  l1460:;	  G->pos= yypos1460; G->thunkpos= yythunkpos1460;
+  }  goto l1457;
+  l1458:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;
+  {  int yypos1464= G->pos, yythunkpos1464= G->thunkpos;  if (!yy_Ticks4(G))  goto l1464;
+  goto l1463;
+  l1464:;	  G->pos= yypos1464; G->thunkpos= yythunkpos1464;
+  }  if (!yymatchChar(G, '`')) goto l1463;
 
+  l1465:;	
+  {  int yypos1466= G->pos, yythunkpos1466= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1466;
+  goto l1465;
+  l1466:;	  G->pos= yypos1466; G->thunkpos= yythunkpos1466;
+  }  goto l1457;
+  l1463:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;
+  {  int yypos1467= G->pos, yythunkpos1467= G->thunkpos;  if (!yy_Sp(G))  goto l1467;
+  if (!yy_Ticks4(G))  goto l1467;
+  goto l1454;
+  l1467:;	  G->pos= yypos1467; G->thunkpos= yythunkpos1467;
   }
-  l892:;	  if (!yy_Spnl(G))  goto l891;
-
-  l894:;	
-  {  int yypos895= G->pos, yythunkpos895= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l895;
-  goto l894;
-  l895:;	  G->pos= yypos895; G->thunkpos= yythunkpos895;
-  }  if (!yymatchChar(G, '>')) goto l891;
-  yyprintf((stderr, "  ok   HtmlBlockOpenAside"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l891:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenAside"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockArticle(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockArticle"));
-  if (!yy_HtmlBlockOpenArticle(G))  goto l896;
+  {  int yypos1468= G->pos, yythunkpos1468= G->thunkpos;  if (!yy_Spacechar(G))  goto l1469;
+  goto l1468;
+  l1469:;	  G->pos= yypos1468; G->thunkpos= yythunkpos1468;  if (!yy_Newline(G))  goto l1454;
 
-  l897:;	
-  {  int yypos898= G->pos, yythunkpos898= G->thunkpos;
-  {  int yypos899= G->pos, yythunkpos899= G->thunkpos;  if (!yy_HtmlBlockArticle(G))  goto l900;
-  goto l899;
-  l900:;	  G->pos= yypos899; G->thunkpos= yythunkpos899;
-  {  int yypos901= G->pos, yythunkpos901= G->thunkpos;  if (!yy_HtmlBlockCloseArticle(G))  goto l901;
-  goto l898;
-  l901:;	  G->pos= yypos901; G->thunkpos= yythunkpos901;
-  }  if (!yymatchDot(G)) goto l898;
+  {  int yypos1470= G->pos, yythunkpos1470= G->thunkpos;  if (!yy_BlankLine(G))  goto l1470;
+  goto l1454;
+  l1470:;	  G->pos= yypos1470; G->thunkpos= yythunkpos1470;
   }
-  l899:;	  goto l897;
-  l898:;	  G->pos= yypos898; G->thunkpos= yythunkpos898;
-  }  if (!yy_HtmlBlockCloseArticle(G))  goto l896;
-  yyprintf((stderr, "  ok   HtmlBlockArticle"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l896:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockArticle"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+  }
+  l1468:;	
+  }
+  l1457:;	
+  l1455:;	
+  {  int yypos1456= G->pos, yythunkpos1456= G->thunkpos;
+  {  int yypos1471= G->pos, yythunkpos1471= G->thunkpos;
+  {  int yypos1475= G->pos, yythunkpos1475= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1475;
+  goto l1472;
+  l1475:;	  G->pos= yypos1475; G->thunkpos= yythunkpos1475;
+  }  if (!yy_Nonspacechar(G))  goto l1472;
 
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockCloseArticle(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseArticle"));
-  if (!yymatchChar(G, '<')) goto l902;
-  if (!yy_Spnl(G))  goto l902;
-  if (!yymatchChar(G, '/')) goto l902;
+  l1473:;	
+  {  int yypos1474= G->pos, yythunkpos1474= G->thunkpos;
+  {  int yypos1476= G->pos, yythunkpos1476= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1476;
+  goto l1474;
+  l1476:;	  G->pos= yypos1476; G->thunkpos= yythunkpos1476;
+  }  if (!yy_Nonspacechar(G))  goto l1474;
+  goto l1473;
+  l1474:;	  G->pos= yypos1474; G->thunkpos= yythunkpos1474;
+  }  goto l1471;
+  l1472:;	  G->pos= yypos1471; G->thunkpos= yythunkpos1471;
+  {  int yypos1478= G->pos, yythunkpos1478= G->thunkpos;  if (!yy_Ticks4(G))  goto l1478;
+  goto l1477;
+  l1478:;	  G->pos= yypos1478; G->thunkpos= yythunkpos1478;
+  }  if (!yymatchChar(G, '`')) goto l1477;
 
-  {  int yypos903= G->pos, yythunkpos903= G->thunkpos;  if (!yymatchString(G, "article")) goto l904;
-  goto l903;
-  l904:;	  G->pos= yypos903; G->thunkpos= yythunkpos903;  if (!yymatchString(G, "ARTICLE")) goto l902;
+  l1479:;	
+  {  int yypos1480= G->pos, yythunkpos1480= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1480;
+  goto l1479;
+  l1480:;	  G->pos= yypos1480; G->thunkpos= yythunkpos1480;
+  }  goto l1471;
+  l1477:;	  G->pos= yypos1471; G->thunkpos= yythunkpos1471;
+  {  int yypos1481= G->pos, yythunkpos1481= G->thunkpos;  if (!yy_Sp(G))  goto l1481;
+  if (!yy_Ticks4(G))  goto l1481;
+  goto l1456;
+  l1481:;	  G->pos= yypos1481; G->thunkpos= yythunkpos1481;
+  }
+  {  int yypos1482= G->pos, yythunkpos1482= G->thunkpos;  if (!yy_Spacechar(G))  goto l1483;
+  goto l1482;
+  l1483:;	  G->pos= yypos1482; G->thunkpos= yythunkpos1482;  if (!yy_Newline(G))  goto l1456;
 
+  {  int yypos1484= G->pos, yythunkpos1484= G->thunkpos;  if (!yy_BlankLine(G))  goto l1484;
+  goto l1456;
+  l1484:;	  G->pos= yypos1484; G->thunkpos= yythunkpos1484;
   }
-  l903:;	  if (!yy_Spnl(G))  goto l902;
-  if (!yymatchChar(G, '>')) goto l902;
-  yyprintf((stderr, "  ok   HtmlBlockCloseArticle"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
+  }
+  l1482:;	
+  }
+  l1471:;	  goto l1455;
+  l1456:;	  G->pos= yypos1456; G->thunkpos= yythunkpos1456;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1454;  if (!yy_Sp(G))  goto l1454;
+  if (!yy_Ticks4(G))  goto l1454;
+  goto l1360;
+  l1454:;	  G->pos= yypos1360; G->thunkpos= yythunkpos1360;  if (!yy_Ticks5(G))  goto l1359;
+  if (!yy_Sp(G))  goto l1359;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1359;
+  {  int yypos1487= G->pos, yythunkpos1487= G->thunkpos;
+  {  int yypos1491= G->pos, yythunkpos1491= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1491;
+  goto l1488;
+  l1491:;	  G->pos= yypos1491; G->thunkpos= yythunkpos1491;
+  }  if (!yy_Nonspacechar(G))  goto l1488;
 
-  return 1;
-  l902:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseArticle"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+  l1489:;	
+  {  int yypos1490= G->pos, yythunkpos1490= G->thunkpos;
+  {  int yypos1492= G->pos, yythunkpos1492= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1492;
+  goto l1490;
+  l1492:;	  G->pos= yypos1492; G->thunkpos= yythunkpos1492;
+  }  if (!yy_Nonspacechar(G))  goto l1490;
+  goto l1489;
+  l1490:;	  G->pos= yypos1490; G->thunkpos= yythunkpos1490;
+  }  goto l1487;
+  l1488:;	  G->pos= yypos1487; G->thunkpos= yythunkpos1487;
+  {  int yypos1494= G->pos, yythunkpos1494= G->thunkpos;  if (!yy_Ticks5(G))  goto l1494;
+  goto l1493;
+  l1494:;	  G->pos= yypos1494; G->thunkpos= yythunkpos1494;
+  }  if (!yymatchChar(G, '`')) goto l1493;
 
-  return 0;
-}
-YY_RULE(int) yy_HtmlBlockOpenArticle(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenArticle"));
-  if (!yymatchChar(G, '<')) goto l905;
-  if (!yy_Spnl(G))  goto l905;
+  l1495:;	
+  {  int yypos1496= G->pos, yythunkpos1496= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1496;
+  goto l1495;
+  l1496:;	  G->pos= yypos1496; G->thunkpos= yythunkpos1496;
+  }  goto l1487;
+  l1493:;	  G->pos= yypos1487; G->thunkpos= yythunkpos1487;
+  {  int yypos1497= G->pos, yythunkpos1497= G->thunkpos;  if (!yy_Sp(G))  goto l1497;
+  if (!yy_Ticks5(G))  goto l1497;
+  goto l1359;
+  l1497:;	  G->pos= yypos1497; G->thunkpos= yythunkpos1497;
+  }
+  {  int yypos1498= G->pos, yythunkpos1498= G->thunkpos;  if (!yy_Spacechar(G))  goto l1499;
+  goto l1498;
+  l1499:;	  G->pos= yypos1498; G->thunkpos= yythunkpos1498;  if (!yy_Newline(G))  goto l1359;
+
+  {  int yypos1500= G->pos, yythunkpos1500= G->thunkpos;  if (!yy_BlankLine(G))  goto l1500;
+  goto l1359;
+  l1500:;	  G->pos= yypos1500; G->thunkpos= yythunkpos1500;
+  }
+  }
+  l1498:;	
+  }
+  l1487:;	
+  l1485:;	
+  {  int yypos1486= G->pos, yythunkpos1486= G->thunkpos;
+  {  int yypos1501= G->pos, yythunkpos1501= G->thunkpos;
+  {  int yypos1505= G->pos, yythunkpos1505= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1505;
+  goto l1502;
+  l1505:;	  G->pos= yypos1505; G->thunkpos= yythunkpos1505;
+  }  if (!yy_Nonspacechar(G))  goto l1502;
+
+  l1503:;	
+  {  int yypos1504= G->pos, yythunkpos1504= G->thunkpos;
+  {  int yypos1506= G->pos, yythunkpos1506= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1506;
+  goto l1504;
+  l1506:;	  G->pos= yypos1506; G->thunkpos= yythunkpos1506;
+  }  if (!yy_Nonspacechar(G))  goto l1504;
+  goto l1503;
+  l1504:;	  G->pos= yypos1504; G->thunkpos= yythunkpos1504;
+  }  goto l1501;
+  l1502:;	  G->pos= yypos1501; G->thunkpos= yythunkpos1501;
+  {  int yypos1508= G->pos, yythunkpos1508= G->thunkpos;  if (!yy_Ticks5(G))  goto l1508;
+  goto l1507;
+  l1508:;	  G->pos= yypos1508; G->thunkpos= yythunkpos1508;
+  }  if (!yymatchChar(G, '`')) goto l1507;
 
-  {  int yypos906= G->pos, yythunkpos906= G->thunkpos;  if (!yymatchString(G, "article")) goto l907;
-  goto l906;
-  l907:;	  G->pos= yypos906; G->thunkpos= yythunkpos906;  if (!yymatchString(G, "ARTICLE")) goto l905;
+  l1509:;	
+  {  int yypos1510= G->pos, yythunkpos1510= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1510;
+  goto l1509;
+  l1510:;	  G->pos= yypos1510; G->thunkpos= yythunkpos1510;
+  }  goto l1501;
+  l1507:;	  G->pos= yypos1501; G->thunkpos= yythunkpos1501;
+  {  int yypos1511= G->pos, yythunkpos1511= G->thunkpos;  if (!yy_Sp(G))  goto l1511;
+  if (!yy_Ticks5(G))  goto l1511;
+  goto l1486;
+  l1511:;	  G->pos= yypos1511; G->thunkpos= yythunkpos1511;
+  }
+  {  int yypos1512= G->pos, yythunkpos1512= G->thunkpos;  if (!yy_Spacechar(G))  goto l1513;
+  goto l1512;
+  l1513:;	  G->pos= yypos1512; G->thunkpos= yythunkpos1512;  if (!yy_Newline(G))  goto l1486;
 
+  {  int yypos1514= G->pos, yythunkpos1514= G->thunkpos;  if (!yy_BlankLine(G))  goto l1514;
+  goto l1486;
+  l1514:;	  G->pos= yypos1514; G->thunkpos= yythunkpos1514;
+  }
   }
-  l906:;	  if (!yy_Spnl(G))  goto l905;
+  l1512:;	
+  }
+  l1501:;	  goto l1485;
+  l1486:;	  G->pos= yypos1486; G->thunkpos= yythunkpos1486;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1359;  if (!yy_Sp(G))  goto l1359;
+  if (!yy_Ticks5(G))  goto l1359;
 
-  l908:;	
-  {  int yypos909= G->pos, yythunkpos909= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l909;
-  goto l908;
-  l909:;	  G->pos= yypos909; G->thunkpos= yythunkpos909;
-  }  if (!yymatchChar(G, '>')) goto l905;
-  yyprintf((stderr, "  ok   HtmlBlockOpenArticle"));
+  }
+  l1360:;	  yyDo(G, yy_1_Code, G->begin, G->end, "yy_1_Code");
+  yyprintf((stderr, "  ok   Code"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l905:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenArticle"));
+  l1359:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Code"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockAddress(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockAddress"));
-  if (!yy_HtmlBlockOpenAddress(G))  goto l910;
-
-  l911:;	
-  {  int yypos912= G->pos, yythunkpos912= G->thunkpos;
-  {  int yypos913= G->pos, yythunkpos913= G->thunkpos;  if (!yy_HtmlBlockAddress(G))  goto l914;
-  goto l913;
-  l914:;	  G->pos= yypos913; G->thunkpos= yythunkpos913;
-  {  int yypos915= G->pos, yythunkpos915= G->thunkpos;  if (!yy_HtmlBlockCloseAddress(G))  goto l915;
-  goto l912;
-  l915:;	  G->pos= yypos915; G->thunkpos= yythunkpos915;
-  }  if (!yymatchDot(G)) goto l912;
-  }
-  l913:;	  goto l911;
-  l912:;	  G->pos= yypos912; G->thunkpos= yythunkpos912;
-  }  if (!yy_HtmlBlockCloseAddress(G))  goto l910;
-  yyprintf((stderr, "  ok   HtmlBlockAddress"));
+/* NoteReference -- "[^" (!Newline !']' .)+ ']', ended by yySpanEnd */
+YY_RULE(int) yy_NoteReference(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  int yyend;  yyprintfv((stderr, "%s\n", "NoteReference"));
+  yyText(G, G->begin, G->end);  if (!( ext(EXT_NOTES) )) goto l1515;  if (!yymatchString(G, "[^")) goto l1515;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1515;
+  if ((yyend= yySpanEnd(G, SPAN_REFERENCE, G->pos)) <= G->pos) goto l1515;
+  G->pos= yyend;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1515;  if (!yymatchChar(G, ']')) goto l1515;
+  yyDo(G, yy_1_NoteReference, G->begin, G->end, "yy_1_NoteReference");
+  yyprintf((stderr, "  ok   NoteReference"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l910:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockAddress"));
+  l1515:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "NoteReference"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockCloseAddress(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockCloseAddress"));
-  if (!yymatchChar(G, '<')) goto l916;
-  if (!yy_Spnl(G))  goto l916;
-  if (!yymatchChar(G, '/')) goto l916;
+YY_RULE(int) yy_Link(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Link"));
 
-  {  int yypos917= G->pos, yythunkpos917= G->thunkpos;  if (!yymatchString(G, "address")) goto l918;
-  goto l917;
-  l918:;	  G->pos= yypos917; G->thunkpos= yythunkpos917;  if (!yymatchString(G, "ADDRESS")) goto l916;
+  {  int yypos1523= G->pos, yythunkpos1523= G->thunkpos;  if (!yy_ExplicitLink(G))  goto l1524;
+  goto l1523;
+  l1524:;	  G->pos= yypos1523; G->thunkpos= yythunkpos1523;  if (!yy_ReferenceLink(G))  goto l1525;
+  goto l1523;
+  l1525:;	  G->pos= yypos1523; G->thunkpos= yythunkpos1523;  if (!yy_AutoLink(G))  goto l1522;
 
   }
-  l917:;	  if (!yy_Spnl(G))  goto l916;
-  if (!yymatchChar(G, '>')) goto l916;
-  yyprintf((stderr, "  ok   HtmlBlockCloseAddress"));
+  l1523:;	  yyprintf((stderr, "  ok   Link"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l916:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockCloseAddress"));
+  l1522:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Link"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockOpenAddress(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockOpenAddress"));
-  if (!yymatchChar(G, '<')) goto l919;
-  if (!yy_Spnl(G))  goto l919;
-
-  {  int yypos920= G->pos, yythunkpos920= G->thunkpos;  if (!yymatchString(G, "address")) goto l921;
-  goto l920;
-  l921:;	  G->pos= yypos920; G->thunkpos= yythunkpos920;  if (!yymatchString(G, "ADDRESS")) goto l919;
-
-  }
-  l920:;	  if (!yy_Spnl(G))  goto l919;
+YY_RULE(int) yy_Image(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Image"));
+  if (!yymatchChar(G, '!')) goto l1526;
 
-  l922:;	
-  {  int yypos923= G->pos, yythunkpos923= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l923;
-  goto l922;
-  l923:;	  G->pos= yypos923; G->thunkpos= yythunkpos923;
-  }  if (!yymatchChar(G, '>')) goto l919;
-  yyprintf((stderr, "  ok   HtmlBlockOpenAddress"));
+  {  int yypos1527= G->pos, yythunkpos1527= G->thunkpos;  if (!yy_AutoLink(G))  goto l1527;
+  goto l1526;
+  l1527:;	  G->pos= yypos1527; G->thunkpos= yythunkpos1527;
+  }  if (!yy_Link(G))  goto l1526;
+  yyDo(G, yy_1_Image, G->begin, G->end, "yy_1_Image");
+  yyprintf((stderr, "  ok   Image"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l919:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockOpenAddress"));
+  l1526:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Image"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_ListBlockLine(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "ListBlockLine"));
+YY_RULE(int) yy_CitationReference(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "CitationReference"));
 
-  {  int yypos925= G->pos, yythunkpos925= G->thunkpos;  if (!yy_BlankLine(G))  goto l925;
-  goto l924;
-  l925:;	  G->pos= yypos925; G->thunkpos= yythunkpos925;
-  }
-  {  int yypos926= G->pos, yythunkpos926= G->thunkpos;
-  {  int yypos927= G->pos, yythunkpos927= G->thunkpos;  if (!yy_Indent(G))  goto l927;
-  goto l928;
-  l927:;	  G->pos= yypos927; G->thunkpos= yythunkpos927;
-  }
-  l928:;	
-  {  int yypos929= G->pos, yythunkpos929= G->thunkpos;  if (!yy_Bullet(G))  goto l930;
-  goto l929;
-  l930:;	  G->pos= yypos929; G->thunkpos= yythunkpos929;  if (!yy_Enumerator(G))  goto l926;
+  {  int yypos1529= G->pos, yythunkpos1529= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_LINEAR_INLINES) )) goto l1530;  if (!yy_CitationReferenceDouble(G))  goto l1530;
+  goto l1529;
+  l1530:;	  G->pos= yypos1529; G->thunkpos= yythunkpos1529;  if (!yy_CitationReferenceSingle(G))  goto l1528;
 
   }
-  l929:;	  goto l924;
-  l926:;	  G->pos= yypos926; G->thunkpos= yythunkpos926;
-  }
-  {  int yypos931= G->pos, yythunkpos931= G->thunkpos;  if (!yy_HorizontalRule(G))  goto l931;
-  goto l924;
-  l931:;	  G->pos= yypos931; G->thunkpos= yythunkpos931;
-  }  if (!yy_OptionallyIndentedLine(G))  goto l924;
-  yyprintf((stderr, "  ok   ListBlockLine"));
+  l1529:;	  yyprintf((stderr, "  ok   CitationReference"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l924:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ListBlockLine"));
+  l1528:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "CitationReference"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_ListContinuationBlock(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "ListContinuationBlock"));
-  if (!yy_StartList(G))  goto l932;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l932;
-  l933:;	
-  {  int yypos934= G->pos, yythunkpos934= G->thunkpos;  if (!yy_BlankLine(G))  goto l934;
-  goto l933;
-  l934:;	  G->pos= yypos934; G->thunkpos= yythunkpos934;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l932;  yyDo(G, yy_1_ListContinuationBlock, G->begin, G->end, "yy_1_ListContinuationBlock");
-  if (!yy_Indent(G))  goto l932;
-  if (!yy_ListBlock(G))  goto l932;
-  yyDo(G, yy_2_ListContinuationBlock, G->begin, G->end, "yy_2_ListContinuationBlock");
+YY_RULE(int) yy_Emph(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Emph"));
 
-  l935:;	
-  {  int yypos936= G->pos, yythunkpos936= G->thunkpos;  if (!yy_Indent(G))  goto l936;
-  if (!yy_ListBlock(G))  goto l936;
-  yyDo(G, yy_2_ListContinuationBlock, G->begin, G->end, "yy_2_ListContinuationBlock");
-  goto l935;
-  l936:;	  G->pos= yypos936; G->thunkpos= yythunkpos936;
-  }  yyDo(G, yy_3_ListContinuationBlock, G->begin, G->end, "yy_3_ListContinuationBlock");
-  yyprintf((stderr, "  ok   ListContinuationBlock"));
+  {  int yypos1532= G->pos, yythunkpos1532= G->thunkpos;  if (!yy_EmphStar(G))  goto l1533;
+  goto l1532;
+  l1533:;	  G->pos= yypos1532; G->thunkpos= yythunkpos1532;  if (!yy_EmphUl(G))  goto l1531;
+
+  }
+  l1532:;	  yyprintf((stderr, "  ok   Emph"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
+
   return 1;
-  l932:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ListContinuationBlock"));
+  l1531:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Emph"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_ListBlock(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "ListBlock"));
-  if (!yy_StartList(G))  goto l937;
-  yyDo(G, yySet, -1, 0, "yySet");
+YY_RULE(int) yy_Strong(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Strong"));
 
-  {  int yypos938= G->pos, yythunkpos938= G->thunkpos;  if (!yy_BlankLine(G))  goto l938;
-  goto l937;
-  l938:;	  G->pos= yypos938; G->thunkpos= yythunkpos938;
-  }  if (!yy_Line(G))  goto l937;
-  yyDo(G, yy_1_ListBlock, G->begin, G->end, "yy_1_ListBlock");
+  {  int yypos1535= G->pos, yythunkpos1535= G->thunkpos;  if (!yy_StrongStar(G))  goto l1536;
+  goto l1535;
+  l1536:;	  G->pos= yypos1535; G->thunkpos= yythunkpos1535;  if (!yy_StrongUl(G))  goto l1534;
 
-  l939:;	
-  {  int yypos940= G->pos, yythunkpos940= G->thunkpos;  if (!yy_ListBlockLine(G))  goto l940;
-  yyDo(G, yy_2_ListBlock, G->begin, G->end, "yy_2_ListBlock");
-  goto l939;
-  l940:;	  G->pos= yypos940; G->thunkpos= yythunkpos940;
-  }  yyDo(G, yy_3_ListBlock, G->begin, G->end, "yy_3_ListBlock");
-  yyprintf((stderr, "  ok   ListBlock"));
+  }
+  l1535:;	  yyprintf((stderr, "  ok   Strong"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
+
   return 1;
-  l937:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ListBlock"));
+  l1534:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Strong"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_ListItem(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "ListItem"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l941;
-  {  int yypos942= G->pos, yythunkpos942= G->thunkpos;  if (!yy_Bullet(G))  goto l943;
-  goto l942;
-  l943:;	  G->pos= yypos942; G->thunkpos= yythunkpos942;  if (!yy_Enumerator(G))  goto l941;
-
-  }
-  l942:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l941;  if (!yy_StartList(G))  goto l941;
-  yyDo(G, yySet, -1, 0, "yySet");
-  if (!yy_ListBlock(G))  goto l941;
-  yyDo(G, yy_1_ListItem, G->begin, G->end, "yy_1_ListItem");
+YY_RULE(int) yy_Space(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Space"));
+  if (!yy_Spacechar(G))  goto l1537;
 
-  l944:;	
-  {  int yypos945= G->pos, yythunkpos945= G->thunkpos;  if (!yy_ListContinuationBlock(G))  goto l945;
-  yyDo(G, yy_2_ListItem, G->begin, G->end, "yy_2_ListItem");
-  goto l944;
-  l945:;	  G->pos= yypos945; G->thunkpos= yythunkpos945;
-  }  yyDo(G, yy_3_ListItem, G->begin, G->end, "yy_3_ListItem");
-  yyprintf((stderr, "  ok   ListItem"));
+  l1538:;	
+  {  int yypos1539= G->pos, yythunkpos1539= G->thunkpos;  if (!yy_Spacechar(G))  goto l1539;
+  goto l1538;
+  l1539:;	  G->pos= yypos1539; G->thunkpos= yythunkpos1539;
+  }  yyDo(G, yy_1_Space, G->begin, G->end, "yy_1_Space");
+  yyprintf((stderr, "  ok   Space"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
+
   return 1;
-  l941:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ListItem"));
+  l1537:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Space"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Enumerator(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Enumerator"));
-  if (!yy_NonindentSpace(G))  goto l946;
-  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "0-9")) goto l946;
+YY_RULE(int) yy_UlOrStarLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "UlOrStarLine"));
 
-  l947:;	
-  {  int yypos948= G->pos, yythunkpos948= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "0-9")) goto l948;
-  goto l947;
-  l948:;	  G->pos= yypos948; G->thunkpos= yythunkpos948;
-  }  if (!yymatchChar(G, '.')) goto l946;
-  if (!yy_Spacechar(G))  goto l946;
+  {  int yypos1541= G->pos, yythunkpos1541= G->thunkpos;  if (!yy_UlLine(G))  goto l1542;
+  goto l1541;
+  l1542:;	  G->pos= yypos1541; G->thunkpos= yythunkpos1541;  if (!yy_StarLine(G))  goto l1540;
 
-  l949:;	
-  {  int yypos950= G->pos, yythunkpos950= G->thunkpos;  if (!yy_Spacechar(G))  goto l950;
-  goto l949;
-  l950:;	  G->pos= yypos950; G->thunkpos= yythunkpos950;
-  }  yyprintf((stderr, "  ok   Enumerator"));
+  }
+  l1541:;	  yyDo(G, yy_1_UlOrStarLine, G->begin, G->end, "yy_1_UlOrStarLine");
+  yyprintf((stderr, "  ok   UlOrStarLine"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l946:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Enumerator"));
+  l1540:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "UlOrStarLine"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_ListItemTight(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "ListItemTight"));
-
-  {  int yypos952= G->pos, yythunkpos952= G->thunkpos;  if (!yy_Bullet(G))  goto l953;
-  goto l952;
-  l953:;	  G->pos= yypos952; G->thunkpos= yythunkpos952;  if (!yy_Enumerator(G))  goto l951;
+/* MathSpan -- '\\' ("\\[" (!"\\\\]" .)* "\\\\]" | "\\(" (!"\\\\)" .)* "\\\\)"),
+	each ended by yySpanEnd */
+YY_RULE(int) yy_MathSpan(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  int yyend;  yyprintfv((stderr, "%s\n", "MathSpan"));
+  if (!yymatchChar(G, '\\')) goto l1543;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1543;
+  {  int yypos1544= G->pos, yythunkpos1544= G->thunkpos;  if (!yymatchString(G, "\\[")) goto l1545;
+  if ((yyend= yySpanEnd(G, SPAN_MATH_BRACKET, G->pos)) < 0) goto l1545;
+  G->pos= yyend;
+  if (!yymatchString(G, "\\\\]")) goto l1545;
+  goto l1544;
+  l1545:;	  G->pos= yypos1544; G->thunkpos= yythunkpos1544;  if (!yymatchString(G, "\\(")) goto l1543;
+  if ((yyend= yySpanEnd(G, SPAN_MATH_PAREN, G->pos)) < 0) goto l1543;
+  G->pos= yyend;
+  if (!yymatchString(G, "\\\\)")) goto l1543;
 
   }
-  l952:;	  if (!yy_StartList(G))  goto l951;
+  l1544:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1543;  yyDo(G, yy_1_MathSpan, G->begin, G->end, "yy_1_MathSpan");
+  yyprintf((stderr, "  ok   MathSpan"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1543:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "MathSpan"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_Str(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "Str"));
+  if (!yy_StartList(G))  goto l1552;
   yyDo(G, yySet, -1, 0, "yySet");
-  if (!yy_ListBlock(G))  goto l951;
-  yyDo(G, yy_1_ListItemTight, G->begin, G->end, "yy_1_ListItemTight");
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1552;  if (!yy_NormalChar(G))  goto l1552;
+  yyNormalChars(G);
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1552;  yyDo(G, yy_1_Str, G->begin, G->end, "yy_1_Str");
 
-  l954:;	
-  {  int yypos955= G->pos, yythunkpos955= G->thunkpos;
-  {  int yypos956= G->pos, yythunkpos956= G->thunkpos;  if (!yy_BlankLine(G))  goto l956;
-  goto l955;
-  l956:;	  G->pos= yypos956; G->thunkpos= yythunkpos956;
-  }  if (!yy_ListContinuationBlock(G))  goto l955;
-  yyDo(G, yy_2_ListItemTight, G->begin, G->end, "yy_2_ListItemTight");
-  goto l954;
-  l955:;	  G->pos= yypos955; G->thunkpos= yythunkpos955;
-  }
-  {  int yypos957= G->pos, yythunkpos957= G->thunkpos;  if (!yy_ListContinuationBlock(G))  goto l957;
-  goto l951;
-  l957:;	  G->pos= yypos957; G->thunkpos= yythunkpos957;
-  }  yyDo(G, yy_3_ListItemTight, G->begin, G->end, "yy_3_ListItemTight");
-  yyprintf((stderr, "  ok   ListItemTight"));
+  l1555:;	
+  {  int yypos1556= G->pos, yythunkpos1556= G->thunkpos;  if (!yy_StrChunk(G))  goto l1556;
+  yyDo(G, yy_2_Str, G->begin, G->end, "yy_2_Str");
+  goto l1555;
+  l1556:;	  G->pos= yypos1556; G->thunkpos= yythunkpos1556;
+  }  yyDo(G, yy_3_Str, G->begin, G->end, "yy_3_Str");
+  yyprintf((stderr, "  ok   Str"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
   yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l951:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ListItemTight"));
+  l1552:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Str"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_ListLoose(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "ListLoose"));
-  if (!yy_StartList(G))  goto l958;
-  yyDo(G, yySet, -2, 0, "yySet");
-  if (!yy_ListItem(G))  goto l958;
-  yyDo(G, yySet, -1, 0, "yySet");
-
-  l961:;	
-  {  int yypos962= G->pos, yythunkpos962= G->thunkpos;  if (!yy_BlankLine(G))  goto l962;
-  goto l961;
-  l962:;	  G->pos= yypos962; G->thunkpos= yythunkpos962;
-  }  yyDo(G, yy_1_ListLoose, G->begin, G->end, "yy_1_ListLoose");
+YY_RULE(int) yy_DollarMath(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "DollarMath"));
 
-  l959:;	
-  {  int yypos960= G->pos, yythunkpos960= G->thunkpos;  if (!yy_ListItem(G))  goto l960;
-  yyDo(G, yySet, -1, 0, "yySet");
+  {  int yypos1558= G->pos, yythunkpos1558= G->thunkpos;  if (!yy_SingleDollarMath(G))  goto l1559;
+  goto l1558;
+  l1559:;	  G->pos= yypos1558; G->thunkpos= yythunkpos1558;  if (!yy_DoubleDollarMath(G))  goto l1557;
 
-  l963:;	
-  {  int yypos964= G->pos, yythunkpos964= G->thunkpos;  if (!yy_BlankLine(G))  goto l964;
-  goto l963;
-  l964:;	  G->pos= yypos964; G->thunkpos= yythunkpos964;
-  }  yyDo(G, yy_1_ListLoose, G->begin, G->end, "yy_1_ListLoose");
-  goto l959;
-  l960:;	  G->pos= yypos960; G->thunkpos= yythunkpos960;
-  }  yyDo(G, yy_2_ListLoose, G->begin, G->end, "yy_2_ListLoose");
-  yyprintf((stderr, "  ok   ListLoose"));
+  }
+  l1558:;	  yyprintf((stderr, "  ok   DollarMath"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
+
   return 1;
-  l958:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ListLoose"));
+  l1557:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DollarMath"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_ListTight(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "ListTight"));
-  if (!yy_StartList(G))  goto l965;
-  yyDo(G, yySet, -1, 0, "yySet");
-  if (!yy_ListItemTight(G))  goto l965;
-  yyDo(G, yy_1_ListTight, G->begin, G->end, "yy_1_ListTight");
+YY_RULE(int) yy_CriticMarkup(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "CriticMarkup"));
 
-  l966:;	
-  {  int yypos967= G->pos, yythunkpos967= G->thunkpos;  if (!yy_ListItemTight(G))  goto l967;
-  yyDo(G, yy_1_ListTight, G->begin, G->end, "yy_1_ListTight");
-  goto l966;
-  l967:;	  G->pos= yypos967; G->thunkpos= yythunkpos967;
-  }
-  l968:;	
-  {  int yypos969= G->pos, yythunkpos969= G->thunkpos;  if (!yy_BlankLine(G))  goto l969;
-  goto l968;
-  l969:;	  G->pos= yypos969; G->thunkpos= yythunkpos969;
-  }
-  {  int yypos970= G->pos, yythunkpos970= G->thunkpos;
-  {  int yypos971= G->pos, yythunkpos971= G->thunkpos;  if (!yy_Bullet(G))  goto l972;
-  goto l971;
-  l972:;	  G->pos= yypos971; G->thunkpos= yythunkpos971;  if (!yy_Enumerator(G))  goto l970;
+  {  int yypos1561= G->pos, yythunkpos1561= G->thunkpos;  if (!yy_CriticAddition(G))  goto l1562;
+  goto l1561;
+  l1562:;	  G->pos= yypos1561; G->thunkpos= yythunkpos1561;  if (!yy_CriticDeletion(G))  goto l1563;
+  goto l1561;
+  l1563:;	  G->pos= yypos1561; G->thunkpos= yythunkpos1561;  if (!yy_CriticSubstitution(G))  goto l1564;
+  goto l1561;
+  l1564:;	  G->pos= yypos1561; G->thunkpos= yythunkpos1561;  if (!yy_CriticHighlight(G))  goto l1565;
+  goto l1561;
+  l1565:;	  G->pos= yypos1561; G->thunkpos= yythunkpos1561;  if (!yy_CriticComment(G))  goto l1560;
 
   }
-  l971:;	  goto l965;
-  l970:;	  G->pos= yypos970; G->thunkpos= yythunkpos970;
-  }  yyDo(G, yy_2_ListTight, G->begin, G->end, "yy_2_ListTight");
-  yyprintf((stderr, "  ok   ListTight"));
+  l1561:;	  yyprintf((stderr, "  ok   CriticMarkup"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
+
   return 1;
-  l965:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ListTight"));
+  l1560:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "CriticMarkup"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Bullet(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Bullet"));
-
-  {  int yypos974= G->pos, yythunkpos974= G->thunkpos;  if (!yy_HorizontalRule(G))  goto l974;
-  goto l973;
-  l974:;	  G->pos= yypos974; G->thunkpos= yythunkpos974;
-  }  if (!yy_NonindentSpace(G))  goto l973;
+YY_RULE(int) yy_voidEndline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "voidEndline"));
 
-  {  int yypos975= G->pos, yythunkpos975= G->thunkpos;  if (!yymatchChar(G, '+')) goto l976;
-  goto l975;
-  l976:;	  G->pos= yypos975; G->thunkpos= yythunkpos975;  if (!yymatchChar(G, '*')) goto l977;
-  goto l975;
-  l977:;	  G->pos= yypos975; G->thunkpos= yythunkpos975;  if (!yymatchChar(G, '-')) goto l973;
+  {  int yypos1567= G->pos, yythunkpos1567= G->thunkpos;  if (!yymatchString(G, "  ")) goto l1568;
+  if (!yy_voidNormalEndline(G))  goto l1568;
+  goto l1567;
+  l1568:;	  G->pos= yypos1567; G->thunkpos= yythunkpos1567;  if (!yy_Sp(G))  goto l1569;
+  if (!yy_Newline(G))  goto l1569;
+  if (!yy_Eof(G))  goto l1569;
+  goto l1567;
+  l1569:;	  G->pos= yypos1567; G->thunkpos= yythunkpos1567;  if (!yy_voidNormalEndline(G))  goto l1566;
 
   }
-  l975:;	  if (!yy_Spacechar(G))  goto l973;
-
-  l978:;	
-  {  int yypos979= G->pos, yythunkpos979= G->thunkpos;  if (!yy_Spacechar(G))  goto l979;
-  goto l978;
-  l979:;	  G->pos= yypos979; G->thunkpos= yythunkpos979;
-  }  yyprintf((stderr, "  ok   Bullet"));
+  l1567:;	  yyprintf((stderr, "  ok   voidEndline"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l973:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Bullet"));
+  l1566:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "voidEndline"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Definition(GREG *G)
+YY_RULE(int) yy_Inlines(GREG *G)
 {  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "Definition"));
-  if (!yy_StartList(G))  goto l980;
+  yyprintfv((stderr, "%s\n", "Inlines"));
+  if (!yy_StartList(G))  goto l1570;
   yyDo(G, yySet, -2, 0, "yySet");
-  if (!yy_StartList(G))  goto l980;
-  yyDo(G, yySet, -1, 0, "yySet");
 
-  {  int yypos981= G->pos, yythunkpos981= G->thunkpos;  if (!yy_BlankLine(G))  goto l981;
-  yyDo(G, yy_1_Definition, G->begin, G->end, "yy_1_Definition");
-  goto l982;
-  l981:;	  G->pos= yypos981; G->thunkpos= yythunkpos981;
+  {  int yypos1573= G->pos, yythunkpos1573= G->thunkpos;
+  {  int yypos1575= G->pos, yythunkpos1575= G->thunkpos;  if (!yy_Endline(G))  goto l1575;
+  goto l1574;
+  l1575:;	  G->pos= yypos1575; G->thunkpos= yythunkpos1575;
+  }  if (!yy_Inline(G))  goto l1574;
+  yyDo(G, yy_1_Inlines, G->begin, G->end, "yy_1_Inlines");
+  goto l1573;
+  l1574:;	  G->pos= yypos1573; G->thunkpos= yythunkpos1573;  if (!yy_Endline(G))  goto l1570;
+  yyDo(G, yySet, -1, 0, "yySet");
+
+  {  int yypos1576= G->pos, yythunkpos1576= G->thunkpos;  if (!yy_Inline(G))  goto l1570;
+  G->pos= yypos1576; G->thunkpos= yythunkpos1576;
+  }  yyDo(G, yy_2_Inlines, G->begin, G->end, "yy_2_Inlines");
+
   }
-  l982:;	  if (!yy_NonindentSpace(G))  goto l980;
-  if (!yymatchChar(G, ':')) goto l980;
-  if (!yy_Sp(G))  goto l980;
-  if (!yy_RawLine(G))  goto l980;
-  yyDo(G, yy_2_Definition, G->begin, G->end, "yy_2_Definition");
+  l1573:;	
+  l1571:;	
+  {  int yypos1572= G->pos, yythunkpos1572= G->thunkpos;
+  {  int yypos1577= G->pos, yythunkpos1577= G->thunkpos;
+  {  int yypos1579= G->pos, yythunkpos1579= G->thunkpos;  if (!yy_Endline(G))  goto l1579;
+  goto l1578;
+  l1579:;	  G->pos= yypos1579; G->thunkpos= yythunkpos1579;
+  }  if (!yy_Inline(G))  goto l1578;
+  yyDo(G, yy_1_Inlines, G->begin, G->end, "yy_1_Inlines");
+  goto l1577;
+  l1578:;	  G->pos= yypos1577; G->thunkpos= yythunkpos1577;  if (!yy_Endline(G))  goto l1572;
+  yyDo(G, yySet, -1, 0, "yySet");
+
+  {  int yypos1580= G->pos, yythunkpos1580= G->thunkpos;  if (!yy_Inline(G))  goto l1572;
+  G->pos= yypos1580; G->thunkpos= yythunkpos1580;
+  }  yyDo(G, yy_2_Inlines, G->begin, G->end, "yy_2_Inlines");
 
-  l983:;	
-  {  int yypos984= G->pos, yythunkpos984= G->thunkpos;
-  {  int yypos985= G->pos, yythunkpos985= G->thunkpos;  if (!yymatchChar(G, ':')) goto l985;
-  goto l984;
-  l985:;	  G->pos= yypos985; G->thunkpos= yythunkpos985;
   }
-  {  int yypos986= G->pos, yythunkpos986= G->thunkpos;  if (!yy_BlankLine(G))  goto l986;
-  goto l984;
-  l986:;	  G->pos= yypos986; G->thunkpos= yythunkpos986;
-  }  if (!yy_RawLine(G))  goto l984;
-  yyDo(G, yy_3_Definition, G->begin, G->end, "yy_3_Definition");
-  goto l983;
-  l984:;	  G->pos= yypos984; G->thunkpos= yythunkpos984;
+  l1577:;	  goto l1571;
+  l1572:;	  G->pos= yypos1572; G->thunkpos= yythunkpos1572;
   }
-  l987:;	
-  {  int yypos988= G->pos, yythunkpos988= G->thunkpos;  if (!yy_BlankLine(G))  goto l988;
-  yyDo(G, yy_4_Definition, G->begin, G->end, "yy_4_Definition");
-  if (!yy_IndentedLine(G))  goto l988;
-  yyDo(G, yy_5_Definition, G->begin, G->end, "yy_5_Definition");
-
-  l989:;	
-  {  int yypos990= G->pos, yythunkpos990= G->thunkpos;  if (!yy_IndentedLine(G))  goto l990;
-  yyDo(G, yy_5_Definition, G->begin, G->end, "yy_5_Definition");
-  goto l989;
-  l990:;	  G->pos= yypos990; G->thunkpos= yythunkpos990;
-  }  yyDo(G, yy_6_Definition, G->begin, G->end, "yy_6_Definition");
-  goto l987;
-  l988:;	  G->pos= yypos988; G->thunkpos= yythunkpos988;
-  }  yyDo(G, yy_7_Definition, G->begin, G->end, "yy_7_Definition");
-  yyprintf((stderr, "  ok   Definition"));
+  {  int yypos1581= G->pos, yythunkpos1581= G->thunkpos;  if (!yy_voidEndline(G))  goto l1581;
+  goto l1582;
+  l1581:;	  G->pos= yypos1581; G->thunkpos= yythunkpos1581;
+  }
+  l1582:;	  yyDo(G, yy_3_Inlines, G->begin, G->end, "yy_3_Inlines");
+  yyprintf((stderr, "  ok   Inlines"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
   yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l980:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Definition"));
+  l1570:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Inlines"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Term(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "Term"));
-  if (!yy_StartList(G))  goto l991;
-  yyDo(G, yySet, -1, 0, "yySet");
+YY_RULE(int) yy_Entity(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Entity"));
 
-  {  int yypos992= G->pos, yythunkpos992= G->thunkpos;  if (!yy_BlankLine(G))  goto l992;
-  goto l991;
-  l992:;	  G->pos= yypos992; G->thunkpos= yythunkpos992;
-  }
-  {  int yypos993= G->pos, yythunkpos993= G->thunkpos;  if (!yymatchChar(G, ':')) goto l993;
-  goto l991;
-  l993:;	  G->pos= yypos993; G->thunkpos= yythunkpos993;
-  }
-  {  int yypos996= G->pos, yythunkpos996= G->thunkpos;  if (!yy_Newline(G))  goto l996;
-  goto l991;
-  l996:;	  G->pos= yypos996; G->thunkpos= yythunkpos996;
-  }
-  {  int yypos997= G->pos, yythunkpos997= G->thunkpos;  if (!yy_Endline(G))  goto l997;
-  goto l991;
-  l997:;	  G->pos= yypos997; G->thunkpos= yythunkpos997;
-  }  if (!yy_Inline(G))  goto l991;
-  yyDo(G, yy_1_Term, G->begin, G->end, "yy_1_Term");
+  {  int yypos1584= G->pos, yythunkpos1584= G->thunkpos;  if (!yy_HexEntity(G))  goto l1585;
+  goto l1584;
+  l1585:;	  G->pos= yypos1584; G->thunkpos= yythunkpos1584;  if (!yy_DecEntity(G))  goto l1586;
+  goto l1584;
+  l1586:;	  G->pos= yypos1584; G->thunkpos= yythunkpos1584;  if (!yy_CharEntity(G))  goto l1583;
 
-  l994:;	
-  {  int yypos995= G->pos, yythunkpos995= G->thunkpos;
-  {  int yypos998= G->pos, yythunkpos998= G->thunkpos;  if (!yy_Newline(G))  goto l998;
-  goto l995;
-  l998:;	  G->pos= yypos998; G->thunkpos= yythunkpos998;
   }
-  {  int yypos999= G->pos, yythunkpos999= G->thunkpos;  if (!yy_Endline(G))  goto l999;
-  goto l995;
-  l999:;	  G->pos= yypos999; G->thunkpos= yythunkpos999;
-  }  if (!yy_Inline(G))  goto l995;
-  yyDo(G, yy_1_Term, G->begin, G->end, "yy_1_Term");
-  goto l994;
-  l995:;	  G->pos= yypos995; G->thunkpos= yythunkpos995;
-  }  if (!yy_Newline(G))  goto l991;
-  yyDo(G, yy_2_Term, G->begin, G->end, "yy_2_Term");
-  yyprintf((stderr, "  ok   Term"));
+  l1584:;	  yyDo(G, yy_1_Entity, G->begin, G->end, "yy_1_Entity");
+  yyprintf((stderr, "  ok   Entity"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
+
   return 1;
-  l991:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Term"));
+  l1583:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Entity"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_TermLine(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "TermLine"));
+YY_RULE(int) yy_EscapedChar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "EscapedChar"));
+  if (!yymatchChar(G, '\\')) goto l1587;
 
-  {  int yypos1001= G->pos, yythunkpos1001= G->thunkpos;  if (!yymatchChar(G, ':')) goto l1001;
-  goto l1000;
-  l1001:;	  G->pos= yypos1001; G->thunkpos= yythunkpos1001;
-  }
-  {  int yypos1002= G->pos, yythunkpos1002= G->thunkpos;  if (!yy_BlankLine(G))  goto l1002;
-  goto l1000;
-  l1002:;	  G->pos= yypos1002; G->thunkpos= yythunkpos1002;
-  }
-  l1003:;	
-  {  int yypos1004= G->pos, yythunkpos1004= G->thunkpos;
-  {  int yypos1005= G->pos, yythunkpos1005= G->thunkpos;  if (!yy_Newline(G))  goto l1005;
-  goto l1004;
-  l1005:;	  G->pos= yypos1005; G->thunkpos= yythunkpos1005;
-  }  if (!yymatchDot(G)) goto l1004;  goto l1003;
-  l1004:;	  G->pos= yypos1004; G->thunkpos= yythunkpos1004;
-  }  if (!yy_Newline(G))  goto l1000;
-  yyprintf((stderr, "  ok   TermLine"));
+  {  int yypos1588= G->pos, yythunkpos1588= G->thunkpos;  if (!yy_Newline(G))  goto l1588;
+  goto l1587;
+  l1588:;	  G->pos= yypos1588; G->thunkpos= yythunkpos1588;
+  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1587;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\236\157\000\120\000\000\000\270\001\000\000\070\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "-\\\\`|*_{}[\\]()#+.!$><'\"\"")) goto l1587;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1587;  yyDo(G, yy_1_EscapedChar, G->begin, G->end, "yy_1_EscapedChar");
+  yyprintf((stderr, "  ok   EscapedChar"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1000:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "TermLine"));
+  l1587:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "EscapedChar"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_VerbatimChunk(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "VerbatimChunk"));
-  if (!yy_StartList(G))  goto l1006;
-  yyDo(G, yySet, -1, 0, "yySet");
-
-  l1007:;	
-  {  int yypos1008= G->pos, yythunkpos1008= G->thunkpos;  if (!yy_BlankLine(G))  goto l1008;
-  yyDo(G, yy_1_VerbatimChunk, G->begin, G->end, "yy_1_VerbatimChunk");
-  goto l1007;
-  l1008:;	  G->pos= yypos1008; G->thunkpos= yythunkpos1008;
-  }  if (!yy_NonblankIndentedLine(G))  goto l1006;
-  yyDo(G, yy_2_VerbatimChunk, G->begin, G->end, "yy_2_VerbatimChunk");
-
-  l1009:;	
-  {  int yypos1010= G->pos, yythunkpos1010= G->thunkpos;  if (!yy_NonblankIndentedLine(G))  goto l1010;
-  yyDo(G, yy_2_VerbatimChunk, G->begin, G->end, "yy_2_VerbatimChunk");
-  goto l1009;
-  l1010:;	  G->pos= yypos1010; G->thunkpos= yythunkpos1010;
-  }  yyDo(G, yy_3_VerbatimChunk, G->begin, G->end, "yy_3_VerbatimChunk");
-  yyprintf((stderr, "  ok   VerbatimChunk"));
+YY_RULE(int) yy_Symbol(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Symbol"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1589;  if (!yy_SpecialChar(G))  goto l1589;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1589;  yyDo(G, yy_1_Symbol, G->begin, G->end, "yy_1_Symbol");
+  yyprintf((stderr, "  ok   Symbol"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
+
   return 1;
-  l1006:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "VerbatimChunk"));
+  l1589:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Symbol"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_NonblankIndentedLine(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "NonblankIndentedLine"));
+YY_RULE(int) yy_OptionallyIndentedLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "OptionallyIndentedLine"));
 
-  {  int yypos1012= G->pos, yythunkpos1012= G->thunkpos;  if (!yy_BlankLine(G))  goto l1012;
-  goto l1011;
-  l1012:;	  G->pos= yypos1012; G->thunkpos= yythunkpos1012;
-  }  if (!yy_IndentedLine(G))  goto l1011;
-  yyprintf((stderr, "  ok   NonblankIndentedLine"));
+  {  int yypos1591= G->pos, yythunkpos1591= G->thunkpos;  if (!yy_Indent(G))  goto l1591;
+  goto l1592;
+  l1591:;	  G->pos= yypos1591; G->thunkpos= yythunkpos1591;
+  }
+  l1592:;	  if (!yy_Line(G))  goto l1590;
+  yyprintf((stderr, "  ok   OptionallyIndentedLine"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1011:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "NonblankIndentedLine"));
+  l1590:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "OptionallyIndentedLine"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_DoubleQuoteEnd(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "DoubleQuoteEnd"));
-  if (!yymatchChar(G, '"')) goto l1013;
-  yyprintf((stderr, "  ok   DoubleQuoteEnd"));
+YY_RULE(int) yy_IndentedLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "IndentedLine"));
+  if (!yy_Indent(G))  goto l1593;
+  if (!yy_Line(G))  goto l1593;
+  yyprintf((stderr, "  ok   IndentedLine"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1013:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DoubleQuoteEnd"));
+  l1593:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "IndentedLine"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_DoubleQuoteStart(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "DoubleQuoteStart"));
-  if (!yymatchChar(G, '"')) goto l1014;
-  yyprintf((stderr, "  ok   DoubleQuoteStart"));
+YY_RULE(int) yy_Indent(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Indent"));
+
+  {  int yypos1595= G->pos, yythunkpos1595= G->thunkpos;  if (!yymatchChar(G, '\t')) goto l1596;
+  goto l1595;
+  l1596:;	  G->pos= yypos1595; G->thunkpos= yythunkpos1595;  if (!yymatchString(G, "    ")) goto l1594;
+
+  }
+  l1595:;	  yyprintf((stderr, "  ok   Indent"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1014:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DoubleQuoteStart"));
+  l1594:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Indent"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_SingleQuoteEnd(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SingleQuoteEnd"));
-  if (!yymatchChar(G, '\'')) goto l1015;
+YY_RULE(int) yy_NonindentSpace(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "NonindentSpace"));
 
-  {  int yypos1016= G->pos, yythunkpos1016= G->thunkpos;  if (!yy_Alphanumeric(G))  goto l1016;
-  goto l1015;
-  l1016:;	  G->pos= yypos1016; G->thunkpos= yythunkpos1016;
-  }  yyprintf((stderr, "  ok   SingleQuoteEnd"));
+  {  int yypos1598= G->pos, yythunkpos1598= G->thunkpos;  if (!yymatchString(G, "   ")) goto l1599;
+  goto l1598;
+  l1599:;	  G->pos= yypos1598; G->thunkpos= yythunkpos1598;  if (!yymatchString(G, "  ")) goto l1600;
+  goto l1598;
+  l1600:;	  G->pos= yypos1598; G->thunkpos= yythunkpos1598;  if (!yymatchChar(G, ' ')) goto l1601;
+  goto l1598;
+  l1601:;	  G->pos= yypos1598; G->thunkpos= yythunkpos1598;  if (!yymatchString(G, "")) goto l1597;
+
+  }
+  l1598:;	  yyprintf((stderr, "  ok   NonindentSpace"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1015:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SingleQuoteEnd"));
+  l1597:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "NonindentSpace"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_SingleQuoteStart(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SingleQuoteStart"));
-  if (!yymatchChar(G, '\'')) goto l1017;
+YY_RULE(int) yy_CharEntity(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "CharEntity"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1602;  if (!yymatchChar(G, '&')) goto l1602;
+  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z0-9")) goto l1602;
 
-  {  int yypos1018= G->pos, yythunkpos1018= G->thunkpos;
-  {  int yypos1019= G->pos, yythunkpos1019= G->thunkpos;  if (!yy_Spacechar(G))  goto l1020;
-  goto l1019;
-  l1020:;	  G->pos= yypos1019; G->thunkpos= yythunkpos1019;  if (!yy_Newline(G))  goto l1018;
-
-  }
-  l1019:;	  goto l1017;
-  l1018:;	  G->pos= yypos1018; G->thunkpos= yythunkpos1018;
-  }  yyprintf((stderr, "  ok   SingleQuoteStart"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1017:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SingleQuoteStart"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_EnDash(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "EnDash"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1021;
-  {  int yypos1022= G->pos, yythunkpos1022= G->thunkpos;  if (!yymatchString(G, "--")) goto l1023;
-  goto l1022;
-  l1023:;	  G->pos= yypos1022; G->thunkpos= yythunkpos1022;  if (!yymatchChar(G, '-')) goto l1021;
-
-  {  int yypos1024= G->pos, yythunkpos1024= G->thunkpos;  if (!yy_Digit(G))  goto l1021;
-  G->pos= yypos1024; G->thunkpos= yythunkpos1024;
-  }
-  }
-  l1022:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1021;  yyDo(G, yy_1_EnDash, G->begin, G->end, "yy_1_EnDash");
-  yyprintf((stderr, "  ok   EnDash"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1021:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "EnDash"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_EmDash(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "EmDash"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1025;  if (!yymatchString(G, "---")) goto l1025;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1025;  yyDo(G, yy_1_EmDash, G->begin, G->end, "yy_1_EmDash");
-  yyprintf((stderr, "  ok   EmDash"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1025:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "EmDash"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Apostrophe(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Apostrophe"));
-  if (!yymatchChar(G, '\'')) goto l1026;
-  yyDo(G, yy_1_Apostrophe, G->begin, G->end, "yy_1_Apostrophe");
-  yyprintf((stderr, "  ok   Apostrophe"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1026:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Apostrophe"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_DoubleQuoted(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "DoubleQuoted"));
-  if (!yy_DoubleQuoteStart(G))  goto l1027;
-  if (!yy_StartList(G))  goto l1027;
-  yyDo(G, yySet, -2, 0, "yySet");
-
-  {  int yypos1030= G->pos, yythunkpos1030= G->thunkpos;  if (!yy_DoubleQuoteEnd(G))  goto l1030;
-  goto l1027;
-  l1030:;	  G->pos= yypos1030; G->thunkpos= yythunkpos1030;
-  }  if (!yy_Inline(G))  goto l1027;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_DoubleQuoted, G->begin, G->end, "yy_1_DoubleQuoted");
-
-  l1028:;	
-  {  int yypos1029= G->pos, yythunkpos1029= G->thunkpos;
-  {  int yypos1031= G->pos, yythunkpos1031= G->thunkpos;  if (!yy_DoubleQuoteEnd(G))  goto l1031;
-  goto l1029;
-  l1031:;	  G->pos= yypos1031; G->thunkpos= yythunkpos1031;
-  }  if (!yy_Inline(G))  goto l1029;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_DoubleQuoted, G->begin, G->end, "yy_1_DoubleQuoted");
-  goto l1028;
-  l1029:;	  G->pos= yypos1029; G->thunkpos= yythunkpos1029;
-  }  if (!yy_DoubleQuoteEnd(G))  goto l1027;
-  yyDo(G, yy_2_DoubleQuoted, G->begin, G->end, "yy_2_DoubleQuoted");
-  yyprintf((stderr, "  ok   DoubleQuoted"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
-  return 1;
-  l1027:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DoubleQuoted"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_SingleQuoted(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "SingleQuoted"));
-  if (!yy_SingleQuoteStart(G))  goto l1032;
-  if (!yy_StartList(G))  goto l1032;
-  yyDo(G, yySet, -2, 0, "yySet");
-
-  {  int yypos1035= G->pos, yythunkpos1035= G->thunkpos;  if (!yy_SingleQuoteEnd(G))  goto l1035;
-  goto l1032;
-  l1035:;	  G->pos= yypos1035; G->thunkpos= yythunkpos1035;
-  }  if (!yy_Inline(G))  goto l1032;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_SingleQuoted, G->begin, G->end, "yy_1_SingleQuoted");
-
-  l1033:;	
-  {  int yypos1034= G->pos, yythunkpos1034= G->thunkpos;
-  {  int yypos1036= G->pos, yythunkpos1036= G->thunkpos;  if (!yy_SingleQuoteEnd(G))  goto l1036;
-  goto l1034;
-  l1036:;	  G->pos= yypos1036; G->thunkpos= yythunkpos1036;
-  }  if (!yy_Inline(G))  goto l1034;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_SingleQuoted, G->begin, G->end, "yy_1_SingleQuoted");
-  goto l1033;
-  l1034:;	  G->pos= yypos1034; G->thunkpos= yythunkpos1034;
-  }  if (!yy_SingleQuoteEnd(G))  goto l1032;
-  yyDo(G, yy_2_SingleQuoted, G->begin, G->end, "yy_2_SingleQuoted");
-  yyprintf((stderr, "  ok   SingleQuoted"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
-  return 1;
-  l1032:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SingleQuoted"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Dash(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Dash"));
-
-  {  int yypos1038= G->pos, yythunkpos1038= G->thunkpos;  if (!yy_EmDash(G))  goto l1039;
-  goto l1038;
-  l1039:;	  G->pos= yypos1038; G->thunkpos= yythunkpos1038;  if (!yy_EnDash(G))  goto l1037;
-
-  }
-  l1038:;	  yyprintf((stderr, "  ok   Dash"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1037:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Dash"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Ellipsis(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Ellipsis"));
-
-  {  int yypos1041= G->pos, yythunkpos1041= G->thunkpos;  if (!yymatchString(G, "...")) goto l1042;
-  goto l1041;
-  l1042:;	  G->pos= yypos1041; G->thunkpos= yythunkpos1041;  if (!yymatchString(G, ". . .")) goto l1040;
-
-  }
-  l1041:;	  yyDo(G, yy_1_Ellipsis, G->begin, G->end, "yy_1_Ellipsis");
-  yyprintf((stderr, "  ok   Ellipsis"));
+  l1603:;	
+  {  int yypos1604= G->pos, yythunkpos1604= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z0-9")) goto l1604;
+  goto l1603;
+  l1604:;	  G->pos= yypos1604; G->thunkpos= yythunkpos1604;
+  }  if (!yymatchChar(G, ';')) goto l1602;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1602;  yyprintf((stderr, "  ok   CharEntity"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1040:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Ellipsis"));
+  l1602:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "CharEntity"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Ticks5(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Ticks5"));
-  if (!yymatchString(G, "`````")) goto l1043;
+YY_RULE(int) yy_DecEntity(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "DecEntity"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1605;  if (!yymatchChar(G, '&')) goto l1605;
+  if (!yymatchChar(G, '#')) goto l1605;
+  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "0-9")) goto l1605;
 
-  {  int yypos1044= G->pos, yythunkpos1044= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1044;
-  goto l1043;
-  l1044:;	  G->pos= yypos1044; G->thunkpos= yythunkpos1044;
-  }  yyprintf((stderr, "  ok   Ticks5"));
+  l1606:;	
+  {  int yypos1607= G->pos, yythunkpos1607= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "0-9")) goto l1607;
+  goto l1606;
+  l1607:;	  G->pos= yypos1607; G->thunkpos= yythunkpos1607;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1605;  if (!yymatchChar(G, ';')) goto l1605;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1605;  yyprintf((stderr, "  ok   DecEntity"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1043:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Ticks5"));
+  l1605:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DecEntity"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Ticks4(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Ticks4"));
-  if (!yymatchString(G, "````")) goto l1045;
+YY_RULE(int) yy_HexEntity(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HexEntity"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1608;  if (!yymatchChar(G, '&')) goto l1608;
+  if (!yymatchChar(G, '#')) goto l1608;
+  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "Xx")) goto l1608;
+  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "0-9a-fA-F")) goto l1608;
 
-  {  int yypos1046= G->pos, yythunkpos1046= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1046;
-  goto l1045;
-  l1046:;	  G->pos= yypos1046; G->thunkpos= yythunkpos1046;
-  }  yyprintf((stderr, "  ok   Ticks4"));
+  l1609:;	
+  {  int yypos1610= G->pos, yythunkpos1610= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "0-9a-fA-F")) goto l1610;
+  goto l1609;
+  l1610:;	  G->pos= yypos1610; G->thunkpos= yythunkpos1610;
+  }  if (!yymatchChar(G, ';')) goto l1608;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1608;  yyprintf((stderr, "  ok   HexEntity"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1045:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Ticks4"));
+  l1608:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HexEntity"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Ticks3(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Ticks3"));
-  if (!yymatchString(G, "```")) goto l1047;
-
-  {  int yypos1048= G->pos, yythunkpos1048= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1048;
-  goto l1047;
-  l1048:;	  G->pos= yypos1048; G->thunkpos= yythunkpos1048;
-  }  yyprintf((stderr, "  ok   Ticks3"));
+YY_RULE(int) yy_Digit(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Digit"));
+  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "0-9")) goto l1611;
+  yyprintf((stderr, "  ok   Digit"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1047:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Ticks3"));
+  l1611:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Digit"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Ticks2(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Ticks2"));
-  if (!yymatchString(G, "``")) goto l1049;
-
-  {  int yypos1050= G->pos, yythunkpos1050= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1050;
-  goto l1049;
-  l1050:;	  G->pos= yypos1050; G->thunkpos= yythunkpos1050;
-  }  yyprintf((stderr, "  ok   Ticks2"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1049:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Ticks2"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Ticks1(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Ticks1"));
-  if (!yymatchChar(G, '`')) goto l1051;
-
-  {  int yypos1052= G->pos, yythunkpos1052= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1052;
-  goto l1051;
-  l1052:;	  G->pos= yypos1052; G->thunkpos= yythunkpos1052;
-  }  yyprintf((stderr, "  ok   Ticks1"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1051:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Ticks1"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_RawNoteBlock(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "RawNoteBlock"));
-  if (!yy_StartList(G))  goto l1053;
-  yyDo(G, yySet, -1, 0, "yySet");
-
-  {  int yypos1056= G->pos, yythunkpos1056= G->thunkpos;  if (!yy_BlankLine(G))  goto l1056;
-  goto l1053;
-  l1056:;	  G->pos= yypos1056; G->thunkpos= yythunkpos1056;
-  }
-  {  int yypos1057= G->pos, yythunkpos1057= G->thunkpos;  if (!yy_NonindentSpace(G))  goto l1057;
-  if (!yy_RawNoteReference(G))  goto l1057;
-  goto l1053;
-  l1057:;	  G->pos= yypos1057; G->thunkpos= yythunkpos1057;
-  }  if (!yy_OptionallyIndentedLine(G))  goto l1053;
-  yyDo(G, yy_1_RawNoteBlock, G->begin, G->end, "yy_1_RawNoteBlock");
-
-  l1054:;	
-  {  int yypos1055= G->pos, yythunkpos1055= G->thunkpos;
-  {  int yypos1058= G->pos, yythunkpos1058= G->thunkpos;  if (!yy_BlankLine(G))  goto l1058;
-  goto l1055;
-  l1058:;	  G->pos= yypos1058; G->thunkpos= yythunkpos1058;
-  }
-  {  int yypos1059= G->pos, yythunkpos1059= G->thunkpos;  if (!yy_NonindentSpace(G))  goto l1059;
-  if (!yy_RawNoteReference(G))  goto l1059;
-  goto l1055;
-  l1059:;	  G->pos= yypos1059; G->thunkpos= yythunkpos1059;
-  }  if (!yy_OptionallyIndentedLine(G))  goto l1055;
-  yyDo(G, yy_1_RawNoteBlock, G->begin, G->end, "yy_1_RawNoteBlock");
-  goto l1054;
-  l1055:;	  G->pos= yypos1055; G->thunkpos= yythunkpos1055;
-  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1053;
-  l1060:;	
-  {  int yypos1061= G->pos, yythunkpos1061= G->thunkpos;  if (!yy_BlankLine(G))  goto l1061;
-  goto l1060;
-  l1061:;	  G->pos= yypos1061; G->thunkpos= yythunkpos1061;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1053;  yyDo(G, yy_2_RawNoteBlock, G->begin, G->end, "yy_2_RawNoteBlock");
-  yyDo(G, yy_3_RawNoteBlock, G->begin, G->end, "yy_3_RawNoteBlock");
-  yyprintf((stderr, "  ok   RawNoteBlock"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
-  return 1;
-  l1053:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RawNoteBlock"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_GlossarySortKey(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "GlossarySortKey"));
-  if (!yymatchChar(G, '(')) goto l1062;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1062;
-  l1063:;	
-  {  int yypos1064= G->pos, yythunkpos1064= G->thunkpos;
-  {  int yypos1065= G->pos, yythunkpos1065= G->thunkpos;  if (!yymatchChar(G, ')')) goto l1065;
-  goto l1064;
-  l1065:;	  G->pos= yypos1065; G->thunkpos= yythunkpos1065;
-  }
-  {  int yypos1066= G->pos, yythunkpos1066= G->thunkpos;  if (!yy_Newline(G))  goto l1066;
-  goto l1064;
-  l1066:;	  G->pos= yypos1066; G->thunkpos= yythunkpos1066;
-  }  if (!yymatchDot(G)) goto l1064;  goto l1063;
-  l1064:;	  G->pos= yypos1064; G->thunkpos= yythunkpos1064;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1062;  if (!yymatchChar(G, ')')) goto l1062;
-  yyDo(G, yy_1_GlossarySortKey, G->begin, G->end, "yy_1_GlossarySortKey");
-  yyprintf((stderr, "  ok   GlossarySortKey"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1062:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "GlossarySortKey"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_GlossaryTerm(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "GlossaryTerm"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1067;
-  {  int yypos1070= G->pos, yythunkpos1070= G->thunkpos;  if (!yy_Newline(G))  goto l1070;
-  goto l1067;
-  l1070:;	  G->pos= yypos1070; G->thunkpos= yythunkpos1070;
-  }
-  {  int yypos1071= G->pos, yythunkpos1071= G->thunkpos;  if (!yymatchChar(G, '(')) goto l1071;
-  goto l1067;
-  l1071:;	  G->pos= yypos1071; G->thunkpos= yythunkpos1071;
-  }  if (!yymatchDot(G)) goto l1067;
-  l1068:;	
-  {  int yypos1069= G->pos, yythunkpos1069= G->thunkpos;
-  {  int yypos1072= G->pos, yythunkpos1072= G->thunkpos;  if (!yy_Newline(G))  goto l1072;
-  goto l1069;
-  l1072:;	  G->pos= yypos1072; G->thunkpos= yythunkpos1072;
-  }
-  {  int yypos1073= G->pos, yythunkpos1073= G->thunkpos;  if (!yymatchChar(G, '(')) goto l1073;
-  goto l1069;
-  l1073:;	  G->pos= yypos1073; G->thunkpos= yythunkpos1073;
-  }  if (!yymatchDot(G)) goto l1069;  goto l1068;
-  l1069:;	  G->pos= yypos1069; G->thunkpos= yythunkpos1069;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1067;  yyDo(G, yy_1_GlossaryTerm, G->begin, G->end, "yy_1_GlossaryTerm");
-  yyprintf((stderr, "  ok   GlossaryTerm"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1067:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "GlossaryTerm"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_RawNoteReference(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RawNoteReference"));
-
-  {  int yypos1075= G->pos, yythunkpos1075= G->thunkpos;  if (!yymatchString(G, "[^")) goto l1076;
-  goto l1075;
-  l1076:;	  G->pos= yypos1075; G->thunkpos= yythunkpos1075;  if (!yymatchString(G, "[#")) goto l1074;
-
-  }
-  l1075:;	  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1074;
-  {  int yypos1079= G->pos, yythunkpos1079= G->thunkpos;  if (!yy_Newline(G))  goto l1079;
-  goto l1074;
-  l1079:;	  G->pos= yypos1079; G->thunkpos= yythunkpos1079;
-  }
-  {  int yypos1080= G->pos, yythunkpos1080= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1080;
-  goto l1074;
-  l1080:;	  G->pos= yypos1080; G->thunkpos= yythunkpos1080;
-  }  if (!yymatchDot(G)) goto l1074;
-  l1077:;	
-  {  int yypos1078= G->pos, yythunkpos1078= G->thunkpos;
-  {  int yypos1081= G->pos, yythunkpos1081= G->thunkpos;  if (!yy_Newline(G))  goto l1081;
-  goto l1078;
-  l1081:;	  G->pos= yypos1081; G->thunkpos= yythunkpos1081;
-  }
-  {  int yypos1082= G->pos, yythunkpos1082= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1082;
-  goto l1078;
-  l1082:;	  G->pos= yypos1082; G->thunkpos= yythunkpos1082;
-  }  if (!yymatchDot(G)) goto l1078;  goto l1077;
-  l1078:;	  G->pos= yypos1078; G->thunkpos= yythunkpos1078;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1074;  if (!yymatchChar(G, ']')) goto l1074;
-  yyDo(G, yy_1_RawNoteReference, G->begin, G->end, "yy_1_RawNoteReference");
-  yyprintf((stderr, "  ok   RawNoteReference"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1074:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RawNoteReference"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_EmptyTitle(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "EmptyTitle"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1083;  if (!yymatchString(G, "")) goto l1083;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1083;  yyprintf((stderr, "  ok   EmptyTitle"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1083:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "EmptyTitle"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_RefTitleParens(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RefTitleParens"));
-  if (!yy_Spnl(G))  goto l1084;
-  if (!yymatchChar(G, '(')) goto l1084;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1084;
-  l1085:;	
-  {  int yypos1086= G->pos, yythunkpos1086= G->thunkpos;
-  {  int yypos1087= G->pos, yythunkpos1087= G->thunkpos;
-  {  int yypos1088= G->pos, yythunkpos1088= G->thunkpos;  if (!yymatchChar(G, ')')) goto l1089;
-  if (!yy_Sp(G))  goto l1089;
-  if (!yy_Newline(G))  goto l1089;
-  goto l1088;
-  l1089:;	  G->pos= yypos1088; G->thunkpos= yythunkpos1088;  if (!yy_Newline(G))  goto l1090;
-  goto l1088;
-  l1090:;	  G->pos= yypos1088; G->thunkpos= yythunkpos1088;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1087;  if (!yymatchChar(G, ')')) goto l1087;
-  if (!yy_Sp(G))  goto l1087;
-  if (!yy_AlphanumericAscii(G))  goto l1087;
-
-  l1091:;	
-  {  int yypos1092= G->pos, yythunkpos1092= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1092;
-  goto l1091;
-  l1092:;	  G->pos= yypos1092; G->thunkpos= yythunkpos1092;
-  }  if (!yymatchChar(G, '=')) goto l1087;
-
-  }
-  l1088:;	  goto l1086;
-  l1087:;	  G->pos= yypos1087; G->thunkpos= yythunkpos1087;
-  }  if (!yymatchDot(G)) goto l1086;  goto l1085;
-  l1086:;	  G->pos= yypos1086; G->thunkpos= yythunkpos1086;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1084;  if (!yymatchChar(G, ')')) goto l1084;
-  yyprintf((stderr, "  ok   RefTitleParens"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1084:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RefTitleParens"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_RefTitleDouble(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RefTitleDouble"));
-  if (!yy_Spnl(G))  goto l1093;
-  if (!yymatchChar(G, '"')) goto l1093;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1093;
-  l1094:;	
-  {  int yypos1095= G->pos, yythunkpos1095= G->thunkpos;
-  {  int yypos1096= G->pos, yythunkpos1096= G->thunkpos;
-  {  int yypos1097= G->pos, yythunkpos1097= G->thunkpos;  if (!yymatchChar(G, '"')) goto l1098;
-  if (!yy_Sp(G))  goto l1098;
-  if (!yy_Newline(G))  goto l1098;
-  goto l1097;
-  l1098:;	  G->pos= yypos1097; G->thunkpos= yythunkpos1097;  if (!yy_Newline(G))  goto l1099;
-  goto l1097;
-  l1099:;	  G->pos= yypos1097; G->thunkpos= yythunkpos1097;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1096;  if (!yymatchChar(G, '"')) goto l1096;
-  if (!yy_Sp(G))  goto l1096;
-  if (!yy_AlphanumericAscii(G))  goto l1096;
-
-  l1100:;	
-  {  int yypos1101= G->pos, yythunkpos1101= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1101;
-  goto l1100;
-  l1101:;	  G->pos= yypos1101; G->thunkpos= yythunkpos1101;
-  }  if (!yymatchChar(G, '=')) goto l1096;
-
-  }
-  l1097:;	  goto l1095;
-  l1096:;	  G->pos= yypos1096; G->thunkpos= yythunkpos1096;
-  }  if (!yymatchDot(G)) goto l1095;  goto l1094;
-  l1095:;	  G->pos= yypos1095; G->thunkpos= yythunkpos1095;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1093;  if (!yymatchChar(G, '"')) goto l1093;
-  yyprintf((stderr, "  ok   RefTitleDouble"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1093:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RefTitleDouble"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_RefTitleSingle(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RefTitleSingle"));
-  if (!yy_Spnl(G))  goto l1102;
-  if (!yymatchChar(G, '\'')) goto l1102;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1102;
-  l1103:;	
-  {  int yypos1104= G->pos, yythunkpos1104= G->thunkpos;
-  {  int yypos1105= G->pos, yythunkpos1105= G->thunkpos;
-  {  int yypos1106= G->pos, yythunkpos1106= G->thunkpos;  if (!yymatchChar(G, '\'')) goto l1107;
-  if (!yy_Sp(G))  goto l1107;
-  if (!yy_Newline(G))  goto l1107;
-  goto l1106;
-  l1107:;	  G->pos= yypos1106; G->thunkpos= yythunkpos1106;  if (!yy_Newline(G))  goto l1108;
-  goto l1106;
-  l1108:;	  G->pos= yypos1106; G->thunkpos= yythunkpos1106;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1105;  if (!yymatchChar(G, '\'')) goto l1105;
-  if (!yy_Sp(G))  goto l1105;
-  if (!yy_AlphanumericAscii(G))  goto l1105;
-
-  l1109:;	
-  {  int yypos1110= G->pos, yythunkpos1110= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1110;
-  goto l1109;
-  l1110:;	  G->pos= yypos1110; G->thunkpos= yythunkpos1110;
-  }  if (!yymatchChar(G, '=')) goto l1105;
-
-  }
-  l1106:;	  goto l1104;
-  l1105:;	  G->pos= yypos1105; G->thunkpos= yythunkpos1105;
-  }  if (!yymatchDot(G)) goto l1104;  goto l1103;
-  l1104:;	  G->pos= yypos1104; G->thunkpos= yythunkpos1104;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1102;  if (!yymatchChar(G, '\'')) goto l1102;
-  yyprintf((stderr, "  ok   RefTitleSingle"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1102:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RefTitleSingle"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_UnQuotedValue(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "UnQuotedValue"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1111;
-  {  int yypos1114= G->pos, yythunkpos1114= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1115;
-  goto l1114;
-  l1115:;	  G->pos= yypos1114; G->thunkpos= yythunkpos1114;  if (!yymatchChar(G, '.')) goto l1111;
-
-  }
-  l1114:;	
-  l1112:;	
-  {  int yypos1113= G->pos, yythunkpos1113= G->thunkpos;
-  {  int yypos1116= G->pos, yythunkpos1116= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1117;
-  goto l1116;
-  l1117:;	  G->pos= yypos1116; G->thunkpos= yythunkpos1116;  if (!yymatchChar(G, '.')) goto l1113;
-
-  }
-  l1116:;	  goto l1112;
-  l1113:;	  G->pos= yypos1113; G->thunkpos= yythunkpos1113;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1111;  yyprintf((stderr, "  ok   UnQuotedValue"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1111:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "UnQuotedValue"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_QuotedValue(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "QuotedValue"));
-  if (!yymatchChar(G, '"')) goto l1118;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1118;
-  l1119:;	
-  {  int yypos1120= G->pos, yythunkpos1120= G->thunkpos;
-  {  int yypos1121= G->pos, yythunkpos1121= G->thunkpos;  if (!yymatchChar(G, '"')) goto l1121;
-  goto l1120;
-  l1121:;	  G->pos= yypos1121; G->thunkpos= yythunkpos1121;
-  }  if (!yymatchDot(G)) goto l1120;  goto l1119;
-  l1120:;	  G->pos= yypos1120; G->thunkpos= yythunkpos1120;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1118;  if (!yymatchChar(G, '"')) goto l1118;
-  yyprintf((stderr, "  ok   QuotedValue"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1118:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "QuotedValue"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_AttrValue(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AttrValue"));
-
-  {  int yypos1123= G->pos, yythunkpos1123= G->thunkpos;  if (!yy_QuotedValue(G))  goto l1124;
-  goto l1123;
-  l1124:;	  G->pos= yypos1123; G->thunkpos= yythunkpos1123;  if (!yy_UnQuotedValue(G))  goto l1122;
-
-  }
-  l1123:;	  yyDo(G, yy_1_AttrValue, G->begin, G->end, "yy_1_AttrValue");
-  yyprintf((stderr, "  ok   AttrValue"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1122:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AttrValue"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_AttrKey(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AttrKey"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1125;  if (!yy_AlphanumericAscii(G))  goto l1125;
-
-  l1126:;	
-  {  int yypos1127= G->pos, yythunkpos1127= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1127;
-  goto l1126;
-  l1127:;	  G->pos= yypos1127; G->thunkpos= yythunkpos1127;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1125;  yyDo(G, yy_1_AttrKey, G->begin, G->end, "yy_1_AttrKey");
-  yyprintf((stderr, "  ok   AttrKey"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1125:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AttrKey"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Attribute(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "Attribute"));
-  if (!yy_Spnl(G))  goto l1128;
-  if (!yy_AttrKey(G))  goto l1128;
-  yyDo(G, yySet, -2, 0, "yySet");
-  if (!yymatchChar(G, '=')) goto l1128;
-  if (!yy_AttrValue(G))  goto l1128;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_Attribute, G->begin, G->end, "yy_1_Attribute");
-  yyprintf((stderr, "  ok   Attribute"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
-  return 1;
-  l1128:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Attribute"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Attributes(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "Attributes"));
-  if (!yy_StartList(G))  goto l1129;
-  yyDo(G, yySet, -1, 0, "yySet");
-  if (!yy_Attribute(G))  goto l1129;
-  yyDo(G, yy_1_Attributes, G->begin, G->end, "yy_1_Attributes");
-
-  l1130:;	
-  {  int yypos1131= G->pos, yythunkpos1131= G->thunkpos;  if (!yy_Attribute(G))  goto l1131;
-  yyDo(G, yy_1_Attributes, G->begin, G->end, "yy_1_Attributes");
-  goto l1130;
-  l1131:;	  G->pos= yypos1131; G->thunkpos= yythunkpos1131;
-  }  yyDo(G, yy_2_Attributes, G->begin, G->end, "yy_2_Attributes");
-  yyprintf((stderr, "  ok   Attributes"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
-  return 1;
-  l1129:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Attributes"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_RefTitle(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RefTitle"));
-
-  {  int yypos1133= G->pos, yythunkpos1133= G->thunkpos;  if (!yy_RefTitleSingle(G))  goto l1134;
-  goto l1133;
-  l1134:;	  G->pos= yypos1133; G->thunkpos= yythunkpos1133;  if (!yy_RefTitleDouble(G))  goto l1135;
-  goto l1133;
-  l1135:;	  G->pos= yypos1133; G->thunkpos= yythunkpos1133;  if (!yy_RefTitleParens(G))  goto l1136;
-  goto l1133;
-  l1136:;	  G->pos= yypos1133; G->thunkpos= yythunkpos1133;  if (!yy_EmptyTitle(G))  goto l1132;
-
-  }
-  l1133:;	  yyDo(G, yy_1_RefTitle, G->begin, G->end, "yy_1_RefTitle");
-  yyprintf((stderr, "  ok   RefTitle"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1132:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RefTitle"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_RefSrc(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RefSrc"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1137;  if (!yy_Nonspacechar(G))  goto l1137;
-
-  l1138:;	
-  {  int yypos1139= G->pos, yythunkpos1139= G->thunkpos;  if (!yy_Nonspacechar(G))  goto l1139;
-  goto l1138;
-  l1139:;	  G->pos= yypos1139; G->thunkpos= yythunkpos1139;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1137;  yyDo(G, yy_1_RefSrc, G->begin, G->end, "yy_1_RefSrc");
-  yyprintf((stderr, "  ok   RefSrc"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1137:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RefSrc"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_AutoLinkEmail(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AutoLinkEmail"));
-  if (!yymatchChar(G, '<')) goto l1140;
-
-  {  int yypos1141= G->pos, yythunkpos1141= G->thunkpos;  if (!yymatchString(G, "mailto:")) goto l1141;
-  goto l1142;
-  l1141:;	  G->pos= yypos1141; G->thunkpos= yythunkpos1141;
-  }
-  l1142:;	  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1140;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\062\350\377\003\376\377\377\207\376\377\377\107\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "-A-Za-z0-9+_./!%%~$")) goto l1140;
-
-  l1143:;	
-  {  int yypos1144= G->pos, yythunkpos1144= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\062\350\377\003\376\377\377\207\376\377\377\107\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "-A-Za-z0-9+_./!%%~$")) goto l1144;
-  goto l1143;
-  l1144:;	  G->pos= yypos1144; G->thunkpos= yythunkpos1144;
-  }  if (!yymatchChar(G, '@')) goto l1140;
-
-  {  int yypos1147= G->pos, yythunkpos1147= G->thunkpos;  if (!yy_Newline(G))  goto l1147;
-  goto l1140;
-  l1147:;	  G->pos= yypos1147; G->thunkpos= yythunkpos1147;
-  }
-  {  int yypos1148= G->pos, yythunkpos1148= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1148;
-  goto l1140;
-  l1148:;	  G->pos= yypos1148; G->thunkpos= yythunkpos1148;
-  }  if (!yymatchDot(G)) goto l1140;
-  l1145:;	
-  {  int yypos1146= G->pos, yythunkpos1146= G->thunkpos;
-  {  int yypos1149= G->pos, yythunkpos1149= G->thunkpos;  if (!yy_Newline(G))  goto l1149;
-  goto l1146;
-  l1149:;	  G->pos= yypos1149; G->thunkpos= yythunkpos1149;
-  }
-  {  int yypos1150= G->pos, yythunkpos1150= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1150;
-  goto l1146;
-  l1150:;	  G->pos= yypos1150; G->thunkpos= yythunkpos1150;
-  }  if (!yymatchDot(G)) goto l1146;  goto l1145;
-  l1146:;	  G->pos= yypos1146; G->thunkpos= yythunkpos1146;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1140;  if (!yymatchChar(G, '>')) goto l1140;
-  yyDo(G, yy_1_AutoLinkEmail, G->begin, G->end, "yy_1_AutoLinkEmail");
-  yyprintf((stderr, "  ok   AutoLinkEmail"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1140:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AutoLinkEmail"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_AutoLinkUrl(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AutoLinkUrl"));
-  if (!yymatchChar(G, '<')) goto l1151;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1151;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z")) goto l1151;
-
-  l1152:;	
-  {  int yypos1153= G->pos, yythunkpos1153= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z")) goto l1153;
-  goto l1152;
-  l1153:;	  G->pos= yypos1153; G->thunkpos= yythunkpos1153;
-  }  if (!yymatchString(G, "://")) goto l1151;
-
-  {  int yypos1156= G->pos, yythunkpos1156= G->thunkpos;  if (!yy_Newline(G))  goto l1156;
-  goto l1151;
-  l1156:;	  G->pos= yypos1156; G->thunkpos= yythunkpos1156;
-  }
-  {  int yypos1157= G->pos, yythunkpos1157= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1157;
-  goto l1151;
-  l1157:;	  G->pos= yypos1157; G->thunkpos= yythunkpos1157;
-  }  if (!yymatchDot(G)) goto l1151;
-  l1154:;	
-  {  int yypos1155= G->pos, yythunkpos1155= G->thunkpos;
-  {  int yypos1158= G->pos, yythunkpos1158= G->thunkpos;  if (!yy_Newline(G))  goto l1158;
-  goto l1155;
-  l1158:;	  G->pos= yypos1158; G->thunkpos= yythunkpos1158;
-  }
-  {  int yypos1159= G->pos, yythunkpos1159= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1159;
-  goto l1155;
-  l1159:;	  G->pos= yypos1159; G->thunkpos= yythunkpos1159;
-  }  if (!yymatchDot(G)) goto l1155;  goto l1154;
-  l1155:;	  G->pos= yypos1155; G->thunkpos= yythunkpos1155;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1151;  if (!yymatchChar(G, '>')) goto l1151;
-  yyDo(G, yy_1_AutoLinkUrl, G->begin, G->end, "yy_1_AutoLinkUrl");
-  yyprintf((stderr, "  ok   AutoLinkUrl"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1151:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AutoLinkUrl"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_TitleDouble(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "TitleDouble"));
-  if (!yymatchChar(G, '"')) goto l1160;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1160;
-  l1161:;	
-  {  int yypos1162= G->pos, yythunkpos1162= G->thunkpos;
-  {  int yypos1163= G->pos, yythunkpos1163= G->thunkpos;  if (!yymatchChar(G, '"')) goto l1163;
-  if (!yy_Sp(G))  goto l1163;
-
-  {  int yypos1164= G->pos, yythunkpos1164= G->thunkpos;  if (!yymatchChar(G, ')')) goto l1165;
-  goto l1164;
-  l1165:;	  G->pos= yypos1164; G->thunkpos= yythunkpos1164;  if (!yy_Newline(G))  goto l1163;
-
-  }
-  l1164:;	  goto l1162;
-  l1163:;	  G->pos= yypos1163; G->thunkpos= yythunkpos1163;
-  }  if (!yymatchDot(G)) goto l1162;  goto l1161;
-  l1162:;	  G->pos= yypos1162; G->thunkpos= yythunkpos1162;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1160;  if (!yymatchChar(G, '"')) goto l1160;
-  yyprintf((stderr, "  ok   TitleDouble"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1160:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "TitleDouble"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_TitleSingle(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "TitleSingle"));
-  if (!yymatchChar(G, '\'')) goto l1166;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1166;
-  l1167:;	
-  {  int yypos1168= G->pos, yythunkpos1168= G->thunkpos;
-  {  int yypos1169= G->pos, yythunkpos1169= G->thunkpos;  if (!yymatchChar(G, '\'')) goto l1169;
-  if (!yy_Sp(G))  goto l1169;
-
-  {  int yypos1170= G->pos, yythunkpos1170= G->thunkpos;  if (!yymatchChar(G, ')')) goto l1171;
-  goto l1170;
-  l1171:;	  G->pos= yypos1170; G->thunkpos= yythunkpos1170;  if (!yy_Newline(G))  goto l1169;
-
-  }
-  l1170:;	  goto l1168;
-  l1169:;	  G->pos= yypos1169; G->thunkpos= yythunkpos1169;
-  }  if (!yymatchDot(G)) goto l1168;  goto l1167;
-  l1168:;	  G->pos= yypos1168; G->thunkpos= yythunkpos1168;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1166;  if (!yymatchChar(G, '\'')) goto l1166;
-  yyprintf((stderr, "  ok   TitleSingle"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1166:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "TitleSingle"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_SourceContents(GREG *G)
-{  yyprintfv((stderr, "%s\n", "SourceContents"));
-
-  l1173:;	
-  {  int yypos1174= G->pos, yythunkpos1174= G->thunkpos;
-  {  int yypos1175= G->pos, yythunkpos1175= G->thunkpos;
-  {  int yypos1179= G->pos, yythunkpos1179= G->thunkpos;  if (!yymatchChar(G, '(')) goto l1179;
-  goto l1176;
-  l1179:;	  G->pos= yypos1179; G->thunkpos= yythunkpos1179;
-  }
-  {  int yypos1180= G->pos, yythunkpos1180= G->thunkpos;  if (!yymatchChar(G, ')')) goto l1180;
-  goto l1176;
-  l1180:;	  G->pos= yypos1180; G->thunkpos= yythunkpos1180;
-  }
-  {  int yypos1181= G->pos, yythunkpos1181= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1181;
-  goto l1176;
-  l1181:;	  G->pos= yypos1181; G->thunkpos= yythunkpos1181;
-  }  if (!yy_Nonspacechar(G))  goto l1176;
-
-  l1177:;	
-  {  int yypos1178= G->pos, yythunkpos1178= G->thunkpos;
-  {  int yypos1182= G->pos, yythunkpos1182= G->thunkpos;  if (!yymatchChar(G, '(')) goto l1182;
-  goto l1178;
-  l1182:;	  G->pos= yypos1182; G->thunkpos= yythunkpos1182;
-  }
-  {  int yypos1183= G->pos, yythunkpos1183= G->thunkpos;  if (!yymatchChar(G, ')')) goto l1183;
-  goto l1178;
-  l1183:;	  G->pos= yypos1183; G->thunkpos= yythunkpos1183;
-  }
-  {  int yypos1184= G->pos, yythunkpos1184= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1184;
-  goto l1178;
-  l1184:;	  G->pos= yypos1184; G->thunkpos= yythunkpos1184;
-  }  if (!yy_Nonspacechar(G))  goto l1178;
-  goto l1177;
-  l1178:;	  G->pos= yypos1178; G->thunkpos= yythunkpos1178;
-  }  goto l1175;
-  l1176:;	  G->pos= yypos1175; G->thunkpos= yythunkpos1175;  if (!yymatchChar(G, '(')) goto l1174;
-  if (!yy_SourceContents(G))  goto l1174;
-  if (!yymatchChar(G, ')')) goto l1174;
-
-  }
-  l1175:;	  goto l1173;
-  l1174:;	  G->pos= yypos1174; G->thunkpos= yythunkpos1174;
-  }  yyprintf((stderr, "  ok   SourceContents"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-}
-YY_RULE(int) yy_Title(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Title"));
-
-  {  int yypos1186= G->pos, yythunkpos1186= G->thunkpos;  if (!yy_TitleSingle(G))  goto l1187;
-  goto l1186;
-  l1187:;	  G->pos= yypos1186; G->thunkpos= yythunkpos1186;  if (!yy_TitleDouble(G))  goto l1188;
-  goto l1186;
-  l1188:;	  G->pos= yypos1186; G->thunkpos= yythunkpos1186;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1185;  if (!yymatchString(G, "")) goto l1185;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1185;
-  }
-  l1186:;	  yyDo(G, yy_1_Title, G->begin, G->end, "yy_1_Title");
-  yyprintf((stderr, "  ok   Title"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1185:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Title"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Source(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Source"));
-
-  {  int yypos1190= G->pos, yythunkpos1190= G->thunkpos;  if (!yymatchChar(G, '<')) goto l1191;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1191;  if (!yy_SourceContents(G))  goto l1191;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1191;  if (!yymatchChar(G, '>')) goto l1191;
-  goto l1190;
-  l1191:;	  G->pos= yypos1190; G->thunkpos= yythunkpos1190;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1189;  if (!yy_SourceContents(G))  goto l1189;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1189;
-  }
-  l1190:;	  yyDo(G, yy_1_Source, G->begin, G->end, "yy_1_Source");
-  yyprintf((stderr, "  ok   Source"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1189:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Source"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_RawCitationReference(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RawCitationReference"));
-  if (!yymatchString(G, "[#")) goto l1192;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1192;
-  {  int yypos1195= G->pos, yythunkpos1195= G->thunkpos;  if (!yy_Newline(G))  goto l1195;
-  goto l1192;
-  l1195:;	  G->pos= yypos1195; G->thunkpos= yythunkpos1195;
-  }
-  {  int yypos1196= G->pos, yythunkpos1196= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1196;
-  goto l1192;
-  l1196:;	  G->pos= yypos1196; G->thunkpos= yythunkpos1196;
-  }  if (!yymatchDot(G)) goto l1192;
-  l1193:;	
-  {  int yypos1194= G->pos, yythunkpos1194= G->thunkpos;
-  {  int yypos1197= G->pos, yythunkpos1197= G->thunkpos;  if (!yy_Newline(G))  goto l1197;
-  goto l1194;
-  l1197:;	  G->pos= yypos1197; G->thunkpos= yythunkpos1197;
-  }
-  {  int yypos1198= G->pos, yythunkpos1198= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1198;
-  goto l1194;
-  l1198:;	  G->pos= yypos1198; G->thunkpos= yythunkpos1198;
-  }  if (!yymatchDot(G)) goto l1194;  goto l1193;
-  l1194:;	  G->pos= yypos1194; G->thunkpos= yythunkpos1194;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1192;  if (!yymatchChar(G, ']')) goto l1192;
-  yyDo(G, yy_1_RawCitationReference, G->begin, G->end, "yy_1_RawCitationReference");
-  yyprintf((stderr, "  ok   RawCitationReference"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1192:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RawCitationReference"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_CitationReferenceSingle(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "CitationReferenceSingle"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1199;
-  {  int yypos1200= G->pos, yythunkpos1200= G->thunkpos;  if (!yymatchString(G, "[]")) goto l1201;
-  if (!yy_Spnl(G))  goto l1201;
-  if (!yy_RawCitationReference(G))  goto l1201;
-  yyDo(G, yySet, -1, 0, "yySet");
-  goto l1200;
-  l1201:;	  G->pos= yypos1200; G->thunkpos= yythunkpos1200;  if (!yy_RawCitationReference(G))  goto l1199;
-  yyDo(G, yySet, -1, 0, "yySet");
-
-  {  int yypos1202= G->pos, yythunkpos1202= G->thunkpos;  if (!yy_Spnl(G))  goto l1202;
-  if (!yymatchString(G, "[]")) goto l1202;
-  goto l1203;
-  l1202:;	  G->pos= yypos1202; G->thunkpos= yythunkpos1202;
-  }
-  l1203:;	
-  }
-  l1200:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1199;  yyDo(G, yy_1_CitationReferenceSingle, G->begin, G->end, "yy_1_CitationReferenceSingle");
-  yyprintf((stderr, "  ok   CitationReferenceSingle"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
-  return 1;
-  l1199:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "CitationReferenceSingle"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_CitationReferenceDouble(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "CitationReferenceDouble"));
-
-  {  int yypos1205= G->pos, yythunkpos1205= G->thunkpos;  if (!yymatchString(G, "[]")) goto l1205;
-  goto l1204;
-  l1205:;	  G->pos= yypos1205; G->thunkpos= yythunkpos1205;
-  }  if (!yy_Label(G))  goto l1204;
-  yyDo(G, yySet, -2, 0, "yySet");
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1204;  if (!yy_Spnl(G))  goto l1204;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1204;
-  {  int yypos1206= G->pos, yythunkpos1206= G->thunkpos;  if (!yymatchString(G, "[]")) goto l1206;
-  goto l1204;
-  l1206:;	  G->pos= yypos1206; G->thunkpos= yythunkpos1206;
-  }  if (!yy_RawCitationReference(G))  goto l1204;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_CitationReferenceDouble, G->begin, G->end, "yy_1_CitationReferenceDouble");
-  yyprintf((stderr, "  ok   CitationReferenceDouble"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
-  return 1;
-  l1204:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "CitationReferenceDouble"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Label(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "Label"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1207;  if (!yymatchChar(G, '[')) goto l1207;
-
-  {  int yypos1208= G->pos, yythunkpos1208= G->thunkpos;  if (!yymatchChar(G, '[')) goto l1208;
-  goto l1207;
-  l1208:;	  G->pos= yypos1208; G->thunkpos= yythunkpos1208;
-  }
-  {  int yypos1209= G->pos, yythunkpos1209= G->thunkpos;
-  {  int yypos1211= G->pos, yythunkpos1211= G->thunkpos;  if (!yymatchChar(G, '^')) goto l1211;
-  goto l1210;
-  l1211:;	  G->pos= yypos1211; G->thunkpos= yythunkpos1211;
-  }
-  {  int yypos1212= G->pos, yythunkpos1212= G->thunkpos;  if (!yymatchChar(G, '#')) goto l1212;
-  goto l1210;
-  l1212:;	  G->pos= yypos1212; G->thunkpos= yythunkpos1212;
-  }  yyText(G, G->begin, G->end);  if (!( ext(EXT_NOTES) )) goto l1210;  goto l1209;
-  l1210:;	  G->pos= yypos1209; G->thunkpos= yythunkpos1209;
-  {  int yypos1213= G->pos, yythunkpos1213= G->thunkpos;  if (!yymatchDot(G)) goto l1207;  G->pos= yypos1213; G->thunkpos= yythunkpos1213;
-  }  yyText(G, G->begin, G->end);  if (!( !ext(EXT_NOTES) )) goto l1207;
-  }
-  l1209:;	  if (!yy_StartList(G))  goto l1207;
-  yyDo(G, yySet, -1, 0, "yySet");
-
-  l1214:;	
-  {  int yypos1215= G->pos, yythunkpos1215= G->thunkpos;
-  {  int yypos1216= G->pos, yythunkpos1216= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1216;
-  goto l1215;
-  l1216:;	  G->pos= yypos1216; G->thunkpos= yythunkpos1216;
-  }  if (!yy_Inline(G))  goto l1215;
-  yyDo(G, yy_1_Label, G->begin, G->end, "yy_1_Label");
-  goto l1214;
-  l1215:;	  G->pos= yypos1215; G->thunkpos= yythunkpos1215;
-  }  if (!yymatchChar(G, ']')) goto l1207;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1207;  yyDo(G, yy_2_Label, G->begin, G->end, "yy_2_Label");
-  yyprintf((stderr, "  ok   Label"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
-  return 1;
-  l1207:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Label"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_ReferenceLinkSingle(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "ReferenceLinkSingle"));
-  if (!yy_Label(G))  goto l1217;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1217;
-  {  int yypos1218= G->pos, yythunkpos1218= G->thunkpos;  if (!yy_Spnl(G))  goto l1218;
-  if (!yymatchString(G, "[]")) goto l1218;
-  goto l1219;
-  l1218:;	  G->pos= yypos1218; G->thunkpos= yythunkpos1218;
-  }
-  l1219:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1217;  yyDo(G, yy_1_ReferenceLinkSingle, G->begin, G->end, "yy_1_ReferenceLinkSingle");
-  yyprintf((stderr, "  ok   ReferenceLinkSingle"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
-  return 1;
-  l1217:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ReferenceLinkSingle"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_ReferenceLinkDouble(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "ReferenceLinkDouble"));
-  if (!yy_Label(G))  goto l1220;
-  yyDo(G, yySet, -2, 0, "yySet");
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1220;  if (!yy_Spnl(G))  goto l1220;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1220;
-  {  int yypos1221= G->pos, yythunkpos1221= G->thunkpos;  if (!yymatchString(G, "[]")) goto l1221;
-  goto l1220;
-  l1221:;	  G->pos= yypos1221; G->thunkpos= yythunkpos1221;
-  }  if (!yy_Label(G))  goto l1220;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_ReferenceLinkDouble, G->begin, G->end, "yy_1_ReferenceLinkDouble");
-  yyprintf((stderr, "  ok   ReferenceLinkDouble"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
-  return 1;
-  l1220:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ReferenceLinkDouble"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_AutoLink(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AutoLink"));
-
-  {  int yypos1223= G->pos, yythunkpos1223= G->thunkpos;  if (!yy_AutoLinkUrl(G))  goto l1224;
-  goto l1223;
-  l1224:;	  G->pos= yypos1223; G->thunkpos= yythunkpos1223;  if (!yy_AutoLinkEmail(G))  goto l1222;
-
-  }
-  l1223:;	  yyprintf((stderr, "  ok   AutoLink"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1222:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AutoLink"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_ReferenceLink(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "ReferenceLink"));
-
-  {  int yypos1226= G->pos, yythunkpos1226= G->thunkpos;  if (!yy_ReferenceLinkDouble(G))  goto l1227;
-  goto l1226;
-  l1227:;	  G->pos= yypos1226; G->thunkpos= yythunkpos1226;  if (!yy_ReferenceLinkSingle(G))  goto l1225;
-
-  }
-  l1226:;	  yyprintf((stderr, "  ok   ReferenceLink"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1225:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ReferenceLink"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_ExplicitLink(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 3, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "ExplicitLink"));
-  if (!yy_Label(G))  goto l1228;
-  yyDo(G, yySet, -3, 0, "yySet");
-  if (!yymatchChar(G, '(')) goto l1228;
-  if (!yy_Sp(G))  goto l1228;
-  if (!yy_Source(G))  goto l1228;
-  yyDo(G, yySet, -2, 0, "yySet");
-  if (!yy_Spnl(G))  goto l1228;
-  if (!yy_Title(G))  goto l1228;
-  yyDo(G, yySet, -1, 0, "yySet");
-  if (!yy_Sp(G))  goto l1228;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1228;  if (!yymatchChar(G, ')')) goto l1228;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1228;  yyDo(G, yy_1_ExplicitLink, G->begin, G->end, "yy_1_ExplicitLink");
-  yyprintf((stderr, "  ok   ExplicitLink"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 3, 0, "yyPop");
-  return 1;
-  l1228:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ExplicitLink"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_StrongUl(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "StrongUl"));
-  if (!yymatchString(G, "__")) goto l1229;
-
-  {  int yypos1230= G->pos, yythunkpos1230= G->thunkpos;  if (!yy_Whitespace(G))  goto l1230;
-  goto l1229;
-  l1230:;	  G->pos= yypos1230; G->thunkpos= yythunkpos1230;
-  }  if (!yy_StartList(G))  goto l1229;
-  yyDo(G, yySet, -2, 0, "yySet");
-
-  {  int yypos1233= G->pos, yythunkpos1233= G->thunkpos;  if (!yymatchString(G, "__")) goto l1233;
-  goto l1229;
-  l1233:;	  G->pos= yypos1233; G->thunkpos= yythunkpos1233;
-  }  if (!yy_Inline(G))  goto l1229;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_StrongUl, G->begin, G->end, "yy_1_StrongUl");
-
-  l1231:;	
-  {  int yypos1232= G->pos, yythunkpos1232= G->thunkpos;
-  {  int yypos1234= G->pos, yythunkpos1234= G->thunkpos;  if (!yymatchString(G, "__")) goto l1234;
-  goto l1232;
-  l1234:;	  G->pos= yypos1234; G->thunkpos= yythunkpos1234;
-  }  if (!yy_Inline(G))  goto l1232;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_StrongUl, G->begin, G->end, "yy_1_StrongUl");
-  goto l1231;
-  l1232:;	  G->pos= yypos1232; G->thunkpos= yythunkpos1232;
-  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1229;  if (!yymatchString(G, "__")) goto l1229;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1229;  yyDo(G, yy_2_StrongUl, G->begin, G->end, "yy_2_StrongUl");
-  yyprintf((stderr, "  ok   StrongUl"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
-  return 1;
-  l1229:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "StrongUl"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_StrongStar(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "StrongStar"));
-  if (!yymatchString(G, "**")) goto l1235;
-
-  {  int yypos1236= G->pos, yythunkpos1236= G->thunkpos;  if (!yy_Whitespace(G))  goto l1236;
-  goto l1235;
-  l1236:;	  G->pos= yypos1236; G->thunkpos= yythunkpos1236;
-  }  if (!yy_StartList(G))  goto l1235;
-  yyDo(G, yySet, -2, 0, "yySet");
-
-  {  int yypos1239= G->pos, yythunkpos1239= G->thunkpos;  if (!yymatchString(G, "**")) goto l1239;
-  goto l1235;
-  l1239:;	  G->pos= yypos1239; G->thunkpos= yythunkpos1239;
-  }  if (!yy_Inline(G))  goto l1235;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_StrongStar, G->begin, G->end, "yy_1_StrongStar");
-
-  l1237:;	
-  {  int yypos1238= G->pos, yythunkpos1238= G->thunkpos;
-  {  int yypos1240= G->pos, yythunkpos1240= G->thunkpos;  if (!yymatchString(G, "**")) goto l1240;
-  goto l1238;
-  l1240:;	  G->pos= yypos1240; G->thunkpos= yythunkpos1240;
-  }  if (!yy_Inline(G))  goto l1238;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_StrongStar, G->begin, G->end, "yy_1_StrongStar");
-  goto l1237;
-  l1238:;	  G->pos= yypos1238; G->thunkpos= yythunkpos1238;
-  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1235;  if (!yymatchString(G, "**")) goto l1235;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1235;  yyDo(G, yy_2_StrongStar, G->begin, G->end, "yy_2_StrongStar");
-  yyprintf((stderr, "  ok   StrongStar"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
-  return 1;
-  l1235:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "StrongStar"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Whitespace(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Whitespace"));
-
-  {  int yypos1242= G->pos, yythunkpos1242= G->thunkpos;  if (!yy_Spacechar(G))  goto l1243;
-  goto l1242;
-  l1243:;	  G->pos= yypos1242; G->thunkpos= yythunkpos1242;  if (!yy_Newline(G))  goto l1241;
-
-  }
-  l1242:;	  yyprintf((stderr, "  ok   Whitespace"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1241:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Whitespace"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_EmphUl(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "EmphUl"));
-  if (!yymatchChar(G, '_')) goto l1244;
-
-  {  int yypos1245= G->pos, yythunkpos1245= G->thunkpos;  if (!yy_Whitespace(G))  goto l1245;
-  goto l1244;
-  l1245:;	  G->pos= yypos1245; G->thunkpos= yythunkpos1245;
-  }  if (!yy_StartList(G))  goto l1244;
-  yyDo(G, yySet, -2, 0, "yySet");
-
-  {  int yypos1248= G->pos, yythunkpos1248= G->thunkpos;
-  {  int yypos1250= G->pos, yythunkpos1250= G->thunkpos;  if (!yymatchChar(G, '_')) goto l1250;
-  goto l1249;
-  l1250:;	  G->pos= yypos1250; G->thunkpos= yythunkpos1250;
-  }  if (!yy_Inline(G))  goto l1249;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_EmphUl, G->begin, G->end, "yy_1_EmphUl");
-  goto l1248;
-  l1249:;	  G->pos= yypos1248; G->thunkpos= yythunkpos1248;  if (!yy_StrongUl(G))  goto l1244;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_2_EmphUl, G->begin, G->end, "yy_2_EmphUl");
-
-  }
-  l1248:;	
-  l1246:;	
-  {  int yypos1247= G->pos, yythunkpos1247= G->thunkpos;
-  {  int yypos1251= G->pos, yythunkpos1251= G->thunkpos;
-  {  int yypos1253= G->pos, yythunkpos1253= G->thunkpos;  if (!yymatchChar(G, '_')) goto l1253;
-  goto l1252;
-  l1253:;	  G->pos= yypos1253; G->thunkpos= yythunkpos1253;
-  }  if (!yy_Inline(G))  goto l1252;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_EmphUl, G->begin, G->end, "yy_1_EmphUl");
-  goto l1251;
-  l1252:;	  G->pos= yypos1251; G->thunkpos= yythunkpos1251;  if (!yy_StrongUl(G))  goto l1247;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_2_EmphUl, G->begin, G->end, "yy_2_EmphUl");
-
-  }
-  l1251:;	  goto l1246;
-  l1247:;	  G->pos= yypos1247; G->thunkpos= yythunkpos1247;
-  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1244;  if (!yymatchChar(G, '_')) goto l1244;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1244;  yyDo(G, yy_3_EmphUl, G->begin, G->end, "yy_3_EmphUl");
-  yyprintf((stderr, "  ok   EmphUl"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
-  return 1;
-  l1244:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "EmphUl"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_EmphStar(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "EmphStar"));
-  if (!yymatchChar(G, '*')) goto l1254;
-
-  {  int yypos1255= G->pos, yythunkpos1255= G->thunkpos;  if (!yy_Whitespace(G))  goto l1255;
-  goto l1254;
-  l1255:;	  G->pos= yypos1255; G->thunkpos= yythunkpos1255;
-  }  if (!yy_StartList(G))  goto l1254;
-  yyDo(G, yySet, -2, 0, "yySet");
-
-  {  int yypos1258= G->pos, yythunkpos1258= G->thunkpos;
-  {  int yypos1260= G->pos, yythunkpos1260= G->thunkpos;  if (!yymatchChar(G, '*')) goto l1260;
-  goto l1259;
-  l1260:;	  G->pos= yypos1260; G->thunkpos= yythunkpos1260;
-  }  if (!yy_Inline(G))  goto l1259;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_EmphStar, G->begin, G->end, "yy_1_EmphStar");
-  goto l1258;
-  l1259:;	  G->pos= yypos1258; G->thunkpos= yythunkpos1258;  if (!yy_StrongStar(G))  goto l1254;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_2_EmphStar, G->begin, G->end, "yy_2_EmphStar");
-
-  }
-  l1258:;	
-  l1256:;	
-  {  int yypos1257= G->pos, yythunkpos1257= G->thunkpos;
-  {  int yypos1261= G->pos, yythunkpos1261= G->thunkpos;
-  {  int yypos1263= G->pos, yythunkpos1263= G->thunkpos;  if (!yymatchChar(G, '*')) goto l1263;
-  goto l1262;
-  l1263:;	  G->pos= yypos1263; G->thunkpos= yythunkpos1263;
-  }  if (!yy_Inline(G))  goto l1262;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_EmphStar, G->begin, G->end, "yy_1_EmphStar");
-  goto l1261;
-  l1262:;	  G->pos= yypos1261; G->thunkpos= yythunkpos1261;  if (!yy_StrongStar(G))  goto l1257;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_2_EmphStar, G->begin, G->end, "yy_2_EmphStar");
-
-  }
-  l1261:;	  goto l1256;
-  l1257:;	  G->pos= yypos1257; G->thunkpos= yythunkpos1257;
-  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1254;  if (!yymatchChar(G, '*')) goto l1254;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1254;  yyDo(G, yy_3_EmphStar, G->begin, G->end, "yy_3_EmphStar");
-  yyprintf((stderr, "  ok   EmphStar"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
-  return 1;
-  l1254:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "EmphStar"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_StarLine(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "StarLine"));
-
-  {  int yypos1265= G->pos, yythunkpos1265= G->thunkpos;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1266;  if (!yymatchString(G, "****")) goto l1266;
-
-  l1267:;	
-  {  int yypos1268= G->pos, yythunkpos1268= G->thunkpos;  if (!yymatchChar(G, '*')) goto l1268;
-  goto l1267;
-  l1268:;	  G->pos= yypos1268; G->thunkpos= yythunkpos1268;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1266;  goto l1265;
-  l1266:;	  G->pos= yypos1265; G->thunkpos= yythunkpos1265;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1264;  if (!yy_Spacechar(G))  goto l1264;
-  if (!yymatchChar(G, '*')) goto l1264;
-
-  l1269:;	
-  {  int yypos1270= G->pos, yythunkpos1270= G->thunkpos;  if (!yymatchChar(G, '*')) goto l1270;
-  goto l1269;
-  l1270:;	  G->pos= yypos1270; G->thunkpos= yythunkpos1270;
-  }
-  {  int yypos1271= G->pos, yythunkpos1271= G->thunkpos;  if (!yy_Spacechar(G))  goto l1264;
-  G->pos= yypos1271; G->thunkpos= yythunkpos1271;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1264;
-  }
-  l1265:;	  yyprintf((stderr, "  ok   StarLine"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1264:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "StarLine"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_UlLine(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "UlLine"));
-
-  {  int yypos1273= G->pos, yythunkpos1273= G->thunkpos;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1274;  if (!yymatchString(G, "____")) goto l1274;
-
-  l1275:;	
-  {  int yypos1276= G->pos, yythunkpos1276= G->thunkpos;  if (!yymatchChar(G, '_')) goto l1276;
-  goto l1275;
-  l1276:;	  G->pos= yypos1276; G->thunkpos= yythunkpos1276;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1274;  goto l1273;
-  l1274:;	  G->pos= yypos1273; G->thunkpos= yythunkpos1273;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1272;  if (!yy_Spacechar(G))  goto l1272;
-  if (!yymatchChar(G, '_')) goto l1272;
-
-  l1277:;	
-  {  int yypos1278= G->pos, yythunkpos1278= G->thunkpos;  if (!yymatchChar(G, '_')) goto l1278;
-  goto l1277;
-  l1278:;	  G->pos= yypos1278; G->thunkpos= yythunkpos1278;
-  }
-  {  int yypos1279= G->pos, yythunkpos1279= G->thunkpos;  if (!yy_Spacechar(G))  goto l1272;
-  G->pos= yypos1279; G->thunkpos= yythunkpos1279;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1272;
-  }
-  l1273:;	  yyprintf((stderr, "  ok   UlLine"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1272:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "UlLine"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_DoubleDollarMath(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "DoubleDollarMath"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1280;  if (!yy_DoubleDollarMathStart(G))  goto l1280;
-
-  l1281:;	
-  {  int yypos1282= G->pos, yythunkpos1282= G->thunkpos;
-  {  int yypos1283= G->pos, yythunkpos1283= G->thunkpos;  if (!yy_DoubleDollarMathEnd(G))  goto l1283;
-  goto l1282;
-  l1283:;	  G->pos= yypos1283; G->thunkpos= yythunkpos1283;
-  }
-  {  int yypos1284= G->pos, yythunkpos1284= G->thunkpos;  if (!yy_BlankLine(G))  goto l1284;
-  if (!yy_BlankLine(G))  goto l1284;
-  goto l1282;
-  l1284:;	  G->pos= yypos1284; G->thunkpos= yythunkpos1284;
-  }  if (!yymatchDot(G)) goto l1282;  goto l1281;
-  l1282:;	  G->pos= yypos1282; G->thunkpos= yythunkpos1282;
-  }  if (!yy_DoubleDollarMathEnd(G))  goto l1280;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1280;  yyDo(G, yy_1_DoubleDollarMath, G->begin, G->end, "yy_1_DoubleDollarMath");
-  yyprintf((stderr, "  ok   DoubleDollarMath"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1280:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DoubleDollarMath"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_DoubleDollarMathEnd(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "DoubleDollarMathEnd"));
-
-  {  int yypos1286= G->pos, yythunkpos1286= G->thunkpos;  if (!yymatchChar(G, '\\')) goto l1286;
-  goto l1285;
-  l1286:;	  G->pos= yypos1286; G->thunkpos= yythunkpos1286;
-  }  if (!yy_Nonspacechar(G))  goto l1285;
-  if (!yymatchChar(G, '$')) goto l1285;
-  if (!yymatchChar(G, '$')) goto l1285;
-
-  {  int yypos1287= G->pos, yythunkpos1287= G->thunkpos;  if (!yy_Nonspacechar(G))  goto l1287;
-  goto l1285;
-  l1287:;	  G->pos= yypos1287; G->thunkpos= yythunkpos1287;
-  }  yyprintf((stderr, "  ok   DoubleDollarMathEnd"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1285:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DoubleDollarMathEnd"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_DoubleDollarMathStart(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "DoubleDollarMathStart"));
-  if (!yymatchChar(G, '$')) goto l1288;
-  if (!yymatchChar(G, '$')) goto l1288;
-
-  {  int yypos1289= G->pos, yythunkpos1289= G->thunkpos;
-  {  int yypos1290= G->pos, yythunkpos1290= G->thunkpos;  if (!yy_Spacechar(G))  goto l1291;
-  goto l1290;
-  l1291:;	  G->pos= yypos1290; G->thunkpos= yythunkpos1290;  if (!yy_Newline(G))  goto l1289;
-
-  }
-  l1290:;	  goto l1288;
-  l1289:;	  G->pos= yypos1289; G->thunkpos= yythunkpos1289;
-  }  yyprintf((stderr, "  ok   DoubleDollarMathStart"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1288:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DoubleDollarMathStart"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_SingleDollarMath(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SingleDollarMath"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1292;  if (!yy_SingleDollarMathStart(G))  goto l1292;
-
-  l1293:;	
-  {  int yypos1294= G->pos, yythunkpos1294= G->thunkpos;
-  {  int yypos1295= G->pos, yythunkpos1295= G->thunkpos;  if (!yy_SingleDollarMathEnd(G))  goto l1295;
-  goto l1294;
-  l1295:;	  G->pos= yypos1295; G->thunkpos= yythunkpos1295;
-  }
-  {  int yypos1296= G->pos, yythunkpos1296= G->thunkpos;  if (!yy_BlankLine(G))  goto l1296;
-  if (!yy_BlankLine(G))  goto l1296;
-  goto l1294;
-  l1296:;	  G->pos= yypos1296; G->thunkpos= yythunkpos1296;
-  }  if (!yymatchDot(G)) goto l1294;  goto l1293;
-  l1294:;	  G->pos= yypos1294; G->thunkpos= yythunkpos1294;
-  }  if (!yy_SingleDollarMathEnd(G))  goto l1292;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1292;  yyDo(G, yy_1_SingleDollarMath, G->begin, G->end, "yy_1_SingleDollarMath");
-  yyprintf((stderr, "  ok   SingleDollarMath"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1292:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SingleDollarMath"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_SingleDollarMathEnd(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SingleDollarMathEnd"));
-
-  {  int yypos1298= G->pos, yythunkpos1298= G->thunkpos;  if (!yymatchChar(G, '\\')) goto l1298;
-  goto l1297;
-  l1298:;	  G->pos= yypos1298; G->thunkpos= yythunkpos1298;
-  }
-  {  int yypos1299= G->pos, yythunkpos1299= G->thunkpos;  if (!yymatchChar(G, '$')) goto l1299;
-  goto l1297;
-  l1299:;	  G->pos= yypos1299; G->thunkpos= yythunkpos1299;
-  }  if (!yy_Nonspacechar(G))  goto l1297;
-  if (!yymatchChar(G, '$')) goto l1297;
-
-  {  int yypos1300= G->pos, yythunkpos1300= G->thunkpos;  if (!yy_Nonspacechar(G))  goto l1300;
-  goto l1297;
-  l1300:;	  G->pos= yypos1300; G->thunkpos= yythunkpos1300;
-  }  yyprintf((stderr, "  ok   SingleDollarMathEnd"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1297:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SingleDollarMathEnd"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_SingleDollarMathStart(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SingleDollarMathStart"));
-  if (!yymatchChar(G, '$')) goto l1301;
-
-  {  int yypos1302= G->pos, yythunkpos1302= G->thunkpos;
-  {  int yypos1303= G->pos, yythunkpos1303= G->thunkpos;  if (!yy_Spacechar(G))  goto l1304;
-  goto l1303;
-  l1304:;	  G->pos= yypos1303; G->thunkpos= yythunkpos1303;  if (!yy_Newline(G))  goto l1305;
-  goto l1303;
-  l1305:;	  G->pos= yypos1303; G->thunkpos= yythunkpos1303;  if (!yymatchChar(G, '$')) goto l1302;
-
-  }
-  l1303:;	  goto l1301;
-  l1302:;	  G->pos= yypos1302; G->thunkpos= yythunkpos1302;
-  }  yyprintf((stderr, "  ok   SingleDollarMathStart"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1301:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SingleDollarMathStart"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_AposChunk(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AposChunk"));
-  yyText(G, G->begin, G->end);  if (!( ext(EXT_SMART) )) goto l1306;  if (!yymatchChar(G, '\'')) goto l1306;
-
-  {  int yypos1307= G->pos, yythunkpos1307= G->thunkpos;  if (!yy_Alphanumeric(G))  goto l1306;
-  G->pos= yypos1307; G->thunkpos= yythunkpos1307;
-  }  yyDo(G, yy_1_AposChunk, G->begin, G->end, "yy_1_AposChunk");
-  yyprintf((stderr, "  ok   AposChunk"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1306:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AposChunk"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_StrChunk(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "StrChunk"));
-
-  {  int yypos1309= G->pos, yythunkpos1309= G->thunkpos;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1310;
-  {  int yypos1313= G->pos, yythunkpos1313= G->thunkpos;  if (!yy_NormalChar(G))  goto l1314;
-  goto l1313;
-  l1314:;	  G->pos= yypos1313; G->thunkpos= yythunkpos1313;  if (!yymatchChar(G, '_')) goto l1310;
-
-  l1315:;	
-  {  int yypos1316= G->pos, yythunkpos1316= G->thunkpos;  if (!yymatchChar(G, '_')) goto l1316;
-  goto l1315;
-  l1316:;	  G->pos= yypos1316; G->thunkpos= yythunkpos1316;
-  }
-  {  int yypos1317= G->pos, yythunkpos1317= G->thunkpos;  if (!yy_Alphanumeric(G))  goto l1310;
-  G->pos= yypos1317; G->thunkpos= yythunkpos1317;
-  }
-  }
-  l1313:;	
-  l1311:;	
-  {  int yypos1312= G->pos, yythunkpos1312= G->thunkpos;
-  {  int yypos1318= G->pos, yythunkpos1318= G->thunkpos;  if (!yy_NormalChar(G))  goto l1319;
-  goto l1318;
-  l1319:;	  G->pos= yypos1318; G->thunkpos= yythunkpos1318;  if (!yymatchChar(G, '_')) goto l1312;
-
-  l1320:;	
-  {  int yypos1321= G->pos, yythunkpos1321= G->thunkpos;  if (!yymatchChar(G, '_')) goto l1321;
-  goto l1320;
-  l1321:;	  G->pos= yypos1321; G->thunkpos= yythunkpos1321;
-  }
-  {  int yypos1322= G->pos, yythunkpos1322= G->thunkpos;  if (!yy_Alphanumeric(G))  goto l1312;
-  G->pos= yypos1322; G->thunkpos= yythunkpos1322;
-  }
-  }
-  l1318:;	  goto l1311;
-  l1312:;	  G->pos= yypos1312; G->thunkpos= yythunkpos1312;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1310;  yyDo(G, yy_1_StrChunk, G->begin, G->end, "yy_1_StrChunk");
-  goto l1309;
-  l1310:;	  G->pos= yypos1309; G->thunkpos= yythunkpos1309;  if (!yy_AposChunk(G))  goto l1308;
-
-  }
-  l1309:;	  yyprintf((stderr, "  ok   StrChunk"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1308:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "StrChunk"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_voidNormalEndline(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "voidNormalEndline"));
-  if (!yy_Sp(G))  goto l1323;
-  if (!yy_Newline(G))  goto l1323;
-
-  {  int yypos1324= G->pos, yythunkpos1324= G->thunkpos;  if (!yy_BlankLine(G))  goto l1324;
-  goto l1323;
-  l1324:;	  G->pos= yypos1324; G->thunkpos= yythunkpos1324;
-  }
-  {  int yypos1325= G->pos, yythunkpos1325= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1325;
-  goto l1323;
-  l1325:;	  G->pos= yypos1325; G->thunkpos= yythunkpos1325;
-  }
-  {  int yypos1326= G->pos, yythunkpos1326= G->thunkpos;  if (!yy_AtxStart(G))  goto l1326;
-  goto l1323;
-  l1326:;	  G->pos= yypos1326; G->thunkpos= yythunkpos1326;
-  }
-  {  int yypos1327= G->pos, yythunkpos1327= G->thunkpos;  if (!yy_Line(G))  goto l1327;
-
-  {  int yypos1328= G->pos, yythunkpos1328= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1329;
-
-  l1330:;	
-  {  int yypos1331= G->pos, yythunkpos1331= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1331;
-  goto l1330;
-  l1331:;	  G->pos= yypos1331; G->thunkpos= yythunkpos1331;
-  }  goto l1328;
-  l1329:;	  G->pos= yypos1328; G->thunkpos= yythunkpos1328;  if (!yymatchChar(G, '-')) goto l1327;
-
-  l1332:;	
-  {  int yypos1333= G->pos, yythunkpos1333= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1333;
-  goto l1332;
-  l1333:;	  G->pos= yypos1333; G->thunkpos= yythunkpos1333;
-  }
-  }
-  l1328:;	  if (!yy_Newline(G))  goto l1327;
-  goto l1323;
-  l1327:;	  G->pos= yypos1327; G->thunkpos= yythunkpos1327;
-  }  yyprintf((stderr, "  ok   voidNormalEndline"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1323:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "voidNormalEndline"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_NormalEndline(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "NormalEndline"));
-  if (!yy_Sp(G))  goto l1334;
-  if (!yy_Newline(G))  goto l1334;
-
-  {  int yypos1335= G->pos, yythunkpos1335= G->thunkpos;  if (!yy_BlankLine(G))  goto l1335;
-  goto l1334;
-  l1335:;	  G->pos= yypos1335; G->thunkpos= yythunkpos1335;
-  }
-  {  int yypos1336= G->pos, yythunkpos1336= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1336;
-  goto l1334;
-  l1336:;	  G->pos= yypos1336; G->thunkpos= yythunkpos1336;
-  }
-  {  int yypos1337= G->pos, yythunkpos1337= G->thunkpos;  if (!yy_AtxStart(G))  goto l1337;
-  goto l1334;
-  l1337:;	  G->pos= yypos1337; G->thunkpos= yythunkpos1337;
-  }
-  {  int yypos1338= G->pos, yythunkpos1338= G->thunkpos;  if (!yy_Line(G))  goto l1338;
-
-  {  int yypos1339= G->pos, yythunkpos1339= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1340;
-
-  l1341:;	
-  {  int yypos1342= G->pos, yythunkpos1342= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1342;
-  goto l1341;
-  l1342:;	  G->pos= yypos1342; G->thunkpos= yythunkpos1342;
-  }  goto l1339;
-  l1340:;	  G->pos= yypos1339; G->thunkpos= yythunkpos1339;  if (!yymatchChar(G, '-')) goto l1338;
-
-  l1343:;	
-  {  int yypos1344= G->pos, yythunkpos1344= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1344;
-  goto l1343;
-  l1344:;	  G->pos= yypos1344; G->thunkpos= yythunkpos1344;
-  }
-  }
-  l1339:;	  if (!yy_Newline(G))  goto l1338;
-  goto l1334;
-  l1338:;	  G->pos= yypos1338; G->thunkpos= yythunkpos1338;
-  }  yyDo(G, yy_1_NormalEndline, G->begin, G->end, "yy_1_NormalEndline");
-  yyprintf((stderr, "  ok   NormalEndline"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1334:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "NormalEndline"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_TerminalEndline(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "TerminalEndline"));
-  if (!yy_Sp(G))  goto l1345;
-  if (!yy_Newline(G))  goto l1345;
-  if (!yy_Eof(G))  goto l1345;
-  yyDo(G, yy_1_TerminalEndline, G->begin, G->end, "yy_1_TerminalEndline");
-  yyprintf((stderr, "  ok   TerminalEndline"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1345:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "TerminalEndline"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_LineBreak(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "LineBreak"));
-  if (!yymatchString(G, "  ")) goto l1346;
-  if (!yy_NormalEndline(G))  goto l1346;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_LineBreak, G->begin, G->end, "yy_1_LineBreak");
-  yyprintf((stderr, "  ok   LineBreak"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
-  return 1;
-  l1346:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "LineBreak"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Smart(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Smart"));
-  yyText(G, G->begin, G->end);  if (!( ext(EXT_SMART) )) goto l1347;
-  {  int yypos1348= G->pos, yythunkpos1348= G->thunkpos;  if (!yy_Ellipsis(G))  goto l1349;
-  goto l1348;
-  l1349:;	  G->pos= yypos1348; G->thunkpos= yythunkpos1348;  if (!yy_Dash(G))  goto l1350;
-  goto l1348;
-  l1350:;	  G->pos= yypos1348; G->thunkpos= yythunkpos1348;  if (!yy_SingleQuoted(G))  goto l1351;
-  goto l1348;
-  l1351:;	  G->pos= yypos1348; G->thunkpos= yythunkpos1348;  if (!yy_DoubleQuoted(G))  goto l1352;
-  goto l1348;
-  l1352:;	  G->pos= yypos1348; G->thunkpos= yythunkpos1348;  if (!yy_Apostrophe(G))  goto l1347;
-
-  }
-  l1348:;	  yyprintf((stderr, "  ok   Smart"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1347:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Smart"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_MarkdownHtmlTagOpen(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "MarkdownHtmlTagOpen"));
-  if (!yy_StartList(G))  goto l1353;
-  yyDo(G, yySet, -1, 0, "yySet");
-  if (!yymatchChar(G, '<')) goto l1353;
-  yyDo(G, yy_1_MarkdownHtmlTagOpen, G->begin, G->end, "yy_1_MarkdownHtmlTagOpen");
-  if (!yy_Spnl(G))  goto l1353;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1353;  if (!yy_HtmlBlockType(G))  goto l1353;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1353;  yyDo(G, yy_2_MarkdownHtmlTagOpen, G->begin, G->end, "yy_2_MarkdownHtmlTagOpen");
-  if (!yy_Spnl(G))  goto l1353;
-
-  l1354:;	
-  {  int yypos1355= G->pos, yythunkpos1355= G->thunkpos;
-  {  int yypos1356= G->pos, yythunkpos1356= G->thunkpos;  if (!yy_MarkdownHtmlAttribute(G))  goto l1356;
-  goto l1355;
-  l1356:;	  G->pos= yypos1356; G->thunkpos= yythunkpos1356;
-  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1355;  if (!yy_HtmlAttribute(G))  goto l1355;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1355;  yyDo(G, yy_3_MarkdownHtmlTagOpen, G->begin, G->end, "yy_3_MarkdownHtmlTagOpen");
-  goto l1354;
-  l1355:;	  G->pos= yypos1355; G->thunkpos= yythunkpos1355;
-  }  if (!yy_MarkdownHtmlAttribute(G))  goto l1353;
-
-  l1357:;	
-  {  int yypos1358= G->pos, yythunkpos1358= G->thunkpos;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1358;  if (!yy_HtmlAttribute(G))  goto l1358;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1358;  yyDo(G, yy_4_MarkdownHtmlTagOpen, G->begin, G->end, "yy_4_MarkdownHtmlTagOpen");
-  goto l1357;
-  l1358:;	  G->pos= yypos1358; G->thunkpos= yythunkpos1358;
-  }  if (!yymatchChar(G, '>')) goto l1353;
-  yyDo(G, yy_5_MarkdownHtmlTagOpen, G->begin, G->end, "yy_5_MarkdownHtmlTagOpen");
-  yyDo(G, yy_6_MarkdownHtmlTagOpen, G->begin, G->end, "yy_6_MarkdownHtmlTagOpen");
-  yyprintf((stderr, "  ok   MarkdownHtmlTagOpen"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
-  return 1;
-  l1353:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "MarkdownHtmlTagOpen"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Code(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Code"));
-
-  {  int yypos1360= G->pos, yythunkpos1360= G->thunkpos;  if (!yy_Ticks1(G))  goto l1361;
-  if (!yy_Sp(G))  goto l1361;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1361;
-  {  int yypos1364= G->pos, yythunkpos1364= G->thunkpos;
-  {  int yypos1368= G->pos, yythunkpos1368= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1368;
-  goto l1365;
-  l1368:;	  G->pos= yypos1368; G->thunkpos= yythunkpos1368;
-  }  if (!yy_Nonspacechar(G))  goto l1365;
-
-  l1366:;	
-  {  int yypos1367= G->pos, yythunkpos1367= G->thunkpos;
-  {  int yypos1369= G->pos, yythunkpos1369= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1369;
-  goto l1367;
-  l1369:;	  G->pos= yypos1369; G->thunkpos= yythunkpos1369;
-  }  if (!yy_Nonspacechar(G))  goto l1367;
-  goto l1366;
-  l1367:;	  G->pos= yypos1367; G->thunkpos= yythunkpos1367;
-  }  goto l1364;
-  l1365:;	  G->pos= yypos1364; G->thunkpos= yythunkpos1364;
-  {  int yypos1371= G->pos, yythunkpos1371= G->thunkpos;  if (!yy_Ticks1(G))  goto l1371;
-  goto l1370;
-  l1371:;	  G->pos= yypos1371; G->thunkpos= yythunkpos1371;
-  }  if (!yymatchChar(G, '`')) goto l1370;
-
-  l1372:;	
-  {  int yypos1373= G->pos, yythunkpos1373= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1373;
-  goto l1372;
-  l1373:;	  G->pos= yypos1373; G->thunkpos= yythunkpos1373;
-  }  goto l1364;
-  l1370:;	  G->pos= yypos1364; G->thunkpos= yythunkpos1364;
-  {  int yypos1374= G->pos, yythunkpos1374= G->thunkpos;  if (!yy_Sp(G))  goto l1374;
-  if (!yy_Ticks1(G))  goto l1374;
-  goto l1361;
-  l1374:;	  G->pos= yypos1374; G->thunkpos= yythunkpos1374;
-  }
-  {  int yypos1375= G->pos, yythunkpos1375= G->thunkpos;  if (!yy_Spacechar(G))  goto l1376;
-  goto l1375;
-  l1376:;	  G->pos= yypos1375; G->thunkpos= yythunkpos1375;  if (!yy_Newline(G))  goto l1361;
-
-  {  int yypos1377= G->pos, yythunkpos1377= G->thunkpos;  if (!yy_BlankLine(G))  goto l1377;
-  goto l1361;
-  l1377:;	  G->pos= yypos1377; G->thunkpos= yythunkpos1377;
-  }
-  }
-  l1375:;	
-  }
-  l1364:;	
-  l1362:;	
-  {  int yypos1363= G->pos, yythunkpos1363= G->thunkpos;
-  {  int yypos1378= G->pos, yythunkpos1378= G->thunkpos;
-  {  int yypos1382= G->pos, yythunkpos1382= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1382;
-  goto l1379;
-  l1382:;	  G->pos= yypos1382; G->thunkpos= yythunkpos1382;
-  }  if (!yy_Nonspacechar(G))  goto l1379;
-
-  l1380:;	
-  {  int yypos1381= G->pos, yythunkpos1381= G->thunkpos;
-  {  int yypos1383= G->pos, yythunkpos1383= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1383;
-  goto l1381;
-  l1383:;	  G->pos= yypos1383; G->thunkpos= yythunkpos1383;
-  }  if (!yy_Nonspacechar(G))  goto l1381;
-  goto l1380;
-  l1381:;	  G->pos= yypos1381; G->thunkpos= yythunkpos1381;
-  }  goto l1378;
-  l1379:;	  G->pos= yypos1378; G->thunkpos= yythunkpos1378;
-  {  int yypos1385= G->pos, yythunkpos1385= G->thunkpos;  if (!yy_Ticks1(G))  goto l1385;
-  goto l1384;
-  l1385:;	  G->pos= yypos1385; G->thunkpos= yythunkpos1385;
-  }  if (!yymatchChar(G, '`')) goto l1384;
-
-  l1386:;	
-  {  int yypos1387= G->pos, yythunkpos1387= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1387;
-  goto l1386;
-  l1387:;	  G->pos= yypos1387; G->thunkpos= yythunkpos1387;
-  }  goto l1378;
-  l1384:;	  G->pos= yypos1378; G->thunkpos= yythunkpos1378;
-  {  int yypos1388= G->pos, yythunkpos1388= G->thunkpos;  if (!yy_Sp(G))  goto l1388;
-  if (!yy_Ticks1(G))  goto l1388;
-  goto l1363;
-  l1388:;	  G->pos= yypos1388; G->thunkpos= yythunkpos1388;
-  }
-  {  int yypos1389= G->pos, yythunkpos1389= G->thunkpos;  if (!yy_Spacechar(G))  goto l1390;
-  goto l1389;
-  l1390:;	  G->pos= yypos1389; G->thunkpos= yythunkpos1389;  if (!yy_Newline(G))  goto l1363;
-
-  {  int yypos1391= G->pos, yythunkpos1391= G->thunkpos;  if (!yy_BlankLine(G))  goto l1391;
-  goto l1363;
-  l1391:;	  G->pos= yypos1391; G->thunkpos= yythunkpos1391;
-  }
-  }
-  l1389:;	
-  }
-  l1378:;	  goto l1362;
-  l1363:;	  G->pos= yypos1363; G->thunkpos= yythunkpos1363;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1361;  if (!yy_Sp(G))  goto l1361;
-  if (!yy_Ticks1(G))  goto l1361;
-  goto l1360;
-  l1361:;	  G->pos= yypos1360; G->thunkpos= yythunkpos1360;  if (!yy_Ticks2(G))  goto l1392;
-  if (!yy_Sp(G))  goto l1392;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1392;
-  {  int yypos1395= G->pos, yythunkpos1395= G->thunkpos;
-  {  int yypos1399= G->pos, yythunkpos1399= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1399;
-  goto l1396;
-  l1399:;	  G->pos= yypos1399; G->thunkpos= yythunkpos1399;
-  }  if (!yy_Nonspacechar(G))  goto l1396;
-
-  l1397:;	
-  {  int yypos1398= G->pos, yythunkpos1398= G->thunkpos;
-  {  int yypos1400= G->pos, yythunkpos1400= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1400;
-  goto l1398;
-  l1400:;	  G->pos= yypos1400; G->thunkpos= yythunkpos1400;
-  }  if (!yy_Nonspacechar(G))  goto l1398;
-  goto l1397;
-  l1398:;	  G->pos= yypos1398; G->thunkpos= yythunkpos1398;
-  }  goto l1395;
-  l1396:;	  G->pos= yypos1395; G->thunkpos= yythunkpos1395;
-  {  int yypos1402= G->pos, yythunkpos1402= G->thunkpos;  if (!yy_Ticks2(G))  goto l1402;
-  goto l1401;
-  l1402:;	  G->pos= yypos1402; G->thunkpos= yythunkpos1402;
-  }  if (!yymatchChar(G, '`')) goto l1401;
-
-  l1403:;	
-  {  int yypos1404= G->pos, yythunkpos1404= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1404;
-  goto l1403;
-  l1404:;	  G->pos= yypos1404; G->thunkpos= yythunkpos1404;
-  }  goto l1395;
-  l1401:;	  G->pos= yypos1395; G->thunkpos= yythunkpos1395;
-  {  int yypos1405= G->pos, yythunkpos1405= G->thunkpos;  if (!yy_Sp(G))  goto l1405;
-  if (!yy_Ticks2(G))  goto l1405;
-  goto l1392;
-  l1405:;	  G->pos= yypos1405; G->thunkpos= yythunkpos1405;
-  }
-  {  int yypos1406= G->pos, yythunkpos1406= G->thunkpos;  if (!yy_Spacechar(G))  goto l1407;
-  goto l1406;
-  l1407:;	  G->pos= yypos1406; G->thunkpos= yythunkpos1406;  if (!yy_Newline(G))  goto l1392;
-
-  {  int yypos1408= G->pos, yythunkpos1408= G->thunkpos;  if (!yy_BlankLine(G))  goto l1408;
-  goto l1392;
-  l1408:;	  G->pos= yypos1408; G->thunkpos= yythunkpos1408;
-  }
-  }
-  l1406:;	
-  }
-  l1395:;	
-  l1393:;	
-  {  int yypos1394= G->pos, yythunkpos1394= G->thunkpos;
-  {  int yypos1409= G->pos, yythunkpos1409= G->thunkpos;
-  {  int yypos1413= G->pos, yythunkpos1413= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1413;
-  goto l1410;
-  l1413:;	  G->pos= yypos1413; G->thunkpos= yythunkpos1413;
-  }  if (!yy_Nonspacechar(G))  goto l1410;
-
-  l1411:;	
-  {  int yypos1412= G->pos, yythunkpos1412= G->thunkpos;
-  {  int yypos1414= G->pos, yythunkpos1414= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1414;
-  goto l1412;
-  l1414:;	  G->pos= yypos1414; G->thunkpos= yythunkpos1414;
-  }  if (!yy_Nonspacechar(G))  goto l1412;
-  goto l1411;
-  l1412:;	  G->pos= yypos1412; G->thunkpos= yythunkpos1412;
-  }  goto l1409;
-  l1410:;	  G->pos= yypos1409; G->thunkpos= yythunkpos1409;
-  {  int yypos1416= G->pos, yythunkpos1416= G->thunkpos;  if (!yy_Ticks2(G))  goto l1416;
-  goto l1415;
-  l1416:;	  G->pos= yypos1416; G->thunkpos= yythunkpos1416;
-  }  if (!yymatchChar(G, '`')) goto l1415;
-
-  l1417:;	
-  {  int yypos1418= G->pos, yythunkpos1418= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1418;
-  goto l1417;
-  l1418:;	  G->pos= yypos1418; G->thunkpos= yythunkpos1418;
-  }  goto l1409;
-  l1415:;	  G->pos= yypos1409; G->thunkpos= yythunkpos1409;
-  {  int yypos1419= G->pos, yythunkpos1419= G->thunkpos;  if (!yy_Sp(G))  goto l1419;
-  if (!yy_Ticks2(G))  goto l1419;
-  goto l1394;
-  l1419:;	  G->pos= yypos1419; G->thunkpos= yythunkpos1419;
-  }
-  {  int yypos1420= G->pos, yythunkpos1420= G->thunkpos;  if (!yy_Spacechar(G))  goto l1421;
-  goto l1420;
-  l1421:;	  G->pos= yypos1420; G->thunkpos= yythunkpos1420;  if (!yy_Newline(G))  goto l1394;
-
-  {  int yypos1422= G->pos, yythunkpos1422= G->thunkpos;  if (!yy_BlankLine(G))  goto l1422;
-  goto l1394;
-  l1422:;	  G->pos= yypos1422; G->thunkpos= yythunkpos1422;
-  }
-  }
-  l1420:;	
-  }
-  l1409:;	  goto l1393;
-  l1394:;	  G->pos= yypos1394; G->thunkpos= yythunkpos1394;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1392;  if (!yy_Sp(G))  goto l1392;
-  if (!yy_Ticks2(G))  goto l1392;
-  goto l1360;
-  l1392:;	  G->pos= yypos1360; G->thunkpos= yythunkpos1360;  if (!yy_Ticks3(G))  goto l1423;
-  if (!yy_Sp(G))  goto l1423;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1423;
-  {  int yypos1426= G->pos, yythunkpos1426= G->thunkpos;
-  {  int yypos1430= G->pos, yythunkpos1430= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1430;
-  goto l1427;
-  l1430:;	  G->pos= yypos1430; G->thunkpos= yythunkpos1430;
-  }  if (!yy_Nonspacechar(G))  goto l1427;
-
-  l1428:;	
-  {  int yypos1429= G->pos, yythunkpos1429= G->thunkpos;
-  {  int yypos1431= G->pos, yythunkpos1431= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1431;
-  goto l1429;
-  l1431:;	  G->pos= yypos1431; G->thunkpos= yythunkpos1431;
-  }  if (!yy_Nonspacechar(G))  goto l1429;
-  goto l1428;
-  l1429:;	  G->pos= yypos1429; G->thunkpos= yythunkpos1429;
-  }  goto l1426;
-  l1427:;	  G->pos= yypos1426; G->thunkpos= yythunkpos1426;
-  {  int yypos1433= G->pos, yythunkpos1433= G->thunkpos;  if (!yy_Ticks3(G))  goto l1433;
-  goto l1432;
-  l1433:;	  G->pos= yypos1433; G->thunkpos= yythunkpos1433;
-  }  if (!yymatchChar(G, '`')) goto l1432;
-
-  l1434:;	
-  {  int yypos1435= G->pos, yythunkpos1435= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1435;
-  goto l1434;
-  l1435:;	  G->pos= yypos1435; G->thunkpos= yythunkpos1435;
-  }  goto l1426;
-  l1432:;	  G->pos= yypos1426; G->thunkpos= yythunkpos1426;
-  {  int yypos1436= G->pos, yythunkpos1436= G->thunkpos;  if (!yy_Sp(G))  goto l1436;
-  if (!yy_Ticks3(G))  goto l1436;
-  goto l1423;
-  l1436:;	  G->pos= yypos1436; G->thunkpos= yythunkpos1436;
-  }
-  {  int yypos1437= G->pos, yythunkpos1437= G->thunkpos;  if (!yy_Spacechar(G))  goto l1438;
-  goto l1437;
-  l1438:;	  G->pos= yypos1437; G->thunkpos= yythunkpos1437;  if (!yy_Newline(G))  goto l1423;
-
-  {  int yypos1439= G->pos, yythunkpos1439= G->thunkpos;  if (!yy_BlankLine(G))  goto l1439;
-  goto l1423;
-  l1439:;	  G->pos= yypos1439; G->thunkpos= yythunkpos1439;
-  }
-  }
-  l1437:;	
-  }
-  l1426:;	
-  l1424:;	
-  {  int yypos1425= G->pos, yythunkpos1425= G->thunkpos;
-  {  int yypos1440= G->pos, yythunkpos1440= G->thunkpos;
-  {  int yypos1444= G->pos, yythunkpos1444= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1444;
-  goto l1441;
-  l1444:;	  G->pos= yypos1444; G->thunkpos= yythunkpos1444;
-  }  if (!yy_Nonspacechar(G))  goto l1441;
-
-  l1442:;	
-  {  int yypos1443= G->pos, yythunkpos1443= G->thunkpos;
-  {  int yypos1445= G->pos, yythunkpos1445= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1445;
-  goto l1443;
-  l1445:;	  G->pos= yypos1445; G->thunkpos= yythunkpos1445;
-  }  if (!yy_Nonspacechar(G))  goto l1443;
-  goto l1442;
-  l1443:;	  G->pos= yypos1443; G->thunkpos= yythunkpos1443;
-  }  goto l1440;
-  l1441:;	  G->pos= yypos1440; G->thunkpos= yythunkpos1440;
-  {  int yypos1447= G->pos, yythunkpos1447= G->thunkpos;  if (!yy_Ticks3(G))  goto l1447;
-  goto l1446;
-  l1447:;	  G->pos= yypos1447; G->thunkpos= yythunkpos1447;
-  }  if (!yymatchChar(G, '`')) goto l1446;
-
-  l1448:;	
-  {  int yypos1449= G->pos, yythunkpos1449= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1449;
-  goto l1448;
-  l1449:;	  G->pos= yypos1449; G->thunkpos= yythunkpos1449;
-  }  goto l1440;
-  l1446:;	  G->pos= yypos1440; G->thunkpos= yythunkpos1440;
-  {  int yypos1450= G->pos, yythunkpos1450= G->thunkpos;  if (!yy_Sp(G))  goto l1450;
-  if (!yy_Ticks3(G))  goto l1450;
-  goto l1425;
-  l1450:;	  G->pos= yypos1450; G->thunkpos= yythunkpos1450;
-  }
-  {  int yypos1451= G->pos, yythunkpos1451= G->thunkpos;  if (!yy_Spacechar(G))  goto l1452;
-  goto l1451;
-  l1452:;	  G->pos= yypos1451; G->thunkpos= yythunkpos1451;  if (!yy_Newline(G))  goto l1425;
-
-  {  int yypos1453= G->pos, yythunkpos1453= G->thunkpos;  if (!yy_BlankLine(G))  goto l1453;
-  goto l1425;
-  l1453:;	  G->pos= yypos1453; G->thunkpos= yythunkpos1453;
-  }
-  }
-  l1451:;	
-  }
-  l1440:;	  goto l1424;
-  l1425:;	  G->pos= yypos1425; G->thunkpos= yythunkpos1425;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1423;  if (!yy_Sp(G))  goto l1423;
-  if (!yy_Ticks3(G))  goto l1423;
-  goto l1360;
-  l1423:;	  G->pos= yypos1360; G->thunkpos= yythunkpos1360;  if (!yy_Ticks4(G))  goto l1454;
-  if (!yy_Sp(G))  goto l1454;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1454;
-  {  int yypos1457= G->pos, yythunkpos1457= G->thunkpos;
-  {  int yypos1461= G->pos, yythunkpos1461= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1461;
-  goto l1458;
-  l1461:;	  G->pos= yypos1461; G->thunkpos= yythunkpos1461;
-  }  if (!yy_Nonspacechar(G))  goto l1458;
-
-  l1459:;	
-  {  int yypos1460= G->pos, yythunkpos1460= G->thunkpos;
-  {  int yypos1462= G->pos, yythunkpos1462= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1462;
-  goto l1460;
-  l1462:;	  G->pos= yypos1462; G->thunkpos= yythunkpos1462;
-  }  if (!yy_Nonspacechar(G))  goto l1460;
-  goto l1459;
-  l1460:;	  G->pos= yypos1460; G->thunkpos= yythunkpos1460;
-  }  goto l1457;
-  l1458:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;
-  {  int yypos1464= G->pos, yythunkpos1464= G->thunkpos;  if (!yy_Ticks4(G))  goto l1464;
-  goto l1463;
-  l1464:;	  G->pos= yypos1464; G->thunkpos= yythunkpos1464;
-  }  if (!yymatchChar(G, '`')) goto l1463;
-
-  l1465:;	
-  {  int yypos1466= G->pos, yythunkpos1466= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1466;
-  goto l1465;
-  l1466:;	  G->pos= yypos1466; G->thunkpos= yythunkpos1466;
-  }  goto l1457;
-  l1463:;	  G->pos= yypos1457; G->thunkpos= yythunkpos1457;
-  {  int yypos1467= G->pos, yythunkpos1467= G->thunkpos;  if (!yy_Sp(G))  goto l1467;
-  if (!yy_Ticks4(G))  goto l1467;
-  goto l1454;
-  l1467:;	  G->pos= yypos1467; G->thunkpos= yythunkpos1467;
-  }
-  {  int yypos1468= G->pos, yythunkpos1468= G->thunkpos;  if (!yy_Spacechar(G))  goto l1469;
-  goto l1468;
-  l1469:;	  G->pos= yypos1468; G->thunkpos= yythunkpos1468;  if (!yy_Newline(G))  goto l1454;
-
-  {  int yypos1470= G->pos, yythunkpos1470= G->thunkpos;  if (!yy_BlankLine(G))  goto l1470;
-  goto l1454;
-  l1470:;	  G->pos= yypos1470; G->thunkpos= yythunkpos1470;
-  }
-  }
-  l1468:;	
-  }
-  l1457:;	
-  l1455:;	
-  {  int yypos1456= G->pos, yythunkpos1456= G->thunkpos;
-  {  int yypos1471= G->pos, yythunkpos1471= G->thunkpos;
-  {  int yypos1475= G->pos, yythunkpos1475= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1475;
-  goto l1472;
-  l1475:;	  G->pos= yypos1475; G->thunkpos= yythunkpos1475;
-  }  if (!yy_Nonspacechar(G))  goto l1472;
-
-  l1473:;	
-  {  int yypos1474= G->pos, yythunkpos1474= G->thunkpos;
-  {  int yypos1476= G->pos, yythunkpos1476= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1476;
-  goto l1474;
-  l1476:;	  G->pos= yypos1476; G->thunkpos= yythunkpos1476;
-  }  if (!yy_Nonspacechar(G))  goto l1474;
-  goto l1473;
-  l1474:;	  G->pos= yypos1474; G->thunkpos= yythunkpos1474;
-  }  goto l1471;
-  l1472:;	  G->pos= yypos1471; G->thunkpos= yythunkpos1471;
-  {  int yypos1478= G->pos, yythunkpos1478= G->thunkpos;  if (!yy_Ticks4(G))  goto l1478;
-  goto l1477;
-  l1478:;	  G->pos= yypos1478; G->thunkpos= yythunkpos1478;
-  }  if (!yymatchChar(G, '`')) goto l1477;
-
-  l1479:;	
-  {  int yypos1480= G->pos, yythunkpos1480= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1480;
-  goto l1479;
-  l1480:;	  G->pos= yypos1480; G->thunkpos= yythunkpos1480;
-  }  goto l1471;
-  l1477:;	  G->pos= yypos1471; G->thunkpos= yythunkpos1471;
-  {  int yypos1481= G->pos, yythunkpos1481= G->thunkpos;  if (!yy_Sp(G))  goto l1481;
-  if (!yy_Ticks4(G))  goto l1481;
-  goto l1456;
-  l1481:;	  G->pos= yypos1481; G->thunkpos= yythunkpos1481;
-  }
-  {  int yypos1482= G->pos, yythunkpos1482= G->thunkpos;  if (!yy_Spacechar(G))  goto l1483;
-  goto l1482;
-  l1483:;	  G->pos= yypos1482; G->thunkpos= yythunkpos1482;  if (!yy_Newline(G))  goto l1456;
-
-  {  int yypos1484= G->pos, yythunkpos1484= G->thunkpos;  if (!yy_BlankLine(G))  goto l1484;
-  goto l1456;
-  l1484:;	  G->pos= yypos1484; G->thunkpos= yythunkpos1484;
-  }
-  }
-  l1482:;	
-  }
-  l1471:;	  goto l1455;
-  l1456:;	  G->pos= yypos1456; G->thunkpos= yythunkpos1456;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1454;  if (!yy_Sp(G))  goto l1454;
-  if (!yy_Ticks4(G))  goto l1454;
-  goto l1360;
-  l1454:;	  G->pos= yypos1360; G->thunkpos= yythunkpos1360;  if (!yy_Ticks5(G))  goto l1359;
-  if (!yy_Sp(G))  goto l1359;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1359;
-  {  int yypos1487= G->pos, yythunkpos1487= G->thunkpos;
-  {  int yypos1491= G->pos, yythunkpos1491= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1491;
-  goto l1488;
-  l1491:;	  G->pos= yypos1491; G->thunkpos= yythunkpos1491;
-  }  if (!yy_Nonspacechar(G))  goto l1488;
-
-  l1489:;	
-  {  int yypos1490= G->pos, yythunkpos1490= G->thunkpos;
-  {  int yypos1492= G->pos, yythunkpos1492= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1492;
-  goto l1490;
-  l1492:;	  G->pos= yypos1492; G->thunkpos= yythunkpos1492;
-  }  if (!yy_Nonspacechar(G))  goto l1490;
-  goto l1489;
-  l1490:;	  G->pos= yypos1490; G->thunkpos= yythunkpos1490;
-  }  goto l1487;
-  l1488:;	  G->pos= yypos1487; G->thunkpos= yythunkpos1487;
-  {  int yypos1494= G->pos, yythunkpos1494= G->thunkpos;  if (!yy_Ticks5(G))  goto l1494;
-  goto l1493;
-  l1494:;	  G->pos= yypos1494; G->thunkpos= yythunkpos1494;
-  }  if (!yymatchChar(G, '`')) goto l1493;
-
-  l1495:;	
-  {  int yypos1496= G->pos, yythunkpos1496= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1496;
-  goto l1495;
-  l1496:;	  G->pos= yypos1496; G->thunkpos= yythunkpos1496;
-  }  goto l1487;
-  l1493:;	  G->pos= yypos1487; G->thunkpos= yythunkpos1487;
-  {  int yypos1497= G->pos, yythunkpos1497= G->thunkpos;  if (!yy_Sp(G))  goto l1497;
-  if (!yy_Ticks5(G))  goto l1497;
-  goto l1359;
-  l1497:;	  G->pos= yypos1497; G->thunkpos= yythunkpos1497;
-  }
-  {  int yypos1498= G->pos, yythunkpos1498= G->thunkpos;  if (!yy_Spacechar(G))  goto l1499;
-  goto l1498;
-  l1499:;	  G->pos= yypos1498; G->thunkpos= yythunkpos1498;  if (!yy_Newline(G))  goto l1359;
-
-  {  int yypos1500= G->pos, yythunkpos1500= G->thunkpos;  if (!yy_BlankLine(G))  goto l1500;
-  goto l1359;
-  l1500:;	  G->pos= yypos1500; G->thunkpos= yythunkpos1500;
-  }
-  }
-  l1498:;	
-  }
-  l1487:;	
-  l1485:;	
-  {  int yypos1486= G->pos, yythunkpos1486= G->thunkpos;
-  {  int yypos1501= G->pos, yythunkpos1501= G->thunkpos;
-  {  int yypos1505= G->pos, yythunkpos1505= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1505;
-  goto l1502;
-  l1505:;	  G->pos= yypos1505; G->thunkpos= yythunkpos1505;
-  }  if (!yy_Nonspacechar(G))  goto l1502;
-
-  l1503:;	
-  {  int yypos1504= G->pos, yythunkpos1504= G->thunkpos;
-  {  int yypos1506= G->pos, yythunkpos1506= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1506;
-  goto l1504;
-  l1506:;	  G->pos= yypos1506; G->thunkpos= yythunkpos1506;
-  }  if (!yy_Nonspacechar(G))  goto l1504;
-  goto l1503;
-  l1504:;	  G->pos= yypos1504; G->thunkpos= yythunkpos1504;
-  }  goto l1501;
-  l1502:;	  G->pos= yypos1501; G->thunkpos= yythunkpos1501;
-  {  int yypos1508= G->pos, yythunkpos1508= G->thunkpos;  if (!yy_Ticks5(G))  goto l1508;
-  goto l1507;
-  l1508:;	  G->pos= yypos1508; G->thunkpos= yythunkpos1508;
-  }  if (!yymatchChar(G, '`')) goto l1507;
-
-  l1509:;	
-  {  int yypos1510= G->pos, yythunkpos1510= G->thunkpos;  if (!yymatchChar(G, '`')) goto l1510;
-  goto l1509;
-  l1510:;	  G->pos= yypos1510; G->thunkpos= yythunkpos1510;
-  }  goto l1501;
-  l1507:;	  G->pos= yypos1501; G->thunkpos= yythunkpos1501;
-  {  int yypos1511= G->pos, yythunkpos1511= G->thunkpos;  if (!yy_Sp(G))  goto l1511;
-  if (!yy_Ticks5(G))  goto l1511;
-  goto l1486;
-  l1511:;	  G->pos= yypos1511; G->thunkpos= yythunkpos1511;
-  }
-  {  int yypos1512= G->pos, yythunkpos1512= G->thunkpos;  if (!yy_Spacechar(G))  goto l1513;
-  goto l1512;
-  l1513:;	  G->pos= yypos1512; G->thunkpos= yythunkpos1512;  if (!yy_Newline(G))  goto l1486;
-
-  {  int yypos1514= G->pos, yythunkpos1514= G->thunkpos;  if (!yy_BlankLine(G))  goto l1514;
-  goto l1486;
-  l1514:;	  G->pos= yypos1514; G->thunkpos= yythunkpos1514;
-  }
-  }
-  l1512:;	
-  }
-  l1501:;	  goto l1485;
-  l1486:;	  G->pos= yypos1486; G->thunkpos= yythunkpos1486;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1359;  if (!yy_Sp(G))  goto l1359;
-  if (!yy_Ticks5(G))  goto l1359;
-
-  }
-  l1360:;	  yyDo(G, yy_1_Code, G->begin, G->end, "yy_1_Code");
-  yyprintf((stderr, "  ok   Code"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1359:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Code"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_NoteReference(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "NoteReference"));
-  yyText(G, G->begin, G->end);  if (!( ext(EXT_NOTES) )) goto l1515;  if (!yymatchString(G, "[^")) goto l1515;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1515;
-  {  int yypos1518= G->pos, yythunkpos1518= G->thunkpos;  if (!yy_Newline(G))  goto l1518;
-  goto l1515;
-  l1518:;	  G->pos= yypos1518; G->thunkpos= yythunkpos1518;
-  }
-  {  int yypos1519= G->pos, yythunkpos1519= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1519;
-  goto l1515;
-  l1519:;	  G->pos= yypos1519; G->thunkpos= yythunkpos1519;
-  }  if (!yymatchDot(G)) goto l1515;
-  l1516:;	
-  {  int yypos1517= G->pos, yythunkpos1517= G->thunkpos;
-  {  int yypos1520= G->pos, yythunkpos1520= G->thunkpos;  if (!yy_Newline(G))  goto l1520;
-  goto l1517;
-  l1520:;	  G->pos= yypos1520; G->thunkpos= yythunkpos1520;
-  }
-  {  int yypos1521= G->pos, yythunkpos1521= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1521;
-  goto l1517;
-  l1521:;	  G->pos= yypos1521; G->thunkpos= yythunkpos1521;
-  }  if (!yymatchDot(G)) goto l1517;  goto l1516;
-  l1517:;	  G->pos= yypos1517; G->thunkpos= yythunkpos1517;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1515;  if (!yymatchChar(G, ']')) goto l1515;
-  yyDo(G, yy_1_NoteReference, G->begin, G->end, "yy_1_NoteReference");
-  yyprintf((stderr, "  ok   NoteReference"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1515:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "NoteReference"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Link(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Link"));
-
-  {  int yypos1523= G->pos, yythunkpos1523= G->thunkpos;  if (!yy_ExplicitLink(G))  goto l1524;
-  goto l1523;
-  l1524:;	  G->pos= yypos1523; G->thunkpos= yythunkpos1523;  if (!yy_ReferenceLink(G))  goto l1525;
-  goto l1523;
-  l1525:;	  G->pos= yypos1523; G->thunkpos= yythunkpos1523;  if (!yy_AutoLink(G))  goto l1522;
-
-  }
-  l1523:;	  yyprintf((stderr, "  ok   Link"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1522:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Link"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Image(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Image"));
-  if (!yymatchChar(G, '!')) goto l1526;
-
-  {  int yypos1527= G->pos, yythunkpos1527= G->thunkpos;  if (!yy_AutoLink(G))  goto l1527;
-  goto l1526;
-  l1527:;	  G->pos= yypos1527; G->thunkpos= yythunkpos1527;
-  }  if (!yy_Link(G))  goto l1526;
-  yyDo(G, yy_1_Image, G->begin, G->end, "yy_1_Image");
-  yyprintf((stderr, "  ok   Image"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1526:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Image"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_CitationReference(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "CitationReference"));
-
-  {  int yypos1529= G->pos, yythunkpos1529= G->thunkpos;  if (!yy_CitationReferenceDouble(G))  goto l1530;
-  goto l1529;
-  l1530:;	  G->pos= yypos1529; G->thunkpos= yythunkpos1529;  if (!yy_CitationReferenceSingle(G))  goto l1528;
-
-  }
-  l1529:;	  yyprintf((stderr, "  ok   CitationReference"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1528:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "CitationReference"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Emph(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Emph"));
-
-  {  int yypos1532= G->pos, yythunkpos1532= G->thunkpos;  if (!yy_EmphStar(G))  goto l1533;
-  goto l1532;
-  l1533:;	  G->pos= yypos1532; G->thunkpos= yythunkpos1532;  if (!yy_EmphUl(G))  goto l1531;
-
-  }
-  l1532:;	  yyprintf((stderr, "  ok   Emph"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1531:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Emph"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Strong(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Strong"));
-
-  {  int yypos1535= G->pos, yythunkpos1535= G->thunkpos;  if (!yy_StrongStar(G))  goto l1536;
-  goto l1535;
-  l1536:;	  G->pos= yypos1535; G->thunkpos= yythunkpos1535;  if (!yy_StrongUl(G))  goto l1534;
-
-  }
-  l1535:;	  yyprintf((stderr, "  ok   Strong"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1534:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Strong"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Space(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Space"));
-  if (!yy_Spacechar(G))  goto l1537;
-
-  l1538:;	
-  {  int yypos1539= G->pos, yythunkpos1539= G->thunkpos;  if (!yy_Spacechar(G))  goto l1539;
-  goto l1538;
-  l1539:;	  G->pos= yypos1539; G->thunkpos= yythunkpos1539;
-  }  yyDo(G, yy_1_Space, G->begin, G->end, "yy_1_Space");
-  yyprintf((stderr, "  ok   Space"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1537:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Space"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_UlOrStarLine(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "UlOrStarLine"));
-
-  {  int yypos1541= G->pos, yythunkpos1541= G->thunkpos;  if (!yy_UlLine(G))  goto l1542;
-  goto l1541;
-  l1542:;	  G->pos= yypos1541; G->thunkpos= yythunkpos1541;  if (!yy_StarLine(G))  goto l1540;
-
-  }
-  l1541:;	  yyDo(G, yy_1_UlOrStarLine, G->begin, G->end, "yy_1_UlOrStarLine");
-  yyprintf((stderr, "  ok   UlOrStarLine"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1540:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "UlOrStarLine"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_MathSpan(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "MathSpan"));
-  if (!yymatchChar(G, '\\')) goto l1543;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1543;
-  {  int yypos1544= G->pos, yythunkpos1544= G->thunkpos;  if (!yymatchString(G, "\\[")) goto l1545;
-
-  l1546:;	
-  {  int yypos1547= G->pos, yythunkpos1547= G->thunkpos;
-  {  int yypos1548= G->pos, yythunkpos1548= G->thunkpos;  if (!yymatchString(G, "\\\\]")) goto l1548;
-  goto l1547;
-  l1548:;	  G->pos= yypos1548; G->thunkpos= yythunkpos1548;
-  }  if (!yymatchDot(G)) goto l1547;  goto l1546;
-  l1547:;	  G->pos= yypos1547; G->thunkpos= yythunkpos1547;
-  }  if (!yymatchString(G, "\\\\]")) goto l1545;
-  goto l1544;
-  l1545:;	  G->pos= yypos1544; G->thunkpos= yythunkpos1544;  if (!yymatchString(G, "\\(")) goto l1543;
-
-  l1549:;	
-  {  int yypos1550= G->pos, yythunkpos1550= G->thunkpos;
-  {  int yypos1551= G->pos, yythunkpos1551= G->thunkpos;  if (!yymatchString(G, "\\\\)")) goto l1551;
-  goto l1550;
-  l1551:;	  G->pos= yypos1551; G->thunkpos= yythunkpos1551;
-  }  if (!yymatchDot(G)) goto l1550;  goto l1549;
-  l1550:;	  G->pos= yypos1550; G->thunkpos= yythunkpos1550;
-  }  if (!yymatchString(G, "\\\\)")) goto l1543;
-
-  }
-  l1544:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1543;  yyDo(G, yy_1_MathSpan, G->begin, G->end, "yy_1_MathSpan");
-  yyprintf((stderr, "  ok   MathSpan"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1543:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "MathSpan"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Str(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "Str"));
-  if (!yy_StartList(G))  goto l1552;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1552;  if (!yy_NormalChar(G))  goto l1552;
-
-  l1553:;	
-  {  int yypos1554= G->pos, yythunkpos1554= G->thunkpos;  if (!yy_NormalChar(G))  goto l1554;
-  goto l1553;
-  l1554:;	  G->pos= yypos1554; G->thunkpos= yythunkpos1554;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1552;  yyDo(G, yy_1_Str, G->begin, G->end, "yy_1_Str");
-
-  l1555:;	
-  {  int yypos1556= G->pos, yythunkpos1556= G->thunkpos;  if (!yy_StrChunk(G))  goto l1556;
-  yyDo(G, yy_2_Str, G->begin, G->end, "yy_2_Str");
-  goto l1555;
-  l1556:;	  G->pos= yypos1556; G->thunkpos= yythunkpos1556;
-  }  yyDo(G, yy_3_Str, G->begin, G->end, "yy_3_Str");
-  yyprintf((stderr, "  ok   Str"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
-  return 1;
-  l1552:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Str"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_DollarMath(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "DollarMath"));
-
-  {  int yypos1558= G->pos, yythunkpos1558= G->thunkpos;  if (!yy_SingleDollarMath(G))  goto l1559;
-  goto l1558;
-  l1559:;	  G->pos= yypos1558; G->thunkpos= yythunkpos1558;  if (!yy_DoubleDollarMath(G))  goto l1557;
-
-  }
-  l1558:;	  yyprintf((stderr, "  ok   DollarMath"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1557:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DollarMath"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_CriticMarkup(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "CriticMarkup"));
-
-  {  int yypos1561= G->pos, yythunkpos1561= G->thunkpos;  if (!yy_CriticAddition(G))  goto l1562;
-  goto l1561;
-  l1562:;	  G->pos= yypos1561; G->thunkpos= yythunkpos1561;  if (!yy_CriticDeletion(G))  goto l1563;
-  goto l1561;
-  l1563:;	  G->pos= yypos1561; G->thunkpos= yythunkpos1561;  if (!yy_CriticSubstitution(G))  goto l1564;
-  goto l1561;
-  l1564:;	  G->pos= yypos1561; G->thunkpos= yythunkpos1561;  if (!yy_CriticHighlight(G))  goto l1565;
-  goto l1561;
-  l1565:;	  G->pos= yypos1561; G->thunkpos= yythunkpos1561;  if (!yy_CriticComment(G))  goto l1560;
-
-  }
-  l1561:;	  yyprintf((stderr, "  ok   CriticMarkup"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1560:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "CriticMarkup"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_voidEndline(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "voidEndline"));
-
-  {  int yypos1567= G->pos, yythunkpos1567= G->thunkpos;  if (!yymatchString(G, "  ")) goto l1568;
-  if (!yy_voidNormalEndline(G))  goto l1568;
-  goto l1567;
-  l1568:;	  G->pos= yypos1567; G->thunkpos= yythunkpos1567;  if (!yy_Sp(G))  goto l1569;
-  if (!yy_Newline(G))  goto l1569;
-  if (!yy_Eof(G))  goto l1569;
-  goto l1567;
-  l1569:;	  G->pos= yypos1567; G->thunkpos= yythunkpos1567;  if (!yy_voidNormalEndline(G))  goto l1566;
-
-  }
-  l1567:;	  yyprintf((stderr, "  ok   voidEndline"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1566:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "voidEndline"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Inlines(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "Inlines"));
-  if (!yy_StartList(G))  goto l1570;
-  yyDo(G, yySet, -2, 0, "yySet");
-
-  {  int yypos1573= G->pos, yythunkpos1573= G->thunkpos;
-  {  int yypos1575= G->pos, yythunkpos1575= G->thunkpos;  if (!yy_Endline(G))  goto l1575;
-  goto l1574;
-  l1575:;	  G->pos= yypos1575; G->thunkpos= yythunkpos1575;
-  }  if (!yy_Inline(G))  goto l1574;
-  yyDo(G, yy_1_Inlines, G->begin, G->end, "yy_1_Inlines");
-  goto l1573;
-  l1574:;	  G->pos= yypos1573; G->thunkpos= yythunkpos1573;  if (!yy_Endline(G))  goto l1570;
-  yyDo(G, yySet, -1, 0, "yySet");
-
-  {  int yypos1576= G->pos, yythunkpos1576= G->thunkpos;  if (!yy_Inline(G))  goto l1570;
-  G->pos= yypos1576; G->thunkpos= yythunkpos1576;
-  }  yyDo(G, yy_2_Inlines, G->begin, G->end, "yy_2_Inlines");
-
-  }
-  l1573:;	
-  l1571:;	
-  {  int yypos1572= G->pos, yythunkpos1572= G->thunkpos;
-  {  int yypos1577= G->pos, yythunkpos1577= G->thunkpos;
-  {  int yypos1579= G->pos, yythunkpos1579= G->thunkpos;  if (!yy_Endline(G))  goto l1579;
-  goto l1578;
-  l1579:;	  G->pos= yypos1579; G->thunkpos= yythunkpos1579;
-  }  if (!yy_Inline(G))  goto l1578;
-  yyDo(G, yy_1_Inlines, G->begin, G->end, "yy_1_Inlines");
-  goto l1577;
-  l1578:;	  G->pos= yypos1577; G->thunkpos= yythunkpos1577;  if (!yy_Endline(G))  goto l1572;
-  yyDo(G, yySet, -1, 0, "yySet");
-
-  {  int yypos1580= G->pos, yythunkpos1580= G->thunkpos;  if (!yy_Inline(G))  goto l1572;
-  G->pos= yypos1580; G->thunkpos= yythunkpos1580;
-  }  yyDo(G, yy_2_Inlines, G->begin, G->end, "yy_2_Inlines");
-
-  }
-  l1577:;	  goto l1571;
-  l1572:;	  G->pos= yypos1572; G->thunkpos= yythunkpos1572;
-  }
-  {  int yypos1581= G->pos, yythunkpos1581= G->thunkpos;  if (!yy_voidEndline(G))  goto l1581;
-  goto l1582;
-  l1581:;	  G->pos= yypos1581; G->thunkpos= yythunkpos1581;
-  }
-  l1582:;	  yyDo(G, yy_3_Inlines, G->begin, G->end, "yy_3_Inlines");
-  yyprintf((stderr, "  ok   Inlines"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
-  return 1;
-  l1570:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Inlines"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Entity(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Entity"));
-
-  {  int yypos1584= G->pos, yythunkpos1584= G->thunkpos;  if (!yy_HexEntity(G))  goto l1585;
-  goto l1584;
-  l1585:;	  G->pos= yypos1584; G->thunkpos= yythunkpos1584;  if (!yy_DecEntity(G))  goto l1586;
-  goto l1584;
-  l1586:;	  G->pos= yypos1584; G->thunkpos= yythunkpos1584;  if (!yy_CharEntity(G))  goto l1583;
-
-  }
-  l1584:;	  yyDo(G, yy_1_Entity, G->begin, G->end, "yy_1_Entity");
-  yyprintf((stderr, "  ok   Entity"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1583:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Entity"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_EscapedChar(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "EscapedChar"));
-  if (!yymatchChar(G, '\\')) goto l1587;
-
-  {  int yypos1588= G->pos, yythunkpos1588= G->thunkpos;  if (!yy_Newline(G))  goto l1588;
-  goto l1587;
-  l1588:;	  G->pos= yypos1588; G->thunkpos= yythunkpos1588;
-  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1587;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\236\157\000\120\000\000\000\270\001\000\000\070\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "-\\\\`|*_{}[\\]()#+.!$><'\"\"")) goto l1587;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1587;  yyDo(G, yy_1_EscapedChar, G->begin, G->end, "yy_1_EscapedChar");
-  yyprintf((stderr, "  ok   EscapedChar"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1587:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "EscapedChar"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Symbol(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Symbol"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1589;  if (!yy_SpecialChar(G))  goto l1589;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1589;  yyDo(G, yy_1_Symbol, G->begin, G->end, "yy_1_Symbol");
-  yyprintf((stderr, "  ok   Symbol"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1589:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Symbol"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_OptionallyIndentedLine(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "OptionallyIndentedLine"));
-
-  {  int yypos1591= G->pos, yythunkpos1591= G->thunkpos;  if (!yy_Indent(G))  goto l1591;
-  goto l1592;
-  l1591:;	  G->pos= yypos1591; G->thunkpos= yythunkpos1591;
-  }
-  l1592:;	  if (!yy_Line(G))  goto l1590;
-  yyprintf((stderr, "  ok   OptionallyIndentedLine"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1590:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "OptionallyIndentedLine"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_IndentedLine(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "IndentedLine"));
-  if (!yy_Indent(G))  goto l1593;
-  if (!yy_Line(G))  goto l1593;
-  yyprintf((stderr, "  ok   IndentedLine"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1593:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "IndentedLine"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Indent(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Indent"));
-
-  {  int yypos1595= G->pos, yythunkpos1595= G->thunkpos;  if (!yymatchChar(G, '\t')) goto l1596;
-  goto l1595;
-  l1596:;	  G->pos= yypos1595; G->thunkpos= yythunkpos1595;  if (!yymatchString(G, "    ")) goto l1594;
-
-  }
-  l1595:;	  yyprintf((stderr, "  ok   Indent"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1594:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Indent"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_NonindentSpace(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "NonindentSpace"));
-
-  {  int yypos1598= G->pos, yythunkpos1598= G->thunkpos;  if (!yymatchString(G, "   ")) goto l1599;
-  goto l1598;
-  l1599:;	  G->pos= yypos1598; G->thunkpos= yythunkpos1598;  if (!yymatchString(G, "  ")) goto l1600;
-  goto l1598;
-  l1600:;	  G->pos= yypos1598; G->thunkpos= yythunkpos1598;  if (!yymatchChar(G, ' ')) goto l1601;
-  goto l1598;
-  l1601:;	  G->pos= yypos1598; G->thunkpos= yythunkpos1598;  if (!yymatchString(G, "")) goto l1597;
-
-  }
-  l1598:;	  yyprintf((stderr, "  ok   NonindentSpace"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1597:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "NonindentSpace"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_CharEntity(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "CharEntity"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1602;  if (!yymatchChar(G, '&')) goto l1602;
-  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z0-9")) goto l1602;
-
-  l1603:;	
-  {  int yypos1604= G->pos, yythunkpos1604= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z0-9")) goto l1604;
-  goto l1603;
-  l1604:;	  G->pos= yypos1604; G->thunkpos= yythunkpos1604;
-  }  if (!yymatchChar(G, ';')) goto l1602;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1602;  yyprintf((stderr, "  ok   CharEntity"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1602:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "CharEntity"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_DecEntity(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "DecEntity"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1605;  if (!yymatchChar(G, '&')) goto l1605;
-  if (!yymatchChar(G, '#')) goto l1605;
-  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "0-9")) goto l1605;
-
-  l1606:;	
-  {  int yypos1607= G->pos, yythunkpos1607= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "0-9")) goto l1607;
-  goto l1606;
-  l1607:;	  G->pos= yypos1607; G->thunkpos= yythunkpos1607;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1605;  if (!yymatchChar(G, ';')) goto l1605;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1605;  yyprintf((stderr, "  ok   DecEntity"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1605:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DecEntity"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_HexEntity(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HexEntity"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1608;  if (!yymatchChar(G, '&')) goto l1608;
-  if (!yymatchChar(G, '#')) goto l1608;
-  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "Xx")) goto l1608;
-  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "0-9a-fA-F")) goto l1608;
-
-  l1609:;	
-  {  int yypos1610= G->pos, yythunkpos1610= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "0-9a-fA-F")) goto l1610;
-  goto l1609;
-  l1610:;	  G->pos= yypos1610; G->thunkpos= yythunkpos1610;
-  }  if (!yymatchChar(G, ';')) goto l1608;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1608;  yyprintf((stderr, "  ok   HexEntity"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1608:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HexEntity"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Digit(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Digit"));
-  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "0-9")) goto l1611;
-  yyprintf((stderr, "  ok   Digit"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-
-  return 1;
-  l1611:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Digit"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Alphanumeric(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Alphanumeric"));
+YY_RULE(int) yy_Alphanumeric(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Alphanumeric"));
 
   {  int yypos1613= G->pos, yythunkpos1613= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "0-9A-Za-z")) goto l1614;
   goto l1613;
@@ -11724,2455 +8452,4225 @@ YY_RULE(int) yy_Alphanumeric(GREG *G)
   l1741:;	  G->pos= yypos1613; G->thunkpos= yythunkpos1613;  if (!yymatchString(G, "\377")) goto l1612;
 
   }
-  l1613:;	  yyprintf((stderr, "  ok   Alphanumeric"));
+  l1613:;	  yyprintf((stderr, "  ok   Alphanumeric"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1612:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Alphanumeric"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+/* HtmlBlockOpen, HtmlBlockClose -- the open and close tags of a block-level
+	element, the name in lower or upper case:
+	'<' Spnl name Spnl HtmlAttribute* '>' and '<' Spnl '/' name Spnl '>' */
+YY_LOCAL(int) yyHtmlBlockOpen(GREG *G, const html_block_tag *tag)
+{  int yypos0= G->pos;
+  if (!yymatchChar(G, '<')) goto l2238;
+  if (!yy_Spnl(G))  goto l2238;
+
+  {  int yypos2239= G->pos;  if (!yymatchString(G, tag->lower)) goto l2240;
+  goto l2239;
+  l2240:;	  G->pos= yypos2239;  if (!yymatchString(G, tag->upper)) goto l2238;
+
+  }
+  l2239:;	  if (!yy_Spnl(G))  goto l2238;
+
+  l2241:;	
+  {  int yypos2242= G->pos;  if (!yy_HtmlAttribute(G))  goto l2242;
+  goto l2241;
+  l2242:;	  G->pos= yypos2242;
+  }  if (!yymatchChar(G, '>')) goto l2238;
+  return 1;
+  l2238:;	  G->pos= yypos0;
+  return 0;
+}
+YY_LOCAL(int) yyHtmlBlockClose(GREG *G, const html_block_tag *tag)
+{  int yypos0= G->pos;
+  if (!yymatchChar(G, '<')) goto l2243;
+  if (!yy_Spnl(G))  goto l2243;
+  if (!yymatchChar(G, '/')) goto l2243;
+
+  {  int yypos2244= G->pos;  if (!yymatchString(G, tag->lower)) goto l2245;
+  goto l2244;
+  l2245:;	  G->pos= yypos2244;  if (!yymatchString(G, tag->upper)) goto l2243;
+
+  }
+  l2244:;	  if (!yy_Spnl(G))  goto l2243;
+  if (!yymatchChar(G, '>')) goto l2243;
+  return 1;
+  l2243:;	  G->pos= yypos0;
+  return 0;
+}
+
+/* yyHtmlBlockBody -- everything after the open tag of a block-level element
+	(its '<' at buffer index open) up to and including the close tag that
+	balances it.  Open tags for the same name nest, except in a script.
+	Only a '<' can start either tag, so the scan goes from one '<' to the
+	next; every open tag passed on the way is matched with its close tag at
+	the same time, and the answers are kept for the rest of the parse. */
+YY_LOCAL(int) yyHtmlBlockBody(GREG *G, const html_block_tag *tag, int open)
+{
+  html_scan *scan= ((parser_data *)G->data)->blocks;
+  html_scan local= { NULL, 0, 0, NULL, 0 };
+  html_scan_entry *e;
+  int id= tag - html_block_tags;
+  int nests= (tag != HTML_TAG_SCRIPT);
+  int yypos0= G->pos, yyat= open;
+  size_t depth= 0;
+  char *lt;
+
+  if (scan == NULL)
+    scan= &local;
+
+  for (;;)
+    {
+      if (scan->capacity && ((e= yyHtmlScanEntry(scan, G->offset + yyat, id))->tag != -1))
+        {
+          /* matched before: skip the block, or give up if it never closes */
+          if (e->end == NO_SCAN_END)
+            goto unclosed;
+          yyByteAt(G, e->end - G->offset - 1);
+          G->pos= e->end - G->offset;
+          if (depth == 0)
+            return 1;
+        }
+      else
+        {
+          if (depth == scan->room)
+            {
+              scan->room= scan->room ? 2 * scan->room : 16;
+              scan->pending= (size_t *)realloc(scan->pending, sizeof(size_t) * scan->room);
+            }
+          scan->pending[depth++]= G->offset + yyat;
+        }
+
+      for (;;)
+        {
+          while (!(lt= (char *)memchr(G->buf + G->pos, '<', G->limit - G->pos)))
+            {
+              G->pos= G->limit;
+              if (!yyrefill(G))
+                goto unclosed;
+            }
+          G->pos= yyat= lt - G->buf;
+          if (nests && yyHtmlBlockOpen(G, tag))
+            break;
+          if (yyHtmlBlockClose(G, tag))
+            {
+              yyHtmlScanSet(scan, scan->pending[--depth], id, G->offset + G->pos);
+              if (depth == 0)
+                {
+                  if (scan == &local)
+                    free_html_scan(&local);
+                  return 1;
+                }
+            }
+          else
+            ++G->pos;
+        }
+    }
+
+  /* none of the blocks still open is ever closed */
+ unclosed:
+  while (depth > 0)
+    yyHtmlScanSet(scan, scan->pending[--depth], id, NO_SCAN_END);
+  if (scan == &local)
+    free_html_scan(&local);
+  G->pos= yypos0;
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockScript(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockScript"));
+  if (!yyHtmlBlockOpen(G, HTML_TAG_SCRIPT))  goto l1742;
+  if (!yyHtmlBlockBody(G, HTML_TAG_SCRIPT, yypos0))  goto l1742;
+  yyprintf((stderr, "  ok   HtmlBlockScript"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1742:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockScript"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_RawHtml(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RawHtml"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1746;
+  {  int yypos1747= G->pos, yythunkpos1747= G->thunkpos;  if (!yy_HtmlComment(G))  goto l1748;
+  goto l1747;
+  l1748:;	  G->pos= yypos1747; G->thunkpos= yythunkpos1747;  if (!yy_HtmlBlockScript(G))  goto l1749;
+  goto l1747;
+  l1749:;	  G->pos= yypos1747; G->thunkpos= yythunkpos1747;  if (!yy_HtmlTag(G))  goto l1746;
+
+  }
+  l1747:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1746;  yyDo(G, yy_1_RawHtml, G->begin, G->end, "yy_1_RawHtml");
+  yyprintf((stderr, "  ok   RawHtml"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1746:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RawHtml"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_HtmlTag(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlTag"));
+  if (!yymatchChar(G, '<')) goto l1750;
+  if (!yy_Spnl(G))  goto l1750;
+
+  {  int yypos1751= G->pos, yythunkpos1751= G->thunkpos;  if (!yymatchChar(G, '/')) goto l1751;
+  goto l1752;
+  l1751:;	  G->pos= yypos1751; G->thunkpos= yythunkpos1751;
+  }
+  l1752:;	  if (!yy_AlphanumericAscii(G))  goto l1750;
+
+  l1753:;	
+  {  int yypos1754= G->pos, yythunkpos1754= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1754;
+  goto l1753;
+  l1754:;	  G->pos= yypos1754; G->thunkpos= yythunkpos1754;
+  }  if (!yy_Spnl(G))  goto l1750;
+
+  l1755:;	
+  {  int yypos1756= G->pos, yythunkpos1756= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l1756;
+  goto l1755;
+  l1756:;	  G->pos= yypos1756; G->thunkpos= yythunkpos1756;
+  }
+  {  int yypos1757= G->pos, yythunkpos1757= G->thunkpos;  if (!yymatchChar(G, '/')) goto l1757;
+  goto l1758;
+  l1757:;	  G->pos= yypos1757; G->thunkpos= yythunkpos1757;
+  }
+  l1758:;	  if (!yy_Spnl(G))  goto l1750;
+  if (!yymatchChar(G, '>')) goto l1750;
+  yyprintf((stderr, "  ok   HtmlTag"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1750:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlTag"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+/* HtmlComment -- "<!--" (!"-->" .)* "-->", ended by yySpanEnd */
+YY_RULE(int) yy_HtmlComment(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  int yyend;  yyprintfv((stderr, "%s\n", "HtmlComment"));
+  if (!yymatchString(G, "<!--")) goto l1759;
+  if ((yyend= yySpanEnd(G, SPAN_COMMENT, G->pos)) < 0) goto l1759;
+  G->pos= yyend;
+  if (!yymatchString(G, "-->")) goto l1759;
+  yyprintf((stderr, "  ok   HtmlComment"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1759:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlComment"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_HtmlAttribute(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlAttribute"));
+
+  {  int yypos1766= G->pos, yythunkpos1766= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1767;
+  goto l1766;
+  l1767:;	  G->pos= yypos1766; G->thunkpos= yythunkpos1766;  if (!yymatchChar(G, '-')) goto l1763;
+
+  }
+  l1766:;	
+  l1764:;	
+  {  int yypos1765= G->pos, yythunkpos1765= G->thunkpos;
+  {  int yypos1768= G->pos, yythunkpos1768= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1769;
+  goto l1768;
+  l1769:;	  G->pos= yypos1768; G->thunkpos= yythunkpos1768;  if (!yymatchChar(G, '-')) goto l1765;
+
+  }
+  l1768:;	  goto l1764;
+  l1765:;	  G->pos= yypos1765; G->thunkpos= yythunkpos1765;
+  }  if (!yy_Spnl(G))  goto l1763;
+
+  {  int yypos1770= G->pos, yythunkpos1770= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1770;
+  if (!yy_Spnl(G))  goto l1770;
+
+  {  int yypos1772= G->pos, yythunkpos1772= G->thunkpos;  if (!yy_Quoted(G))  goto l1773;
+  goto l1772;
+  l1773:;	  G->pos= yypos1772; G->thunkpos= yythunkpos1772;
+  {  int yypos1776= G->pos, yythunkpos1776= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1776;
+  goto l1770;
+  l1776:;	  G->pos= yypos1776; G->thunkpos= yythunkpos1776;
+  }  if (!yy_Nonspacechar(G))  goto l1770;
+
+  l1774:;	
+  {  int yypos1775= G->pos, yythunkpos1775= G->thunkpos;
+  {  int yypos1777= G->pos, yythunkpos1777= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1777;
+  goto l1775;
+  l1777:;	  G->pos= yypos1777; G->thunkpos= yythunkpos1777;
+  }  if (!yy_Nonspacechar(G))  goto l1775;
+  goto l1774;
+  l1775:;	  G->pos= yypos1775; G->thunkpos= yythunkpos1775;
+  }
+  }
+  l1772:;	  goto l1771;
+  l1770:;	  G->pos= yypos1770; G->thunkpos= yythunkpos1770;
+  }
+  l1771:;	  if (!yy_Spnl(G))  goto l1763;
+  yyprintf((stderr, "  ok   HtmlAttribute"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1763:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlAttribute"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_Quoted(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Quoted"));
+
+  {  int yypos1779= G->pos, yythunkpos1779= G->thunkpos;  if (!yymatchChar(G, '"')) goto l1780;
+
+  l1781:;	
+  {  int yypos1782= G->pos, yythunkpos1782= G->thunkpos;
+  {  int yypos1783= G->pos, yythunkpos1783= G->thunkpos;  if (!yymatchChar(G, '"')) goto l1783;
+  goto l1782;
+  l1783:;	  G->pos= yypos1783; G->thunkpos= yythunkpos1783;
+  }  if (!yymatchDot(G)) goto l1782;  goto l1781;
+  l1782:;	  G->pos= yypos1782; G->thunkpos= yythunkpos1782;
+  }  if (!yymatchChar(G, '"')) goto l1780;
+  goto l1779;
+  l1780:;	  G->pos= yypos1779; G->thunkpos= yythunkpos1779;  if (!yymatchChar(G, '\'')) goto l1778;
+
+  l1784:;	
+  {  int yypos1785= G->pos, yythunkpos1785= G->thunkpos;
+  {  int yypos1786= G->pos, yythunkpos1786= G->thunkpos;  if (!yymatchChar(G, '\'')) goto l1786;
+  goto l1785;
+  l1786:;	  G->pos= yypos1786; G->thunkpos= yythunkpos1786;
+  }  if (!yymatchDot(G)) goto l1785;  goto l1784;
+  l1785:;	  G->pos= yypos1785; G->thunkpos= yythunkpos1785;
+  }  if (!yymatchChar(G, '\'')) goto l1778;
+
+  }
+  l1779:;	  yyprintf((stderr, "  ok   Quoted"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1778:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Quoted"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_ExtendedSpecialChar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "ExtendedSpecialChar"));
+
+  {  int yypos1788= G->pos, yythunkpos1788= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( ext(EXT_SMART) )) goto l1789;
+  {  int yypos1790= G->pos, yythunkpos1790= G->thunkpos;  if (!yymatchChar(G, '.')) goto l1791;
+  goto l1790;
+  l1791:;	  G->pos= yypos1790; G->thunkpos= yythunkpos1790;  if (!yymatchChar(G, '-')) goto l1792;
+  goto l1790;
+  l1792:;	  G->pos= yypos1790; G->thunkpos= yythunkpos1790;  if (!yymatchChar(G, '\'')) goto l1793;
+  goto l1790;
+  l1793:;	  G->pos= yypos1790; G->thunkpos= yythunkpos1790;  if (!yymatchChar(G, '"')) goto l1789;
+
+  }
+  l1790:;	  goto l1788;
+  l1789:;	  G->pos= yypos1788; G->thunkpos= yythunkpos1788;  yyText(G, G->begin, G->end);  if (!( ext(EXT_NOTES) )) goto l1794;  if (!yymatchChar(G, '^')) goto l1794;
+  goto l1788;
+  l1794:;	  G->pos= yypos1788; G->thunkpos= yythunkpos1788;  yyText(G, G->begin, G->end);  if (!( ext(EXT_CRITIC) )) goto l1787;  if (!yymatchChar(G, '{')) goto l1787;
+
+  }
+  l1788:;	  yyprintf((stderr, "  ok   ExtendedSpecialChar"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1787:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ExtendedSpecialChar"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_SpecialChar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SpecialChar"));
+
+  {  int yypos1796= G->pos, yythunkpos1796= G->thunkpos;  if (!yymatchChar(G, '*')) goto l1797;
+  goto l1796;
+  l1797:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '_')) goto l1798;
+  goto l1796;
+  l1798:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '`')) goto l1799;
+  goto l1796;
+  l1799:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '&')) goto l1800;
+  goto l1796;
+  l1800:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '[')) goto l1801;
+  goto l1796;
+  l1801:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, ']')) goto l1802;
+  goto l1796;
+  l1802:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '(')) goto l1803;
+  goto l1796;
+  l1803:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, ')')) goto l1804;
+  goto l1796;
+  l1804:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '<')) goto l1805;
+  goto l1796;
+  l1805:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '!')) goto l1806;
+  goto l1796;
+  l1806:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '#')) goto l1807;
+  goto l1796;
+  l1807:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '\\')) goto l1808;
+  goto l1796;
+  l1808:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '\'')) goto l1809;
+  goto l1796;
+  l1809:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '"')) goto l1810;
+  goto l1796;
+  l1810:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yy_ExtendedSpecialChar(G))  goto l1795;
+
+  }
+  l1796:;	  yyprintf((stderr, "  ok   SpecialChar"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1795:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SpecialChar"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_NormalChar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "NormalChar"));
+
+  {  int yypos1812= G->pos, yythunkpos1812= G->thunkpos;
+  {  int yypos1813= G->pos, yythunkpos1813= G->thunkpos;  if (!yy_SpecialChar(G))  goto l1814;
+  goto l1813;
+  l1814:;	  G->pos= yypos1813; G->thunkpos= yythunkpos1813;  if (!yy_Spacechar(G))  goto l1815;
+  goto l1813;
+  l1815:;	  G->pos= yypos1813; G->thunkpos= yythunkpos1813;  if (!yy_Newline(G))  goto l1812;
+
+  }
+  l1813:;	  goto l1811;
+  l1812:;	  G->pos= yypos1812; G->thunkpos= yythunkpos1812;
+  }  if (!yymatchDot(G)) goto l1811;  yyprintf((stderr, "  ok   NormalChar"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1811:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "NormalChar"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_Nonspacechar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Nonspacechar"));
+
+  {  int yypos1817= G->pos, yythunkpos1817= G->thunkpos;  if (!yy_Spacechar(G))  goto l1817;
+  goto l1816;
+  l1817:;	  G->pos= yypos1817; G->thunkpos= yythunkpos1817;
+  }
+  {  int yypos1818= G->pos, yythunkpos1818= G->thunkpos;  if (!yy_Newline(G))  goto l1818;
+  goto l1816;
+  l1818:;	  G->pos= yypos1818; G->thunkpos= yythunkpos1818;
+  }  if (!yymatchDot(G)) goto l1816;  yyprintf((stderr, "  ok   Nonspacechar"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1816:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Nonspacechar"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_Spnl(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Spnl"));
+  if (!yy_Sp(G))  goto l1819;
+
+  {  int yypos1820= G->pos, yythunkpos1820= G->thunkpos;  if (!yy_Newline(G))  goto l1820;
+  if (!yy_Sp(G))  goto l1820;
+  goto l1821;
+  l1820:;	  G->pos= yypos1820; G->thunkpos= yythunkpos1820;
+  }
+  l1821:;	  yyprintf((stderr, "  ok   Spnl"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1819:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Spnl"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_Spacechar(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Spacechar"));
+
+  {  int yypos1823= G->pos, yythunkpos1823= G->thunkpos;  if (!yymatchChar(G, ' ')) goto l1824;
+  goto l1823;
+  l1824:;	  G->pos= yypos1823; G->thunkpos= yythunkpos1823;  if (!yymatchChar(G, '\t')) goto l1822;
+
+  }
+  l1823:;	  yyprintf((stderr, "  ok   Spacechar"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1822:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Spacechar"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_Eof(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Eof"));
+
+  {  int yypos1826= G->pos, yythunkpos1826= G->thunkpos;  if (!yymatchDot(G)) goto l1826;  goto l1825;
+  l1826:;	  G->pos= yypos1826; G->thunkpos= yythunkpos1826;
+  }  yyprintf((stderr, "  ok   Eof"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1825:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Eof"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_Line(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Line"));
+  if (!yy_RawLine(G))  goto l1827;
+  yyDo(G, yy_1_Line, G->begin, G->end, "yy_1_Line");
+  yyprintf((stderr, "  ok   Line"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1827:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Line"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_BlockQuoteMarker(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "BlockQuoteMarker"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1828;  if (!yymatchChar(G, '>')) goto l1828;
+
+  {  int yypos1829= G->pos, yythunkpos1829= G->thunkpos;  if (!yymatchChar(G, ' ')) goto l1829;
+  goto l1830;
+  l1829:;	  G->pos= yypos1829; G->thunkpos= yythunkpos1829;
+  }
+  l1830:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1828;  yyDo(G, yy_1_BlockQuoteMarker, G->begin, G->end, "yy_1_BlockQuoteMarker");
+  yyprintf((stderr, "  ok   BlockQuoteMarker"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1828:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "BlockQuoteMarker"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_BlockQuoteRaw(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "BlockQuoteRaw"));
+  if (!yy_StartList(G))  goto l1831;
+  yyDo(G, yySet, -2, 0, "yySet");
+  if (!yy_BlockQuoteMarker(G))  goto l1831;
+  yyDo(G, yySet, -1, 0, "yySet");
+  if (!yy_Line(G))  goto l1831;
+  yyDo(G, yy_1_BlockQuoteRaw, G->begin, G->end, "yy_1_BlockQuoteRaw");
+
+  l1834:;	
+  {  int yypos1835= G->pos, yythunkpos1835= G->thunkpos;
+  {  int yypos1836= G->pos, yythunkpos1836= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1836;
+  goto l1835;
+  l1836:;	  G->pos= yypos1836; G->thunkpos= yythunkpos1836;
+  }
+  {  int yypos1837= G->pos, yythunkpos1837= G->thunkpos;  if (!yy_BlankLine(G))  goto l1837;
+  goto l1835;
+  l1837:;	  G->pos= yypos1837; G->thunkpos= yythunkpos1837;
+  }  if (!yy_Line(G))  goto l1835;
+  yyDo(G, yy_2_BlockQuoteRaw, G->begin, G->end, "yy_2_BlockQuoteRaw");
+  goto l1834;
+  l1835:;	  G->pos= yypos1835; G->thunkpos= yythunkpos1835;
+  }
+  l1838:;	
+  {  int yypos1839= G->pos, yythunkpos1839= G->thunkpos;  if (!yy_BlankLine(G))  goto l1839;
+  yyDo(G, yy_3_BlockQuoteRaw, G->begin, G->end, "yy_3_BlockQuoteRaw");
+  goto l1838;
+  l1839:;	  G->pos= yypos1839; G->thunkpos= yythunkpos1839;
+  }
+  l1832:;	
+  {  int yypos1833= G->pos, yythunkpos1833= G->thunkpos;  if (!yy_BlockQuoteMarker(G))  goto l1833;
+  yyDo(G, yySet, -1, 0, "yySet");
+  if (!yy_Line(G))  goto l1833;
+  yyDo(G, yy_1_BlockQuoteRaw, G->begin, G->end, "yy_1_BlockQuoteRaw");
+
+  l1840:;	
+  {  int yypos1841= G->pos, yythunkpos1841= G->thunkpos;
+  {  int yypos1842= G->pos, yythunkpos1842= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1842;
+  goto l1841;
+  l1842:;	  G->pos= yypos1842; G->thunkpos= yythunkpos1842;
+  }
+  {  int yypos1843= G->pos, yythunkpos1843= G->thunkpos;  if (!yy_BlankLine(G))  goto l1843;
+  goto l1841;
+  l1843:;	  G->pos= yypos1843; G->thunkpos= yythunkpos1843;
+  }  if (!yy_Line(G))  goto l1841;
+  yyDo(G, yy_2_BlockQuoteRaw, G->begin, G->end, "yy_2_BlockQuoteRaw");
+  goto l1840;
+  l1841:;	  G->pos= yypos1841; G->thunkpos= yythunkpos1841;
+  }
+  l1844:;	
+  {  int yypos1845= G->pos, yythunkpos1845= G->thunkpos;  if (!yy_BlankLine(G))  goto l1845;
+  yyDo(G, yy_3_BlockQuoteRaw, G->begin, G->end, "yy_3_BlockQuoteRaw");
+  goto l1844;
+  l1845:;	  G->pos= yypos1845; G->thunkpos= yythunkpos1845;
+  }  goto l1832;
+  l1833:;	  G->pos= yypos1833; G->thunkpos= yythunkpos1833;
+  }  yyDo(G, yy_4_BlockQuoteRaw, G->begin, G->end, "yy_4_BlockQuoteRaw");
+  yyprintf((stderr, "  ok   BlockQuoteRaw"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+  yyDo(G, yyPop, 2, 0, "yyPop");
+  return 1;
+  l1831:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "BlockQuoteRaw"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_Endline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Endline"));
+
+  {  int yypos1847= G->pos, yythunkpos1847= G->thunkpos;  if (!yy_LineBreak(G))  goto l1848;
+  goto l1847;
+  l1848:;	  G->pos= yypos1847; G->thunkpos= yythunkpos1847;  if (!yy_TerminalEndline(G))  goto l1849;
+  goto l1847;
+  l1849:;	  G->pos= yypos1847; G->thunkpos= yythunkpos1847;  if (!yy_NormalEndline(G))  goto l1846;
+
+  }
+  l1847:;	  yyprintf((stderr, "  ok   Endline"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1846:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Endline"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_SetextBottom2(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SetextBottom2"));
+  if (!yymatchChar(G, '-')) goto l1850;
+
+  l1851:;	
+  {  int yypos1852= G->pos, yythunkpos1852= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1852;
+  goto l1851;
+  l1852:;	  G->pos= yypos1852; G->thunkpos= yythunkpos1852;
+  }  if (!yy_Newline(G))  goto l1850;
+  yyprintf((stderr, "  ok   SetextBottom2"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1850:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SetextBottom2"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_SetextBottom1(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SetextBottom1"));
+  if (!yymatchChar(G, '=')) goto l1853;
+
+  l1854:;	
+  {  int yypos1855= G->pos, yythunkpos1855= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1855;
+  goto l1854;
+  l1855:;	  G->pos= yypos1855; G->thunkpos= yythunkpos1855;
+  }  if (!yy_Newline(G))  goto l1853;
+  yyprintf((stderr, "  ok   SetextBottom1"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
+
+  return 1;
+  l1853:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SetextBottom1"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_SetextHeading2(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "SetextHeading2"));
+
+  {  int yypos1857= G->pos, yythunkpos1857= G->thunkpos;  if (!yy_RawLine(G))  goto l1856;
+  if (!yy_SetextBottom2(G))  goto l1856;
+  G->pos= yypos1857; G->thunkpos= yythunkpos1857;
+  }  if (!yy_StartList(G))  goto l1856;
+  yyDo(G, yySet, -2, 0, "yySet");
+
+  {  int yypos1860= G->pos, yythunkpos1860= G->thunkpos;  if (!yy_Endline(G))  goto l1860;
+  goto l1856;
+  l1860:;	  G->pos= yypos1860; G->thunkpos= yythunkpos1860;
+  }
+  {  int yypos1861= G->pos, yythunkpos1861= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1861;  if (!yy_Sp(G))  goto l1861;
+  if (!yy_AutoLabel(G))  goto l1861;
+  goto l1856;
+  l1861:;	  G->pos= yypos1861; G->thunkpos= yythunkpos1861;
+  }  if (!yy_Inline(G))  goto l1856;
+  yyDo(G, yy_1_SetextHeading2, G->begin, G->end, "yy_1_SetextHeading2");
+
+  l1858:;	
+  {  int yypos1859= G->pos, yythunkpos1859= G->thunkpos;
+  {  int yypos1862= G->pos, yythunkpos1862= G->thunkpos;  if (!yy_Endline(G))  goto l1862;
+  goto l1859;
+  l1862:;	  G->pos= yypos1862; G->thunkpos= yythunkpos1862;
+  }
+  {  int yypos1863= G->pos, yythunkpos1863= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1863;  if (!yy_Sp(G))  goto l1863;
+  if (!yy_AutoLabel(G))  goto l1863;
+  goto l1859;
+  l1863:;	  G->pos= yypos1863; G->thunkpos= yythunkpos1863;
+  }  if (!yy_Inline(G))  goto l1859;
+  yyDo(G, yy_1_SetextHeading2, G->begin, G->end, "yy_1_SetextHeading2");
+  goto l1858;
+  l1859:;	  G->pos= yypos1859; G->thunkpos= yythunkpos1859;
+  }
+  {  int yypos1864= G->pos, yythunkpos1864= G->thunkpos;  if (!yy_Sp(G))  goto l1864;
+  if (!yy_AutoLabel(G))  goto l1864;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_2_SetextHeading2, G->begin, G->end, "yy_2_SetextHeading2");
+
+  {  int yypos1866= G->pos, yythunkpos1866= G->thunkpos;  if (!yy_Sp(G))  goto l1866;
+  goto l1867;
+  l1866:;	  G->pos= yypos1866; G->thunkpos= yythunkpos1866;
+  }
+  l1867:;	  goto l1865;
+  l1864:;	  G->pos= yypos1864; G->thunkpos= yythunkpos1864;
+  }
+  l1865:;	
+  {  int yypos1868= G->pos, yythunkpos1868= G->thunkpos;  if (!yy_Sp(G))  goto l1868;
+  goto l1869;
+  l1868:;	  G->pos= yypos1868; G->thunkpos= yythunkpos1868;
+  }
+  l1869:;	  if (!yy_Newline(G))  goto l1856;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1856;  if (!yy_SetextBottom2(G))  goto l1856;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1856;  yyDo(G, yy_3_SetextHeading2, G->begin, G->end, "yy_3_SetextHeading2");
+  yyprintf((stderr, "  ok   SetextHeading2"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l1612:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Alphanumeric"));
+  l1856:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SetextHeading2"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockScript(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockScript"));
-  if (!yy_HtmlBlockOpenScript(G))  goto l1742;
-
-  l1743:;	
-  {  int yypos1744= G->pos, yythunkpos1744= G->thunkpos;
-  {  int yypos1745= G->pos, yythunkpos1745= G->thunkpos;  if (!yy_HtmlBlockCloseScript(G))  goto l1745;
-  goto l1744;
-  l1745:;	  G->pos= yypos1745; G->thunkpos= yythunkpos1745;
-  }  if (!yymatchDot(G)) goto l1744;  goto l1743;
-  l1744:;	  G->pos= yypos1744; G->thunkpos= yythunkpos1744;
-  }  if (!yy_HtmlBlockCloseScript(G))  goto l1742;
-  yyprintf((stderr, "  ok   HtmlBlockScript"));
+YY_RULE(int) yy_SetextHeading1(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "SetextHeading1"));
+
+  {  int yypos1871= G->pos, yythunkpos1871= G->thunkpos;  if (!yy_RawLine(G))  goto l1870;
+  if (!yy_SetextBottom1(G))  goto l1870;
+  G->pos= yypos1871; G->thunkpos= yythunkpos1871;
+  }  if (!yy_StartList(G))  goto l1870;
+  yyDo(G, yySet, -2, 0, "yySet");
+
+  {  int yypos1874= G->pos, yythunkpos1874= G->thunkpos;  if (!yy_Endline(G))  goto l1874;
+  goto l1870;
+  l1874:;	  G->pos= yypos1874; G->thunkpos= yythunkpos1874;
+  }
+  {  int yypos1875= G->pos, yythunkpos1875= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1875;  if (!yy_Sp(G))  goto l1875;
+  if (!yy_AutoLabel(G))  goto l1875;
+  goto l1870;
+  l1875:;	  G->pos= yypos1875; G->thunkpos= yythunkpos1875;
+  }  if (!yy_Inline(G))  goto l1870;
+  yyDo(G, yy_1_SetextHeading1, G->begin, G->end, "yy_1_SetextHeading1");
+
+  l1872:;	
+  {  int yypos1873= G->pos, yythunkpos1873= G->thunkpos;
+  {  int yypos1876= G->pos, yythunkpos1876= G->thunkpos;  if (!yy_Endline(G))  goto l1876;
+  goto l1873;
+  l1876:;	  G->pos= yypos1876; G->thunkpos= yythunkpos1876;
+  }
+  {  int yypos1877= G->pos, yythunkpos1877= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1877;  if (!yy_Sp(G))  goto l1877;
+  if (!yy_AutoLabel(G))  goto l1877;
+  goto l1873;
+  l1877:;	  G->pos= yypos1877; G->thunkpos= yythunkpos1877;
+  }  if (!yy_Inline(G))  goto l1873;
+  yyDo(G, yy_1_SetextHeading1, G->begin, G->end, "yy_1_SetextHeading1");
+  goto l1872;
+  l1873:;	  G->pos= yypos1873; G->thunkpos= yythunkpos1873;
+  }
+  {  int yypos1878= G->pos, yythunkpos1878= G->thunkpos;  if (!yy_Sp(G))  goto l1878;
+  if (!yy_AutoLabel(G))  goto l1878;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_2_SetextHeading1, G->begin, G->end, "yy_2_SetextHeading1");
+
+  {  int yypos1880= G->pos, yythunkpos1880= G->thunkpos;  if (!yy_Sp(G))  goto l1880;
+  goto l1881;
+  l1880:;	  G->pos= yypos1880; G->thunkpos= yythunkpos1880;
+  }
+  l1881:;	  goto l1879;
+  l1878:;	  G->pos= yypos1878; G->thunkpos= yythunkpos1878;
+  }
+  l1879:;	
+  {  int yypos1882= G->pos, yythunkpos1882= G->thunkpos;  if (!yy_Sp(G))  goto l1882;
+  goto l1883;
+  l1882:;	  G->pos= yypos1882; G->thunkpos= yythunkpos1882;
+  }
+  l1883:;	  if (!yy_Newline(G))  goto l1870;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1870;  if (!yy_SetextBottom1(G))  goto l1870;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1870;  yyDo(G, yy_3_SetextHeading1, G->begin, G->end, "yy_3_SetextHeading1");
+  yyprintf((stderr, "  ok   SetextHeading1"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l1742:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockScript"));
+  l1870:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SetextHeading1"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_RawHtml(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RawHtml"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1746;
-  {  int yypos1747= G->pos, yythunkpos1747= G->thunkpos;  if (!yy_HtmlComment(G))  goto l1748;
-  goto l1747;
-  l1748:;	  G->pos= yypos1747; G->thunkpos= yythunkpos1747;  if (!yy_HtmlBlockScript(G))  goto l1749;
-  goto l1747;
-  l1749:;	  G->pos= yypos1747; G->thunkpos= yythunkpos1747;  if (!yy_HtmlTag(G))  goto l1746;
+YY_RULE(int) yy_AtxStart(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AtxStart"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1884;
+  {  int yypos1885= G->pos, yythunkpos1885= G->thunkpos;  if (!yymatchString(G, "######")) goto l1886;
+  goto l1885;
+  l1886:;	  G->pos= yypos1885; G->thunkpos= yythunkpos1885;  if (!yymatchString(G, "#####")) goto l1887;
+  goto l1885;
+  l1887:;	  G->pos= yypos1885; G->thunkpos= yythunkpos1885;  if (!yymatchString(G, "####")) goto l1888;
+  goto l1885;
+  l1888:;	  G->pos= yypos1885; G->thunkpos= yythunkpos1885;  if (!yymatchString(G, "###")) goto l1889;
+  goto l1885;
+  l1889:;	  G->pos= yypos1885; G->thunkpos= yythunkpos1885;  if (!yymatchString(G, "##")) goto l1890;
+  goto l1885;
+  l1890:;	  G->pos= yypos1885; G->thunkpos= yythunkpos1885;  if (!yymatchChar(G, '#')) goto l1884;
 
   }
-  l1747:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1746;  yyDo(G, yy_1_RawHtml, G->begin, G->end, "yy_1_RawHtml");
-  yyprintf((stderr, "  ok   RawHtml"));
+  l1885:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1884;  yyDo(G, yy_1_AtxStart, G->begin, G->end, "yy_1_AtxStart");
+  yyprintf((stderr, "  ok   AtxStart"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1746:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RawHtml"));
+  l1884:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AtxStart"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlTag(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlTag"));
-  if (!yymatchChar(G, '<')) goto l1750;
-  if (!yy_Spnl(G))  goto l1750;
-
-  {  int yypos1751= G->pos, yythunkpos1751= G->thunkpos;  if (!yymatchChar(G, '/')) goto l1751;
-  goto l1752;
-  l1751:;	  G->pos= yypos1751; G->thunkpos= yythunkpos1751;
-  }
-  l1752:;	  if (!yy_AlphanumericAscii(G))  goto l1750;
-
-  l1753:;	
-  {  int yypos1754= G->pos, yythunkpos1754= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1754;
-  goto l1753;
-  l1754:;	  G->pos= yypos1754; G->thunkpos= yythunkpos1754;
-  }  if (!yy_Spnl(G))  goto l1750;
-
-  l1755:;	
-  {  int yypos1756= G->pos, yythunkpos1756= G->thunkpos;  if (!yy_HtmlAttribute(G))  goto l1756;
-  goto l1755;
-  l1756:;	  G->pos= yypos1756; G->thunkpos= yythunkpos1756;
-  }
-  {  int yypos1757= G->pos, yythunkpos1757= G->thunkpos;  if (!yymatchChar(G, '/')) goto l1757;
-  goto l1758;
-  l1757:;	  G->pos= yypos1757; G->thunkpos= yythunkpos1757;
-  }
-  l1758:;	  if (!yy_Spnl(G))  goto l1750;
-  if (!yymatchChar(G, '>')) goto l1750;
-  yyprintf((stderr, "  ok   HtmlTag"));
+/* LinkTail -- with EXT_LINEAR_INLINES, the part of an ExplicitLink after
+	its label:  ']' '(' Sp Source Spnl Title Sp ')'.  The label itself is
+	paired up with the tail later, by resolve_inline_delimiters. */
+YY_RULE(int) yy_LinkTail(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  int yyc, yyend;  yyprintfv((stderr, "%s\n", "LinkTail"));
+  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2237;  if (!yymatchChar(G, ']')) goto l2237;  if (!yymatchChar(G, '(')) goto l2237;
+  while (((yyc= yyByteAt(G, G->pos)) == ' ') || (yyc == '\t')) ++G->pos;
+  if ((yyc == '<') && (yyByteAt(G, (yyend= yySourceEnd(G, G->pos + 1))) == '>'))
+    {
+      yyDo(G, yy_1_Source, G->pos + 1, yyend, "yy_1_Source");
+      G->pos= yyend + 1;
+    }
+  else
+    {
+      yyend= yySourceEnd(G, G->pos);
+      yyDo(G, yy_1_Source, G->pos, yyend, "yy_1_Source");
+      G->pos= yyend;
+    }
+  yyDo(G, yySet, -2, 0, "yySet");
+  if (!yy_Spnl(G))  goto l2237;
+  yyc= yyByteAt(G, G->pos);
+  if (((yyc == '\'') || (yyc == '"')) && ((yyend= yyTitleEnd(G, G->pos + 1, yyc)) >= 0))
+    {
+      yyDo(G, yy_1_Title, G->pos + 1, yyend, "yy_1_Title");
+      G->pos= yyend + 1;
+    }
+  else
+    yyDo(G, yy_1_Title, G->pos, G->pos, "yy_1_Title");
+  yyDo(G, yySet, -1, 0, "yySet");
+  if (!yy_Sp(G))  goto l2237;
+  if (!yymatchChar(G, ')')) goto l2237;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2237;  yyDo(G, yy_1_LinkTail, G->begin, G->end, "yy_1_LinkTail");
+  yyprintf((stderr, "  ok   %s", "LinkTail"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l1750:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlTag"));
+  l2237:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "LinkTail"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlComment(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlComment"));
-  if (!yymatchString(G, "<!--")) goto l1759;
+YY_RULE(int) yy_Inline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Inline"));
 
-  l1760:;	
-  {  int yypos1761= G->pos, yythunkpos1761= G->thunkpos;
-  {  int yypos1762= G->pos, yythunkpos1762= G->thunkpos;  if (!yymatchString(G, "-->")) goto l1762;
-  goto l1761;
-  l1762:;	  G->pos= yypos1762; G->thunkpos= yythunkpos1762;
-  }  if (!yymatchDot(G)) goto l1761;  goto l1760;
-  l1761:;	  G->pos= yypos1761; G->thunkpos= yythunkpos1761;
-  }  if (!yymatchString(G, "-->")) goto l1759;
-  yyprintf((stderr, "  ok   HtmlComment"));
+  {  int yypos1892= G->pos, yythunkpos1892= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( ext(EXT_CRITIC) )) goto l1893;  if (!yy_CriticMarkup(G))  goto l1893;
+  goto l1892;
+  l1893:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1894;  if (!yy_DollarMath(G))  goto l1894;
+  goto l1892;
+  l1894:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Str(G))  goto l1895;
+  goto l1892;
+  l1895:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1896;  if (!yy_MathSpan(G))  goto l1896;
+  goto l1892;
+  l1896:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Endline(G))  goto l1897;
+  goto l1892;
+  l1897:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_UlOrStarLine(G))  goto l1898;
+  goto l1892;
+  l1898:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Space(G))  goto l1899;
+  goto l1892;
+  l1899:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_LINEAR_INLINES) )) goto l1901;  if (!yy_Strong(G))  goto l1900;
+  goto l1892;
+  l1900:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Emph(G))  goto l1901;
+  goto l1892;
+  l1901:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1902;  if (!yy_CitationReference(G))  goto l1902;
+  goto l1892;
+  l1902:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_LINEAR_INLINES) )) goto l1903;  if (!yy_Image(G))  goto l1903;
+  goto l1892;
+  l1903:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_LINEAR_INLINES) )) goto l2235;  if (!yy_Link(G))  goto l1904;
+  goto l1892;
+  l2235:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_LinkTail(G))  goto l2236;
+  goto l1892;
+  l2236:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_AutoLink(G))  goto l1904;
+  goto l1892;
+  l1904:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_NoteReference(G))  goto l1905;
+  goto l1892;
+  l1905:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Code(G))  goto l1906;
+  goto l1892;
+  l1906:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_MarkdownHtmlTagOpen(G))  goto l1907;
+  goto l1892;
+  l1907:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_RawHtml(G))  goto l1908;
+  goto l1892;
+  l1908:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Entity(G))  goto l1909;
+  goto l1892;
+  l1909:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_EscapedChar(G))  goto l1910;
+  goto l1892;
+  l1910:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Smart(G))  goto l1911;
+  goto l1892;
+  l1911:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Symbol(G))  goto l1891;
+
+  }
+  l1892:;	  yyprintf((stderr, "  ok   Inline"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1759:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlComment"));
+  l1891:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Inline"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlAttribute(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlAttribute"));
+YY_RULE(int) yy_AutoLabel(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AutoLabel"));
+  if (!yymatchChar(G, '[')) goto l1912;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1912;
+  {  int yypos1913= G->pos, yythunkpos1913= G->thunkpos;  if (!yy_Newline(G))  goto l1913;
+  goto l1912;
+  l1913:;	  G->pos= yypos1913; G->thunkpos= yythunkpos1913;
+  }
+  {  int yypos1914= G->pos, yythunkpos1914= G->thunkpos;  if (!yymatchChar(G, '^')) goto l1914;
+  goto l1912;
+  l1914:;	  G->pos= yypos1914; G->thunkpos= yythunkpos1914;
+  }
+  {  int yypos1915= G->pos, yythunkpos1915= G->thunkpos;  if (!yymatchChar(G, '#')) goto l1915;
+  goto l1912;
+  l1915:;	  G->pos= yypos1915; G->thunkpos= yythunkpos1915;
+  }  if (!yymatchDot(G)) goto l1912;
+  {  int yypos1918= G->pos, yythunkpos1918= G->thunkpos;  if (!yy_Newline(G))  goto l1918;
+  goto l1912;
+  l1918:;	  G->pos= yypos1918; G->thunkpos= yythunkpos1918;
+  }
+  {  int yypos1919= G->pos, yythunkpos1919= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1919;
+  goto l1912;
+  l1919:;	  G->pos= yypos1919; G->thunkpos= yythunkpos1919;
+  }  if (!yymatchDot(G)) goto l1912;
+  l1916:;	
+  {  int yypos1917= G->pos, yythunkpos1917= G->thunkpos;
+  {  int yypos1920= G->pos, yythunkpos1920= G->thunkpos;  if (!yy_Newline(G))  goto l1920;
+  goto l1917;
+  l1920:;	  G->pos= yypos1920; G->thunkpos= yythunkpos1920;
+  }
+  {  int yypos1921= G->pos, yythunkpos1921= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1921;
+  goto l1917;
+  l1921:;	  G->pos= yypos1921; G->thunkpos= yythunkpos1921;
+  }  if (!yymatchDot(G)) goto l1917;  goto l1916;
+  l1917:;	  G->pos= yypos1917; G->thunkpos= yythunkpos1917;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1912;  if (!yymatchChar(G, ']')) goto l1912;
 
-  {  int yypos1766= G->pos, yythunkpos1766= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1767;
-  goto l1766;
-  l1767:;	  G->pos= yypos1766; G->thunkpos= yythunkpos1766;  if (!yymatchChar(G, '-')) goto l1763;
+  {  int yypos1922= G->pos, yythunkpos1922= G->thunkpos;
+  {  int yypos1923= G->pos, yythunkpos1923= G->thunkpos;
+  {  int yypos1924= G->pos, yythunkpos1924= G->thunkpos;  if (!yy_Sp(G))  goto l1924;
+  goto l1925;
+  l1924:;	  G->pos= yypos1924; G->thunkpos= yythunkpos1924;
+  }
+  l1925:;	
+  {  int yypos1926= G->pos, yythunkpos1926= G->thunkpos;  if (!yymatchChar(G, '(')) goto l1927;
+  goto l1926;
+  l1927:;	  G->pos= yypos1926; G->thunkpos= yythunkpos1926;  if (!yymatchChar(G, '[')) goto l1923;
 
   }
-  l1766:;	
-  l1764:;	
-  {  int yypos1765= G->pos, yythunkpos1765= G->thunkpos;
-  {  int yypos1768= G->pos, yythunkpos1768= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l1769;
-  goto l1768;
-  l1769:;	  G->pos= yypos1768; G->thunkpos= yythunkpos1768;  if (!yymatchChar(G, '-')) goto l1765;
+  l1926:;	  goto l1912;
+  l1923:;	  G->pos= yypos1923; G->thunkpos= yythunkpos1923;
+  }  G->pos= yypos1922; G->thunkpos= yythunkpos1922;
+  }  yyDo(G, yy_1_AutoLabel, G->begin, G->end, "yy_1_AutoLabel");
+  yyprintf((stderr, "  ok   AutoLabel"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
 
-  }
-  l1768:;	  goto l1764;
-  l1765:;	  G->pos= yypos1765; G->thunkpos= yythunkpos1765;
-  }  if (!yy_Spnl(G))  goto l1763;
+  return 1;
+  l1912:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AutoLabel"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
 
-  {  int yypos1770= G->pos, yythunkpos1770= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1770;
-  if (!yy_Spnl(G))  goto l1770;
+  return 0;
+}
+YY_RULE(int) yy_AtxInline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AtxInline"));
 
-  {  int yypos1772= G->pos, yythunkpos1772= G->thunkpos;  if (!yy_Quoted(G))  goto l1773;
-  goto l1772;
-  l1773:;	  G->pos= yypos1772; G->thunkpos= yythunkpos1772;
-  {  int yypos1776= G->pos, yythunkpos1776= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1776;
-  goto l1770;
-  l1776:;	  G->pos= yypos1776; G->thunkpos= yythunkpos1776;
-  }  if (!yy_Nonspacechar(G))  goto l1770;
+  {  int yypos1929= G->pos, yythunkpos1929= G->thunkpos;  if (!yy_Newline(G))  goto l1929;
+  goto l1928;
+  l1929:;	  G->pos= yypos1929; G->thunkpos= yythunkpos1929;
+  }
+  {  int yypos1930= G->pos, yythunkpos1930= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1930;  if (!yy_Sp(G))  goto l1930;
+  if (!yy_AutoLabel(G))  goto l1930;
 
-  l1774:;	
-  {  int yypos1775= G->pos, yythunkpos1775= G->thunkpos;
-  {  int yypos1777= G->pos, yythunkpos1777= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1777;
-  goto l1775;
-  l1777:;	  G->pos= yypos1777; G->thunkpos= yythunkpos1777;
-  }  if (!yy_Nonspacechar(G))  goto l1775;
-  goto l1774;
-  l1775:;	  G->pos= yypos1775; G->thunkpos= yythunkpos1775;
+  {  int yypos1931= G->pos, yythunkpos1931= G->thunkpos;  if (!yy_Sp(G))  goto l1931;
+  goto l1932;
+  l1931:;	  G->pos= yypos1931; G->thunkpos= yythunkpos1931;
   }
+  l1932:;	
+  l1933:;	
+  {  int yypos1934= G->pos, yythunkpos1934= G->thunkpos;  if (!yymatchChar(G, '#')) goto l1934;
+  goto l1933;
+  l1934:;	  G->pos= yypos1934; G->thunkpos= yythunkpos1934;
+  }  if (!yy_Sp(G))  goto l1930;
+  if (!yy_Newline(G))  goto l1930;
+  goto l1928;
+  l1930:;	  G->pos= yypos1930; G->thunkpos= yythunkpos1930;
   }
-  l1772:;	  goto l1771;
-  l1770:;	  G->pos= yypos1770; G->thunkpos= yythunkpos1770;
+  {  int yypos1935= G->pos, yythunkpos1935= G->thunkpos;
+  {  int yypos1936= G->pos, yythunkpos1936= G->thunkpos;  if (!yy_Sp(G))  goto l1936;
+  goto l1937;
+  l1936:;	  G->pos= yypos1936; G->thunkpos= yythunkpos1936;
   }
-  l1771:;	  if (!yy_Spnl(G))  goto l1763;
-  yyprintf((stderr, "  ok   HtmlAttribute"));
+  l1937:;	
+  l1938:;	
+  {  int yypos1939= G->pos, yythunkpos1939= G->thunkpos;  if (!yymatchChar(G, '#')) goto l1939;
+  goto l1938;
+  l1939:;	  G->pos= yypos1939; G->thunkpos= yythunkpos1939;
+  }  if (!yy_Sp(G))  goto l1935;
+  if (!yy_Newline(G))  goto l1935;
+  goto l1928;
+  l1935:;	  G->pos= yypos1935; G->thunkpos= yythunkpos1935;
+  }  if (!yy_Inline(G))  goto l1928;
+  yyprintf((stderr, "  ok   AtxInline"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1763:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlAttribute"));
+  l1928:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AtxInline"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Quoted(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Quoted"));
-
-  {  int yypos1779= G->pos, yythunkpos1779= G->thunkpos;  if (!yymatchChar(G, '"')) goto l1780;
-
-  l1781:;	
-  {  int yypos1782= G->pos, yythunkpos1782= G->thunkpos;
-  {  int yypos1783= G->pos, yythunkpos1783= G->thunkpos;  if (!yymatchChar(G, '"')) goto l1783;
-  goto l1782;
-  l1783:;	  G->pos= yypos1783; G->thunkpos= yythunkpos1783;
-  }  if (!yymatchDot(G)) goto l1782;  goto l1781;
-  l1782:;	  G->pos= yypos1782; G->thunkpos= yythunkpos1782;
-  }  if (!yymatchChar(G, '"')) goto l1780;
-  goto l1779;
-  l1780:;	  G->pos= yypos1779; G->thunkpos= yythunkpos1779;  if (!yymatchChar(G, '\'')) goto l1778;
+YY_RULE(int) yy_AtxHeading(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 3, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "AtxHeading"));
+  if (!yy_AtxStart(G))  goto l1940;
+  yyDo(G, yySet, -3, 0, "yySet");
 
-  l1784:;	
-  {  int yypos1785= G->pos, yythunkpos1785= G->thunkpos;
-  {  int yypos1786= G->pos, yythunkpos1786= G->thunkpos;  if (!yymatchChar(G, '\'')) goto l1786;
-  goto l1785;
-  l1786:;	  G->pos= yypos1786; G->thunkpos= yythunkpos1786;
-  }  if (!yymatchDot(G)) goto l1785;  goto l1784;
-  l1785:;	  G->pos= yypos1785; G->thunkpos= yythunkpos1785;
-  }  if (!yymatchChar(G, '\'')) goto l1778;
+  {  int yypos1941= G->pos, yythunkpos1941= G->thunkpos;  if (!yy_Sp(G))  goto l1941;
+  goto l1942;
+  l1941:;	  G->pos= yypos1941; G->thunkpos= yythunkpos1941;
+  }
+  l1942:;	  if (!yy_StartList(G))  goto l1940;
+  yyDo(G, yySet, -2, 0, "yySet");
+  if (!yy_AtxInline(G))  goto l1940;
+  yyDo(G, yy_1_AtxHeading, G->begin, G->end, "yy_1_AtxHeading");
 
+  l1943:;	
+  {  int yypos1944= G->pos, yythunkpos1944= G->thunkpos;  if (!yy_AtxInline(G))  goto l1944;
+  yyDo(G, yy_1_AtxHeading, G->begin, G->end, "yy_1_AtxHeading");
+  goto l1943;
+  l1944:;	  G->pos= yypos1944; G->thunkpos= yythunkpos1944;
   }
-  l1779:;	  yyprintf((stderr, "  ok   Quoted"));
+  {  int yypos1945= G->pos, yythunkpos1945= G->thunkpos;
+  {  int yypos1947= G->pos, yythunkpos1947= G->thunkpos;  if (!yy_Sp(G))  goto l1947;
+  goto l1948;
+  l1947:;	  G->pos= yypos1947; G->thunkpos= yythunkpos1947;
+  }
+  l1948:;	  if (!yy_AutoLabel(G))  goto l1945;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_2_AtxHeading, G->begin, G->end, "yy_2_AtxHeading");
+  goto l1946;
+  l1945:;	  G->pos= yypos1945; G->thunkpos= yythunkpos1945;
+  }
+  l1946:;	
+  {  int yypos1949= G->pos, yythunkpos1949= G->thunkpos;
+  {  int yypos1951= G->pos, yythunkpos1951= G->thunkpos;  if (!yy_Sp(G))  goto l1951;
+  goto l1952;
+  l1951:;	  G->pos= yypos1951; G->thunkpos= yythunkpos1951;
+  }
+  l1952:;	
+  l1953:;	
+  {  int yypos1954= G->pos, yythunkpos1954= G->thunkpos;  if (!yymatchChar(G, '#')) goto l1954;
+  goto l1953;
+  l1954:;	  G->pos= yypos1954; G->thunkpos= yythunkpos1954;
+  }  if (!yy_Sp(G))  goto l1949;
+  goto l1950;
+  l1949:;	  G->pos= yypos1949; G->thunkpos= yythunkpos1949;
+  }
+  l1950:;	  if (!yy_Sp(G))  goto l1940;
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1940;  if (!yy_Newline(G))  goto l1940;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1940;  yyDo(G, yy_3_AtxHeading, G->begin, G->end, "yy_3_AtxHeading");
+  yyprintf((stderr, "  ok   AtxHeading"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 3, 0, "yyPop");
   return 1;
-  l1778:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Quoted"));
+  l1940:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AtxHeading"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_ExtendedSpecialChar(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "ExtendedSpecialChar"));
-
-  {  int yypos1788= G->pos, yythunkpos1788= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( ext(EXT_SMART) )) goto l1789;
-  {  int yypos1790= G->pos, yythunkpos1790= G->thunkpos;  if (!yymatchChar(G, '.')) goto l1791;
-  goto l1790;
-  l1791:;	  G->pos= yypos1790; G->thunkpos= yythunkpos1790;  if (!yymatchChar(G, '-')) goto l1792;
-  goto l1790;
-  l1792:;	  G->pos= yypos1790; G->thunkpos= yythunkpos1790;  if (!yymatchChar(G, '\'')) goto l1793;
-  goto l1790;
-  l1793:;	  G->pos= yypos1790; G->thunkpos= yythunkpos1790;  if (!yymatchChar(G, '"')) goto l1789;
+YY_RULE(int) yy_Heading(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Heading"));
 
-  }
-  l1790:;	  goto l1788;
-  l1789:;	  G->pos= yypos1788; G->thunkpos= yythunkpos1788;  yyText(G, G->begin, G->end);  if (!( ext(EXT_NOTES) )) goto l1794;  if (!yymatchChar(G, '^')) goto l1794;
-  goto l1788;
-  l1794:;	  G->pos= yypos1788; G->thunkpos= yythunkpos1788;  yyText(G, G->begin, G->end);  if (!( ext(EXT_CRITIC) )) goto l1787;  if (!yymatchChar(G, '{')) goto l1787;
+  {  int yypos1956= G->pos, yythunkpos1956= G->thunkpos;  if (!yy_SetextHeading(G))  goto l1957;
+  goto l1956;
+  l1957:;	  G->pos= yypos1956; G->thunkpos= yythunkpos1956;  if (!yy_AtxHeading(G))  goto l1955;
 
   }
-  l1788:;	  yyprintf((stderr, "  ok   ExtendedSpecialChar"));
+  l1956:;	  yyprintf((stderr, "  ok   Heading"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1787:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ExtendedSpecialChar"));
+  l1955:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Heading"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_SpecialChar(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SpecialChar"));
+YY_RULE(int) yy_HeadingSectionBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HeadingSectionBlock"));
 
-  {  int yypos1796= G->pos, yythunkpos1796= G->thunkpos;  if (!yymatchChar(G, '*')) goto l1797;
-  goto l1796;
-  l1797:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '_')) goto l1798;
-  goto l1796;
-  l1798:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '`')) goto l1799;
-  goto l1796;
-  l1799:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '&')) goto l1800;
-  goto l1796;
-  l1800:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '[')) goto l1801;
-  goto l1796;
-  l1801:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, ']')) goto l1802;
-  goto l1796;
-  l1802:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '(')) goto l1803;
-  goto l1796;
-  l1803:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, ')')) goto l1804;
-  goto l1796;
-  l1804:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '<')) goto l1805;
-  goto l1796;
-  l1805:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '!')) goto l1806;
-  goto l1796;
-  l1806:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '#')) goto l1807;
-  goto l1796;
-  l1807:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '\\')) goto l1808;
-  goto l1796;
-  l1808:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '\'')) goto l1809;
-  goto l1796;
-  l1809:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yymatchChar(G, '"')) goto l1810;
-  goto l1796;
-  l1810:;	  G->pos= yypos1796; G->thunkpos= yythunkpos1796;  if (!yy_ExtendedSpecialChar(G))  goto l1795;
+  l1959:;	
+  {  int yypos1960= G->pos, yythunkpos1960= G->thunkpos;  if (!yy_BlankLine(G))  goto l1960;
+  goto l1959;
+  l1960:;	  G->pos= yypos1960; G->thunkpos= yythunkpos1960;
+  }
+  {  int yypos1961= G->pos, yythunkpos1961= G->thunkpos;  if (!yy_Heading(G))  goto l1961;
+  goto l1958;
+  l1961:;	  G->pos= yypos1961; G->thunkpos= yythunkpos1961;
+  }
+  {  int yypos1962= G->pos, yythunkpos1962= G->thunkpos;  if (!yy_BlockQuote(G))  goto l1963;
+  goto l1962;
+  l1963:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_Verbatim(G))  goto l1964;
+  goto l1962;
+  l1964:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1965;  if (!yy_DefinitionList(G))  goto l1965;
+  goto l1962;
+  l1965:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1966;  if (!yy_Glossary(G))  goto l1966;
+  goto l1962;
+  l1966:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_Note(G))  goto l1967;
+  goto l1962;
+  l1967:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_LinkReference(G))  goto l1968;
+  goto l1962;
+  l1968:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_HorizontalRule(G))  goto l1969;
+  goto l1962;
+  l1969:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_OrderedList(G))  goto l1970;
+  goto l1962;
+  l1970:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_BulletList(G))  goto l1971;
+  goto l1962;
+  l1971:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_HtmlBlock(G))  goto l1972;
+  goto l1962;
+  l1972:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_MarkdownHtmlBlock(G))  goto l1973;
+  goto l1962;
+  l1973:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_StyleBlock(G))  goto l1974;
+  goto l1962;
+  l1974:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1975;  if (!yy_Table(G))  goto l1975;
+  goto l1962;
+  l1975:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1976;  if (!yy_ImageBlock(G))  goto l1976;
+  goto l1962;
+  l1976:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;
+  {  int yypos1978= G->pos, yythunkpos1978= G->thunkpos;
+  {  int yypos1979= G->pos, yythunkpos1979= G->thunkpos;  if (!yy_Sp(G))  goto l1979;
+  goto l1980;
+  l1979:;	  G->pos= yypos1979; G->thunkpos= yythunkpos1979;
+  }
+  l1980:;	  if (!yy_HtmlBlockInTags(G))  goto l1978;
+  goto l1977;
+  l1978:;	  G->pos= yypos1978; G->thunkpos= yythunkpos1978;
+  }  if (!yy_Para(G))  goto l1977;
+  goto l1962;
+  l1977:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_Plain(G))  goto l1958;
 
   }
-  l1796:;	  yyprintf((stderr, "  ok   SpecialChar"));
+  l1962:;	  yyprintf((stderr, "  ok   HeadingSectionBlock"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1795:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SpecialChar"));
+  l1958:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HeadingSectionBlock"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_NormalChar(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "NormalChar"));
-
-  {  int yypos1812= G->pos, yythunkpos1812= G->thunkpos;
-  {  int yypos1813= G->pos, yythunkpos1813= G->thunkpos;  if (!yy_SpecialChar(G))  goto l1814;
-  goto l1813;
-  l1814:;	  G->pos= yypos1813; G->thunkpos= yythunkpos1813;  if (!yy_Spacechar(G))  goto l1815;
-  goto l1813;
-  l1815:;	  G->pos= yypos1813; G->thunkpos= yythunkpos1813;  if (!yy_Newline(G))  goto l1812;
-
-  }
-  l1813:;	  goto l1811;
-  l1812:;	  G->pos= yypos1812; G->thunkpos= yythunkpos1812;
-  }  if (!yymatchDot(G)) goto l1811;  yyprintf((stderr, "  ok   NormalChar"));
+YY_RULE(int) yy_Plain(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "Plain"));
+  if (!yy_Inlines(G))  goto l1981;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_Plain, G->begin, G->end, "yy_1_Plain");
+  yyprintf((stderr, "  ok   Plain"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l1811:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "NormalChar"));
+  l1981:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Plain"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Nonspacechar(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Nonspacechar"));
+YY_RULE(int) yy_Para(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "Para"));
+  if (!yy_NonindentSpace(G))  goto l1982;
+  if (!yy_Inlines(G))  goto l1982;
+  yyDo(G, yySet, -1, 0, "yySet");
+  if (!yy_BlankLine(G))  goto l1982;
 
-  {  int yypos1817= G->pos, yythunkpos1817= G->thunkpos;  if (!yy_Spacechar(G))  goto l1817;
-  goto l1816;
-  l1817:;	  G->pos= yypos1817; G->thunkpos= yythunkpos1817;
-  }
-  {  int yypos1818= G->pos, yythunkpos1818= G->thunkpos;  if (!yy_Newline(G))  goto l1818;
-  goto l1816;
-  l1818:;	  G->pos= yypos1818; G->thunkpos= yythunkpos1818;
-  }  if (!yymatchDot(G)) goto l1816;  yyprintf((stderr, "  ok   Nonspacechar"));
+  l1983:;	
+  {  int yypos1984= G->pos, yythunkpos1984= G->thunkpos;  if (!yy_BlankLine(G))  goto l1984;
+  goto l1983;
+  l1984:;	  G->pos= yypos1984; G->thunkpos= yythunkpos1984;
+  }  yyDo(G, yy_1_Para, G->begin, G->end, "yy_1_Para");
+  yyprintf((stderr, "  ok   Para"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l1816:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Nonspacechar"));
+  l1982:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Para"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Spnl(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Spnl"));
-  if (!yy_Sp(G))  goto l1819;
+/* HtmlBlockInTags -- an element whose name the grammar lists, from its open
+	tag to the close tag that balances it.  The names spelled by a prefix of
+	the tag name are tried in the order the grammar lists them (so "<pre>"
+	first tries to be a "p" with an attribute "re"). */
+YY_RULE(int) yy_HtmlBlockInTags(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  const html_block_tag *yytag;  int yyname, yyrun, yytried= -1;  yyprintfv((stderr, "%s\n", "HtmlBlockInTags"));
+  if (!yymatchChar(G, '<')) goto l1985;
+  if (!yy_Spnl(G))  goto l1985;
+  yyname= G->pos;  yyrun= yyHtmlTagName(G);
 
-  {  int yypos1820= G->pos, yythunkpos1820= G->thunkpos;  if (!yy_Newline(G))  goto l1820;
-  if (!yy_Sp(G))  goto l1820;
-  goto l1821;
-  l1820:;	  G->pos= yypos1820; G->thunkpos= yythunkpos1820;
-  }
-  l1821:;	  yyprintf((stderr, "  ok   Spnl"));
+  l1987:;	  G->pos= yyname;  yytag= yyHtmlTagAfter(G, yyrun, 1, yytried);  if (!yytag) goto l1985;
+  yytried= yytag->in_tags;  G->pos= yypos0;
+  if (!yyHtmlBlockOpen(G, yytag))  goto l1987;
+  if (!yyHtmlBlockBody(G, yytag, yypos0))  goto l1987;
+  yyprintf((stderr, "  ok   HtmlBlockInTags"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1819:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Spnl"));
+  l1985:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockInTags"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Spacechar(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Spacechar"));
-
-  {  int yypos1823= G->pos, yythunkpos1823= G->thunkpos;  if (!yymatchChar(G, ' ')) goto l1824;
-  goto l1823;
-  l1824:;	  G->pos= yypos1823; G->thunkpos= yythunkpos1823;  if (!yymatchChar(G, '\t')) goto l1822;
+YY_RULE(int) yy_ImageBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "ImageBlock"));
+  if (!yy_Image(G))  goto l2029;
+  if (!yy_Sp(G))  goto l2029;
+  if (!yy_Newline(G))  goto l2029;
+  if (!yy_BlankLine(G))  goto l2029;
 
-  }
-  l1823:;	  yyprintf((stderr, "  ok   Spacechar"));
+  l2030:;	
+  {  int yypos2031= G->pos, yythunkpos2031= G->thunkpos;  if (!yy_BlankLine(G))  goto l2031;
+  goto l2030;
+  l2031:;	  G->pos= yypos2031; G->thunkpos= yythunkpos2031;
+  }  yyDo(G, yy_1_ImageBlock, G->begin, G->end, "yy_1_ImageBlock");
+  yyprintf((stderr, "  ok   ImageBlock"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1822:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Spacechar"));
+  l2029:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ImageBlock"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Eof(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Eof"));
+YY_RULE(int) yy_Table(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "Table"));
+  if (!yy_StartList(G))  goto l2032;
+  yyDo(G, yySet, -2, 0, "yySet");
+  if (!yy_StartList(G))  goto l2032;
+  yyDo(G, yySet, -1, 0, "yySet");
 
-  {  int yypos1826= G->pos, yythunkpos1826= G->thunkpos;  if (!yymatchDot(G)) goto l1826;  goto l1825;
-  l1826:;	  G->pos= yypos1826; G->thunkpos= yythunkpos1826;
-  }  yyprintf((stderr, "  ok   Eof"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
+  {  int yypos2033= G->pos, yythunkpos2033= G->thunkpos;  if (!yy_TableCaption(G))  goto l2033;
+  yyDo(G, yy_1_Table, G->begin, G->end, "yy_1_Table");
+  goto l2034;
+  l2033:;	  G->pos= yypos2033; G->thunkpos= yythunkpos2033;
+  }
+  l2034:;	  if (!yy_TableBody(G))  goto l2032;
+  yyDo(G, yy_2_Table, G->begin, G->end, "yy_2_Table");
+  if (!yy_SeparatorLine(G))  goto l2032;
+  yyDo(G, yy_3_Table, G->begin, G->end, "yy_3_Table");
+  if (!yy_TableBody(G))  goto l2032;
+  yyDo(G, yy_4_Table, G->begin, G->end, "yy_4_Table");
 
-  return 1;
-  l1825:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Eof"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+  l2035:;	
+  {  int yypos2036= G->pos, yythunkpos2036= G->thunkpos;  if (!yy_BlankLine(G))  goto l2036;
 
-  return 0;
-}
-YY_RULE(int) yy_Line(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Line"));
-  if (!yy_RawLine(G))  goto l1827;
-  yyDo(G, yy_1_Line, G->begin, G->end, "yy_1_Line");
-  yyprintf((stderr, "  ok   Line"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
+  {  int yypos2037= G->pos, yythunkpos2037= G->thunkpos;  if (!yy_TableCaption(G))  goto l2037;
+  goto l2036;
+  l2037:;	  G->pos= yypos2037; G->thunkpos= yythunkpos2037;
+  }  if (!yy_TableBody(G))  goto l2036;
+  yyDo(G, yy_5_Table, G->begin, G->end, "yy_5_Table");
 
-  return 1;
-  l1827:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Line"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+  {  int yypos2038= G->pos, yythunkpos2038= G->thunkpos;
+  {  int yypos2039= G->pos, yythunkpos2039= G->thunkpos;  if (!yy_TableCaption(G))  goto l2040;
+  goto l2039;
+  l2040:;	  G->pos= yypos2039; G->thunkpos= yythunkpos2039;  if (!yy_BlankLine(G))  goto l2036;
 
-  return 0;
-}
-YY_RULE(int) yy_BlockQuoteMarker(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "BlockQuoteMarker"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1828;  if (!yymatchChar(G, '>')) goto l1828;
+  }
+  l2039:;	  G->pos= yypos2038; G->thunkpos= yythunkpos2038;
+  }  goto l2035;
+  l2036:;	  G->pos= yypos2036; G->thunkpos= yythunkpos2036;
+  }
+  {  int yypos2041= G->pos, yythunkpos2041= G->thunkpos;  if (!yy_TableCaption(G))  goto l2042;
+  yyDo(G, yy_6_Table, G->begin, G->end, "yy_6_Table");
 
-  {  int yypos1829= G->pos, yythunkpos1829= G->thunkpos;  if (!yymatchChar(G, ' ')) goto l1829;
-  goto l1830;
-  l1829:;	  G->pos= yypos1829; G->thunkpos= yythunkpos1829;
+  {  int yypos2043= G->pos, yythunkpos2043= G->thunkpos;  if (!yy_BlankLine(G))  goto l2042;
+  G->pos= yypos2043; G->thunkpos= yythunkpos2043;
+  }  goto l2041;
+  l2042:;	  G->pos= yypos2041; G->thunkpos= yythunkpos2041;
+  {  int yypos2044= G->pos, yythunkpos2044= G->thunkpos;  if (!yy_BlankLine(G))  goto l2032;
+  G->pos= yypos2044; G->thunkpos= yythunkpos2044;
   }
-  l1830:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1828;  yyDo(G, yy_1_BlockQuoteMarker, G->begin, G->end, "yy_1_BlockQuoteMarker");
-  yyprintf((stderr, "  ok   BlockQuoteMarker"));
+  }
+  l2041:;	  yyDo(G, yy_7_Table, G->begin, G->end, "yy_7_Table");
+  yyprintf((stderr, "  ok   Table"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l1828:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "BlockQuoteMarker"));
+  l2032:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Table"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_BlockQuoteRaw(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "BlockQuoteRaw"));
-  if (!yy_StartList(G))  goto l1831;
-  yyDo(G, yySet, -2, 0, "yySet");
-  if (!yy_BlockQuoteMarker(G))  goto l1831;
-  yyDo(G, yySet, -1, 0, "yySet");
-  if (!yy_Line(G))  goto l1831;
-  yyDo(G, yy_1_BlockQuoteRaw, G->begin, G->end, "yy_1_BlockQuoteRaw");
-
-  l1834:;	
-  {  int yypos1835= G->pos, yythunkpos1835= G->thunkpos;
-  {  int yypos1836= G->pos, yythunkpos1836= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1836;
-  goto l1835;
-  l1836:;	  G->pos= yypos1836; G->thunkpos= yythunkpos1836;
-  }
-  {  int yypos1837= G->pos, yythunkpos1837= G->thunkpos;  if (!yy_BlankLine(G))  goto l1837;
-  goto l1835;
-  l1837:;	  G->pos= yypos1837; G->thunkpos= yythunkpos1837;
-  }  if (!yy_Line(G))  goto l1835;
-  yyDo(G, yy_2_BlockQuoteRaw, G->begin, G->end, "yy_2_BlockQuoteRaw");
-  goto l1834;
-  l1835:;	  G->pos= yypos1835; G->thunkpos= yythunkpos1835;
-  }
-  l1838:;	
-  {  int yypos1839= G->pos, yythunkpos1839= G->thunkpos;  if (!yy_BlankLine(G))  goto l1839;
-  yyDo(G, yy_3_BlockQuoteRaw, G->begin, G->end, "yy_3_BlockQuoteRaw");
-  goto l1838;
-  l1839:;	  G->pos= yypos1839; G->thunkpos= yythunkpos1839;
-  }
-  l1832:;	
-  {  int yypos1833= G->pos, yythunkpos1833= G->thunkpos;  if (!yy_BlockQuoteMarker(G))  goto l1833;
-  yyDo(G, yySet, -1, 0, "yySet");
-  if (!yy_Line(G))  goto l1833;
-  yyDo(G, yy_1_BlockQuoteRaw, G->begin, G->end, "yy_1_BlockQuoteRaw");
-
-  l1840:;	
-  {  int yypos1841= G->pos, yythunkpos1841= G->thunkpos;
-  {  int yypos1842= G->pos, yythunkpos1842= G->thunkpos;  if (!yymatchChar(G, '>')) goto l1842;
-  goto l1841;
-  l1842:;	  G->pos= yypos1842; G->thunkpos= yythunkpos1842;
-  }
-  {  int yypos1843= G->pos, yythunkpos1843= G->thunkpos;  if (!yy_BlankLine(G))  goto l1843;
-  goto l1841;
-  l1843:;	  G->pos= yypos1843; G->thunkpos= yythunkpos1843;
-  }  if (!yy_Line(G))  goto l1841;
-  yyDo(G, yy_2_BlockQuoteRaw, G->begin, G->end, "yy_2_BlockQuoteRaw");
-  goto l1840;
-  l1841:;	  G->pos= yypos1841; G->thunkpos= yythunkpos1841;
-  }
-  l1844:;	
-  {  int yypos1845= G->pos, yythunkpos1845= G->thunkpos;  if (!yy_BlankLine(G))  goto l1845;
-  yyDo(G, yy_3_BlockQuoteRaw, G->begin, G->end, "yy_3_BlockQuoteRaw");
-  goto l1844;
-  l1845:;	  G->pos= yypos1845; G->thunkpos= yythunkpos1845;
-  }  goto l1832;
-  l1833:;	  G->pos= yypos1833; G->thunkpos= yythunkpos1833;
-  }  yyDo(G, yy_4_BlockQuoteRaw, G->begin, G->end, "yy_4_BlockQuoteRaw");
-  yyprintf((stderr, "  ok   BlockQuoteRaw"));
+YY_RULE(int) yy_StyleBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "StyleBlock"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2045;  if (!yy_InStyleTags(G))  goto l2045;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2045;
+  l2046:;	
+  {  int yypos2047= G->pos, yythunkpos2047= G->thunkpos;  if (!yy_BlankLine(G))  goto l2047;
+  goto l2046;
+  l2047:;	  G->pos= yypos2047; G->thunkpos= yythunkpos2047;
+  }  yyDo(G, yy_1_StyleBlock, G->begin, G->end, "yy_1_StyleBlock");
+  yyprintf((stderr, "  ok   StyleBlock"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
+
   return 1;
-  l1831:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "BlockQuoteRaw"));
+  l2045:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "StyleBlock"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Endline(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Endline"));
-
-  {  int yypos1847= G->pos, yythunkpos1847= G->thunkpos;  if (!yy_LineBreak(G))  goto l1848;
-  goto l1847;
-  l1848:;	  G->pos= yypos1847; G->thunkpos= yythunkpos1847;  if (!yy_TerminalEndline(G))  goto l1849;
-  goto l1847;
-  l1849:;	  G->pos= yypos1847; G->thunkpos= yythunkpos1847;  if (!yy_NormalEndline(G))  goto l1846;
+YY_RULE(int) yy_MarkdownHtmlBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "MarkdownHtmlBlock"));
+
+  {  int yypos2049= G->pos, yythunkpos2049= G->thunkpos;  if (!yy_MarkdownHtmlTagOpen(G))  goto l2048;
+  G->pos= yypos2049; G->thunkpos= yythunkpos2049;
+  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2048;
+  {  int yypos2050= G->pos, yythunkpos2050= G->thunkpos;  if (!yy_HtmlBlockInTags(G))  goto l2051;
+  goto l2050;
+  l2051:;	  G->pos= yypos2050; G->thunkpos= yythunkpos2050;  if (!yy_HtmlComment(G))  goto l2052;
+  goto l2050;
+  l2052:;	  G->pos= yypos2050; G->thunkpos= yythunkpos2050;  if (!yy_HtmlBlockSelfClosing(G))  goto l2048;
 
   }
-  l1847:;	  yyprintf((stderr, "  ok   Endline"));
+  l2050:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2048;  if (!yy_BlankLine(G))  goto l2048;
+
+  l2053:;	
+  {  int yypos2054= G->pos, yythunkpos2054= G->thunkpos;  if (!yy_BlankLine(G))  goto l2054;
+  goto l2053;
+  l2054:;	  G->pos= yypos2054; G->thunkpos= yythunkpos2054;
+  }  yyDo(G, yy_1_MarkdownHtmlBlock, G->begin, G->end, "yy_1_MarkdownHtmlBlock");
+  yyprintf((stderr, "  ok   MarkdownHtmlBlock"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1846:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Endline"));
+  l2048:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "MarkdownHtmlBlock"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_SetextBottom2(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SetextBottom2"));
-  if (!yymatchChar(G, '-')) goto l1850;
+YY_RULE(int) yy_HtmlBlock(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlock"));
 
-  l1851:;	
-  {  int yypos1852= G->pos, yythunkpos1852= G->thunkpos;  if (!yymatchChar(G, '-')) goto l1852;
-  goto l1851;
-  l1852:;	  G->pos= yypos1852; G->thunkpos= yythunkpos1852;
-  }  if (!yy_Newline(G))  goto l1850;
-  yyprintf((stderr, "  ok   SetextBottom2"));
+  {  int yypos2056= G->pos, yythunkpos2056= G->thunkpos;  if (!yy_MarkdownHtmlTagOpen(G))  goto l2056;
+  goto l2055;
+  l2056:;	  G->pos= yypos2056; G->thunkpos= yythunkpos2056;
+  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2055;
+  {  int yypos2057= G->pos, yythunkpos2057= G->thunkpos;  if (!yy_HtmlBlockInTags(G))  goto l2058;
+  goto l2057;
+  l2058:;	  G->pos= yypos2057; G->thunkpos= yythunkpos2057;  if (!yy_HtmlComment(G))  goto l2059;
+  goto l2057;
+  l2059:;	  G->pos= yypos2057; G->thunkpos= yythunkpos2057;  if (!yy_HtmlBlockSelfClosing(G))  goto l2055;
+
+  }
+  l2057:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2055;  if (!yy_BlankLine(G))  goto l2055;
+
+  l2060:;	
+  {  int yypos2061= G->pos, yythunkpos2061= G->thunkpos;  if (!yy_BlankLine(G))  goto l2061;
+  goto l2060;
+  l2061:;	  G->pos= yypos2061; G->thunkpos= yythunkpos2061;
+  }  yyDo(G, yy_1_HtmlBlock, G->begin, G->end, "yy_1_HtmlBlock");
+  yyprintf((stderr, "  ok   HtmlBlock"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1850:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SetextBottom2"));
+  l2055:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlock"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_SetextBottom1(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SetextBottom1"));
-  if (!yymatchChar(G, '=')) goto l1853;
+YY_RULE(int) yy_BulletList(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "BulletList"));
 
-  l1854:;	
-  {  int yypos1855= G->pos, yythunkpos1855= G->thunkpos;  if (!yymatchChar(G, '=')) goto l1855;
-  goto l1854;
-  l1855:;	  G->pos= yypos1855; G->thunkpos= yythunkpos1855;
-  }  if (!yy_Newline(G))  goto l1853;
-  yyprintf((stderr, "  ok   SetextBottom1"));
+  {  int yypos2063= G->pos, yythunkpos2063= G->thunkpos;  if (!yy_Bullet(G))  goto l2062;
+  G->pos= yypos2063; G->thunkpos= yythunkpos2063;
+  }
+  {  int yypos2064= G->pos, yythunkpos2064= G->thunkpos;  if (!yy_ListTight(G))  goto l2065;
+  goto l2064;
+  l2065:;	  G->pos= yypos2064; G->thunkpos= yythunkpos2064;  if (!yy_ListLoose(G))  goto l2062;
+
+  }
+  l2064:;	  yyDo(G, yy_1_BulletList, G->begin, G->end, "yy_1_BulletList");
+  yyprintf((stderr, "  ok   BulletList"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1853:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SetextBottom1"));
+  l2062:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "BulletList"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_SetextHeading2(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "SetextHeading2"));
-
-  {  int yypos1857= G->pos, yythunkpos1857= G->thunkpos;  if (!yy_RawLine(G))  goto l1856;
-  if (!yy_SetextBottom2(G))  goto l1856;
-  G->pos= yypos1857; G->thunkpos= yythunkpos1857;
-  }  if (!yy_StartList(G))  goto l1856;
-  yyDo(G, yySet, -2, 0, "yySet");
-
-  {  int yypos1860= G->pos, yythunkpos1860= G->thunkpos;  if (!yy_Endline(G))  goto l1860;
-  goto l1856;
-  l1860:;	  G->pos= yypos1860; G->thunkpos= yythunkpos1860;
-  }
-  {  int yypos1861= G->pos, yythunkpos1861= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1861;  if (!yy_Sp(G))  goto l1861;
-  if (!yy_AutoLabel(G))  goto l1861;
-  goto l1856;
-  l1861:;	  G->pos= yypos1861; G->thunkpos= yythunkpos1861;
-  }  if (!yy_Inline(G))  goto l1856;
-  yyDo(G, yy_1_SetextHeading2, G->begin, G->end, "yy_1_SetextHeading2");
+YY_RULE(int) yy_OrderedList(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "OrderedList"));
 
-  l1858:;	
-  {  int yypos1859= G->pos, yythunkpos1859= G->thunkpos;
-  {  int yypos1862= G->pos, yythunkpos1862= G->thunkpos;  if (!yy_Endline(G))  goto l1862;
-  goto l1859;
-  l1862:;	  G->pos= yypos1862; G->thunkpos= yythunkpos1862;
-  }
-  {  int yypos1863= G->pos, yythunkpos1863= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1863;  if (!yy_Sp(G))  goto l1863;
-  if (!yy_AutoLabel(G))  goto l1863;
-  goto l1859;
-  l1863:;	  G->pos= yypos1863; G->thunkpos= yythunkpos1863;
-  }  if (!yy_Inline(G))  goto l1859;
-  yyDo(G, yy_1_SetextHeading2, G->begin, G->end, "yy_1_SetextHeading2");
-  goto l1858;
-  l1859:;	  G->pos= yypos1859; G->thunkpos= yythunkpos1859;
+  {  int yypos2067= G->pos, yythunkpos2067= G->thunkpos;  if (!yy_Enumerator(G))  goto l2066;
+  G->pos= yypos2067; G->thunkpos= yythunkpos2067;
   }
-  {  int yypos1864= G->pos, yythunkpos1864= G->thunkpos;  if (!yy_Sp(G))  goto l1864;
-  if (!yy_AutoLabel(G))  goto l1864;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_2_SetextHeading2, G->begin, G->end, "yy_2_SetextHeading2");
+  {  int yypos2068= G->pos, yythunkpos2068= G->thunkpos;  if (!yy_ListTight(G))  goto l2069;
+  goto l2068;
+  l2069:;	  G->pos= yypos2068; G->thunkpos= yythunkpos2068;  if (!yy_ListLoose(G))  goto l2066;
 
-  {  int yypos1866= G->pos, yythunkpos1866= G->thunkpos;  if (!yy_Sp(G))  goto l1866;
-  goto l1867;
-  l1866:;	  G->pos= yypos1866; G->thunkpos= yythunkpos1866;
-  }
-  l1867:;	  goto l1865;
-  l1864:;	  G->pos= yypos1864; G->thunkpos= yythunkpos1864;
-  }
-  l1865:;	
-  {  int yypos1868= G->pos, yythunkpos1868= G->thunkpos;  if (!yy_Sp(G))  goto l1868;
-  goto l1869;
-  l1868:;	  G->pos= yypos1868; G->thunkpos= yythunkpos1868;
   }
-  l1869:;	  if (!yy_Newline(G))  goto l1856;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1856;  if (!yy_SetextBottom2(G))  goto l1856;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1856;  yyDo(G, yy_3_SetextHeading2, G->begin, G->end, "yy_3_SetextHeading2");
-  yyprintf((stderr, "  ok   SetextHeading2"));
+  l2068:;	  yyDo(G, yy_1_OrderedList, G->begin, G->end, "yy_1_OrderedList");
+  yyprintf((stderr, "  ok   OrderedList"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
+
   return 1;
-  l1856:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SetextHeading2"));
+  l2066:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "OrderedList"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_SetextHeading1(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "SetextHeading1"));
-
-  {  int yypos1871= G->pos, yythunkpos1871= G->thunkpos;  if (!yy_RawLine(G))  goto l1870;
-  if (!yy_SetextBottom1(G))  goto l1870;
-  G->pos= yypos1871; G->thunkpos= yythunkpos1871;
-  }  if (!yy_StartList(G))  goto l1870;
-  yyDo(G, yySet, -2, 0, "yySet");
-
-  {  int yypos1874= G->pos, yythunkpos1874= G->thunkpos;  if (!yy_Endline(G))  goto l1874;
-  goto l1870;
-  l1874:;	  G->pos= yypos1874; G->thunkpos= yythunkpos1874;
-  }
-  {  int yypos1875= G->pos, yythunkpos1875= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1875;  if (!yy_Sp(G))  goto l1875;
-  if (!yy_AutoLabel(G))  goto l1875;
-  goto l1870;
-  l1875:;	  G->pos= yypos1875; G->thunkpos= yythunkpos1875;
-  }  if (!yy_Inline(G))  goto l1870;
-  yyDo(G, yy_1_SetextHeading1, G->begin, G->end, "yy_1_SetextHeading1");
-
-  l1872:;	
-  {  int yypos1873= G->pos, yythunkpos1873= G->thunkpos;
-  {  int yypos1876= G->pos, yythunkpos1876= G->thunkpos;  if (!yy_Endline(G))  goto l1876;
-  goto l1873;
-  l1876:;	  G->pos= yypos1876; G->thunkpos= yythunkpos1876;
-  }
-  {  int yypos1877= G->pos, yythunkpos1877= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1877;  if (!yy_Sp(G))  goto l1877;
-  if (!yy_AutoLabel(G))  goto l1877;
-  goto l1873;
-  l1877:;	  G->pos= yypos1877; G->thunkpos= yythunkpos1877;
-  }  if (!yy_Inline(G))  goto l1873;
-  yyDo(G, yy_1_SetextHeading1, G->begin, G->end, "yy_1_SetextHeading1");
-  goto l1872;
-  l1873:;	  G->pos= yypos1873; G->thunkpos= yythunkpos1873;
-  }
-  {  int yypos1878= G->pos, yythunkpos1878= G->thunkpos;  if (!yy_Sp(G))  goto l1878;
-  if (!yy_AutoLabel(G))  goto l1878;
+YY_RULE(int) yy_HeadingSection(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "HeadingSection"));
+  if (!yy_StartList(G))  goto l2070;
   yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_2_SetextHeading1, G->begin, G->end, "yy_2_SetextHeading1");
+  if (!yy_Heading(G))  goto l2070;
+  yyDo(G, yy_1_HeadingSection, G->begin, G->end, "yy_1_HeadingSection");
 
-  {  int yypos1880= G->pos, yythunkpos1880= G->thunkpos;  if (!yy_Sp(G))  goto l1880;
-  goto l1881;
-  l1880:;	  G->pos= yypos1880; G->thunkpos= yythunkpos1880;
-  }
-  l1881:;	  goto l1879;
-  l1878:;	  G->pos= yypos1878; G->thunkpos= yythunkpos1878;
-  }
-  l1879:;	
-  {  int yypos1882= G->pos, yythunkpos1882= G->thunkpos;  if (!yy_Sp(G))  goto l1882;
-  goto l1883;
-  l1882:;	  G->pos= yypos1882; G->thunkpos= yythunkpos1882;
-  }
-  l1883:;	  if (!yy_Newline(G))  goto l1870;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1870;  if (!yy_SetextBottom1(G))  goto l1870;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1870;  yyDo(G, yy_3_SetextHeading1, G->begin, G->end, "yy_3_SetextHeading1");
-  yyprintf((stderr, "  ok   SetextHeading1"));
+  l2071:;	
+  {  int yypos2072= G->pos, yythunkpos2072= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !((parser_data *)G->data)->flat_sections )) goto l2072;  if (!yy_HeadingSectionBlock(G))  goto l2072;
+  yyDo(G, yy_2_HeadingSection, G->begin, G->end, "yy_2_HeadingSection");
+  goto l2071;
+  l2072:;	  G->pos= yypos2072; G->thunkpos= yythunkpos2072;
+  }  yyDo(G, yy_3_HeadingSection, G->begin, G->end, "yy_3_HeadingSection");
+  yyprintf((stderr, "  ok   HeadingSection"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l1870:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SetextHeading1"));
+  l2070:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HeadingSection"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_AtxStart(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AtxStart"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1884;
-  {  int yypos1885= G->pos, yythunkpos1885= G->thunkpos;  if (!yymatchString(G, "######")) goto l1886;
-  goto l1885;
-  l1886:;	  G->pos= yypos1885; G->thunkpos= yythunkpos1885;  if (!yymatchString(G, "#####")) goto l1887;
-  goto l1885;
-  l1887:;	  G->pos= yypos1885; G->thunkpos= yythunkpos1885;  if (!yymatchString(G, "####")) goto l1888;
-  goto l1885;
-  l1888:;	  G->pos= yypos1885; G->thunkpos= yythunkpos1885;  if (!yymatchString(G, "###")) goto l1889;
-  goto l1885;
-  l1889:;	  G->pos= yypos1885; G->thunkpos= yythunkpos1885;  if (!yymatchString(G, "##")) goto l1890;
-  goto l1885;
-  l1890:;	  G->pos= yypos1885; G->thunkpos= yythunkpos1885;  if (!yymatchChar(G, '#')) goto l1884;
+YY_RULE(int) yy_HorizontalRule(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HorizontalRule"));
+  if (!yy_NonindentSpace(G))  goto l2073;
+
+  {  int yypos2074= G->pos, yythunkpos2074= G->thunkpos;  if (!yymatchChar(G, '*')) goto l2075;
+  if (!yy_Sp(G))  goto l2075;
+  if (!yymatchChar(G, '*')) goto l2075;
+  if (!yy_Sp(G))  goto l2075;
+  if (!yymatchChar(G, '*')) goto l2075;
+
+  l2076:;	
+  {  int yypos2077= G->pos, yythunkpos2077= G->thunkpos;  if (!yy_Sp(G))  goto l2077;
+  if (!yymatchChar(G, '*')) goto l2077;
+  goto l2076;
+  l2077:;	  G->pos= yypos2077; G->thunkpos= yythunkpos2077;
+  }  goto l2074;
+  l2075:;	  G->pos= yypos2074; G->thunkpos= yythunkpos2074;  if (!yymatchChar(G, '-')) goto l2078;
+  if (!yy_Sp(G))  goto l2078;
+  if (!yymatchChar(G, '-')) goto l2078;
+  if (!yy_Sp(G))  goto l2078;
+  if (!yymatchChar(G, '-')) goto l2078;
+
+  l2079:;	
+  {  int yypos2080= G->pos, yythunkpos2080= G->thunkpos;  if (!yy_Sp(G))  goto l2080;
+  if (!yymatchChar(G, '-')) goto l2080;
+  goto l2079;
+  l2080:;	  G->pos= yypos2080; G->thunkpos= yythunkpos2080;
+  }  goto l2074;
+  l2078:;	  G->pos= yypos2074; G->thunkpos= yythunkpos2074;  if (!yymatchChar(G, '_')) goto l2073;
+  if (!yy_Sp(G))  goto l2073;
+  if (!yymatchChar(G, '_')) goto l2073;
+  if (!yy_Sp(G))  goto l2073;
+  if (!yymatchChar(G, '_')) goto l2073;
 
+  l2081:;	
+  {  int yypos2082= G->pos, yythunkpos2082= G->thunkpos;  if (!yy_Sp(G))  goto l2082;
+  if (!yymatchChar(G, '_')) goto l2082;
+  goto l2081;
+  l2082:;	  G->pos= yypos2082; G->thunkpos= yythunkpos2082;
   }
-  l1885:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1884;  yyDo(G, yy_1_AtxStart, G->begin, G->end, "yy_1_AtxStart");
-  yyprintf((stderr, "  ok   AtxStart"));
+  }
+  l2074:;	  if (!yy_Sp(G))  goto l2073;
+  if (!yy_Newline(G))  goto l2073;
+  if (!yy_BlankLine(G))  goto l2073;
+
+  l2083:;	
+  {  int yypos2084= G->pos, yythunkpos2084= G->thunkpos;  if (!yy_BlankLine(G))  goto l2084;
+  goto l2083;
+  l2084:;	  G->pos= yypos2084; G->thunkpos= yythunkpos2084;
+  }  yyDo(G, yy_1_HorizontalRule, G->begin, G->end, "yy_1_HorizontalRule");
+  yyprintf((stderr, "  ok   HorizontalRule"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1884:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AtxStart"));
+  l2073:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HorizontalRule"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Inline(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Inline"));
+YY_RULE(int) yy_LinkReference(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 4, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "LinkReference"));
+  if (!yy_StartList(G))  goto l2085;
+  yyDo(G, yySet, -4, 0, "yySet");
+  if (!yy_NonindentSpace(G))  goto l2085;
 
-  {  int yypos1892= G->pos, yythunkpos1892= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( ext(EXT_CRITIC) )) goto l1893;  if (!yy_CriticMarkup(G))  goto l1893;
-  goto l1892;
-  l1893:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1894;  if (!yy_DollarMath(G))  goto l1894;
-  goto l1892;
-  l1894:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Str(G))  goto l1895;
-  goto l1892;
-  l1895:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1896;  if (!yy_MathSpan(G))  goto l1896;
-  goto l1892;
-  l1896:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Endline(G))  goto l1897;
-  goto l1892;
-  l1897:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_UlOrStarLine(G))  goto l1898;
-  goto l1892;
-  l1898:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Space(G))  goto l1899;
-  goto l1892;
-  l1899:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Strong(G))  goto l1900;
-  goto l1892;
-  l1900:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Emph(G))  goto l1901;
-  goto l1892;
-  l1901:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1902;  if (!yy_CitationReference(G))  goto l1902;
-  goto l1892;
-  l1902:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Image(G))  goto l1903;
-  goto l1892;
-  l1903:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Link(G))  goto l1904;
-  goto l1892;
-  l1904:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_NoteReference(G))  goto l1905;
-  goto l1892;
-  l1905:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Code(G))  goto l1906;
-  goto l1892;
-  l1906:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_MarkdownHtmlTagOpen(G))  goto l1907;
-  goto l1892;
-  l1907:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_RawHtml(G))  goto l1908;
-  goto l1892;
-  l1908:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Entity(G))  goto l1909;
-  goto l1892;
-  l1909:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_EscapedChar(G))  goto l1910;
-  goto l1892;
-  l1910:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Smart(G))  goto l1911;
-  goto l1892;
-  l1911:;	  G->pos= yypos1892; G->thunkpos= yythunkpos1892;  if (!yy_Symbol(G))  goto l1891;
+  {  int yypos2086= G->pos, yythunkpos2086= G->thunkpos;  if (!yymatchString(G, "[]")) goto l2086;
+  goto l2085;
+  l2086:;	  G->pos= yypos2086; G->thunkpos= yythunkpos2086;
+  }  if (!yy_Label(G))  goto l2085;
+  yyDo(G, yySet, -3, 0, "yySet");
+  if (!yymatchChar(G, ':')) goto l2085;
+  if (!yy_Spnl(G))  goto l2085;
+  if (!yy_RefSrc(G))  goto l2085;
+  yyDo(G, yySet, -2, 0, "yySet");
+  if (!yy_RefTitle(G))  goto l2085;
+  yyDo(G, yySet, -1, 0, "yySet");
 
+  {  int yypos2087= G->pos, yythunkpos2087= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l2087;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2087;  if (!yy_Attributes(G))  goto l2087;
+  yyDo(G, yy_1_LinkReference, G->begin, G->end, "yy_1_LinkReference");
+  goto l2088;
+  l2087:;	  G->pos= yypos2087; G->thunkpos= yythunkpos2087;
   }
-  l1892:;	  yyprintf((stderr, "  ok   Inline"));
+  l2088:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2085;  if (!yy_BlankLine(G))  goto l2085;
+
+  l2089:;	
+  {  int yypos2090= G->pos, yythunkpos2090= G->thunkpos;  if (!yy_BlankLine(G))  goto l2090;
+  goto l2089;
+  l2090:;	  G->pos= yypos2090; G->thunkpos= yythunkpos2090;
+  }  yyDo(G, yy_2_LinkReference, G->begin, G->end, "yy_2_LinkReference");
+  yyprintf((stderr, "  ok   LinkReference"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 4, 0, "yyPop");
   return 1;
-  l1891:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Inline"));
+  l2085:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "LinkReference"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_AutoLabel(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AutoLabel"));
-  if (!yymatchChar(G, '[')) goto l1912;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1912;
-  {  int yypos1913= G->pos, yythunkpos1913= G->thunkpos;  if (!yy_Newline(G))  goto l1913;
-  goto l1912;
-  l1913:;	  G->pos= yypos1913; G->thunkpos= yythunkpos1913;
-  }
-  {  int yypos1914= G->pos, yythunkpos1914= G->thunkpos;  if (!yymatchChar(G, '^')) goto l1914;
-  goto l1912;
-  l1914:;	  G->pos= yypos1914; G->thunkpos= yythunkpos1914;
-  }
-  {  int yypos1915= G->pos, yythunkpos1915= G->thunkpos;  if (!yymatchChar(G, '#')) goto l1915;
-  goto l1912;
-  l1915:;	  G->pos= yypos1915; G->thunkpos= yythunkpos1915;
-  }  if (!yymatchDot(G)) goto l1912;
-  {  int yypos1918= G->pos, yythunkpos1918= G->thunkpos;  if (!yy_Newline(G))  goto l1918;
-  goto l1912;
-  l1918:;	  G->pos= yypos1918; G->thunkpos= yythunkpos1918;
-  }
-  {  int yypos1919= G->pos, yythunkpos1919= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1919;
-  goto l1912;
-  l1919:;	  G->pos= yypos1919; G->thunkpos= yythunkpos1919;
-  }  if (!yymatchDot(G)) goto l1912;
-  l1916:;	
-  {  int yypos1917= G->pos, yythunkpos1917= G->thunkpos;
-  {  int yypos1920= G->pos, yythunkpos1920= G->thunkpos;  if (!yy_Newline(G))  goto l1920;
-  goto l1917;
-  l1920:;	  G->pos= yypos1920; G->thunkpos= yythunkpos1920;
-  }
-  {  int yypos1921= G->pos, yythunkpos1921= G->thunkpos;  if (!yymatchChar(G, ']')) goto l1921;
-  goto l1917;
-  l1921:;	  G->pos= yypos1921; G->thunkpos= yythunkpos1921;
-  }  if (!yymatchDot(G)) goto l1917;  goto l1916;
-  l1917:;	  G->pos= yypos1917; G->thunkpos= yythunkpos1917;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1912;  if (!yymatchChar(G, ']')) goto l1912;
-
-  {  int yypos1922= G->pos, yythunkpos1922= G->thunkpos;
-  {  int yypos1923= G->pos, yythunkpos1923= G->thunkpos;
-  {  int yypos1924= G->pos, yythunkpos1924= G->thunkpos;  if (!yy_Sp(G))  goto l1924;
-  goto l1925;
-  l1924:;	  G->pos= yypos1924; G->thunkpos= yythunkpos1924;
-  }
-  l1925:;	
-  {  int yypos1926= G->pos, yythunkpos1926= G->thunkpos;  if (!yymatchChar(G, '(')) goto l1927;
-  goto l1926;
-  l1927:;	  G->pos= yypos1926; G->thunkpos= yythunkpos1926;  if (!yymatchChar(G, '[')) goto l1923;
+YY_RULE(int) yy_Note(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "Note"));
+  yyText(G, G->begin, G->end);  if (!( ext(EXT_NOTES) )) goto l2091;  if (!yy_NonindentSpace(G))  goto l2091;
+  if (!yy_RawNoteReference(G))  goto l2091;
+  yyDo(G, yySet, -2, 0, "yySet");
+  if (!yymatchChar(G, ':')) goto l2091;
+  if (!yy_Sp(G))  goto l2091;
+  if (!yy_StartList(G))  goto l2091;
+  yyDo(G, yySet, -1, 0, "yySet");
+  if (!yy_RawNoteBlock(G))  goto l2091;
+  yyDo(G, yy_1_Note, G->begin, G->end, "yy_1_Note");
 
-  }
-  l1926:;	  goto l1912;
-  l1923:;	  G->pos= yypos1923; G->thunkpos= yythunkpos1923;
-  }  G->pos= yypos1922; G->thunkpos= yythunkpos1922;
-  }  yyDo(G, yy_1_AutoLabel, G->begin, G->end, "yy_1_AutoLabel");
-  yyprintf((stderr, "  ok   AutoLabel"));
+  l2092:;	
+  {  int yypos2093= G->pos, yythunkpos2093= G->thunkpos;
+  {  int yypos2094= G->pos, yythunkpos2094= G->thunkpos;  if (!yy_Indent(G))  goto l2093;
+  G->pos= yypos2094; G->thunkpos= yythunkpos2094;
+  }  if (!yy_RawNoteBlock(G))  goto l2093;
+  yyDo(G, yy_2_Note, G->begin, G->end, "yy_2_Note");
+  goto l2092;
+  l2093:;	  G->pos= yypos2093; G->thunkpos= yythunkpos2093;
+  }  yyDo(G, yy_3_Note, G->begin, G->end, "yy_3_Note");
+  yyprintf((stderr, "  ok   Note"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l1912:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AutoLabel"));
+  l2091:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Note"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_AtxInline(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AtxInline"));
+YY_RULE(int) yy_Glossary(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "Glossary"));
+  yyText(G, G->begin, G->end);  if (!( ext(EXT_NOTES) )) goto l2095;  if (!yy_StartList(G))  goto l2095;
+  yyDo(G, yySet, -2, 0, "yySet");
+  if (!yy_NonindentSpace(G))  goto l2095;
+  if (!yy_RawNoteReference(G))  goto l2095;
+  yyDo(G, yySet, -1, 0, "yySet");
+  if (!yymatchChar(G, ':')) goto l2095;
+  if (!yy_Sp(G))  goto l2095;
+  if (!yymatchString(G, "glossary:")) goto l2095;
+  if (!yy_Sp(G))  goto l2095;
+  if (!yy_GlossaryTerm(G))  goto l2095;
+  yyDo(G, yy_1_Glossary, G->begin, G->end, "yy_1_Glossary");
 
-  {  int yypos1929= G->pos, yythunkpos1929= G->thunkpos;  if (!yy_Newline(G))  goto l1929;
-  goto l1928;
-  l1929:;	  G->pos= yypos1929; G->thunkpos= yythunkpos1929;
+  {  int yypos2096= G->pos, yythunkpos2096= G->thunkpos;  if (!yy_GlossarySortKey(G))  goto l2096;
+  yyDo(G, yy_2_Glossary, G->begin, G->end, "yy_2_Glossary");
+  goto l2097;
+  l2096:;	  G->pos= yypos2096; G->thunkpos= yythunkpos2096;
   }
-  {  int yypos1930= G->pos, yythunkpos1930= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1930;  if (!yy_Sp(G))  goto l1930;
-  if (!yy_AutoLabel(G))  goto l1930;
+  l2097:;	  if (!yy_Newline(G))  goto l2095;
+  if (!yy_RawNoteBlock(G))  goto l2095;
+  yyDo(G, yy_3_Glossary, G->begin, G->end, "yy_3_Glossary");
 
-  {  int yypos1931= G->pos, yythunkpos1931= G->thunkpos;  if (!yy_Sp(G))  goto l1931;
-  goto l1932;
-  l1931:;	  G->pos= yypos1931; G->thunkpos= yythunkpos1931;
-  }
-  l1932:;	
-  l1933:;	
-  {  int yypos1934= G->pos, yythunkpos1934= G->thunkpos;  if (!yymatchChar(G, '#')) goto l1934;
-  goto l1933;
-  l1934:;	  G->pos= yypos1934; G->thunkpos= yythunkpos1934;
-  }  if (!yy_Sp(G))  goto l1930;
-  if (!yy_Newline(G))  goto l1930;
-  goto l1928;
-  l1930:;	  G->pos= yypos1930; G->thunkpos= yythunkpos1930;
-  }
-  {  int yypos1935= G->pos, yythunkpos1935= G->thunkpos;
-  {  int yypos1936= G->pos, yythunkpos1936= G->thunkpos;  if (!yy_Sp(G))  goto l1936;
-  goto l1937;
-  l1936:;	  G->pos= yypos1936; G->thunkpos= yythunkpos1936;
-  }
-  l1937:;	
-  l1938:;	
-  {  int yypos1939= G->pos, yythunkpos1939= G->thunkpos;  if (!yymatchChar(G, '#')) goto l1939;
-  goto l1938;
-  l1939:;	  G->pos= yypos1939; G->thunkpos= yythunkpos1939;
-  }  if (!yy_Sp(G))  goto l1935;
-  if (!yy_Newline(G))  goto l1935;
-  goto l1928;
-  l1935:;	  G->pos= yypos1935; G->thunkpos= yythunkpos1935;
-  }  if (!yy_Inline(G))  goto l1928;
-  yyprintf((stderr, "  ok   AtxInline"));
+  l2098:;	
+  {  int yypos2099= G->pos, yythunkpos2099= G->thunkpos;
+  {  int yypos2100= G->pos, yythunkpos2100= G->thunkpos;  if (!yy_Indent(G))  goto l2099;
+  G->pos= yypos2100; G->thunkpos= yythunkpos2100;
+  }  if (!yy_RawNoteBlock(G))  goto l2099;
+  yyDo(G, yy_4_Glossary, G->begin, G->end, "yy_4_Glossary");
+  goto l2098;
+  l2099:;	  G->pos= yypos2099; G->thunkpos= yythunkpos2099;
+  }  yyDo(G, yy_5_Glossary, G->begin, G->end, "yy_5_Glossary");
+  yyprintf((stderr, "  ok   Glossary"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l1928:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AtxInline"));
+  l2095:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Glossary"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
-  return 0;
-}
-YY_RULE(int) yy_AtxHeading(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 3, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "AtxHeading"));
-  if (!yy_AtxStart(G))  goto l1940;
-  yyDo(G, yySet, -3, 0, "yySet");
+  return 0;
+}
+YY_RULE(int) yy_DefinitionList(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "DefinitionList"));
+  if (!yy_StartList(G))  goto l2101;
+  yyDo(G, yySet, -1, 0, "yySet");
+
+  {  int yypos2102= G->pos, yythunkpos2102= G->thunkpos;  if (!yy_TermLine(G))  goto l2101;
+
+  l2103:;	
+  {  int yypos2104= G->pos, yythunkpos2104= G->thunkpos;  if (!yy_TermLine(G))  goto l2104;
+  goto l2103;
+  l2104:;	  G->pos= yypos2104; G->thunkpos= yythunkpos2104;
+  }
+  {  int yypos2105= G->pos, yythunkpos2105= G->thunkpos;  if (!yy_Newline(G))  goto l2105;
+  goto l2106;
+  l2105:;	  G->pos= yypos2105; G->thunkpos= yythunkpos2105;
+  }
+  l2106:;	  if (!yy_NonindentSpace(G))  goto l2101;
+  if (!yymatchChar(G, ':')) goto l2101;
+  G->pos= yypos2102; G->thunkpos= yythunkpos2102;
+  }  if (!yy_Term(G))  goto l2101;
+  yyDo(G, yy_1_DefinitionList, G->begin, G->end, "yy_1_DefinitionList");
 
-  {  int yypos1941= G->pos, yythunkpos1941= G->thunkpos;  if (!yy_Sp(G))  goto l1941;
-  goto l1942;
-  l1941:;	  G->pos= yypos1941; G->thunkpos= yythunkpos1941;
+  l2109:;	
+  {  int yypos2110= G->pos, yythunkpos2110= G->thunkpos;  if (!yy_Term(G))  goto l2110;
+  yyDo(G, yy_1_DefinitionList, G->begin, G->end, "yy_1_DefinitionList");
+  goto l2109;
+  l2110:;	  G->pos= yypos2110; G->thunkpos= yythunkpos2110;
   }
-  l1942:;	  if (!yy_StartList(G))  goto l1940;
-  yyDo(G, yySet, -2, 0, "yySet");
-  if (!yy_AtxInline(G))  goto l1940;
-  yyDo(G, yy_1_AtxHeading, G->begin, G->end, "yy_1_AtxHeading");
+  {  int yypos2111= G->pos, yythunkpos2111= G->thunkpos;  if (!yy_BlankLine(G))  goto l2111;
+  goto l2112;
+  l2111:;	  G->pos= yypos2111; G->thunkpos= yythunkpos2111;
+  }
+  l2112:;	  if (!yy_Definition(G))  goto l2101;
+  yyDo(G, yy_2_DefinitionList, G->begin, G->end, "yy_2_DefinitionList");
 
-  l1943:;	
-  {  int yypos1944= G->pos, yythunkpos1944= G->thunkpos;  if (!yy_AtxInline(G))  goto l1944;
-  yyDo(G, yy_1_AtxHeading, G->begin, G->end, "yy_1_AtxHeading");
-  goto l1943;
-  l1944:;	  G->pos= yypos1944; G->thunkpos= yythunkpos1944;
+  l2113:;	
+  {  int yypos2114= G->pos, yythunkpos2114= G->thunkpos;  if (!yy_Definition(G))  goto l2114;
+  yyDo(G, yy_2_DefinitionList, G->begin, G->end, "yy_2_DefinitionList");
+  goto l2113;
+  l2114:;	  G->pos= yypos2114; G->thunkpos= yythunkpos2114;
   }
-  {  int yypos1945= G->pos, yythunkpos1945= G->thunkpos;
-  {  int yypos1947= G->pos, yythunkpos1947= G->thunkpos;  if (!yy_Sp(G))  goto l1947;
-  goto l1948;
-  l1947:;	  G->pos= yypos1947; G->thunkpos= yythunkpos1947;
+  l2115:;	
+  {  int yypos2116= G->pos, yythunkpos2116= G->thunkpos;  if (!yy_BlankLine(G))  goto l2116;
+  goto l2115;
+  l2116:;	  G->pos= yypos2116; G->thunkpos= yythunkpos2116;
   }
-  l1948:;	  if (!yy_AutoLabel(G))  goto l1945;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_2_AtxHeading, G->begin, G->end, "yy_2_AtxHeading");
-  goto l1946;
-  l1945:;	  G->pos= yypos1945; G->thunkpos= yythunkpos1945;
+  l2107:;	
+  {  int yypos2108= G->pos, yythunkpos2108= G->thunkpos;  if (!yy_Term(G))  goto l2108;
+  yyDo(G, yy_1_DefinitionList, G->begin, G->end, "yy_1_DefinitionList");
+
+  l2117:;	
+  {  int yypos2118= G->pos, yythunkpos2118= G->thunkpos;  if (!yy_Term(G))  goto l2118;
+  yyDo(G, yy_1_DefinitionList, G->begin, G->end, "yy_1_DefinitionList");
+  goto l2117;
+  l2118:;	  G->pos= yypos2118; G->thunkpos= yythunkpos2118;
   }
-  l1946:;	
-  {  int yypos1949= G->pos, yythunkpos1949= G->thunkpos;
-  {  int yypos1951= G->pos, yythunkpos1951= G->thunkpos;  if (!yy_Sp(G))  goto l1951;
-  goto l1952;
-  l1951:;	  G->pos= yypos1951; G->thunkpos= yythunkpos1951;
+  {  int yypos2119= G->pos, yythunkpos2119= G->thunkpos;  if (!yy_BlankLine(G))  goto l2119;
+  goto l2120;
+  l2119:;	  G->pos= yypos2119; G->thunkpos= yythunkpos2119;
   }
-  l1952:;	
-  l1953:;	
-  {  int yypos1954= G->pos, yythunkpos1954= G->thunkpos;  if (!yymatchChar(G, '#')) goto l1954;
-  goto l1953;
-  l1954:;	  G->pos= yypos1954; G->thunkpos= yythunkpos1954;
-  }  if (!yy_Sp(G))  goto l1949;
-  goto l1950;
-  l1949:;	  G->pos= yypos1949; G->thunkpos= yythunkpos1949;
+  l2120:;	  if (!yy_Definition(G))  goto l2108;
+  yyDo(G, yy_2_DefinitionList, G->begin, G->end, "yy_2_DefinitionList");
+
+  l2121:;	
+  {  int yypos2122= G->pos, yythunkpos2122= G->thunkpos;  if (!yy_Definition(G))  goto l2122;
+  yyDo(G, yy_2_DefinitionList, G->begin, G->end, "yy_2_DefinitionList");
+  goto l2121;
+  l2122:;	  G->pos= yypos2122; G->thunkpos= yythunkpos2122;
   }
-  l1950:;	  if (!yy_Sp(G))  goto l1940;
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l1940;  if (!yy_Newline(G))  goto l1940;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l1940;  yyDo(G, yy_3_AtxHeading, G->begin, G->end, "yy_3_AtxHeading");
-  yyprintf((stderr, "  ok   AtxHeading"));
+  l2123:;	
+  {  int yypos2124= G->pos, yythunkpos2124= G->thunkpos;  if (!yy_BlankLine(G))  goto l2124;
+  goto l2123;
+  l2124:;	  G->pos= yypos2124; G->thunkpos= yythunkpos2124;
+  }  goto l2107;
+  l2108:;	  G->pos= yypos2108; G->thunkpos= yythunkpos2108;
+  }  yyDo(G, yy_3_DefinitionList, G->begin, G->end, "yy_3_DefinitionList");
+  yyprintf((stderr, "  ok   DefinitionList"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 3, 0, "yyPop");
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l1940:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AtxHeading"));
+  l2101:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DefinitionList"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Heading(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Heading"));
+/* Verbatim blocks are scanned a line at a time and built as one node.  The
+	rules would make a STR of each line (less its Indent), a "\n" for each
+	blank line between chunks, and join them with mk_str_from_list;
+	yyVerbatimText does the same in one pass over the block's text. */
+YY_ACTION(void) yyVerbatimText(GREG *G, char *yytext, int yyleng, yythunk *thunk, YY_XTYPE YY_XVAR)
+{
+  char *text= (char *)malloc(yyleng + 1), *out= text, *p= yytext, *end= yytext + yyleng, *nl, *eol, *q;
+  yyprintf((stderr, "do yyVerbatimText"));
+  yyprintfvTcontext(yytext);
+  yyprintf((stderr, "\n"));
+  while (p < end)
+    {
+      nl= (char *)memchr(p, '\n', end - p);
+      eol= nl ? nl + 1 : end;
+      for (q= p; (q < eol) && ((*q == ' ') || (*q == '\t')); ++q)
+        ;
+      if (q == nl)
+        *out++= '\n';
+      else
+        {
+          p+= (*p == '\t') ? 1 : 4;
+          memcpy(out, p, eol - p);
+          out+= eol - p;
+        }
+      p= eol;
+    }
+  *out= '\0';
+  yy= node(VERBATIM);
+  yy->str= text;
+}
 
-  {  int yypos1956= G->pos, yythunkpos1956= G->thunkpos;  if (!yy_SetextHeading(G))  goto l1957;
-  goto l1956;
-  l1957:;	  G->pos= yypos1956; G->thunkpos= yythunkpos1956;  if (!yy_AtxHeading(G))  goto l1955;
+/* yyVerbatimLine -- sort the line starting at buffer index i for Verbatim:
+	0 for a BlankLine, 1 for a NonblankIndentedLine, 2 for anything else,
+	-1 if it holds a carriage return.  *next is set to the index after its
+	Newline, or to the end of the input. */
+YY_LOCAL(int) yyVerbatimLine(GREG *G, int i, int *next)
+{
+  char *nl;
+  int from= i, j;
 
-  }
-  l1956:;	  yyprintf((stderr, "  ok   Heading"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
+  while (!(nl= (char *)memchr(G->buf + from, '\n', G->limit - from)))
+    {
+      from= G->limit;
+      if (yyByteAt(G, from) == -1)
+        break;
+    }
+  *next= nl ? (int)(nl - G->buf) + 1 : G->limit;
+  if (memchr(G->buf + i, '\r', *next - i))
+    return -1;
 
-  return 1;
-  l1955:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Heading"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+  for (j= i; (j < *next) && ((G->buf[j] == ' ') || (G->buf[j] == '\t')); ++j)
+    ;
+  if (nl && (j == *next - 1))
+    return 0;
+  if ((i < *next) && (G->buf[i] == '\t'))
+    j= i + 1;
+  else if ((*next - i >= 4) && !memcmp(G->buf + i, "    ", 4))
+    j= i + 4;
+  else
+    return 2;
+  return (nl || (j < *next)) ? 1 : 2;     /* Line wants a Newline or a character */
+}
 
-  return 0;
+/* yyVerbatimEnd -- buffer index after the last NonblankIndentedLine of the
+	Verbatim block at the current position, with *after set past the blank
+	lines that follow it; -1 if there is no such block or the rules should
+	handle it (carriage returns) */
+YY_LOCAL(int) yyVerbatimEnd(GREG *G, int *after)
+{
+  int i= G->pos, next, end= -1, kind;
+
+  while ((kind= yyVerbatimLine(G, i, &next)) != 2)
+    {
+      if (kind < 0)
+        return -1;
+      if (kind == 1)
+        end= next;
+      i= next;
+    }
+  *after= i;
+  return end;
 }
-YY_RULE(int) yy_HeadingSectionBlock(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HeadingSectionBlock"));
 
-  l1959:;	
-  {  int yypos1960= G->pos, yythunkpos1960= G->thunkpos;  if (!yy_BlankLine(G))  goto l1960;
-  goto l1959;
-  l1960:;	  G->pos= yypos1960; G->thunkpos= yythunkpos1960;
-  }
-  {  int yypos1961= G->pos, yythunkpos1961= G->thunkpos;  if (!yy_Heading(G))  goto l1961;
-  goto l1958;
-  l1961:;	  G->pos= yypos1961; G->thunkpos= yythunkpos1961;
+YY_RULE(int) yy_Verbatim(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "Verbatim"));
+
+  l2126:;	
+  {  int yypos2127= G->pos, yythunkpos2127= G->thunkpos;  if (!yy_BlankLine(G))  goto l2127;
+  goto l2126;
+  l2127:;	  G->pos= yypos2127; G->thunkpos= yythunkpos2127;
   }
-  {  int yypos1962= G->pos, yythunkpos1962= G->thunkpos;  if (!yy_BlockQuote(G))  goto l1963;
-  goto l1962;
-  l1963:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_Verbatim(G))  goto l1964;
-  goto l1962;
-  l1964:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1965;  if (!yy_DefinitionList(G))  goto l1965;
-  goto l1962;
-  l1965:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1966;  if (!yy_Glossary(G))  goto l1966;
-  goto l1962;
-  l1966:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_Note(G))  goto l1967;
-  goto l1962;
-  l1967:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_LinkReference(G))  goto l1968;
-  goto l1962;
-  l1968:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_HorizontalRule(G))  goto l1969;
-  goto l1962;
-  l1969:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_OrderedList(G))  goto l1970;
-  goto l1962;
-  l1970:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_BulletList(G))  goto l1971;
-  goto l1962;
-  l1971:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_HtmlBlock(G))  goto l1972;
-  goto l1962;
-  l1972:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_MarkdownHtmlBlock(G))  goto l1973;
-  goto l1962;
-  l1973:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_StyleBlock(G))  goto l1974;
-  goto l1962;
-  l1974:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1975;  if (!yy_Table(G))  goto l1975;
-  goto l1962;
-  l1975:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l1976;  if (!yy_ImageBlock(G))  goto l1976;
-  goto l1962;
-  l1976:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;
-  {  int yypos1978= G->pos, yythunkpos1978= G->thunkpos;
-  {  int yypos1979= G->pos, yythunkpos1979= G->thunkpos;  if (!yy_Sp(G))  goto l1979;
-  goto l1980;
-  l1979:;	  G->pos= yypos1979; G->thunkpos= yythunkpos1979;
+  {  int yyafter, yyend= yyVerbatimEnd(G, &yyafter);  if (yyend < 0) goto l2248;
+  G->begin= G->pos;  G->end= yyend;  G->pos= yyafter;  yyDo(G, yyVerbatimText, G->begin, G->end, "yyVerbatimText");
+  goto l2249;
   }
-  l1980:;	  if (!yy_HtmlBlockInTags(G))  goto l1978;
-  goto l1977;
-  l1978:;	  G->pos= yypos1978; G->thunkpos= yythunkpos1978;
-  }  if (!yy_Para(G))  goto l1977;
-  goto l1962;
-  l1977:;	  G->pos= yypos1962; G->thunkpos= yythunkpos1962;  if (!yy_Plain(G))  goto l1958;
+  l2248:;	  if (!yy_StartList(G))  goto l2125;
+  yyDo(G, yySet, -1, 0, "yySet");
+  if (!yy_VerbatimChunk(G))  goto l2125;
+  yyDo(G, yy_1_Verbatim, G->begin, G->end, "yy_1_Verbatim");
 
+  l2128:;	
+  {  int yypos2129= G->pos, yythunkpos2129= G->thunkpos;  if (!yy_VerbatimChunk(G))  goto l2129;
+  yyDo(G, yy_1_Verbatim, G->begin, G->end, "yy_1_Verbatim");
+  goto l2128;
+  l2129:;	  G->pos= yypos2129; G->thunkpos= yythunkpos2129;
   }
-  l1962:;	  yyprintf((stderr, "  ok   HeadingSectionBlock"));
+  l2130:;	
+  {  int yypos2131= G->pos, yythunkpos2131= G->thunkpos;  if (!yy_BlankLine(G))  goto l2131;
+  goto l2130;
+  l2131:;	  G->pos= yypos2131; G->thunkpos= yythunkpos2131;
+  }  yyDo(G, yy_2_Verbatim, G->begin, G->end, "yy_2_Verbatim");
+
+  l2249:;	  yyprintf((stderr, "  ok   Verbatim"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l1958:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HeadingSectionBlock"));
+  l2125:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Verbatim"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Plain(GREG *G)
+YY_RULE(int) yy_BlockQuote(GREG *G)
 {  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "Plain"));
-  if (!yy_Inlines(G))  goto l1981;
+  yyprintfv((stderr, "%s\n", "BlockQuote"));
+  if (!yy_BlockQuoteRaw(G))  goto l2132;
   yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_Plain, G->begin, G->end, "yy_1_Plain");
-  yyprintf((stderr, "  ok   Plain"));
+  yyDo(G, yy_1_BlockQuote, G->begin, G->end, "yy_1_BlockQuote");
+  yyprintf((stderr, "  ok   BlockQuote"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
   yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l1981:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Plain"));
+  l2132:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "BlockQuote"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Para(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "Para"));
-  if (!yy_NonindentSpace(G))  goto l1982;
-  if (!yy_Inlines(G))  goto l1982;
-  yyDo(G, yySet, -1, 0, "yySet");
-  if (!yy_BlankLine(G))  goto l1982;
+YY_RULE(int) yy_RawLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RawLine"));
+
+  {  int yypos2134= G->pos, yythunkpos2134= G->thunkpos;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2135;
+  l2136:;	
+  {  int yypos2137= G->pos, yythunkpos2137= G->thunkpos;
+  {  int yypos2138= G->pos, yythunkpos2138= G->thunkpos;  if (!yymatchChar(G, '\r')) goto l2138;
+  goto l2137;
+  l2138:;	  G->pos= yypos2138; G->thunkpos= yythunkpos2138;
+  }
+  {  int yypos2139= G->pos, yythunkpos2139= G->thunkpos;  if (!yymatchChar(G, '\n')) goto l2139;
+  goto l2137;
+  l2139:;	  G->pos= yypos2139; G->thunkpos= yythunkpos2139;
+  }  if (!yymatchDot(G)) goto l2137;  goto l2136;
+  l2137:;	  G->pos= yypos2137; G->thunkpos= yythunkpos2137;
+  }  if (!yy_Newline(G))  goto l2135;
+  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2135;  goto l2134;
+  l2135:;	  G->pos= yypos2134; G->thunkpos= yythunkpos2134;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2133;  if (!yymatchDot(G)) goto l2133;
+  l2140:;	
+  {  int yypos2141= G->pos, yythunkpos2141= G->thunkpos;  if (!yymatchDot(G)) goto l2141;  goto l2140;
+  l2141:;	  G->pos= yypos2141; G->thunkpos= yythunkpos2141;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2133;  if (!yy_Eof(G))  goto l2133;
 
-  l1983:;	
-  {  int yypos1984= G->pos, yythunkpos1984= G->thunkpos;  if (!yy_BlankLine(G))  goto l1984;
-  goto l1983;
-  l1984:;	  G->pos= yypos1984; G->thunkpos= yythunkpos1984;
-  }  yyDo(G, yy_1_Para, G->begin, G->end, "yy_1_Para");
-  yyprintf((stderr, "  ok   Para"));
+  }
+  l2134:;	  yyprintf((stderr, "  ok   RawLine"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
+
   return 1;
-  l1982:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Para"));
+  l2133:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RawLine"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlockInTags(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlockInTags"));
-
-  {  int yypos1986= G->pos, yythunkpos1986= G->thunkpos;  if (!yy_HtmlBlockAddress(G))  goto l1987;
-  goto l1986;
-  l1987:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockArticle(G))  goto l1988;
-  goto l1986;
-  l1988:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockAside(G))  goto l1989;
-  goto l1986;
-  l1989:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockCanvas(G))  goto l1990;
-  goto l1986;
-  l1990:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockBlockquote(G))  goto l1991;
-  goto l1986;
-  l1991:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockCenter(G))  goto l1992;
-  goto l1986;
-  l1992:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockDir(G))  goto l1993;
-  goto l1986;
-  l1993:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockDiv(G))  goto l1994;
-  goto l1986;
-  l1994:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockDl(G))  goto l1995;
-  goto l1986;
-  l1995:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockFieldset(G))  goto l1996;
-  goto l1986;
-  l1996:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockFigure(G))  goto l1997;
-  goto l1986;
-  l1997:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockFooter(G))  goto l1998;
-  goto l1986;
-  l1998:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockForm(G))  goto l1999;
-  goto l1986;
-  l1999:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockHeader(G))  goto l2000;
-  goto l1986;
-  l2000:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockHgroup(G))  goto l2001;
-  goto l1986;
-  l2001:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockH1(G))  goto l2002;
-  goto l1986;
-  l2002:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockH2(G))  goto l2003;
-  goto l1986;
-  l2003:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockH3(G))  goto l2004;
-  goto l1986;
-  l2004:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockH4(G))  goto l2005;
-  goto l1986;
-  l2005:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockH5(G))  goto l2006;
-  goto l1986;
-  l2006:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockH6(G))  goto l2007;
-  goto l1986;
-  l2007:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockMenu(G))  goto l2008;
-  goto l1986;
-  l2008:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockNoframes(G))  goto l2009;
-  goto l1986;
-  l2009:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockNoscript(G))  goto l2010;
-  goto l1986;
-  l2010:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockOl(G))  goto l2011;
-  goto l1986;
-  l2011:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockP(G))  goto l2012;
-  goto l1986;
-  l2012:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockPre(G))  goto l2013;
-  goto l1986;
-  l2013:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockProgress(G))  goto l2014;
-  goto l1986;
-  l2014:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockSection(G))  goto l2015;
-  goto l1986;
-  l2015:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockTable(G))  goto l2016;
-  goto l1986;
-  l2016:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockUl(G))  goto l2017;
-  goto l1986;
-  l2017:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockVideo(G))  goto l2018;
-  goto l1986;
-  l2018:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockDd(G))  goto l2019;
-  goto l1986;
-  l2019:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockDt(G))  goto l2020;
-  goto l1986;
-  l2020:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockFrameset(G))  goto l2021;
-  goto l1986;
-  l2021:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockLi(G))  goto l2022;
-  goto l1986;
-  l2022:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockTbody(G))  goto l2023;
-  goto l1986;
-  l2023:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockTd(G))  goto l2024;
-  goto l1986;
-  l2024:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockTfoot(G))  goto l2025;
-  goto l1986;
-  l2025:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockTh(G))  goto l2026;
-  goto l1986;
-  l2026:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockThead(G))  goto l2027;
-  goto l1986;
-  l2027:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockTr(G))  goto l2028;
-  goto l1986;
-  l2028:;	  G->pos= yypos1986; G->thunkpos= yythunkpos1986;  if (!yy_HtmlBlockScript(G))  goto l1985;
-
-  }
-  l1986:;	  yyprintf((stderr, "  ok   HtmlBlockInTags"));
+YY_RULE(int) yy_SingleLineMetaKeyValue(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SingleLineMetaKeyValue"));
+  if (!yy_MetaDataKey(G))  goto l2142;
+  if (!yy_Sp(G))  goto l2142;
+  if (!yymatchChar(G, ':')) goto l2142;
+  if (!yy_Sp(G))  goto l2142;
+
+  l2143:;	
+  {  int yypos2144= G->pos, yythunkpos2144= G->thunkpos;
+  {  int yypos2145= G->pos, yythunkpos2145= G->thunkpos;  if (!yy_Newline(G))  goto l2145;
+  goto l2144;
+  l2145:;	  G->pos= yypos2145; G->thunkpos= yythunkpos2145;
+  }  if (!yymatchDot(G)) goto l2144;  goto l2143;
+  l2144:;	  G->pos= yypos2144; G->thunkpos= yythunkpos2144;
+  }  yyprintf((stderr, "  ok   SingleLineMetaKeyValue"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l1985:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlockInTags"));
+  l2142:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SingleLineMetaKeyValue"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_ImageBlock(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "ImageBlock"));
-  if (!yy_Image(G))  goto l2029;
-  if (!yy_Sp(G))  goto l2029;
-  if (!yy_Newline(G))  goto l2029;
-  if (!yy_BlankLine(G))  goto l2029;
-
-  l2030:;	
-  {  int yypos2031= G->pos, yythunkpos2031= G->thunkpos;  if (!yy_BlankLine(G))  goto l2031;
-  goto l2030;
-  l2031:;	  G->pos= yypos2031; G->thunkpos= yythunkpos2031;
-  }  yyDo(G, yy_1_ImageBlock, G->begin, G->end, "yy_1_ImageBlock");
-  yyprintf((stderr, "  ok   ImageBlock"));
+YY_RULE(int) yy_AlphanumericAscii(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AlphanumericAscii"));
+  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z0-9")) goto l2146;
+  yyprintf((stderr, "  ok   AlphanumericAscii"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l2029:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "ImageBlock"));
+  l2146:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AlphanumericAscii"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Table(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "Table"));
-  if (!yy_StartList(G))  goto l2032;
-  yyDo(G, yySet, -2, 0, "yySet");
-  if (!yy_StartList(G))  goto l2032;
+YY_RULE(int) yy_MetaDataValue(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "MetaDataValue"));
+  if (!yy_StartList(G))  goto l2147;
   yyDo(G, yySet, -1, 0, "yySet");
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2147;
+  l2148:;	
+  {  int yypos2149= G->pos, yythunkpos2149= G->thunkpos;
+  {  int yypos2150= G->pos, yythunkpos2150= G->thunkpos;  if (!yy_Newline(G))  goto l2150;
+  goto l2149;
+  l2150:;	  G->pos= yypos2150; G->thunkpos= yythunkpos2150;
+  }  if (!yymatchDot(G)) goto l2149;  goto l2148;
+  l2149:;	  G->pos= yypos2149; G->thunkpos= yythunkpos2149;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2147;  yyDo(G, yy_1_MetaDataValue, G->begin, G->end, "yy_1_MetaDataValue");
 
-  {  int yypos2033= G->pos, yythunkpos2033= G->thunkpos;  if (!yy_TableCaption(G))  goto l2033;
-  yyDo(G, yy_1_Table, G->begin, G->end, "yy_1_Table");
-  goto l2034;
-  l2033:;	  G->pos= yypos2033; G->thunkpos= yythunkpos2033;
-  }
-  l2034:;	  if (!yy_TableBody(G))  goto l2032;
-  yyDo(G, yy_2_Table, G->begin, G->end, "yy_2_Table");
-  if (!yy_SeparatorLine(G))  goto l2032;
-  yyDo(G, yy_3_Table, G->begin, G->end, "yy_3_Table");
-  if (!yy_TableBody(G))  goto l2032;
-  yyDo(G, yy_4_Table, G->begin, G->end, "yy_4_Table");
-
-  l2035:;	
-  {  int yypos2036= G->pos, yythunkpos2036= G->thunkpos;  if (!yy_BlankLine(G))  goto l2036;
-
-  {  int yypos2037= G->pos, yythunkpos2037= G->thunkpos;  if (!yy_TableCaption(G))  goto l2037;
-  goto l2036;
-  l2037:;	  G->pos= yypos2037; G->thunkpos= yythunkpos2037;
-  }  if (!yy_TableBody(G))  goto l2036;
-  yyDo(G, yy_5_Table, G->begin, G->end, "yy_5_Table");
-
-  {  int yypos2038= G->pos, yythunkpos2038= G->thunkpos;
-  {  int yypos2039= G->pos, yythunkpos2039= G->thunkpos;  if (!yy_TableCaption(G))  goto l2040;
-  goto l2039;
-  l2040:;	  G->pos= yypos2039; G->thunkpos= yythunkpos2039;  if (!yy_BlankLine(G))  goto l2036;
+  {  int yypos2151= G->pos, yythunkpos2151= G->thunkpos;  if (!yy_Newline(G))  goto l2152;
 
+  {  int yypos2153= G->pos, yythunkpos2153= G->thunkpos;
+  {  int yypos2154= G->pos, yythunkpos2154= G->thunkpos;  if (!yy_BlankLine(G))  goto l2154;
+  goto l2152;
+  l2154:;	  G->pos= yypos2154; G->thunkpos= yythunkpos2154;
   }
-  l2039:;	  G->pos= yypos2038; G->thunkpos= yythunkpos2038;
-  }  goto l2035;
-  l2036:;	  G->pos= yypos2036; G->thunkpos= yythunkpos2036;
-  }
-  {  int yypos2041= G->pos, yythunkpos2041= G->thunkpos;  if (!yy_TableCaption(G))  goto l2042;
-  yyDo(G, yy_6_Table, G->begin, G->end, "yy_6_Table");
+  {  int yypos2155= G->pos, yythunkpos2155= G->thunkpos;  if (!yy_SingleLineMetaKeyValue(G))  goto l2155;
+  goto l2152;
+  l2155:;	  G->pos= yypos2155; G->thunkpos= yythunkpos2155;
+  }  if (!yy_Sp(G))  goto l2152;
+  if (!yy_RawLine(G))  goto l2152;
+  G->pos= yypos2153; G->thunkpos= yythunkpos2153;
+  }  yyDo(G, yy_2_MetaDataValue, G->begin, G->end, "yy_2_MetaDataValue");
+  goto l2151;
+  l2152:;	  G->pos= yypos2151; G->thunkpos= yythunkpos2151;  if (!yy_Newline(G))  goto l2147;
 
-  {  int yypos2043= G->pos, yythunkpos2043= G->thunkpos;  if (!yy_BlankLine(G))  goto l2042;
-  G->pos= yypos2043; G->thunkpos= yythunkpos2043;
-  }  goto l2041;
-  l2042:;	  G->pos= yypos2041; G->thunkpos= yythunkpos2041;
-  {  int yypos2044= G->pos, yythunkpos2044= G->thunkpos;  if (!yy_BlankLine(G))  goto l2032;
-  G->pos= yypos2044; G->thunkpos= yythunkpos2044;
   }
+  l2151:;	
+  l2156:;	
+  {  int yypos2157= G->pos, yythunkpos2157= G->thunkpos;
+  {  int yypos2158= G->pos, yythunkpos2158= G->thunkpos;  if (!yy_BlankLine(G))  goto l2158;
+  goto l2157;
+  l2158:;	  G->pos= yypos2158; G->thunkpos= yythunkpos2158;
   }
-  l2041:;	  yyDo(G, yy_7_Table, G->begin, G->end, "yy_7_Table");
-  yyprintf((stderr, "  ok   Table"));
+  {  int yypos2159= G->pos, yythunkpos2159= G->thunkpos;  if (!yy_SingleLineMetaKeyValue(G))  goto l2159;
+  goto l2157;
+  l2159:;	  G->pos= yypos2159; G->thunkpos= yythunkpos2159;
+  }  if (!yy_Sp(G))  goto l2157;
+  if (!yy_RawLine(G))  goto l2157;
+  yyDo(G, yy_3_MetaDataValue, G->begin, G->end, "yy_3_MetaDataValue");
+  goto l2156;
+  l2157:;	  G->pos= yypos2157; G->thunkpos= yythunkpos2157;
+  }  yyDo(G, yy_4_MetaDataValue, G->begin, G->end, "yy_4_MetaDataValue");
+  yyprintf((stderr, "  ok   MetaDataValue"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l2032:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Table"));
+  l2147:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "MetaDataValue"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_StyleBlock(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "StyleBlock"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2045;  if (!yy_InStyleTags(G))  goto l2045;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2045;
-  l2046:;	
-  {  int yypos2047= G->pos, yythunkpos2047= G->thunkpos;  if (!yy_BlankLine(G))  goto l2047;
-  goto l2046;
-  l2047:;	  G->pos= yypos2047; G->thunkpos= yythunkpos2047;
-  }  yyDo(G, yy_1_StyleBlock, G->begin, G->end, "yy_1_StyleBlock");
-  yyprintf((stderr, "  ok   StyleBlock"));
+YY_RULE(int) yy_MetaDataKeyValue(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "MetaDataKeyValue"));
+  if (!yy_MetaDataKey(G))  goto l2160;
+  yyDo(G, yySet, -2, 0, "yySet");
+  if (!yy_Sp(G))  goto l2160;
+  if (!yymatchChar(G, ':')) goto l2160;
+  if (!yy_Sp(G))  goto l2160;
+  if (!yy_MetaDataValue(G))  goto l2160;
+  yyDo(G, yySet, -1, 0, "yySet");
+  yyDo(G, yy_1_MetaDataKeyValue, G->begin, G->end, "yy_1_MetaDataKeyValue");
+  yyprintf((stderr, "  ok   MetaDataKeyValue"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l2045:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "StyleBlock"));
+  l2160:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "MetaDataKeyValue"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_MarkdownHtmlBlock(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "MarkdownHtmlBlock"));
+YY_RULE(int) yy_SetextHeading(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SetextHeading"));
 
-  {  int yypos2049= G->pos, yythunkpos2049= G->thunkpos;  if (!yy_MarkdownHtmlTagOpen(G))  goto l2048;
-  G->pos= yypos2049; G->thunkpos= yythunkpos2049;
-  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2048;
-  {  int yypos2050= G->pos, yythunkpos2050= G->thunkpos;  if (!yy_HtmlBlockInTags(G))  goto l2051;
-  goto l2050;
-  l2051:;	  G->pos= yypos2050; G->thunkpos= yythunkpos2050;  if (!yy_HtmlComment(G))  goto l2052;
-  goto l2050;
-  l2052:;	  G->pos= yypos2050; G->thunkpos= yythunkpos2050;  if (!yy_HtmlBlockSelfClosing(G))  goto l2048;
+  {  int yypos2162= G->pos, yythunkpos2162= G->thunkpos;  if (!yy_SetextHeading1(G))  goto l2163;
+  goto l2162;
+  l2163:;	  G->pos= yypos2162; G->thunkpos= yythunkpos2162;  if (!yy_SetextHeading2(G))  goto l2161;
 
   }
-  l2050:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2048;  if (!yy_BlankLine(G))  goto l2048;
+  l2162:;	  yyprintf((stderr, "  ok   SetextHeading"));
+  yyprintfGcontext;
+  yyprintf((stderr, "\n"));
 
-  l2053:;	
-  {  int yypos2054= G->pos, yythunkpos2054= G->thunkpos;  if (!yy_BlankLine(G))  goto l2054;
-  goto l2053;
-  l2054:;	  G->pos= yypos2054; G->thunkpos= yythunkpos2054;
-  }  yyDo(G, yy_1_MarkdownHtmlBlock, G->begin, G->end, "yy_1_MarkdownHtmlBlock");
-  yyprintf((stderr, "  ok   MarkdownHtmlBlock"));
+  return 1;
+  l2161:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SetextHeading"));
+  yyprintfvGcontext;
+  yyprintfv((stderr, "\n"));
+
+  return 0;
+}
+YY_RULE(int) yy_BlankLine(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "BlankLine"));
+  if (!yy_Sp(G))  goto l2164;
+  if (!yy_Newline(G))  goto l2164;
+  yyprintf((stderr, "  ok   BlankLine"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l2048:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "MarkdownHtmlBlock"));
+  l2164:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "BlankLine"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HtmlBlock(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HtmlBlock"));
+YY_RULE(int) yy_Block(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Block"));
 
-  {  int yypos2056= G->pos, yythunkpos2056= G->thunkpos;  if (!yy_MarkdownHtmlTagOpen(G))  goto l2056;
-  goto l2055;
-  l2056:;	  G->pos= yypos2056; G->thunkpos= yythunkpos2056;
-  }  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2055;
-  {  int yypos2057= G->pos, yythunkpos2057= G->thunkpos;  if (!yy_HtmlBlockInTags(G))  goto l2058;
-  goto l2057;
-  l2058:;	  G->pos= yypos2057; G->thunkpos= yythunkpos2057;  if (!yy_HtmlComment(G))  goto l2059;
-  goto l2057;
-  l2059:;	  G->pos= yypos2057; G->thunkpos= yythunkpos2057;  if (!yy_HtmlBlockSelfClosing(G))  goto l2055;
+  l2166:;	
+  {  int yypos2167= G->pos, yythunkpos2167= G->thunkpos;  if (!yy_BlankLine(G))  goto l2167;
+  goto l2166;
+  l2167:;	  G->pos= yypos2167; G->thunkpos= yythunkpos2167;
+  }
+  {  int yypos2168= G->pos, yythunkpos2168= G->thunkpos;  unsigned int yyclass= yyLineClass(G);
+  if (!(yyclass & LINE_QUOTE)) goto l2169;
+  if (!yy_BlockQuote(G))  goto l2169;
+  goto l2168;
+  l2169:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!(yyclass & LINE_INDENTED)) goto l2170;
+  if (!yy_Verbatim(G))  goto l2170;
+  goto l2168;
+  l2170:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l2171;  if (!(yyclass & LINE_TERM)) goto l2171;
+  if (!yy_DefinitionList(G))  goto l2171;
+  goto l2168;
+  l2171:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l2172;  if (!(yyclass & LINE_BRACKET)) goto l2172;
+  if (!yy_Glossary(G))  goto l2172;
+  goto l2168;
+  l2172:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!(yyclass & LINE_BRACKET)) goto l2173;
+  if (!yy_Note(G))  goto l2173;
+  goto l2168;
+  l2173:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!(yyclass & LINE_BRACKET)) goto l2174;
+  if (!yy_LinkReference(G))  goto l2174;
+  goto l2168;
+  l2174:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!(yyclass & LINE_RULE)) goto l2175;
+  if (!yy_HorizontalRule(G))  goto l2175;
+  goto l2168;
+  l2175:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!(yyclass & (LINE_ATX | LINE_SETEXT))) goto l2176;
+  if (!yy_HeadingSection(G))  goto l2176;
+  goto l2168;
+  l2176:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!(yyclass & LINE_ORDERED)) goto l2177;
+  if (!yy_OrderedList(G))  goto l2177;
+  goto l2168;
+  l2177:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!(yyclass & LINE_BULLET)) goto l2178;
+  if (!yy_BulletList(G))  goto l2178;
+  goto l2168;
+  l2178:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!(yyclass & LINE_HTML)) goto l2181;
+  if (!yy_HtmlBlock(G))  goto l2179;
+  goto l2168;
+  l2179:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!yy_MarkdownHtmlBlock(G))  goto l2180;
+  goto l2168;
+  l2180:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!yy_StyleBlock(G))  goto l2181;
+  goto l2168;
+  l2181:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l2182;  if (!(yyclass & (LINE_PIPE | LINE_BRACKET))) goto l2182;
+  if (!yy_Table(G))  goto l2182;
+  goto l2168;
+  l2182:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l2183;  if (!(yyclass & LINE_BANG)) goto l2183;
+  if (!yy_ImageBlock(G))  goto l2183;
+  goto l2168;
+  l2183:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;
+  {  int yypos2185= G->pos, yythunkpos2185= G->thunkpos;  if (!(yyclass & LINE_SP_HTML)) goto l2185;
+  {  int yypos2186= G->pos, yythunkpos2186= G->thunkpos;  if (!yy_Sp(G))  goto l2186;
+  goto l2187;
+  l2186:;	  G->pos= yypos2186; G->thunkpos= yythunkpos2186;
+  }
+  l2187:;	  if (!yy_HtmlBlockInTags(G))  goto l2185;
+  goto l2184;
+  l2185:;	  G->pos= yypos2185; G->thunkpos= yythunkpos2185;
+  }  if (!yy_Para(G))  goto l2184;
+  goto l2168;
+  l2184:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!yy_Plain(G))  goto l2165;
 
   }
-  l2057:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2055;  if (!yy_BlankLine(G))  goto l2055;
-
-  l2060:;	
-  {  int yypos2061= G->pos, yythunkpos2061= G->thunkpos;  if (!yy_BlankLine(G))  goto l2061;
-  goto l2060;
-  l2061:;	  G->pos= yypos2061; G->thunkpos= yythunkpos2061;
-  }  yyDo(G, yy_1_HtmlBlock, G->begin, G->end, "yy_1_HtmlBlock");
-  yyprintf((stderr, "  ok   HtmlBlock"));
+  l2168:;	  yyprintf((stderr, "  ok   Block"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l2055:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HtmlBlock"));
+  l2165:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Block"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_BulletList(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "BulletList"));
+YY_RULE(int) yy_MetaData(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
+  yyprintfv((stderr, "%s\n", "MetaData"));
+  if (!yy_StartList(G))  goto l2188;
+  yyDo(G, yySet, -1, 0, "yySet");
 
-  {  int yypos2063= G->pos, yythunkpos2063= G->thunkpos;  if (!yy_Bullet(G))  goto l2062;
-  G->pos= yypos2063; G->thunkpos= yythunkpos2063;
-  }
-  {  int yypos2064= G->pos, yythunkpos2064= G->thunkpos;  if (!yy_ListTight(G))  goto l2065;
-  goto l2064;
-  l2065:;	  G->pos= yypos2064; G->thunkpos= yythunkpos2064;  if (!yy_ListLoose(G))  goto l2062;
+  {  int yypos2189= G->pos, yythunkpos2189= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z")) goto l2189;
 
+  l2190:;	
+  {  int yypos2191= G->pos, yythunkpos2191= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z")) goto l2191;
+  goto l2190;
+  l2191:;	  G->pos= yypos2191; G->thunkpos= yythunkpos2191;
+  }  if (!yymatchString(G, "://")) goto l2189;
+  goto l2188;
+  l2189:;	  G->pos= yypos2189; G->thunkpos= yythunkpos2189;
   }
-  l2064:;	  yyDo(G, yy_1_BulletList, G->begin, G->end, "yy_1_BulletList");
-  yyprintf((stderr, "  ok   BulletList"));
+  {  int yypos2192= G->pos, yythunkpos2192= G->thunkpos;  if (!yy_SetextHeading(G))  goto l2192;
+  goto l2188;
+  l2192:;	  G->pos= yypos2192; G->thunkpos= yythunkpos2192;
+  }  if (!yy_MetaDataKeyValue(G))  goto l2188;
+  yyDo(G, yy_1_MetaData, G->begin, G->end, "yy_1_MetaData");
+
+  l2193:;	
+  {  int yypos2194= G->pos, yythunkpos2194= G->thunkpos;  if (!yy_MetaDataKeyValue(G))  goto l2194;
+  yyDo(G, yy_1_MetaData, G->begin, G->end, "yy_1_MetaData");
+  goto l2193;
+  l2194:;	  G->pos= yypos2194; G->thunkpos= yythunkpos2194;
+  }  yyDo(G, yy_2_MetaData, G->begin, G->end, "yy_2_MetaData");
+  yyprintf((stderr, "  ok   MetaData"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-
+  yyDo(G, yyPop, 1, 0, "yyPop");
   return 1;
-  l2062:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "BulletList"));
+  l2188:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "MetaData"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_OrderedList(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "OrderedList"));
+YY_RULE(int) yy_Newline(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Newline"));
 
-  {  int yypos2067= G->pos, yythunkpos2067= G->thunkpos;  if (!yy_Enumerator(G))  goto l2066;
-  G->pos= yypos2067; G->thunkpos= yythunkpos2067;
-  }
-  {  int yypos2068= G->pos, yythunkpos2068= G->thunkpos;  if (!yy_ListTight(G))  goto l2069;
-  goto l2068;
-  l2069:;	  G->pos= yypos2068; G->thunkpos= yythunkpos2068;  if (!yy_ListLoose(G))  goto l2066;
+  {  int yypos2196= G->pos, yythunkpos2196= G->thunkpos;  if (!yymatchChar(G, '\n')) goto l2197;
+  goto l2196;
+  l2197:;	  G->pos= yypos2196; G->thunkpos= yythunkpos2196;  if (!yymatchChar(G, '\r')) goto l2195;
 
+  {  int yypos2198= G->pos, yythunkpos2198= G->thunkpos;  if (!yymatchChar(G, '\n')) goto l2198;
+  goto l2199;
+  l2198:;	  G->pos= yypos2198; G->thunkpos= yythunkpos2198;
   }
-  l2068:;	  yyDo(G, yy_1_OrderedList, G->begin, G->end, "yy_1_OrderedList");
-  yyprintf((stderr, "  ok   OrderedList"));
+  l2199:;	
+  }
+  l2196:;	  yyprintf((stderr, "  ok   Newline"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l2066:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "OrderedList"));
+  l2195:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Newline"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_HeadingSection(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "HeadingSection"));
-  if (!yy_StartList(G))  goto l2070;
-  yyDo(G, yySet, -1, 0, "yySet");
-  if (!yy_Heading(G))  goto l2070;
-  yyDo(G, yy_1_HeadingSection, G->begin, G->end, "yy_1_HeadingSection");
+YY_RULE(int) yy_Sp(GREG *G)
+{  yyprintfv((stderr, "%s\n", "Sp"));
 
-  l2071:;	
-  {  int yypos2072= G->pos, yythunkpos2072= G->thunkpos;  if (!yy_HeadingSectionBlock(G))  goto l2072;
-  yyDo(G, yy_2_HeadingSection, G->begin, G->end, "yy_2_HeadingSection");
-  goto l2071;
-  l2072:;	  G->pos= yypos2072; G->thunkpos= yythunkpos2072;
-  }  yyDo(G, yy_3_HeadingSection, G->begin, G->end, "yy_3_HeadingSection");
-  yyprintf((stderr, "  ok   HeadingSection"));
+  l2201:;	
+  {  int yypos2202= G->pos, yythunkpos2202= G->thunkpos;  if (!yy_Spacechar(G))  goto l2202;
+  goto l2201;
+  l2202:;	  G->pos= yypos2202; G->thunkpos= yythunkpos2202;
+  }  yyprintf((stderr, "  ok   Sp"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
-  return 1;
-  l2070:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HeadingSection"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
 
-  return 0;
+  return 1;
 }
-YY_RULE(int) yy_HorizontalRule(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "HorizontalRule"));
-  if (!yy_NonindentSpace(G))  goto l2073;
+YY_RULE(int) yy_MetaDataKey(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "MetaDataKey"));
+  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2203;
+  {  int yypos2204= G->pos, yythunkpos2204= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z")) goto l2204;
 
-  {  int yypos2074= G->pos, yythunkpos2074= G->thunkpos;  if (!yymatchChar(G, '*')) goto l2075;
-  if (!yy_Sp(G))  goto l2075;
-  if (!yymatchChar(G, '*')) goto l2075;
-  if (!yy_Sp(G))  goto l2075;
-  if (!yymatchChar(G, '*')) goto l2075;
+  l2205:;	
+  {  int yypos2206= G->pos, yythunkpos2206= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z")) goto l2206;
+  goto l2205;
+  l2206:;	  G->pos= yypos2206; G->thunkpos= yythunkpos2206;
+  }  if (!yymatchString(G, "://")) goto l2204;
+  goto l2203;
+  l2204:;	  G->pos= yypos2204; G->thunkpos= yythunkpos2204;
+  }  if (!yy_AlphanumericAscii(G))  goto l2203;
 
-  l2076:;	
-  {  int yypos2077= G->pos, yythunkpos2077= G->thunkpos;  if (!yy_Sp(G))  goto l2077;
-  if (!yymatchChar(G, '*')) goto l2077;
-  goto l2076;
-  l2077:;	  G->pos= yypos2077; G->thunkpos= yythunkpos2077;
-  }  goto l2074;
-  l2075:;	  G->pos= yypos2074; G->thunkpos= yythunkpos2074;  if (!yymatchChar(G, '-')) goto l2078;
-  if (!yy_Sp(G))  goto l2078;
-  if (!yymatchChar(G, '-')) goto l2078;
-  if (!yy_Sp(G))  goto l2078;
-  if (!yymatchChar(G, '-')) goto l2078;
+  l2207:;	
+  {  int yypos2208= G->pos, yythunkpos2208= G->thunkpos;  if (!yy_Sp(G))  goto l2208;
 
-  l2079:;	
-  {  int yypos2080= G->pos, yythunkpos2080= G->thunkpos;  if (!yy_Sp(G))  goto l2080;
-  if (!yymatchChar(G, '-')) goto l2080;
-  goto l2079;
-  l2080:;	  G->pos= yypos2080; G->thunkpos= yythunkpos2080;
-  }  goto l2074;
-  l2078:;	  G->pos= yypos2074; G->thunkpos= yythunkpos2074;  if (!yymatchChar(G, '_')) goto l2073;
-  if (!yy_Sp(G))  goto l2073;
-  if (!yymatchChar(G, '_')) goto l2073;
-  if (!yy_Sp(G))  goto l2073;
-  if (!yymatchChar(G, '_')) goto l2073;
+  {  int yypos2211= G->pos, yythunkpos2211= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l2212;
+  goto l2211;
+  l2212:;	  G->pos= yypos2211; G->thunkpos= yythunkpos2211;  if (!yymatchChar(G, '_')) goto l2213;
+  goto l2211;
+  l2213:;	  G->pos= yypos2211; G->thunkpos= yythunkpos2211;  if (!yymatchChar(G, ' ')) goto l2214;
+  goto l2211;
+  l2214:;	  G->pos= yypos2211; G->thunkpos= yythunkpos2211;  if (!yymatchChar(G, '-')) goto l2215;
+  goto l2211;
+  l2215:;	  G->pos= yypos2211; G->thunkpos= yythunkpos2211;  if (!yymatchChar(G, '.')) goto l2208;
 
-  l2081:;	
-  {  int yypos2082= G->pos, yythunkpos2082= G->thunkpos;  if (!yy_Sp(G))  goto l2082;
-  if (!yymatchChar(G, '_')) goto l2082;
-  goto l2081;
-  l2082:;	  G->pos= yypos2082; G->thunkpos= yythunkpos2082;
-  }
   }
-  l2074:;	  if (!yy_Sp(G))  goto l2073;
-  if (!yy_Newline(G))  goto l2073;
-  if (!yy_BlankLine(G))  goto l2073;
+  l2211:;	
+  l2209:;	
+  {  int yypos2210= G->pos, yythunkpos2210= G->thunkpos;
+  {  int yypos2216= G->pos, yythunkpos2216= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l2217;
+  goto l2216;
+  l2217:;	  G->pos= yypos2216; G->thunkpos= yythunkpos2216;  if (!yymatchChar(G, '_')) goto l2218;
+  goto l2216;
+  l2218:;	  G->pos= yypos2216; G->thunkpos= yythunkpos2216;  if (!yymatchChar(G, ' ')) goto l2219;
+  goto l2216;
+  l2219:;	  G->pos= yypos2216; G->thunkpos= yythunkpos2216;  if (!yymatchChar(G, '-')) goto l2220;
+  goto l2216;
+  l2220:;	  G->pos= yypos2216; G->thunkpos= yythunkpos2216;  if (!yymatchChar(G, '.')) goto l2210;
 
-  l2083:;	
-  {  int yypos2084= G->pos, yythunkpos2084= G->thunkpos;  if (!yy_BlankLine(G))  goto l2084;
-  goto l2083;
-  l2084:;	  G->pos= yypos2084; G->thunkpos= yythunkpos2084;
-  }  yyDo(G, yy_1_HorizontalRule, G->begin, G->end, "yy_1_HorizontalRule");
-  yyprintf((stderr, "  ok   HorizontalRule"));
+  }
+  l2216:;	  goto l2209;
+  l2210:;	  G->pos= yypos2210; G->thunkpos= yythunkpos2210;
+  }  goto l2207;
+  l2208:;	  G->pos= yypos2208; G->thunkpos= yythunkpos2208;
+  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2203;  yyDo(G, yy_1_MetaDataKey, G->begin, G->end, "yy_1_MetaDataKey");
+  yyprintf((stderr, "  ok   MetaDataKey"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
 
   return 1;
-  l2073:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "HorizontalRule"));
+  l2203:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "MetaDataKey"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_LinkReference(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 4, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "LinkReference"));
-  if (!yy_StartList(G))  goto l2085;
-  yyDo(G, yySet, -4, 0, "yySet");
-  if (!yy_NonindentSpace(G))  goto l2085;
-
-  {  int yypos2086= G->pos, yythunkpos2086= G->thunkpos;  if (!yymatchString(G, "[]")) goto l2086;
-  goto l2085;
-  l2086:;	  G->pos= yypos2086; G->thunkpos= yythunkpos2086;
-  }  if (!yy_Label(G))  goto l2085;
-  yyDo(G, yySet, -3, 0, "yySet");
-  if (!yymatchChar(G, ':')) goto l2085;
-  if (!yy_Spnl(G))  goto l2085;
-  if (!yy_RefSrc(G))  goto l2085;
-  yyDo(G, yySet, -2, 0, "yySet");
-  if (!yy_RefTitle(G))  goto l2085;
-  yyDo(G, yySet, -1, 0, "yySet");
-
-  {  int yypos2087= G->pos, yythunkpos2087= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l2087;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2087;  if (!yy_Attributes(G))  goto l2087;
-  yyDo(G, yy_1_LinkReference, G->begin, G->end, "yy_1_LinkReference");
-  goto l2088;
-  l2087:;	  G->pos= yypos2087; G->thunkpos= yythunkpos2087;
-  }
-  l2088:;	  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2085;  if (!yy_BlankLine(G))  goto l2085;
+YY_RULE(int) yy_StartList(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "StartList"));
 
-  l2089:;	
-  {  int yypos2090= G->pos, yythunkpos2090= G->thunkpos;  if (!yy_BlankLine(G))  goto l2090;
-  goto l2089;
-  l2090:;	  G->pos= yypos2090; G->thunkpos= yythunkpos2090;
-  }  yyDo(G, yy_2_LinkReference, G->begin, G->end, "yy_2_LinkReference");
-  yyprintf((stderr, "  ok   LinkReference"));
+  {  int yypos2222= G->pos, yythunkpos2222= G->thunkpos;  if (!yymatchDot(G)) goto l2221;  G->pos= yypos2222; G->thunkpos= yythunkpos2222;
+  }  yyDo(G, yy_1_StartList, G->begin, G->end, "yy_1_StartList");
+  yyprintf((stderr, "  ok   StartList"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 4, 0, "yyPop");
+
   return 1;
-  l2085:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "LinkReference"));
+  l2221:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "StartList"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
-
-  return 0;
-}
-YY_RULE(int) yy_Note(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "Note"));
-  yyText(G, G->begin, G->end);  if (!( ext(EXT_NOTES) )) goto l2091;  if (!yy_NonindentSpace(G))  goto l2091;
-  if (!yy_RawNoteReference(G))  goto l2091;
-  yyDo(G, yySet, -2, 0, "yySet");
-  if (!yymatchChar(G, ':')) goto l2091;
-  if (!yy_Sp(G))  goto l2091;
-  if (!yy_StartList(G))  goto l2091;
-  yyDo(G, yySet, -1, 0, "yySet");
-  if (!yy_RawNoteBlock(G))  goto l2091;
-  yyDo(G, yy_1_Note, G->begin, G->end, "yy_1_Note");
-
-  l2092:;	
-  {  int yypos2093= G->pos, yythunkpos2093= G->thunkpos;
-  {  int yypos2094= G->pos, yythunkpos2094= G->thunkpos;  if (!yy_Indent(G))  goto l2093;
-  G->pos= yypos2094; G->thunkpos= yythunkpos2094;
-  }  if (!yy_RawNoteBlock(G))  goto l2093;
-  yyDo(G, yy_2_Note, G->begin, G->end, "yy_2_Note");
-  goto l2092;
-  l2093:;	  G->pos= yypos2093; G->thunkpos= yythunkpos2093;
-  }  yyDo(G, yy_3_Note, G->begin, G->end, "yy_3_Note");
-  yyprintf((stderr, "  ok   Note"));
+
+  return 0;
+}
+YY_RULE(int) yy_BOM(GREG *G)
+{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "BOM"));
+  if (!yymatchString(G, "\357\273\277")) goto l2223;
+  yyprintf((stderr, "  ok   BOM"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
+
   return 1;
-  l2091:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Note"));
+  l2223:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "BOM"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_Glossary(GREG *G)
+YY_RULE(int) yy_Doc(GREG *G)
 {  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "Glossary"));
-  yyText(G, G->begin, G->end);  if (!( ext(EXT_NOTES) )) goto l2095;  if (!yy_StartList(G))  goto l2095;
+  yyprintfv((stderr, "%s\n", "Doc"));
+
+  {  int yypos2225= G->pos, yythunkpos2225= G->thunkpos;  if (!yy_BOM(G))  goto l2225;
+  goto l2226;
+  l2225:;	  G->pos= yypos2225; G->thunkpos= yythunkpos2225;
+  }
+  l2226:;	  if (!yy_StartList(G))  goto l2224;
   yyDo(G, yySet, -2, 0, "yySet");
-  if (!yy_NonindentSpace(G))  goto l2095;
-  if (!yy_RawNoteReference(G))  goto l2095;
+  if (!yy_StartList(G))  goto l2224;
   yyDo(G, yySet, -1, 0, "yySet");
-  if (!yymatchChar(G, ':')) goto l2095;
-  if (!yy_Sp(G))  goto l2095;
-  if (!yymatchString(G, "glossary:")) goto l2095;
-  if (!yy_Sp(G))  goto l2095;
-  if (!yy_GlossaryTerm(G))  goto l2095;
-  yyDo(G, yy_1_Glossary, G->begin, G->end, "yy_1_Glossary");
 
-  {  int yypos2096= G->pos, yythunkpos2096= G->thunkpos;  if (!yy_GlossarySortKey(G))  goto l2096;
-  yyDo(G, yy_2_Glossary, G->begin, G->end, "yy_2_Glossary");
-  goto l2097;
-  l2096:;	  G->pos= yypos2096; G->thunkpos= yythunkpos2096;
-  }
-  l2097:;	  if (!yy_Newline(G))  goto l2095;
-  if (!yy_RawNoteBlock(G))  goto l2095;
-  yyDo(G, yy_3_Glossary, G->begin, G->end, "yy_3_Glossary");
+  {  int yypos2227= G->pos, yythunkpos2227= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && !ext(EXT_NO_METADATA) )) goto l2227;
+  {  int yypos2229= G->pos, yythunkpos2229= G->thunkpos;  if (!yy_MetaDataKey(G))  goto l2227;
+  if (!yy_Sp(G))  goto l2227;
+  if (!yymatchChar(G, ':')) goto l2227;
+  if (!yy_Sp(G))  goto l2227;
 
-  l2098:;	
-  {  int yypos2099= G->pos, yythunkpos2099= G->thunkpos;
-  {  int yypos2100= G->pos, yythunkpos2100= G->thunkpos;  if (!yy_Indent(G))  goto l2099;
-  G->pos= yypos2100; G->thunkpos= yythunkpos2100;
-  }  if (!yy_RawNoteBlock(G))  goto l2099;
-  yyDo(G, yy_4_Glossary, G->begin, G->end, "yy_4_Glossary");
-  goto l2098;
-  l2099:;	  G->pos= yypos2099; G->thunkpos= yythunkpos2099;
-  }  yyDo(G, yy_5_Glossary, G->begin, G->end, "yy_5_Glossary");
-  yyprintf((stderr, "  ok   Glossary"));
+  {  int yypos2230= G->pos, yythunkpos2230= G->thunkpos;  if (!yy_Newline(G))  goto l2230;
+  goto l2227;
+  l2230:;	  G->pos= yypos2230; G->thunkpos= yythunkpos2230;
+  }  G->pos= yypos2229; G->thunkpos= yythunkpos2229;
+  }  if (!yy_MetaData(G))  goto l2227;
+  yyDo(G, yy_1_Doc, G->begin, G->end, "yy_1_Doc");
+  goto l2228;
+  l2227:;	  G->pos= yypos2227; G->thunkpos= yythunkpos2227;
+  }
+  l2228:;	
+  l2231:;	
+  {  int yypos2232= G->pos, yythunkpos2232= G->thunkpos;  if (!yy_Block(G))  goto l2232;
+  yyDo(G, yy_2_Doc, G->begin, G->end, "yy_2_Doc");
+  goto l2231;
+  l2232:;	  G->pos= yypos2232; G->thunkpos= yythunkpos2232;
+  }
+  l2233:;	
+  {  int yypos2234= G->pos, yythunkpos2234= G->thunkpos;  if (!yy_BlankLine(G))  goto l2234;
+  goto l2233;
+  l2234:;	  G->pos= yypos2234; G->thunkpos= yythunkpos2234;
+  }  yyDo(G, yy_3_Doc, G->begin, G->end, "yy_3_Doc");
+  yyprintf((stderr, "  ok   Doc"));
   yyprintfGcontext;
   yyprintf((stderr, "\n"));
   yyDo(G, yyPop, 2, 0, "yyPop");
   return 1;
-  l2095:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Glossary"));
+  l2224:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Doc"));
   yyprintfvGcontext;
   yyprintfv((stderr, "\n"));
 
   return 0;
 }
-YY_RULE(int) yy_DefinitionList(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "DefinitionList"));
-  if (!yy_StartList(G))  goto l2101;
-  yyDo(G, yySet, -1, 0, "yySet");
 
-  {  int yypos2102= G->pos, yythunkpos2102= G->thunkpos;  if (!yy_TermLine(G))  goto l2101;
+#ifndef YY_PART
 
-  l2103:;	
-  {  int yypos2104= G->pos, yythunkpos2104= G->thunkpos;  if (!yy_TermLine(G))  goto l2104;
-  goto l2103;
-  l2104:;	  G->pos= yypos2104; G->thunkpos= yythunkpos2104;
-  }
-  {  int yypos2105= G->pos, yythunkpos2105= G->thunkpos;  if (!yy_Newline(G))  goto l2105;
-  goto l2106;
-  l2105:;	  G->pos= yypos2105; G->thunkpos= yythunkpos2105;
-  }
-  l2106:;	  if (!yy_NonindentSpace(G))  goto l2101;
-  if (!yymatchChar(G, ':')) goto l2101;
-  G->pos= yypos2102; G->thunkpos= yythunkpos2102;
-  }  if (!yy_Term(G))  goto l2101;
-  yyDo(G, yy_1_DefinitionList, G->begin, G->end, "yy_1_DefinitionList");
+typedef int (*yyrule)(GREG *G);
 
-  l2109:;	
-  {  int yypos2110= G->pos, yythunkpos2110= G->thunkpos;  if (!yy_Term(G))  goto l2110;
-  yyDo(G, yy_1_DefinitionList, G->begin, G->end, "yy_1_DefinitionList");
-  goto l2109;
-  l2110:;	  G->pos= yypos2110; G->thunkpos= yythunkpos2110;
-  }
-  {  int yypos2111= G->pos, yythunkpos2111= G->thunkpos;  if (!yy_BlankLine(G))  goto l2111;
-  goto l2112;
-  l2111:;	  G->pos= yypos2111; G->thunkpos= yythunkpos2111;
-  }
-  l2112:;	  if (!yy_Definition(G))  goto l2101;
-  yyDo(G, yy_2_DefinitionList, G->begin, G->end, "yy_2_DefinitionList");
+/* parse_try -- match yystart against the input without running its
+	actions or letting go of the matched input; follow with parse_accept,
+	or parse_retract to match again from the same place */
+YY_PARSE(int) YY_NAME(parse_try)(GREG *G, yyrule yystart)
+{
+  if (!G->buflen)
+    {
+      G->buflen= YY_BUFFER_START_SIZE;
+      G->buf= (char*)YY_ALLOC(G->buflen, G->data);
+      G->textlen= YY_BUFFER_START_SIZE;
+      G->text= (char*)YY_ALLOC(G->textlen, G->data);
+      G->thunkslen= YY_STACK_SIZE;
+      G->thunks= (yythunk*)YY_ALLOC(sizeof(yythunk) * G->thunkslen, G->data);
+      G->valslen= YY_STACK_SIZE;
+      G->vals= (YYSTYPE*)YY_ALLOC(sizeof(YYSTYPE) * G->valslen, G->data);
+      G->begin= G->end= G->pos= G->limit= G->thunkpos= 0;
+    }
+  G->pos = 0;
+  G->begin= G->end= G->pos;
+  G->thunkpos= 0;
+  G->val= G->vals;
+  return yystart(G);
+}
 
-  l2113:;	
-  {  int yypos2114= G->pos, yythunkpos2114= G->thunkpos;  if (!yy_Definition(G))  goto l2114;
-  yyDo(G, yy_2_DefinitionList, G->begin, G->end, "yy_2_DefinitionList");
-  goto l2113;
-  l2114:;	  G->pos= yypos2114; G->thunkpos= yythunkpos2114;
-  }
-  l2115:;	
-  {  int yypos2116= G->pos, yythunkpos2116= G->thunkpos;  if (!yy_BlankLine(G))  goto l2116;
-  goto l2115;
-  l2116:;	  G->pos= yypos2116; G->thunkpos= yythunkpos2116;
-  }
-  l2107:;	
-  {  int yypos2108= G->pos, yythunkpos2108= G->thunkpos;  if (!yy_Term(G))  goto l2108;
-  yyDo(G, yy_1_DefinitionList, G->begin, G->end, "yy_1_DefinitionList");
+YY_PARSE(void) YY_NAME(parse_accept)(GREG *G)
+{
+  yyDone(G);
+  yyCommit(G);
+}
+
+YY_PARSE(void) YY_NAME(parse_retract)(GREG *G)
+{
+  G->begin= G->end= G->pos= 0;
+  G->thunkpos= 0;
+}
+
+YY_PARSE(int) YY_NAME(parse_from)(GREG *G, yyrule yystart)
+{
+  int yyok= YY_NAME(parse_try)(G, yystart);
+  if (yyok) yyDone(G);
+  yyCommit(G);
+  return yyok;
+  (void)yyrefill;
+  (void)yymatchDot;
+  (void)yymatchChar;
+  (void)yymatchString;
+  (void)yymatchClass;
+  (void)yyDo;
+  (void)yyText;
+  (void)yyDone;
+  (void)yyCommit;
+  (void)yyAccept;
+  (void)yyPush;
+  (void)yyPop;
+  (void)yySet;
+}
+
+YY_PARSE(int) YY_NAME(parse)(GREG *G)
+{
+  return YY_NAME(parse_from)(G, yy_Doc);
+}
+
+YY_PARSE(void) YY_NAME(init)(GREG *G)
+{
+    memset(G, 0, sizeof(GREG));
+}
+YY_PARSE(void) YY_NAME(deinit)(GREG *G)
+{
+    if (G->buf) YY_FREE(G->buf);
+    if (G->text) YY_FREE(G->text);
+    if (G->thunks) YY_FREE(G->thunks);
+    if (G->vals) YY_FREE((void*)G->vals);
+}
+YY_PARSE(GREG *) YY_NAME(parse_new)(YY_XTYPE data)
+{
+  GREG *G = (GREG *)YY_CALLOC(1, sizeof(GREG), G->data);
+  G->data = data;
+  return G;
+}
+
+YY_PARSE(void) YY_NAME(parse_free)(GREG *G)
+{
+  YY_NAME(deinit)(G);
+  YY_FREE(G);
+}
+
+#endif
+
+
+/* process_raw_blocks -- follow the tree and process any RAW nodes and insert them
+	into the tree */
+node * process_raw_blocks(node * n, int extensions) {
+	/* from the parser data we get the parent node and pointer to reference list */
+	node *current = NULL;
+	node *last_child = NULL;
+	char *contents;
+	char *saveptr;
+	GREG g;
+	line_map lines = { NULL, 0, 0, 0 };
+	link_scan tails = { NULL, NULL, 0, 0, 0, { NO_SCAN_END, NO_SCAN_END }, { NO_SCAN_END, NO_SCAN_END } };
+	html_scan blocks = { NULL, 0, 0, NULL, 0 };
+
+	current = n;
+	
+	while (current != NULL) {
+		if (current->key == RAW) {
+			/* Process this RAW block */
+			
+			yyinit(&g);
+			contents = strtok_r(current->str, "\001", &saveptr);
+			current->key = LIST;
+			g.data = mk_parser_data(contents, (extensions | EXT_NO_METADATA ));
+			classify_lines(&lines, contents, strlen(contents), "");
+			((parser_data *)g.data)->lines = &lines;
+			reset_link_scan(&tails);
+			((parser_data *)g.data)->tails = &tails;
+			reset_html_scan(&blocks);
+			((parser_data *)g.data)->blocks = &blocks;
+			
+			while (yyparse(&g));
+			
+			current->children = ((parser_data *)g.data)->result;
+			
+			free((parser_data *)g.data);	/* we're not using free_parser_data to preserve result tree */
+			
+			yydeinit(&g);
+			
+			last_child = current->children;
+			while ((contents = strtok_r(NULL, "\001", &saveptr))) {
+				while (last_child->next != NULL) 
+					last_child = last_child->next;
+					
+					yyinit(&g);
+					g.data = mk_parser_data(contents, (extensions | EXT_NO_METADATA ));
+					classify_lines(&lines, contents, strlen(contents), "");
+					((parser_data *)g.data)->lines = &lines;
+					reset_link_scan(&tails);
+					((parser_data *)g.data)->tails = &tails;
+					reset_html_scan(&blocks);
+					((parser_data *)g.data)->blocks = &blocks;
+					while (yyparse(&g));
+					last_child->next = ((parser_data *)g.data)->result;
+					free((parser_data *)g.data);
+					yydeinit(&g);
+			}
+			free(current->str);
+			current->str = NULL;
+		}
+		if (current->children != NULL) {
+			/* Recurse into children */
+			current->children = process_raw_blocks(current->children, extensions);
+		}
+		current = current->next;
+	}
+	free_line_map(&lines);
+	free_link_scan(&tails);
+	free_html_scan(&blocks);
+	return n;
+}
+
+/* A converter keeps the parser context, preformat buffer, scratch pad and
+	output buffer of the last conversion so that they can be reset and reused
+	by the next one, rather than being rebuilt for every document */
+struct mmd_converter {
+	int          extensions;
+	int          format;
+	GREG         g;               /* parser context; buffers kept between runs */
+	parser_data  data;
+	GString     *formatted;       /* preformatted input */
+	line_map     lines;           /* classes of the input lines */
+	link_scan    tails;           /* link tails seen by the linear inline engine */
+	html_scan    blocks;          /* where HTML blocks end */
+	GString     *out;             /* output of the last conversion */
+	scratch_pad *scratch;
+};
+
+/* Buffers that grew past this size are released after a conversion rather
+	than held on to */
+#define CONVERTER_RETAIN_LIMIT (1 << 20)
+
+mmd_converter * mmd_converter_new(int extensions, int format) {
+	mmd_converter *c = (mmd_converter *)malloc(sizeof(mmd_converter));
+	c->extensions = extensions;
+	c->format     = format;
+	yyinit(&c->g);
+	c->g.data     = &c->data;
+	c->formatted  = g_string_sized_new(0);
+	c->lines.lines = NULL;
+	c->lines.count = c->lines.capacity = c->lines.cursor = 0;
+	c->tails.source_end = NULL;
+	c->tails.pending = NULL;
+	c->tails.capacity = 0;
+	reset_link_scan(&c->tails);
+	c->blocks.entries = NULL;
+	c->blocks.pending = NULL;
+	c->blocks.count = c->blocks.capacity = c->blocks.room = 0;
+	c->out        = NULL;
+	c->scratch    = mk_scratch_pad(extensions);
+	return c;
+}
+
+void mmd_converter_free(mmd_converter *c) {
+	if (c == NULL)
+		return;
+	yydeinit(&c->g);
+	g_string_free(c->formatted, true);
+	free_line_map(&c->lines);
+	free_link_scan(&c->tails);
+	free_html_scan(&c->blocks);
+	g_string_free(c->out, true);
+	free_scratch_pad(c->scratch);
+	free(c);
+}
+
+/* reset_parser_context -- rewind a used parser to an empty input, keeping
+	its buffers and stacks */
+static void reset_parser_context(GREG *g) {
+	g->begin = g->end = g->pos = g->limit = g->offset = 0;
+	g->thunkpos = 0;
+	g->val = g->vals;
+}
+
+/* release_large_buffers -- don't let one huge document pin its memory */
+static void release_large_buffers(mmd_converter *c) {
+	if ((c->g.buflen > CONVERTER_RETAIN_LIMIT) || (c->g.thunkslen > CONVERTER_RETAIN_LIMIT)) {
+		yydeinit(&c->g);
+		yyinit(&c->g);
+		c->g.data = &c->data;
+	}
+	if (c->lines.capacity * sizeof(line_info) > CONVERTER_RETAIN_LIMIT)
+		free_line_map(&c->lines);
+	if (c->tails.capacity * sizeof(size_t) > CONVERTER_RETAIN_LIMIT)
+		free_link_scan(&c->tails);
+	if (c->blocks.capacity * sizeof(html_scan_entry) > CONVERTER_RETAIN_LIMIT)
+		free_html_scan(&c->blocks);
+	if (c->formatted->currentStringBufferSize > CONVERTER_RETAIN_LIMIT) {
+		g_string_free(c->formatted, true);
+		c->formatted = g_string_sized_new(0);
+	}
+}
 
-  l2117:;	
-  {  int yypos2118= G->pos, yythunkpos2118= G->thunkpos;  if (!yy_Term(G))  goto l2118;
-  yyDo(G, yy_1_DefinitionList, G->begin, G->end, "yy_1_DefinitionList");
-  goto l2117;
-  l2118:;	  G->pos= yypos2118; G->thunkpos= yythunkpos2118;
-  }
-  {  int yypos2119= G->pos, yythunkpos2119= G->thunkpos;  if (!yy_BlankLine(G))  goto l2119;
-  goto l2120;
-  l2119:;	  G->pos= yypos2119; G->thunkpos= yythunkpos2119;
-  }
-  l2120:;	  if (!yy_Definition(G))  goto l2108;
-  yyDo(G, yy_2_DefinitionList, G->begin, G->end, "yy_2_DefinitionList");
+static const char * converter_run(mmd_converter *c, const char *source, size_t len, size_t *out_len, bool inline_only, char ***metadata);
+static char ** metadata_pairs(node *list);
 
-  l2121:;	
-  {  int yypos2122= G->pos, yythunkpos2122= G->thunkpos;  if (!yy_Definition(G))  goto l2122;
-  yyDo(G, yy_2_DefinitionList, G->begin, G->end, "yy_2_DefinitionList");
-  goto l2121;
-  l2122:;	  G->pos= yypos2122; G->thunkpos= yythunkpos2122;
-  }
-  l2123:;	
-  {  int yypos2124= G->pos, yythunkpos2124= G->thunkpos;  if (!yy_BlankLine(G))  goto l2124;
-  goto l2123;
-  l2124:;	  G->pos= yypos2124; G->thunkpos= yythunkpos2124;
-  }  goto l2107;
-  l2108:;	  G->pos= yypos2108; G->thunkpos= yythunkpos2108;
-  }  yyDo(G, yy_3_DefinitionList, G->begin, G->end, "yy_3_DefinitionList");
-  yyprintf((stderr, "  ok   DefinitionList"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
-  return 1;
-  l2101:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "DefinitionList"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+/* parse_inline_text -- parse the preformatted input as a run of inlines,
+	starting from the Inlines rule rather than Doc.  A run stops at a line
+	that would start a block; runs are joined with the line end that
+	stopped them, or with a space where blank lines came between them. */
+static node * parse_inline_text(GREG *g) {
+	node *result = NULL;
+	node *run;
+	int line_ends = 0;
 
-  return 0;
+	while (1) {
+		if (yyparse_from(g, yy_BlankLine)) {
+			line_ends++;
+			continue;
+		}
+		if (!yyparse_from(g, yy_Inlines))
+			break;
+		run = g->ss;
+		if (result != NULL)
+			result = cons(mk_str(line_ends == 1 ? "\n" : " "), result);
+		result = cons(run, result);
+		line_ends = 0;
+	}
+	return mk_list(LIST, result);
 }
-YY_RULE(int) yy_Verbatim(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "Verbatim"));
-
-  l2126:;	
-  {  int yypos2127= G->pos, yythunkpos2127= G->thunkpos;  if (!yy_BlankLine(G))  goto l2127;
-  goto l2126;
-  l2127:;	  G->pos= yypos2127; G->thunkpos= yythunkpos2127;
-  }  if (!yy_StartList(G))  goto l2125;
-  yyDo(G, yySet, -1, 0, "yySet");
-  if (!yy_VerbatimChunk(G))  goto l2125;
-  yyDo(G, yy_1_Verbatim, G->begin, G->end, "yy_1_Verbatim");
 
-  l2128:;	
-  {  int yypos2129= G->pos, yythunkpos2129= G->thunkpos;  if (!yy_VerbatimChunk(G))  goto l2129;
-  yyDo(G, yy_1_Verbatim, G->begin, G->end, "yy_1_Verbatim");
-  goto l2128;
-  l2129:;	  G->pos= yypos2129; G->thunkpos= yythunkpos2129;
-  }
-  l2130:;	
-  {  int yypos2131= G->pos, yythunkpos2131= G->thunkpos;  if (!yy_BlankLine(G))  goto l2131;
-  goto l2130;
-  l2131:;	  G->pos= yypos2131; G->thunkpos= yythunkpos2131;
-  }  yyDo(G, yy_2_Verbatim, G->begin, G->end, "yy_2_Verbatim");
-  yyprintf((stderr, "  ok   Verbatim"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
-  return 1;
-  l2125:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Verbatim"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+/* mmd_converter_convert -- convert len bytes of source (need not be NUL
+	terminated).  The result belongs to the converter and is valid until
+	the next call, unless claimed with mmd_converter_detach_output. */
+const char * mmd_converter_convert(mmd_converter *c, const char *source, size_t len, size_t *out_len) {
+	return converter_run(c, source, len, out_len, false, NULL);
+}
 
-  return 0;
+/* mmd_converter_convert_with_metadata -- as mmd_converter_convert, and
+	also store the metadata found by the same parse in metadata, in the
+	form returned by extract_metadata (free with free_metadata) */
+const char * mmd_converter_convert_with_metadata(mmd_converter *c, const char *source, size_t len, size_t *out_len, char ***metadata) {
+	return converter_run(c, source, len, out_len, false, metadata);
 }
-YY_RULE(int) yy_BlockQuote(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "BlockQuote"));
-  if (!yy_BlockQuoteRaw(G))  goto l2132;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_BlockQuote, G->begin, G->end, "yy_1_BlockQuote");
-  yyprintf((stderr, "  ok   BlockQuote"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
-  return 1;
-  l2132:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "BlockQuote"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
 
-  return 0;
+/* mmd_converter_convert_inline -- as mmd_converter_convert, but the source
+	is parsed as inline Markdown only (no blocks, metadata or paragraphs) */
+const char * mmd_converter_convert_inline(mmd_converter *c, const char *source, size_t len, size_t *out_len) {
+	return converter_run(c, source, len, out_len, true, NULL);
 }
-YY_RULE(int) yy_RawLine(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "RawLine"));
 
-  {  int yypos2134= G->pos, yythunkpos2134= G->thunkpos;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2135;
-  l2136:;	
-  {  int yypos2137= G->pos, yythunkpos2137= G->thunkpos;
-  {  int yypos2138= G->pos, yythunkpos2138= G->thunkpos;  if (!yymatchChar(G, '\r')) goto l2138;
-  goto l2137;
-  l2138:;	  G->pos= yypos2138; G->thunkpos= yythunkpos2138;
-  }
-  {  int yypos2139= G->pos, yythunkpos2139= G->thunkpos;  if (!yymatchChar(G, '\n')) goto l2139;
-  goto l2137;
-  l2139:;	  G->pos= yypos2139; G->thunkpos= yythunkpos2139;
-  }  if (!yymatchDot(G)) goto l2137;  goto l2136;
-  l2137:;	  G->pos= yypos2137; G->thunkpos= yythunkpos2137;
-  }  if (!yy_Newline(G))  goto l2135;
-  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2135;  goto l2134;
-  l2135:;	  G->pos= yypos2134; G->thunkpos= yythunkpos2134;  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2133;  if (!yymatchDot(G)) goto l2133;
-  l2140:;	
-  {  int yypos2141= G->pos, yythunkpos2141= G->thunkpos;  if (!yymatchDot(G)) goto l2141;  goto l2140;
-  l2141:;	  G->pos= yypos2141; G->thunkpos= yythunkpos2141;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2133;  if (!yy_Eof(G))  goto l2133;
+/* converter_parse -- preformat and parse source as the converter is set
+	up to, and return the tree ready for the writers.  The tree belongs to
+	the converter until converter_release; if the parse was abandoned
+	(c->data.parse_aborted) there is none. */
+static node * converter_parse(mmd_converter *c, const char *source, size_t len, bool inline_only, char ***metadata) {
+	int extensions = c->extensions;
+	int format = c->format;
+	node *refined;
 
-  }
-  l2134:;	  yyprintf((stderr, "  ok   RawLine"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
+	g_string_truncate(c->formatted, 0);
 
-  return 1;
-  l2133:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "RawLine"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+	reset_parser_context(&c->g);
 
-  return 0;
+	if ((extensions & EXT_CRITIC_ACCEPT) || (extensions & EXT_CRITIC_REJECT)) {
+		/* Resolve Critic Markup while preformatting the input */
+		critic_preformat_into(c->formatted, source, len, extensions, format);
+		init_parser_data_len(&c->data, c->formatted->str, c->formatted->currentStringLength, "", extensions);
+	} else if (needs_preformat(source, len)) {
+		preformat_text_into(c->formatted, source, len);
+		init_parser_data_len(&c->data, c->formatted->str, c->formatted->currentStringLength, "", extensions);
+	} else {
+		/* nothing to change, so parse the caller's text directly */
+		init_parser_data_len(&c->data, source, len, "\n\n", extensions);
+	}
+
+	if (!inline_only) {
+		/* classify each line once for the block rules */
+		classify_lines(&c->lines, c->data.charbuf, c->data.charbuf_end - c->data.charbuf, c->data.trailer);
+		c->data.lines = &c->lines;
+	}
+	if (extensions & EXT_LINEAR_INLINES) {
+		reset_link_scan(&c->tails);
+		c->data.tails = &c->tails;
+	}
+	reset_html_scan(&c->blocks);
+	c->data.blocks = &c->blocks;
+	
+	if (inline_only) {
+		c->data.result = parse_inline_text(&c->g);
+	} else if (format == OPML_FORMAT) {
+		while (yyparse_from(&c->g, yy_DocForOPML));	/* We want simpler version */
+	} else {
+		while (yyparse(&c->g));       /* parse */
+	}
+
+	if (c->data.parse_aborted) {
+		/* clean up */
+		free_node_tree(c->data.result);
+		free_node_tree(c->data.autolabels);
+		c->data.result = c->data.autolabels = NULL;
+		release_large_buffers(c);
+
+		if (metadata != NULL)
+			*metadata = metadata_pairs(NULL);
+		return NULL;
+	}
+
+	/* collect metadata before the writers get to the tree */
+	if (metadata != NULL)
+		*metadata = metadata_pairs(c->data.result);
+
+	refined = process_raw_blocks(c->data.result, extensions);    /* iteratively parse RAW bits */
+
+	if (extensions & EXT_LINEAR_INLINES)
+		c->data.result = refined = resolve_inline_delimiters(refined, extensions);    /* pair up emphasis, links and quotes */
+
+	/* move autolabels to main parse tree */
+	if (c->data.autolabels != NULL) {
+		append_list(c->data.autolabels,refined);
+		c->data.autolabels = NULL;	
+	}
+
+	return refined;
 }
-YY_RULE(int) yy_SingleLineMetaKeyValue(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SingleLineMetaKeyValue"));
-  if (!yy_MetaDataKey(G))  goto l2142;
-  if (!yy_Sp(G))  goto l2142;
-  if (!yymatchChar(G, ':')) goto l2142;
-  if (!yy_Sp(G))  goto l2142;
 
-  l2143:;	
-  {  int yypos2144= G->pos, yythunkpos2144= G->thunkpos;
-  {  int yypos2145= G->pos, yythunkpos2145= G->thunkpos;  if (!yy_Newline(G))  goto l2145;
-  goto l2144;
-  l2145:;	  G->pos= yypos2145; G->thunkpos= yythunkpos2145;
-  }  if (!yymatchDot(G)) goto l2144;  goto l2143;
-  l2144:;	  G->pos= yypos2144; G->thunkpos= yythunkpos2144;
-  }  yyprintf((stderr, "  ok   SingleLineMetaKeyValue"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
+/* converter_release -- free the tree from converter_parse */
+static void converter_release(mmd_converter *c) {
+	free_node_tree(c->data.result);
+	c->data.result = NULL;
+	release_large_buffers(c);
+}
 
-  return 1;
-  l2142:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SingleLineMetaKeyValue"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+static const char * converter_run(mmd_converter *c, const char *source, size_t len, size_t *out_len, bool inline_only, char ***metadata) {
+	int extensions = c->extensions;
+	int format = c->format;
+	node *refined;
+	cache_key key;
+	bool cached;
+
+	if (c->out == NULL)
+		c->out = g_string_sized_new(0);
+	g_string_truncate(c->out, 0);
+
+	/* output that is collected whole can come from, and go to, the cache */
+	cached = cache_enabled() && (metadata == NULL) && (c->out->flush == NULL);
+	if (cached) {
+		cache_key_for(&key, source, len, extensions, format, inline_only);
+		if (cache_fetch(&key, c->out)) {
+			if (out_len != NULL)
+				*out_len = c->out->currentStringLength;
+			return c->out->str;
+		}
+	}
 
-  return 0;
+	refined = converter_parse(c, source, len, inline_only, metadata);
+	if (c->data.parse_aborted) {
+		g_string_append(c->out, "MultiMarkdown was unable to parse this file.");
+		if (out_len != NULL)
+			*out_len = c->out->currentStringLength;
+		return c->out->str;
+	}
+
+	/* there is no document to complete around a run of inlines */
+	if (inline_only)
+		extensions &= ~EXT_COMPLETE;
+	
+	/* Show what we got */
+	reset_scratch_pad(c->scratch, extensions);
+	export_node_tree_into(c->out, refined, format, c->scratch);
+	
+	/* clean up */
+	converter_release(c);
+	
+	if (cached)
+		cache_store(&key, c->out->str, c->out->currentStringLength);
+
+	if (out_len != NULL)
+		*out_len = c->out->currentStringLength;
+	return c->out->str;
 }
-YY_RULE(int) yy_AlphanumericAscii(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "AlphanumericAscii"));
-  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z0-9")) goto l2146;
-  yyprintf((stderr, "  ok   AlphanumericAscii"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
 
-  return 1;
-  l2146:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "AlphanumericAscii"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+/* mmd_converter_detach_output -- take ownership of the last result as a
+	malloc'ed string; the converter starts a new output buffer next time */
+char * mmd_converter_detach_output(mmd_converter *c) {
+	char *out;
 
-  return 0;
+	if (c->out == NULL)
+		return NULL;
+	out = g_string_free(c->out, false);
+	c->out = NULL;
+	return out;
 }
-YY_RULE(int) yy_MetaDataValue(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "MetaDataValue"));
-  if (!yy_StartList(G))  goto l2147;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2147;
-  l2148:;	
-  {  int yypos2149= G->pos, yythunkpos2149= G->thunkpos;
-  {  int yypos2150= G->pos, yythunkpos2150= G->thunkpos;  if (!yy_Newline(G))  goto l2150;
-  goto l2149;
-  l2150:;	  G->pos= yypos2150; G->thunkpos= yythunkpos2150;
-  }  if (!yymatchDot(G)) goto l2149;  goto l2148;
-  l2149:;	  G->pos= yypos2149; G->thunkpos= yythunkpos2149;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2147;  yyDo(G, yy_1_MetaDataValue, G->begin, G->end, "yy_1_MetaDataValue");
 
-  {  int yypos2151= G->pos, yythunkpos2151= G->thunkpos;  if (!yy_Newline(G))  goto l2152;
+char * markdown_to_string(char * source, int extensions, int format) {
+	return markdown_to_string_len(source, strlen(source), extensions, format, NULL);
+}
 
-  {  int yypos2153= G->pos, yythunkpos2153= G->thunkpos;
-  {  int yypos2154= G->pos, yythunkpos2154= G->thunkpos;  if (!yy_BlankLine(G))  goto l2154;
-  goto l2152;
-  l2154:;	  G->pos= yypos2154; G->thunkpos= yythunkpos2154;
-  }
-  {  int yypos2155= G->pos, yythunkpos2155= G->thunkpos;  if (!yy_SingleLineMetaKeyValue(G))  goto l2155;
-  goto l2152;
-  l2155:;	  G->pos= yypos2155; G->thunkpos= yythunkpos2155;
-  }  if (!yy_Sp(G))  goto l2152;
-  if (!yy_RawLine(G))  goto l2152;
-  G->pos= yypos2153; G->thunkpos= yythunkpos2153;
-  }  yyDo(G, yy_2_MetaDataValue, G->begin, G->end, "yy_2_MetaDataValue");
-  goto l2151;
-  l2152:;	  G->pos= yypos2151; G->thunkpos= yythunkpos2151;  if (!yy_Newline(G))  goto l2147;
+/* Inputs shorter than this are converted with a converter kept per thread,
+	so that short snippets don't pay for setting up and tearing down the
+	parser buffers, scratch pad and output buffer each time */
+#define SMALL_INPUT_LIMIT 4096
 
-  }
-  l2151:;	
-  l2156:;	
-  {  int yypos2157= G->pos, yythunkpos2157= G->thunkpos;
-  {  int yypos2158= G->pos, yythunkpos2158= G->thunkpos;  if (!yy_BlankLine(G))  goto l2158;
-  goto l2157;
-  l2158:;	  G->pos= yypos2158; G->thunkpos= yythunkpos2158;
-  }
-  {  int yypos2159= G->pos, yythunkpos2159= G->thunkpos;  if (!yy_SingleLineMetaKeyValue(G))  goto l2159;
-  goto l2157;
-  l2159:;	  G->pos= yypos2159; G->thunkpos= yythunkpos2159;
-  }  if (!yy_Sp(G))  goto l2157;
-  if (!yy_RawLine(G))  goto l2157;
-  yyDo(G, yy_3_MetaDataValue, G->begin, G->end, "yy_3_MetaDataValue");
-  goto l2156;
-  l2157:;	  G->pos= yypos2157; G->thunkpos= yythunkpos2157;
-  }  yyDo(G, yy_4_MetaDataValue, G->begin, G->end, "yy_4_MetaDataValue");
-  yyprintf((stderr, "  ok   MetaDataValue"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
-  return 1;
-  l2147:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "MetaDataValue"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+static pthread_key_t  small_input_key;
+static pthread_once_t small_input_once = PTHREAD_ONCE_INIT;
 
-  return 0;
+static void free_small_input_converter(void *c) {
+	mmd_converter_free((mmd_converter *)c);
 }
-YY_RULE(int) yy_MetaDataKeyValue(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "MetaDataKeyValue"));
-  if (!yy_MetaDataKey(G))  goto l2160;
-  yyDo(G, yySet, -2, 0, "yySet");
-  if (!yy_Sp(G))  goto l2160;
-  if (!yymatchChar(G, ':')) goto l2160;
-  if (!yy_Sp(G))  goto l2160;
-  if (!yy_MetaDataValue(G))  goto l2160;
-  yyDo(G, yySet, -1, 0, "yySet");
-  yyDo(G, yy_1_MetaDataKeyValue, G->begin, G->end, "yy_1_MetaDataKeyValue");
-  yyprintf((stderr, "  ok   MetaDataKeyValue"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
-  return 1;
-  l2160:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "MetaDataKeyValue"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
 
-  return 0;
+static void make_small_input_key(void) {
+	pthread_key_create(&small_input_key, free_small_input_converter);
 }
-YY_RULE(int) yy_SetextHeading(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "SetextHeading"));
 
-  {  int yypos2162= G->pos, yythunkpos2162= G->thunkpos;  if (!yy_SetextHeading1(G))  goto l2163;
-  goto l2162;
-  l2163:;	  G->pos= yypos2162; G->thunkpos= yythunkpos2162;  if (!yy_SetextHeading2(G))  goto l2161;
+/* small_input_converter -- this thread's converter, set up for the given
+	extensions and format (the converter state doesn't depend on either) */
+static mmd_converter * small_input_converter(int extensions, int format) {
+	mmd_converter *c;
 
-  }
-  l2162:;	  yyprintf((stderr, "  ok   SetextHeading"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
+	pthread_once(&small_input_once, make_small_input_key);
+	c = (mmd_converter *)pthread_getspecific(small_input_key);
+	if (c == NULL) {
+		c = mmd_converter_new(extensions, format);
+		pthread_setspecific(small_input_key, c);
+	}
+	c->extensions = extensions;
+	c->format     = format;
+	return c;
+}
 
-  return 1;
-  l2161:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "SetextHeading"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+static char * convert_to_string(const char * source, size_t len, int extensions, int format, size_t *out_len, bool inline_only, char ***metadata);
 
-  return 0;
+/* markdown_to_string_len -- convert len bytes of source, which need not be
+	NUL terminated; the length of the result is stored in out_len (if not NULL) */
+char * markdown_to_string_len(const char * source, size_t len, int extensions, int format, size_t *out_len) {
+	return convert_to_string(source, len, extensions, format, out_len, false, NULL);
 }
-YY_RULE(int) yy_BlankLine(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "BlankLine"));
-  if (!yy_Sp(G))  goto l2164;
-  if (!yy_Newline(G))  goto l2164;
-  yyprintf((stderr, "  ok   BlankLine"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
 
-  return 1;
-  l2164:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "BlankLine"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+/* markdown_with_metadata_len -- as markdown_to_string_len, and also store
+	the document's metadata in metadata, in the form returned by
+	extract_metadata (free with free_metadata).  The document is only
+	parsed once. */
+char * markdown_with_metadata_len(const char * source, size_t len, int extensions, int format, size_t *out_len, char ***metadata) {
+	return convert_to_string(source, len, extensions, format, out_len, false, metadata);
+}
 
-  return 0;
+/* markdown_inline_to_string_len -- convert inline Markdown only; nothing
+	is wrapped in paragraphs or other blocks */
+char * markdown_inline_to_string_len(const char * source, size_t len, int extensions, int format, size_t *out_len) {
+	return convert_to_string(source, len, extensions, format, out_len, true, NULL);
 }
-YY_RULE(int) yy_Block(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Block"));
 
-  l2166:;	
-  {  int yypos2167= G->pos, yythunkpos2167= G->thunkpos;  if (!yy_BlankLine(G))  goto l2167;
-  goto l2166;
-  l2167:;	  G->pos= yypos2167; G->thunkpos= yythunkpos2167;
-  }
-  {  int yypos2168= G->pos, yythunkpos2168= G->thunkpos;  if (!yy_BlockQuote(G))  goto l2169;
-  goto l2168;
-  l2169:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!yy_Verbatim(G))  goto l2170;
-  goto l2168;
-  l2170:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l2171;  if (!yy_DefinitionList(G))  goto l2171;
-  goto l2168;
-  l2171:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l2172;  if (!yy_Glossary(G))  goto l2172;
-  goto l2168;
-  l2172:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!yy_Note(G))  goto l2173;
-  goto l2168;
-  l2173:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!yy_LinkReference(G))  goto l2174;
-  goto l2168;
-  l2174:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!yy_HorizontalRule(G))  goto l2175;
-  goto l2168;
-  l2175:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!yy_HeadingSection(G))  goto l2176;
-  goto l2168;
-  l2176:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!yy_OrderedList(G))  goto l2177;
-  goto l2168;
-  l2177:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!yy_BulletList(G))  goto l2178;
-  goto l2168;
-  l2178:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!yy_HtmlBlock(G))  goto l2179;
-  goto l2168;
-  l2179:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!yy_MarkdownHtmlBlock(G))  goto l2180;
-  goto l2168;
-  l2180:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!yy_StyleBlock(G))  goto l2181;
-  goto l2168;
-  l2181:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l2182;  if (!yy_Table(G))  goto l2182;
-  goto l2168;
-  l2182:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) )) goto l2183;  if (!yy_ImageBlock(G))  goto l2183;
-  goto l2168;
-  l2183:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;
-  {  int yypos2185= G->pos, yythunkpos2185= G->thunkpos;
-  {  int yypos2186= G->pos, yythunkpos2186= G->thunkpos;  if (!yy_Sp(G))  goto l2186;
-  goto l2187;
-  l2186:;	  G->pos= yypos2186; G->thunkpos= yythunkpos2186;
-  }
-  l2187:;	  if (!yy_HtmlBlockInTags(G))  goto l2185;
-  goto l2184;
-  l2185:;	  G->pos= yypos2185; G->thunkpos= yythunkpos2185;
-  }  if (!yy_Para(G))  goto l2184;
-  goto l2168;
-  l2184:;	  G->pos= yypos2168; G->thunkpos= yythunkpos2168;  if (!yy_Plain(G))  goto l2165;
+/* convert_to_string -- one-off conversion to a malloc'ed string */
+static char * convert_to_string(const char * source, size_t len, int extensions, int format, size_t *out_len, bool inline_only, char ***metadata) {
+	char *out;
+	const char *result;
+	size_t result_len;
+	mmd_converter *c;
+
+	if (len < SMALL_INPUT_LIMIT) {
+		/* the only allocation that outlives the call is the copy we return */
+		c = small_input_converter(extensions, format);
+		result = converter_run(c, source, len, &result_len, inline_only, metadata);
+		out = (char *)malloc(result_len + 1);
+		memcpy(out, result, result_len + 1);
+		if (out_len != NULL)
+			*out_len = result_len;
+		return out;
+	}
 
-  }
-  l2168:;	  yyprintf((stderr, "  ok   Block"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
+	c = mmd_converter_new(extensions, format);
+	converter_run(c, source, len, out_len, inline_only, metadata);
+	out = mmd_converter_detach_output(c);
+	mmd_converter_free(c);
 
-  return 1;
-  l2165:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Block"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+	return out;
+}
 
-  return 0;
+/* mmd_converter_convert_to -- as mmd_converter_convert, but the output is
+	passed to write as it is produced, so only about MMD_SINK_CHUNK bytes of
+	it are held at once.  Returns false if any write failed. */
+bool mmd_converter_convert_to(mmd_converter *c, const char *source, size_t len, mmd_write_fn write, void *context) {
+	bool ok;
+
+	if (c->out == NULL)
+		c->out = g_string_sized_new(MMD_SINK_CHUNK);
+	g_string_truncate(c->out, 0);
+	g_string_set_flush(c->out, write, context, MMD_SINK_CHUNK);
+
+	converter_run(c, source, len, NULL, false, NULL);
+	ok = g_string_flush(c->out);
+
+	g_string_set_flush(c->out, NULL, NULL, 0);
+	return ok;
+}
+
+/* Streaming conversion -- the document is parsed a block at a time, and each
+	block is written out and freed before the next one is parsed, so memory
+	use follows the largest block (and the reference table) rather than the
+	length of the document.  Input that needs preformatting is preformatted
+	a window of STREAM_WINDOW bytes at a time for the same reason.
+
+	Links and notes can refer forward to definitions later in the document,
+	so when the source has any '[' a first pass parses the blocks only to
+	collect the definitions (see extract_block_references), and the second
+	pass writes the output. */
+
+#define STREAM_WINDOW (64 * 1024)
+
+/* A fed block that needs more input is parsed again once the input still
+	to parse has grown by 1/STREAM_REPARSE_GROWTH, so that however small
+	the pieces are, each block is parsed only a few times over on average */
+#define STREAM_REPARSE_GROWTH 8
+
+/* Once this many HTML block scans are kept, those behind the parse are
+	dropped */
+#define STREAM_SCAN_LIMIT 4096
+
+static int yy_MetaDataOnly(GREG *G);
+
+/* The rest of a source being preformatted a window at a time */
+typedef struct {
+	const char *next;
+	const char *end;
+	GString    *window;         /* the preformatted window being parsed */
+	int         charstotab;     /* carried from one window to the next */
+} stream_source;
+
+/* refill_stream_source -- preformat the next window of the source */
+static bool refill_stream_source(void *stream, char **input, const char **input_end) {
+	stream_source *s = (stream_source *)stream;
+	size_t len = s->end - s->next;
+
+	if (len == 0)
+		return false;
+	if (len > STREAM_WINDOW) {
+		len = STREAM_WINDOW;
+		/* don't split a \r\n between windows */
+		if (s->next[len - 1] == '\r')
+			len--;
+	}
+	g_string_truncate(s->window, 0);
+	preformat_text_append(s->window, s->next, len, &s->charstotab);
+	s->next += len;
+
+	*input = s->window->str;
+	*input_end = s->window->str + s->window->currentStringLength;
+	return true;
+}
+
+/* stream_start -- get the converter ready to parse source from the start */
+static void stream_start(mmd_converter *c, stream_source *input, const char *source, size_t len) {
+	reset_parser_context(&c->g);
+
+	if (needs_preformat(source, len)) {
+		/* the byte order mark is dropped */
+		if ((len >= 3) && (memcmp(source, "\xEF\xBB\xBF", 3) == 0))
+			source += 3, len -= 3;
+		input->next = source;
+		input->end = source + len;
+		input->window = c->formatted;
+		input->charstotab = TABSTOP;
+		init_parser_data_len(&c->data, "", 0, "\n\n", c->extensions);
+		c->data.refill = refill_stream_source;
+		c->data.stream = input;
+	} else {
+		init_parser_data_len(&c->data, source, len, "\n\n", c->extensions);
+	}
+
+	if (c->extensions & EXT_LINEAR_INLINES) {
+		reset_link_scan(&c->tails);
+		c->data.tails = &c->tails;
+	}
+	reset_html_scan(&c->blocks);
+	c->data.blocks = &c->blocks;
 }
-YY_RULE(int) yy_MetaData(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 1, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "MetaData"));
-  if (!yy_StartList(G))  goto l2188;
-  yyDo(G, yySet, -1, 0, "yySet");
 
-  {  int yypos2189= G->pos, yythunkpos2189= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z")) goto l2189;
+/* stream_metadata -- parse the metadata at the start of the document, if
+	there is any */
+static node * stream_metadata(mmd_converter *c) {
+	if ((c->extensions & EXT_COMPATIBILITY) || (c->extensions & EXT_NO_METADATA))
+		return NULL;
+	if (!yyparse_from(&c->g, yy_MetaDataOnly))
+		return NULL;
+	return c->g.ss;
+}
 
-  l2190:;	
-  {  int yypos2191= G->pos, yythunkpos2191= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z")) goto l2191;
-  goto l2190;
-  l2191:;	  G->pos= yypos2191; G->thunkpos= yythunkpos2191;
-  }  if (!yymatchString(G, "://")) goto l2189;
-  goto l2188;
-  l2189:;	  G->pos= yypos2189; G->thunkpos= yythunkpos2189;
-  }
-  {  int yypos2192= G->pos, yythunkpos2192= G->thunkpos;  if (!yy_SetextHeading(G))  goto l2192;
-  goto l2188;
-  l2192:;	  G->pos= yypos2192; G->thunkpos= yythunkpos2192;
-  }  if (!yy_MetaDataKeyValue(G))  goto l2188;
-  yyDo(G, yy_1_MetaData, G->begin, G->end, "yy_1_MetaData");
+/* stream_block -- parse the next block, or return NULL at the end of the
+	document.  The matched input is let go. */
+static node * stream_block(mmd_converter *c, size_t *scan_limit) {
+	node *block = NULL;
 
-  l2193:;	
-  {  int yypos2194= G->pos, yythunkpos2194= G->thunkpos;  if (!yy_MetaDataKeyValue(G))  goto l2194;
-  yyDo(G, yy_1_MetaData, G->begin, G->end, "yy_1_MetaData");
-  goto l2193;
-  l2194:;	  G->pos= yypos2194; G->thunkpos= yythunkpos2194;
-  }  yyDo(G, yy_2_MetaData, G->begin, G->end, "yy_2_MetaData");
-  yyprintf((stderr, "  ok   MetaData"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 1, 0, "yyPop");
-  return 1;
-  l2188:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "MetaData"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+	if (yyparse_from(&c->g, yy_Block))
+		block = c->g.ss;
 
-  return 0;
+	if (c->blocks.count > *scan_limit) {
+		yyHtmlScanPrune(&c->blocks, c->g.offset);
+		if (c->blocks.count > *scan_limit / 2)
+			*scan_limit *= 2;
+	}
+	return block;
+}
+
+/* writes_sections_flat -- is a heading section written as just its blocks
+	in order?  If so it needn't be gathered up before it is written. */
+static bool writes_sections_flat(int format) {
+	return (format == HTML_FORMAT) || (format == LATEX_FORMAT) ||
+		(format == MEMOIR_FORMAT) || (format == MAN_FORMAT) || (format == ODF_FORMAT);
+}
+
+/* refine_block -- what converter_run does to the whole tree before export */
+static node * refine_block(node *block, int extensions) {
+	block = process_raw_blocks(block, extensions);
+	if (extensions & EXT_LINEAR_INLINES)
+		block = resolve_inline_delimiters(block, extensions);
+	return block;
+}
+
+/* holds_references -- will extract_references take anything from list? */
+static bool holds_references(node *list) {
+	for (; list != NULL; list = list->next) {
+		switch (list->key) {
+			case LINKREFERENCE:
+			case NOTESOURCE:
+			case GLOSSARYSOURCE:
+			case H1: case H2: case H3: case H4: case H5: case H6:
+			case TABLE:
+				return true;
+			case HEADINGSECTION:
+				if (holds_references(list->children))
+					return true;
+				break;
+			default:
+				break;
+		}
+	}
+	return false;
 }
-YY_RULE(int) yy_Newline(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "Newline"));
 
-  {  int yypos2196= G->pos, yythunkpos2196= G->thunkpos;  if (!yymatchChar(G, '\n')) goto l2197;
-  goto l2196;
-  l2197:;	  G->pos= yypos2196; G->thunkpos= yythunkpos2196;  if (!yymatchChar(G, '\r')) goto l2195;
+/* extract_block_references -- extract_references for one block of the
+	document.  A definition that starts the document is left in place,
+	so every other block is put behind before for the call.  Returns what
+	is left of the block. */
+static node * extract_block_references(node *block, node *before, bool first, scratch_pad *scratch) {
+	if (first) {
+		extract_references(block, scratch);
+		return block;
+	}
+	before->next = block;
+	extract_references(before, scratch);
+	block = before->next;
+	before->next = NULL;
+	return block;
+}
+
+/* mmd_converter_stream_to -- as mmd_converter_convert_to, but the document
+	is parsed, converted and written a block at a time, so that memory use
+	doesn't grow with its length.  The output is the same, except that
+	OPML, which nests the whole document under its headings, and Critic
+	Markup accept or reject, which is applied to the whole text before it
+	is parsed, are converted by mmd_converter_convert_to instead. */
+bool mmd_converter_stream_to(mmd_converter *c, const char *source, size_t len, mmd_write_fn write, void *context) {
+	int extensions = c->extensions;
+	int format = c->format;
+	stream_source input;
+	scratch_pad *discard;
+	node *before;
+	node *metadata = NULL;
+	node *block;
+	bool first;
+	bool ok;
+	size_t scan_limit = STREAM_SCAN_LIMIT;
+
+	if ((format == OPML_FORMAT) || (extensions & EXT_CRITIC_ACCEPT) || (extensions & EXT_CRITIC_REJECT))
+		return mmd_converter_convert_to(c, source, len, write, context);
+
+	if (c->out == NULL)
+		c->out = g_string_sized_new(MMD_SINK_CHUNK);
+	g_string_truncate(c->out, 0);
+	g_string_set_flush(c->out, write, context, MMD_SINK_CHUNK);
+
+	reset_scratch_pad(c->scratch, extensions);
+	discard = mk_scratch_pad(extensions);
+	before = mk_node(LIST);
+
+	if (format_uses_references(format) && (memchr(source, '[', len) != NULL)) {
+		/* first pass: collect the definitions and labels */
+		stream_start(c, &input, source, len);
+		c->data.flat_sections = true;
+		block = stream_metadata(c);
+		if (block == NULL)
+			block = stream_block(c, &scan_limit);
+		for (first = true; block != NULL; first = false) {
+			if (holds_references(block)) {
+				block = refine_block(block, extensions);
+				block = extract_block_references(block, before, first, c->scratch);
+			}
+			free_node_tree(block);
+			block = stream_block(c, &scan_limit);
+		}
+		/* labels defined by headings and tables follow the document */
+		free_node_tree(extract_block_references(c->data.autolabels, before, false, c->scratch));
+		c->data.autolabels = NULL;
+	}
 
-  {  int yypos2198= G->pos, yythunkpos2198= G->thunkpos;  if (!yymatchChar(G, '\n')) goto l2198;
-  goto l2199;
-  l2198:;	  G->pos= yypos2198; G->thunkpos= yythunkpos2198;
-  }
-  l2199:;	
-  }
-  l2196:;	  yyprintf((stderr, "  ok   Newline"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
+	stream_start(c, &input, source, len);
+	metadata = stream_metadata(c);
 
-  return 1;
-  l2195:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Newline"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+	format = export_begin(c->out, metadata, format, c->scratch);
 
-  return 0;
-}
-YY_RULE(int) yy_Sp(GREG *G)
-{  yyprintfv((stderr, "%s\n", "Sp"));
+	c->data.flat_sections = writes_sections_flat(format);
 
-  l2201:;	
-  {  int yypos2202= G->pos, yythunkpos2202= G->thunkpos;  if (!yy_Spacechar(G))  goto l2202;
-  goto l2201;
-  l2202:;	  G->pos= yypos2202; G->thunkpos= yythunkpos2202;
-  }  yyprintf((stderr, "  ok   Sp"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
+	block = (metadata != NULL) ? metadata : stream_block(c, &scan_limit);
 
-  return 1;
+	for (first = true; block != NULL; first = false) {
+		block = refine_block(block, extensions);
+		if (format_uses_references(format))
+			block = extract_block_references(block, before, first, discard);
+		export_blocks(c->out, block, format, c->scratch);
+		free_node_tree(block);
+
+		if (format_uses_references(format)) {
+			/* the labels were collected by the first pass */
+			free_node_tree(extract_block_references(c->data.autolabels, before, false, discard));
+			c->data.autolabels = NULL;
+			reset_scratch_pad(discard, extensions);
+		}
+
+		block = stream_block(c, &scan_limit);
+	}
+
+	if (metadata != NULL) {
+		block = mk_node(FOOTER);
+		export_blocks(c->out, block, format, c->scratch);
+		free_node(block);
+	}
+	if (c->data.autolabels != NULL) {
+		/* left for the end of the tree, as converter_run does */
+		export_blocks(c->out, c->data.autolabels, format, c->scratch);
+		free_node_tree(c->data.autolabels);
+		c->data.autolabels = NULL;
+	}
+	export_end(c->out, NULL, format, c->scratch);
+
+	free_node(before);
+	free_scratch_pad(discard);
+	release_large_buffers(c);
+
+	ok = g_string_flush(c->out);
+	g_string_set_flush(c->out, NULL, NULL, 0);
+	return ok;
+}
+
+/* sink_conversion -- one-off conversion streamed to write by convert */
+static bool sink_conversion(const char *source, size_t len, int extensions, int format, mmd_write_fn write, void *context,
+	bool (*convert)(mmd_converter *, const char *, size_t, mmd_write_fn, void *)) {
+	mmd_converter *c;
+	bool ok;
+
+	if (len < SMALL_INPUT_LIMIT) {
+		/* write may itself convert other texts on this thread, so the
+			thread's converter is put out of their reach while in use */
+		c = small_input_converter(extensions, format);
+		pthread_setspecific(small_input_key, NULL);
+		ok = convert(c, source, len, write, context);
+		mmd_converter_free((mmd_converter *)pthread_getspecific(small_input_key));
+		pthread_setspecific(small_input_key, c);
+		return ok;
+	}
+
+	c = mmd_converter_new(extensions, format);
+	ok = convert(c, source, len, write, context);
+	mmd_converter_free(c);
+	return ok;
+}
+
+/* markdown_to_sink -- one-off conversion streamed to write */
+bool markdown_to_sink(const char *source, size_t len, int extensions, int format, mmd_write_fn write, void *context) {
+	return sink_conversion(source, len, extensions, format, write, context, mmd_converter_convert_to);
+}
+
+/* markdown_stream_to_sink -- one-off conversion a block at a time (see
+	mmd_converter_stream_to) streamed to write */
+bool markdown_stream_to_sink(const char *source, size_t len, int extensions, int format, mmd_write_fn write, void *context) {
+	return sink_conversion(source, len, extensions, format, write, context, mmd_converter_stream_to);
+}
+
+/* mmd_converter_serialize -- parse len bytes of source and pass the tree, in
+	the form read by mmd_deserialize, to write (see serialize.c).  Returns
+	false if any write failed. */
+bool mmd_converter_serialize(mmd_converter *c, const char *source, size_t len, mmd_write_fn write, void *context) {
+	node *tree;
+	bool ok;
+
+	tree = converter_parse(c, source, len, false, NULL);
+	if (c->data.parse_aborted)
+		return serialize_tree(NULL, c->extensions, c->format, true, write, context);
+
+	ok = serialize_tree(tree, c->extensions, c->format, false, write, context);
+	converter_release(c);
+	return ok;
+}
+
+/* mmd_serialize -- one-off parse, with the tree streamed to write */
+bool mmd_serialize(const char *source, size_t len, int extensions, int format, mmd_write_fn write, void *context) {
+	return sink_conversion(source, len, extensions, format, write, context, mmd_converter_serialize);
+}
+
+/* Fed conversion -- the document arrives a piece at a time through
+	mmd_stream_feed, and each block is converted and written as soon as the
+	input after it shows where it ends.  A parse that runs into the end of
+	what has arrived is dropped and tried again when more has arrived (see
+	STREAM_REPARSE_GROWTH).
+
+	The definitions further on aren't known yet, so a block with a link,
+	note or citation that can't be resolved is held back, along with the
+	blocks after it, until the definition turns up or the stream is
+	finished. */
+
+struct mmd_stream {
+	mmd_converter *c;
+	int            format;        /* as adjusted by export_begin */
+	GString       *input;         /* what has been fed */
+	size_t         taken;         /* how much of input has been preformatted */
+	int            charstotab;    /* carried from one piece to the next */
+	bool           started;       /* the byte order mark has been dealt with */
+	bool           finishing;     /* there is no more input to come */
+	bool           whole;         /* convert the whole input when finished */
+	bool           begun;         /* the metadata is parsed and the output begun */
+	bool           first;         /* the next block starts the document */
+	bool           metadata;      /* the document has metadata */
+	size_t         retry_at;      /* wait for this much unparsed input */
+	size_t         scan_limit;
+	node          *before;        /* see extract_block_references */
+	node          *held;          /* blocks held back, each in a LIST node */
+	node          *held_tail;
+	node          *links_seen;    /* the definitions when last looked at */
+	node          *notes_seen;
+};
+
+/* refill_fed_input -- preformat the next piece of what has been fed */
+static bool refill_fed_input(void *stream, char **input, const char **input_end) {
+	mmd_stream *s = (mmd_stream *)stream;
+	GString *window = s->c->formatted;
+	const char *next = s->input->str + s->taken;
+	size_t len = s->input->currentStringLength - s->taken;
+	bool capped = false;
+
+	g_string_truncate(window, 0);
+	*input = window->str;
+	*input_end = window->str;
+
+	if (!s->started) {
+		/* wait until a byte order mark can be told from the text */
+		if ((len < 3) && !s->finishing && (memcmp(next, "\xEF\xBB\xBF", len) == 0))
+			return true;
+		s->started = true;
+		if ((len >= 3) && (memcmp(next, "\xEF\xBB\xBF", 3) == 0))
+			next += 3, len -= 3, s->taken += 3;
+	}
+	if (len > STREAM_WINDOW)
+		len = STREAM_WINDOW, capped = true;
+	/* a \r may be the first half of a \r\n */
+	if ((len > 0) && (next[len - 1] == '\r') && (capped || !s->finishing))
+		len--;
+	if (len == 0)
+		return !s->finishing;
+
+	preformat_text_append(window, next, len, &s->charstotab);
+	s->taken += len;
+
+	*input = window->str;
+	*input_end = window->str + window->currentStringLength;
+	return true;
 }
-YY_RULE(int) yy_MetaDataKey(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "MetaDataKey"));
-  yyText(G, G->begin, G->end);  if (!(YY_BEGIN)) goto l2203;
-  {  int yypos2204= G->pos, yythunkpos2204= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z")) goto l2204;
 
-  l2205:;	
-  {  int yypos2206= G->pos, yythunkpos2206= G->thunkpos;  if (!yymatchClass(G, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", "A-Za-z")) goto l2206;
-  goto l2205;
-  l2206:;	  G->pos= yypos2206; G->thunkpos= yythunkpos2206;
-  }  if (!yymatchString(G, "://")) goto l2204;
-  goto l2203;
-  l2204:;	  G->pos= yypos2204; G->thunkpos= yythunkpos2204;
-  }  if (!yy_AlphanumericAscii(G))  goto l2203;
+/* stream_unparsed -- how much of the input fed so far is still to parse */
+static size_t stream_unparsed(mmd_stream *s) {
+	mmd_converter *c = s->c;
 
-  l2207:;	
-  {  int yypos2208= G->pos, yythunkpos2208= G->thunkpos;  if (!yy_Sp(G))  goto l2208;
+	return (c->g.limit - c->g.pos) + (c->data.charbuf_end - c->data.charbuf) +
+		(s->input->currentStringLength - s->taken);
+}
 
-  {  int yypos2211= G->pos, yythunkpos2211= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l2212;
-  goto l2211;
-  l2212:;	  G->pos= yypos2211; G->thunkpos= yythunkpos2211;  if (!yymatchChar(G, '_')) goto l2213;
-  goto l2211;
-  l2213:;	  G->pos= yypos2211; G->thunkpos= yythunkpos2211;  if (!yymatchChar(G, ' ')) goto l2214;
-  goto l2211;
-  l2214:;	  G->pos= yypos2211; G->thunkpos= yythunkpos2211;  if (!yymatchChar(G, '-')) goto l2215;
-  goto l2211;
-  l2215:;	  G->pos= yypos2211; G->thunkpos= yythunkpos2211;  if (!yymatchChar(G, '.')) goto l2208;
+/* stream_wait -- don't parse again until there is enough new input */
+static void stream_wait(mmd_stream *s) {
+	size_t unparsed = stream_unparsed(s);
 
-  }
-  l2211:;	
-  l2209:;	
-  {  int yypos2210= G->pos, yythunkpos2210= G->thunkpos;
-  {  int yypos2216= G->pos, yythunkpos2216= G->thunkpos;  if (!yy_AlphanumericAscii(G))  goto l2217;
-  goto l2216;
-  l2217:;	  G->pos= yypos2216; G->thunkpos= yythunkpos2216;  if (!yymatchChar(G, '_')) goto l2218;
-  goto l2216;
-  l2218:;	  G->pos= yypos2216; G->thunkpos= yythunkpos2216;  if (!yymatchChar(G, ' ')) goto l2219;
-  goto l2216;
-  l2219:;	  G->pos= yypos2216; G->thunkpos= yythunkpos2216;  if (!yymatchChar(G, '-')) goto l2220;
-  goto l2216;
-  l2220:;	  G->pos= yypos2216; G->thunkpos= yythunkpos2216;  if (!yymatchChar(G, '.')) goto l2210;
+	s->retry_at = unparsed + unparsed / STREAM_REPARSE_GROWTH + 1;
+}
 
-  }
-  l2216:;	  goto l2209;
-  l2210:;	  G->pos= yypos2210; G->thunkpos= yythunkpos2210;
-  }  goto l2207;
-  l2208:;	  G->pos= yypos2208; G->thunkpos= yythunkpos2208;
-  }  yyText(G, G->begin, G->end);  if (!(YY_END)) goto l2203;  yyDo(G, yy_1_MetaDataKey, G->begin, G->end, "yy_1_MetaDataKey");
-  yyprintf((stderr, "  ok   MetaDataKey"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
+/* stream_try -- parse rule from the end of the last block.  Returns 1 if
+	it matched, 0 if not, or -1 if it ran out of input before it could
+	tell, in which case the attempt is dropped. */
+static int stream_try(mmd_stream *s, yyrule rule) {
+	mmd_converter *c = s->c;
+	int matched;
 
-  return 1;
-  l2203:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "MetaDataKey"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+	c->data.starved = false;
+	matched = yyparse_try(&c->g, rule);
+	if (c->data.starved) {
+		yyparse_retract(&c->g);
+		/* scans that stopped at the end of the input are out of date */
+		reset_link_scan(&c->tails);
+		reset_html_scan(&c->blocks);
+		stream_wait(s);
+		return -1;
+	}
+	if (matched)
+		yyparse_accept(&c->g);
+	else
+		yyparse_retract(&c->g);
+	s->retry_at = 0;
+	return matched;
+}
+
+/* stream_release -- write out the held blocks whose references can now be
+	resolved, in order; or all of them */
+static void stream_release(mmd_stream *s, bool all) {
+	mmd_converter *c = s->c;
+	node *next;
+
+	while ((s->held != NULL) && (all || references_resolved(s->held->children, c->scratch))) {
+		next = s->held->next;
+		s->held->next = NULL;
+		export_blocks(c->out, s->held->children, s->format, c->scratch);
+		free_node_tree(s->held);
+		s->held = next;
+	}
+	if (s->held == NULL)
+		s->held_tail = NULL;
+}
+
+/* stream_take_block -- write out a block of the document, or hold it back */
+static void stream_take_block(mmd_stream *s, node *block) {
+	mmd_converter *c = s->c;
+	node *entry;
+	bool defined;
+
+	block = refine_block(block, c->extensions);
+	if (!format_uses_references(s->format)) {
+		export_blocks(c->out, block, s->format, c->scratch);
+		free_node_tree(block);
+		s->first = false;
+		return;
+	}
 
-  return 0;
+	block = extract_block_references(block, s->before, s->first, c->scratch);
+	s->first = false;
+	free_node_tree(extract_block_references(c->data.autolabels, s->before, false, c->scratch));
+	c->data.autolabels = NULL;
+	defined = (c->scratch->links != s->links_seen) || (c->scratch->notes != s->notes_seen);
+
+	if (block != NULL) {
+		entry = mk_node(LIST);
+		entry->children = block;
+		if (s->held == NULL) {
+			s->held = entry;
+			defined = true;
+		} else {
+			s->held_tail->next = entry;
+		}
+		s->held_tail = entry;
+	}
+	/* the held blocks were checked against all but the new definitions */
+	if (defined)
+		stream_release(s, false);
+
+	s->links_seen = c->scratch->links;
+	s->notes_seen = c->scratch->notes;
 }
-YY_RULE(int) yy_StartList(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "StartList"));
 
-  {  int yypos2222= G->pos, yythunkpos2222= G->thunkpos;  if (!yymatchDot(G)) goto l2221;  G->pos= yypos2222; G->thunkpos= yythunkpos2222;
-  }  yyDo(G, yy_1_StartList, G->begin, G->end, "yy_1_StartList");
-  yyprintf((stderr, "  ok   StartList"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
+/* stream_advance -- parse and write out as much as the input allows */
+static void stream_advance(mmd_stream *s) {
+	mmd_converter *c = s->c;
+	int matched;
 
-  return 1;
-  l2221:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "StartList"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+	if (!s->finishing && (stream_unparsed(s) < s->retry_at))
+		return;
 
-  return 0;
+	if (!s->begun) {
+		matched = 0;
+		if (!(c->extensions & EXT_COMPATIBILITY) && !(c->extensions & EXT_NO_METADATA)) {
+			matched = stream_try(s, yy_MetaDataOnly);
+			if (matched < 0)
+				return;
+		}
+		s->begun = true;
+		s->metadata = matched;
+		s->format = export_begin(c->out, matched ? c->g.ss : NULL, c->format, c->scratch);
+		c->data.flat_sections = writes_sections_flat(s->format);
+		if (matched)
+			stream_take_block(s, c->g.ss);
+	}
+
+	while ((matched = stream_try(s, yy_Block)) > 0) {
+		stream_take_block(s, c->g.ss);
+		if (c->blocks.count > s->scan_limit) {
+			yyHtmlScanPrune(&c->blocks, c->g.offset);
+			if (c->blocks.count > s->scan_limit / 2)
+				s->scan_limit *= 2;
+		}
+	}
+	if ((matched == 0) && !s->finishing) {
+		/* the document can't end before it is finished */
+		stream_wait(s);
+	}
 }
-YY_RULE(int) yy_BOM(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyprintfv((stderr, "%s\n", "BOM"));
-  if (!yymatchString(G, "\357\273\277")) goto l2223;
-  yyprintf((stderr, "  ok   BOM"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
 
-  return 1;
-  l2223:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "BOM"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+/* mmd_stream_new -- start a document that is fed a piece at a time, with
+	its output passed to write.  OPML and Critic Markup accept or reject
+	need the whole document, so for them the input is collected and
+	converted by mmd_converter_convert_to when the stream is finished. */
+mmd_stream * mmd_stream_new(int extensions, int format, mmd_write_fn write, void *context) {
+	mmd_stream *s = (mmd_stream *)malloc(sizeof(mmd_stream));
+	mmd_converter *c = mmd_converter_new(extensions, format);
+
+	s->c = c;
+	s->format = format;
+	s->input = g_string_sized_new(0);
+	s->taken = 0;
+	s->charstotab = TABSTOP;
+	s->started = s->finishing = s->begun = s->metadata = false;
+	s->whole = (format == OPML_FORMAT) || (extensions & EXT_CRITIC_ACCEPT) || (extensions & EXT_CRITIC_REJECT);
+	s->first = true;
+	s->retry_at = 0;
+	s->scan_limit = STREAM_SCAN_LIMIT;
+	s->before = mk_node(LIST);
+	s->held = s->held_tail = NULL;
+	s->links_seen = c->scratch->links;
+	s->notes_seen = c->scratch->notes;
+
+	c->out = g_string_sized_new(MMD_SINK_CHUNK);
+	g_string_set_flush(c->out, write, context, MMD_SINK_CHUNK);
+	reset_parser_context(&c->g);
+	init_parser_data_len(&c->data, "", 0, "\n\n", extensions);
+	if (s->whole)
+		return s;
+
+	c->data.refill = refill_fed_input;
+	c->data.stream = s;
+	if (extensions & EXT_LINEAR_INLINES) {
+		reset_link_scan(&c->tails);
+		c->data.tails = &c->tails;
+	}
+	reset_html_scan(&c->blocks);
+	c->data.blocks = &c->blocks;
+	return s;
+}
 
-  return 0;
+/* mmd_stream_feed -- add len bytes of data to the document, and write out
+	the blocks that are now complete.  Returns false if a write failed. */
+bool mmd_stream_feed(mmd_stream *s, const char *data, size_t len) {
+	size_t left = s->input->currentStringLength - s->taken;
+
+	/* let go of the input already used, once that is worth the copy */
+	if ((s->taken > 0) && (s->taken >= left)) {
+		memmove(s->input->str, s->input->str + s->taken, left);
+		g_string_truncate(s->input, left);
+		s->taken = 0;
+	}
+	g_string_append_len(s->input, data, len);
+
+	if (!s->whole)
+		stream_advance(s);
+	return g_string_flush(s->c->out);
 }
-YY_RULE(int) yy_Doc(GREG *G)
-{  int yypos0= G->pos, yythunkpos0= G->thunkpos;  yyDo(G, yyPush, 2, 0, "yyPush");
-  yyprintfv((stderr, "%s\n", "Doc"));
 
-  {  int yypos2225= G->pos, yythunkpos2225= G->thunkpos;  if (!yy_BOM(G))  goto l2225;
-  goto l2226;
-  l2225:;	  G->pos= yypos2225; G->thunkpos= yythunkpos2225;
-  }
-  l2226:;	  if (!yy_StartList(G))  goto l2224;
-  yyDo(G, yySet, -2, 0, "yySet");
-  if (!yy_StartList(G))  goto l2224;
-  yyDo(G, yySet, -1, 0, "yySet");
+/* mmd_stream_finish -- end the document, write out the rest of it and free
+	the stream.  Returns false if any write failed. */
+bool mmd_stream_finish(mmd_stream *s) {
+	mmd_converter *c = s->c;
+	node *footer;
+	bool ok;
 
-  {  int yypos2227= G->pos, yythunkpos2227= G->thunkpos;  yyText(G, G->begin, G->end);  if (!( !ext(EXT_COMPATIBILITY) && !ext(EXT_NO_METADATA) )) goto l2227;
-  {  int yypos2229= G->pos, yythunkpos2229= G->thunkpos;  if (!yy_MetaDataKey(G))  goto l2227;
-  if (!yy_Sp(G))  goto l2227;
-  if (!yymatchChar(G, ':')) goto l2227;
-  if (!yy_Sp(G))  goto l2227;
+	if (s->whole) {
+		ok = mmd_converter_convert_to(c, s->input->str, s->input->currentStringLength,
+			c->out->flush, c->out->flushContext);
+		mmd_stream_free(s);
+		return ok;
+	}
 
-  {  int yypos2230= G->pos, yythunkpos2230= G->thunkpos;  if (!yy_Newline(G))  goto l2230;
-  goto l2227;
-  l2230:;	  G->pos= yypos2230; G->thunkpos= yythunkpos2230;
-  }  G->pos= yypos2229; G->thunkpos= yythunkpos2229;
-  }  if (!yy_MetaData(G))  goto l2227;
-  yyDo(G, yy_1_Doc, G->begin, G->end, "yy_1_Doc");
-  goto l2228;
-  l2227:;	  G->pos= yypos2227; G->thunkpos= yythunkpos2227;
-  }
-  l2228:;	
-  l2231:;	
-  {  int yypos2232= G->pos, yythunkpos2232= G->thunkpos;  if (!yy_Block(G))  goto l2232;
-  yyDo(G, yy_2_Doc, G->begin, G->end, "yy_2_Doc");
-  goto l2231;
-  l2232:;	  G->pos= yypos2232; G->thunkpos= yythunkpos2232;
-  }
-  l2233:;	
-  {  int yypos2234= G->pos, yythunkpos2234= G->thunkpos;  if (!yy_BlankLine(G))  goto l2234;
-  goto l2233;
-  l2234:;	  G->pos= yypos2234; G->thunkpos= yythunkpos2234;
-  }  yyDo(G, yy_3_Doc, G->begin, G->end, "yy_3_Doc");
-  yyprintf((stderr, "  ok   Doc"));
-  yyprintfGcontext;
-  yyprintf((stderr, "\n"));
-  yyDo(G, yyPop, 2, 0, "yyPop");
-  return 1;
-  l2224:;	  G->pos= yypos0; G->thunkpos= yythunkpos0;  yyprintfv((stderr, "  fail %s", "Doc"));
-  yyprintfvGcontext;
-  yyprintfv((stderr, "\n"));
+	s->finishing = true;
+	stream_advance(s);
+	stream_release(s, true);
 
-  return 0;
+	if (s->metadata) {
+		footer = mk_node(FOOTER);
+		export_blocks(c->out, footer, s->format, c->scratch);
+		free_node(footer);
+	}
+	if (c->data.autolabels != NULL) {
+		/* left for the end of the tree, as converter_run does */
+		export_blocks(c->out, c->data.autolabels, s->format, c->scratch);
+		free_node_tree(c->data.autolabels);
+		c->data.autolabels = NULL;
+	}
+	export_end(c->out, NULL, s->format, c->scratch);
+
+	ok = g_string_flush(c->out);
+	mmd_stream_free(s);
+	return ok;
+}
+
+/* mmd_stream_free -- abandon a stream without finishing the document */
+void mmd_stream_free(mmd_stream *s) {
+	if (s == NULL)
+		return;
+	free_node_tree(s->held);
+	free_node_tree(s->c->data.autolabels);
+	free_node(s->before);
+	g_string_free(s->input, true);
+	mmd_converter_free(s->c);
+	free(s);
+}
+
+/* Documents rendered again and again as they are edited -- every render
+	parses the whole text, but writes a top-level block only if its output
+	may differ from the last render's.  The output of each block is kept
+	under a key made of what its source parsed to, the options, the state
+	the writer is in as the block starts and what the block's links, notes
+	and citations resolve to.  (The parse rather than the source itself, as
+	the same text can parse differently depending on what follows it: a
+	list is loose or tight according to the line after it.)  A block whose key was seen by the last render has its
+	output copied and its effect on the writer (the notes it numbers)
+	played back.  What comes before the first block and after the last (the
+	footnotes) is written afresh every time. */
+
+/* What a block's output depends on and changes in the scratch pad, apart
+	from the definitions */
+typedef struct {
+	int extensions;
+	int padded;
+	int baseheaderlevel;
+	int language;
+	int footnote_to_print;
+	int max_footnote_num;
+	int obfuscate;
+	int no_latex_footnote;
+	int odf_para_type;
+	int odf_list_needs_end_p;
+	int table_column;
+	int cell_type;
+} writer_state;
+
+/* A note that a block used, so that the use can be played back */
+typedef struct {
+	char *label;
+	short key;                  /* the note's type once the block was written */
+	bool  first_use;            /* no block before used it */
+} note_use;
+
+/* The output of a top-level block */
+typedef struct {
+	cache_key     key;
+	size_t        start;        /* in the document's output */
+	size_t        len;
+	writer_state  after;        /* the state the block left the writer in */
+	char         *latex_footer;
+	note_use     *notes;        /* those used first, in order, then the rest */
+	size_t        note_count;
+} fragment;
+
+struct mmd_document {
+	mmd_converter *c;
+	GString       *out;         /* the output of the last render */
+	fragment      *fragments;   /* ... and of each block in it */
+	size_t         count;
+	size_t         room;
+	size_t        *changed;     /* the blocks it wrote afresh */
+	size_t         changed_count;
+	node         **parsed;      /* the blocks waiting to be written */
+	size_t         parsed_room;
+	size_t        *lookup;      /* fragments hashed on key, as index + 1 */
+	size_t         lookup_size; /* a power of two, or 0 */
+};
+
+/* Working out the key of a block, and noting the notes it refers to */
+typedef struct {
+	cache_key     key;
+	scratch_pad  *scratch;
+	node        **notes;
+	size_t        note_count;
+	size_t        note_room;
+} block_keying;
+
+static void save_writer_state(writer_state *w, scratch_pad *scratch) {
+	memset(w, 0, sizeof(writer_state));
+	w->extensions           = scratch->extensions;
+	w->padded               = scratch->padded;
+	w->baseheaderlevel      = scratch->baseheaderlevel;
+	w->language             = scratch->language;
+	w->footnote_to_print    = scratch->footnote_to_print;
+	w->max_footnote_num     = scratch->max_footnote_num;
+	w->obfuscate            = scratch->obfuscate;
+	w->no_latex_footnote    = scratch->no_latex_footnote;
+	w->odf_para_type        = scratch->odf_para_type;
+	w->odf_list_needs_end_p = scratch->odf_list_needs_end_p;
+	w->table_column         = scratch->table_column;
+	w->cell_type            = scratch->cell_type;
+}
+
+static void restore_writer_state(const writer_state *w, scratch_pad *scratch) {
+	scratch->extensions           = w->extensions;
+	scratch->padded               = w->padded;
+	scratch->baseheaderlevel      = w->baseheaderlevel;
+	scratch->language             = w->language;
+	scratch->footnote_to_print    = w->footnote_to_print;
+	scratch->max_footnote_num     = w->max_footnote_num;
+	scratch->obfuscate            = w->obfuscate;
+	scratch->no_latex_footnote    = w->no_latex_footnote;
+	scratch->odf_para_type        = w->odf_para_type;
+	scratch->odf_list_needs_end_p = w->odf_list_needs_end_p;
+	scratch->table_column         = w->table_column;
+	scratch->cell_type            = w->cell_type;
+}
+
+/* in_list -- is n one of the nodes of list? */
+static bool in_list(node *n, node *list) {
+	for (; list != NULL; list = list->next) {
+		if (list == n)
+			return true;
+	}
+	return false;
+}
+
+/* mix_reference -- fold what a reference resolves to into the key of the
+	block it is in: the definition of a link, or the number, type and text
+	of a note (a reference_visitor) */
+static bool mix_reference(void *context, node *ref, bool has_label, link_data *link, node *note) {
+	block_keying *k = (block_keying *)context;
+	node definition;
+	int facts[5];
+
+	memset(facts, 0, sizeof(facts));
+	facts[0] = ref->key;
+	if (note != NULL) {
+		/* a note used already keeps its number; one that isn't takes the
+			next, so the count of notes used so far matters instead */
+		if (in_list(note, k->scratch->used_notes)) {
+			facts[1] = 1;
+			facts[2] = count_node_from_end(note);
+		} else {
+			facts[1] = 2;
+			facts[2] = (k->scratch->used_notes != NULL) ? count_node_from_end(k->scratch->used_notes) : 0;
+		}
+		facts[3] = note->key;
+		facts[4] = k->scratch->max_footnote_num;
+		cache_key_mix(&k->key, facts, sizeof(facts));
+		cache_key_mix_tree(&k->key, note->children);
+
+		if (k->note_count == k->note_room) {
+			k->note_room = (k->note_room > 0) ? k->note_room * 2 : 8;
+			k->notes = (node **)realloc(k->notes, k->note_room * sizeof(node *));
+		}
+		k->notes[k->note_count++] = note;
+	} else if (link != NULL) {
+		facts[1] = 3;
+		cache_key_mix(&k->key, facts, sizeof(facts));
+		memset(&definition, 0, sizeof(definition));
+		definition.key = ref->key;
+		definition.link_data = link;
+		cache_key_mix_tree(&k->key, &definition);
+	} else {
+		facts[1] = has_label ? 4 : 5;
+		cache_key_mix(&k->key, facts, sizeof(facts));
+	}
+	return true;
 }
 
-#ifndef YY_PART
+/* block_key -- work out the key of block as the writer stands */
+static void block_key(block_keying *k, node *block, int extensions, int format) {
+	writer_state state;
 
-typedef int (*yyrule)(GREG *G);
+	cache_key_for(&k->key, "", 0, extensions, format, false);
+	cache_key_mix_tree(&k->key, block);
 
-YY_PARSE(int) YY_NAME(parse_from)(GREG *G, yyrule yystart)
-{
-  int yyok;
-  if (!G->buflen)
-    {
-      G->buflen= YY_BUFFER_START_SIZE;
-      G->buf= (char*)YY_ALLOC(G->buflen, G->data);
-      G->textlen= YY_BUFFER_START_SIZE;
-      G->text= (char*)YY_ALLOC(G->textlen, G->data);
-      G->thunkslen= YY_STACK_SIZE;
-      G->thunks= (yythunk*)YY_ALLOC(sizeof(yythunk) * G->thunkslen, G->data);
-      G->valslen= YY_STACK_SIZE;
-      G->vals= (YYSTYPE*)YY_ALLOC(sizeof(YYSTYPE) * G->valslen, G->data);
-      G->begin= G->end= G->pos= G->limit= G->thunkpos= 0;
-    }
-  G->pos = 0;
-  G->begin= G->end= G->pos;
-  G->thunkpos= 0;
-  G->val= G->vals;
-  yyok= yystart(G);
-  if (yyok) yyDone(G);
-  yyCommit(G);
-  return yyok;
-  (void)yyrefill;
-  (void)yymatchDot;
-  (void)yymatchChar;
-  (void)yymatchString;
-  (void)yymatchClass;
-  (void)yyDo;
-  (void)yyText;
-  (void)yyDone;
-  (void)yyCommit;
-  (void)yyAccept;
-  (void)yyPush;
-  (void)yyPop;
-  (void)yySet;
+	/* the highest note number referred to so far only matters to blocks
+		that refer to notes, so it is mixed in with those references */
+	save_writer_state(&state, k->scratch);
+	state.max_footnote_num = 0;
+	cache_key_mix(&k->key, &state, sizeof(state));
+	if (k->scratch->latex_footer != NULL)
+		cache_key_mix(&k->key, k->scratch->latex_footer, strlen(k->scratch->latex_footer) + 1);
+
+	k->note_count = 0;
+	visit_references(block, k->scratch, mix_reference, k);
 }
 
-YY_PARSE(int) YY_NAME(parse)(GREG *G)
-{
-  return YY_NAME(parse_from)(G, yy_Doc);
+static void free_fragment(fragment *f) {
+	size_t i;
+
+	for (i = 0; i < f->note_count; i++)
+		free(f->notes[i].label);
+	free(f->notes);
+	free(f->latex_footer);
 }
 
-YY_PARSE(void) YY_NAME(init)(GREG *G)
-{
-    memset(G, 0, sizeof(GREG));
+static void add_note_use(fragment *f, size_t *room, node *note, bool first_use) {
+	if (f->note_count == *room) {
+		*room = (*room > 0) ? *room * 2 : 4;
+		f->notes = (note_use *)realloc(f->notes, *room * sizeof(note_use));
+	}
+	f->notes[f->note_count].label = strdup(note->str);
+	f->notes[f->note_count].key = note->key;
+	f->notes[f->note_count].first_use = first_use;
+	f->note_count++;
+}
+
+/* record_block -- note down what writing a block did to the writer: its
+	state afterwards, the notes it was the first to use (those that joined
+	used_notes since it was used_before) and the types of all the notes it
+	refers to, which citations change */
+static void record_block(fragment *f, block_keying *k, node *used_before) {
+	scratch_pad *scratch = k->scratch;
+	size_t room = 0;
+	size_t first;
+	size_t i;
+	note_use swap;
+	node *n;
+
+	save_writer_state(&f->after, scratch);
+	f->latex_footer = (scratch->latex_footer != NULL) ? strdup(scratch->latex_footer) : NULL;
+	f->notes = NULL;
+	f->note_count = 0;
+
+	for (n = scratch->used_notes; (n != used_before) && (n != NULL); n = n->next)
+		add_note_use(f, &room, n, true);
+	/* used_notes is newest first */
+	first = f->note_count;
+	for (i = 0; i < first / 2; i++) {
+		swap = f->notes[i];
+		f->notes[i] = f->notes[first - 1 - i];
+		f->notes[first - 1 - i] = swap;
+	}
+	for (i = 0; i < k->note_count; i++)
+		add_note_use(f, &room, k->notes[i], false);
+}
+
+/* replay_block -- do to the writer what writing the block of f did */
+static void replay_block(const fragment *f, scratch_pad *scratch) {
+	int max_footnote_num = scratch->max_footnote_num;
+	size_t i;
+	node *n;
+
+	restore_writer_state(&f->after, scratch);
+	if (f->note_count == 0)
+		scratch->max_footnote_num = max_footnote_num;
+	if ((f->latex_footer != NULL) &&
+		((scratch->latex_footer == NULL) || (strcmp(scratch->latex_footer, f->latex_footer) != 0))) {
+		free(scratch->latex_footer);
+		scratch->latex_footer = strdup(f->latex_footer);
+	}
+
+	for (i = 0; i < f->note_count; i++) {
+		if (f->notes[i].first_use) {
+			n = node_matching_label(f->notes[i].label, scratch->notes);
+			if (n != NULL)
+				move_note_to_used(n, scratch);
+		} else {
+			n = node_matching_label(f->notes[i].label, scratch->used_notes);
+			if (n == NULL)
+				n = node_matching_label(f->notes[i].label, scratch->notes);
+		}
+		if (n != NULL)
+			n->key = f->notes[i].key;
+	}
 }
-YY_PARSE(void) YY_NAME(deinit)(GREG *G)
-{
-    if (G->buf) YY_FREE(G->buf);
-    if (G->text) YY_FREE(G->text);
-    if (G->thunks) YY_FREE(G->thunks);
-    if (G->vals) YY_FREE((void*)G->vals);
+
+/* index_fragments -- hash the fragments of the last render on their keys */
+static void index_fragments(mmd_document *d) {
+	size_t size = 16;
+	size_t at;
+	size_t i;
+
+	while (size < d->count * 2)
+		size *= 2;
+	if (size > d->lookup_size) {
+		free(d->lookup);
+		d->lookup = (size_t *)malloc(size * sizeof(size_t));
+		d->lookup_size = size;
+	}
+	memset(d->lookup, 0, d->lookup_size * sizeof(size_t));
+	for (i = 0; i < d->count; i++) {
+		at = d->fragments[i].key.h1 & (d->lookup_size - 1);
+		while (d->lookup[at] != 0)
+			at = (at + 1) & (d->lookup_size - 1);
+		d->lookup[at] = i + 1;
+	}
 }
-YY_PARSE(GREG *) YY_NAME(parse_new)(YY_XTYPE data)
-{
-  GREG *G = (GREG *)YY_CALLOC(1, sizeof(GREG), G->data);
-  G->data = data;
-  return G;
+
+/* find_fragment -- the last render's fragment with key, or NULL */
+static fragment * find_fragment(mmd_document *d, const cache_key *key) {
+	size_t at;
+	fragment *f;
+
+	if (d->lookup_size == 0)
+		return NULL;
+	for (at = key->h1 & (d->lookup_size - 1); d->lookup[at] != 0; at = (at + 1) & (d->lookup_size - 1)) {
+		f = &d->fragments[d->lookup[at] - 1];
+		if ((f->key.h1 == key->h1) && (f->key.h2 == key->h2))
+			return f;
+	}
+	return NULL;
 }
 
-YY_PARSE(void) YY_NAME(parse_free)(GREG *G)
-{
-  YY_NAME(deinit)(G);
-  YY_FREE(G);
+static fragment * new_fragment(fragment **fragments, size_t *count, size_t *room) {
+	if (*count == *room) {
+		*room = (*room > 0) ? *room * 2 : 64;
+		*fragments = (fragment *)realloc(*fragments, *room * sizeof(fragment));
+	}
+	memset(&(*fragments)[*count], 0, sizeof(fragment));
+	return &(*fragments)[(*count)++];
 }
 
-#endif
+static void note_changed(mmd_document *d, size_t i, size_t *room) {
+	if (d->changed_count == *room) {
+		*room = (*room > 0) ? *room * 2 : 64;
+		d->changed = (size_t *)realloc(d->changed, *room * sizeof(size_t));
+	}
+	d->changed[d->changed_count++] = i;
+}
+
+/* mmd_document_new -- a document to be rendered again and again with the
+	given extensions and output format */
+mmd_document * mmd_document_new(int extensions, int format) {
+	mmd_document *d = (mmd_document *)calloc(1, sizeof(mmd_document));
+
+	d->c = mmd_converter_new(extensions, format);
+	d->out = g_string_sized_new(0);
+	return d;
+}
+
+void mmd_document_free(mmd_document *d) {
+	size_t i;
+
+	if (d == NULL)
+		return;
+	for (i = 0; i < d->count; i++)
+		free_fragment(&d->fragments[i]);
+	free(d->fragments);
+	free(d->changed);
+	free(d->parsed);
+	free(d->lookup);
+	g_string_free(d->out, true);
+	mmd_converter_free(d->c);
+	free(d);
+}
+
+/* parse_blocks -- parse the whole of source into d->parsed a block at a
+	time, taking the definitions out of the blocks into the scratch pad.
+	Returns the number of blocks, and sets *metadata to the metadata block
+	(also the first block) if there is one and *autolabels to the labels
+	left for the end of the document. */
+static size_t parse_blocks(mmd_document *d, const char *source, size_t len, node **metadata, node **autolabels) {
+	mmd_converter *c = d->c;
+	int extensions = c->extensions;
+	size_t scan_limit = STREAM_SCAN_LIMIT;
+	size_t count = 0;
+	node *before = mk_node(LIST);
+	node *block;
+
+	reset_parser_context(&c->g);
+	g_string_truncate(c->formatted, 0);
+	if (needs_preformat(source, len)) {
+		preformat_text_into(c->formatted, source, len);
+		init_parser_data_len(&c->data, c->formatted->str, c->formatted->currentStringLength, "", extensions);
+	} else {
+		init_parser_data_len(&c->data, source, len, "\n\n", extensions);
+	}
+	classify_lines(&c->lines, c->data.charbuf, c->data.charbuf_end - c->data.charbuf, c->data.trailer);
+	c->data.lines = &c->lines;
+	if (extensions & EXT_LINEAR_INLINES) {
+		reset_link_scan(&c->tails);
+		c->data.tails = &c->tails;
+	}
+	reset_html_scan(&c->blocks);
+	c->data.blocks = &c->blocks;
+	c->data.flat_sections = true;
+
+	block = *metadata = stream_metadata(c);
+	if (block == NULL)
+		block = stream_block(c, &scan_limit);
+	while (block != NULL) {
+		if (count == d->parsed_room) {
+			d->parsed_room = (d->parsed_room > 0) ? d->parsed_room * 2 : 64;
+			d->parsed = (node **)realloc(d->parsed, d->parsed_room * sizeof(node *));
+		}
+		block = refine_block(block, extensions);
+		if (format_uses_references(c->format) && holds_references(block))
+			block = extract_block_references(block, before, count == 0, c->scratch);
+		d->parsed[count++] = block;
+		block = stream_block(c, &scan_limit);
+	}
 
+	/* labels defined by headings and tables follow the document */
+	*autolabels = extract_block_references(c->data.autolabels, before, false, c->scratch);
+	c->data.autolabels = NULL;
+	free_node(before);
+	return count;
+}
+
+/* render_whole -- render a document that isn't split into blocks as one
+	block: one whose format gathers up heading sections (OPML, text, beamer)
+	or whose options need the whole text (Critic Markup accept or reject) */
+static void render_whole(mmd_document *d, GString *out, fragment **fragments, size_t *count, size_t *room,
+	const char *source, size_t len, size_t *changed_room) {
+	fragment *f;
+	const char *result;
+	size_t result_len;
+
+	f = new_fragment(fragments, count, room);
+	cache_key_for(&f->key, source, len, d->c->extensions, d->c->format, false);
+	result = converter_run(d->c, source, len, &result_len, false, NULL);
+	g_string_append_len(out, result, result_len);
+	f->start = 0;
+	f->len = result_len;
+	if ((d->count != 1) || (d->fragments[0].key.h1 != f->key.h1) || (d->fragments[0].key.h2 != f->key.h2))
+		note_changed(d, 0, changed_room);
+}
+
+/* mmd_document_render -- render source, the document as it now stands,
+	writing only the blocks whose output may have changed since the last
+	render.  The result belongs to the document and is valid until the next
+	render. */
+const char * mmd_document_render(mmd_document *d, const char *source, size_t len, size_t *out_len) {
+	mmd_converter *c = d->c;
+	int format = c->format;
+	GString *out = g_string_sized_new(d->out->currentStringLength + 64);
+	fragment *fragments = NULL;
+	fragment *f;
+	fragment *old;
+	size_t count = 0;
+	size_t room = 0;
+	size_t changed_room = 0;
+	size_t blocks;
+	size_t i;
+	block_keying k;
+	node *metadata = NULL;
+	node *autolabels = NULL;
+	node *used_before;
+
+	d->changed_count = 0;
+	free(d->changed);
+	d->changed = NULL;
+	index_fragments(d);
+
+	if (!writes_sections_flat(format) || (c->extensions & EXT_CRITIC_ACCEPT) || (c->extensions & EXT_CRITIC_REJECT)) {
+		render_whole(d, out, &fragments, &count, &room, source, len, &changed_room);
+		goto done;
+	}
 
-/* process_raw_blocks -- follow the tree and process any RAW nodes and insert them
-	into the tree */
-node * process_raw_blocks(node * n, int extensions) {
-	/* from the parser data we get the parent node and pointer to reference list */
-	node *current = NULL;
-	node *last_child = NULL;
-	char *contents;
-	GREG g;
+	reset_scratch_pad(c->scratch, c->extensions);
+	blocks = parse_blocks(d, source, len, &metadata, &autolabels);
+
+	format = export_begin(out, metadata, format, c->scratch);
+	if (c->data.parse_aborted || !writes_sections_flat(format)) {
+		/* metadata can make beamer of LaTeX */
+		for (i = 0; i < blocks; i++)
+			free_node_tree(d->parsed[i]);
+		free_node_tree(autolabels);
+		g_string_truncate(out, 0);
+		render_whole(d, out, &fragments, &count, &room, source, len, &changed_room);
+		goto done;
+	}
 
-	current = n;
-	
-	while (current != NULL) {
-		if (current->key == RAW) {
-			/* Process this RAW block */
-			
-			yyinit(&g);
-			contents = strtok(current->str, "\001");
-			current->key = LIST;
-			g.data = mk_parser_data(contents, (extensions | EXT_NO_METADATA ));
-			
-			while (yyparse(&g));
-			
-			current->children = ((parser_data *)g.data)->result;
-			
-			free((parser_data *)g.data);	/* we're not using free_parser_data to preserve result tree */
-			
-			yydeinit(&g);
-			
-			last_child = current->children;
-			while ((contents = strtok(NULL, "\001"))) {
-				while (last_child->next != NULL) 
-					last_child = last_child->next;
-					
-					yyinit(&g);
-					g.data = mk_parser_data(contents, (extensions | EXT_NO_METADATA ));
-					while (yyparse(&g));
-					last_child->next = ((parser_data *)g.data)->result;
-					free((parser_data *)g.data);
-					yydeinit(&g);
+	k.scratch = c->scratch;
+	k.notes = NULL;
+	k.note_room = 0;
+	for (i = 0; i < blocks; i++) {
+		block_key(&k, d->parsed[i], c->extensions, format);
+		f = new_fragment(&fragments, &count, &room);
+		f->key = k.key;
+		f->start = out->currentStringLength;
+
+		old = find_fragment(d, &k.key);
+		if (old != NULL) {
+			g_string_append_len(out, d->out->str + old->start, old->len);
+			replay_block(old, c->scratch);
+			f->len = old->len;
+			f->after = old->after;
+			f->latex_footer = (old->latex_footer != NULL) ? strdup(old->latex_footer) : NULL;
+			if (old->note_count > 0) {
+				f->notes = (note_use *)malloc(old->note_count * sizeof(note_use));
+				for (f->note_count = 0; f->note_count < old->note_count; f->note_count++) {
+					f->notes[f->note_count] = old->notes[f->note_count];
+					f->notes[f->note_count].label = strdup(old->notes[f->note_count].label);
+				}
 			}
-			free(current->str);
-			current->str = NULL;
-		}
-		if (current->children != NULL) {
-			/* Recurse into children */
-			current->children = process_raw_blocks(current->children, extensions);
+		} else {
+			used_before = c->scratch->used_notes;
+			export_blocks(out, d->parsed[i], format, c->scratch);
+			f->len = out->currentStringLength - f->start;
+			record_block(f, &k, used_before);
+			note_changed(d, i, &changed_room);
 		}
-		current = current->next;
+		free_node_tree(d->parsed[i]);
+		d->parsed[i] = NULL;
 	}
-	return n;
+	free(k.notes);
+
+	if (metadata != NULL) {
+		metadata = mk_node(FOOTER);
+		export_blocks(out, metadata, format, c->scratch);
+		free_node(metadata);
+	}
+	if (autolabels != NULL) {
+		/* left for the end of the tree, as converter_run does */
+		export_blocks(out, autolabels, format, c->scratch);
+		free_node_tree(autolabels);
+	}
+	export_end(out, NULL, format, c->scratch);
+	release_large_buffers(c);
+
+done:
+	for (i = 0; i < d->count; i++)
+		free_fragment(&d->fragments[i]);
+	free(d->fragments);
+	d->fragments = fragments;
+	d->count = count;
+	d->room = room;
+	g_string_free(d->out, true);
+	d->out = out;
+
+	if (out_len != NULL)
+		*out_len = out->currentStringLength;
+	return out->str;
+}
+
+/* mmd_document_changed -- the number of blocks the last render wrote
+	afresh, with their indexes (in order) in *changed; every other block's
+	output is the same as some block's in the render before */
+size_t mmd_document_changed(mmd_document *d, const size_t **changed) {
+	*changed = d->changed;
+	return d->changed_count;
+}
+
+/* mmd_document_blocks -- the number of top-level blocks in the last render */
+size_t mmd_document_blocks(mmd_document *d) {
+	return d->count;
+}
+
+/* mmd_document_block -- the output of block i of the last render, which is
+	within the output of the render; NULL if there is no such block */
+const char * mmd_document_block(mmd_document *d, size_t i, size_t *len) {
+	if (i >= d->count)
+		return NULL;
+	*len = d->fragments[i].len;
+	return d->out->str + d->fragments[i].start;
+}
+
+/* yy_MetaDataOnly -- the start of the Doc rule, up to and including the
+	metadata block:  BOM? &( MetaDataKey Sp ':' Sp !Newline ) MetaData
+	On success the METADATA node is left in yy. */
+static int yy_MetaDataOnly(GREG *G) {
+	int yypos0 = G->pos, yythunkpos0 = G->thunkpos;
+	int yypos1, yythunkpos1;
+
+	if (!yy_BOM(G)) {
+		G->pos = yypos0; G->thunkpos = yythunkpos0;
+	}
+
+	yypos1 = G->pos; yythunkpos1 = G->thunkpos;
+	if (!yy_MetaDataKey(G) || !yy_Sp(G) || !yymatchChar(G, ':') || !yy_Sp(G))
+		goto fail;
+	if (yy_Newline(G))
+		goto fail;
+	G->pos = yypos1; G->thunkpos = yythunkpos1;
+
+	if (!yy_MetaData(G))
+		goto fail;
+	return 1;
+
+fail:
+	G->pos = yypos0; G->thunkpos = yythunkpos0;
+	return 0;
+}
+
+/* metadata_prefix_length -- length of source up to and including the first
+	blank line.  Metadata can't continue past a blank line, so this is all
+	of the document that the metadata parser needs to see. */
+static size_t metadata_prefix_length(const char *source, size_t len) {
+	const char *end = source + len;
+	const char *line = source;
+	const char *p;
+
+	while (line < end) {
+		p = line;
+		while ((p < end) && ((*p == ' ') || (*p == '\t') || (*p == '\r')))
+			p++;
+		if ((p < end) && (*p == '\n'))
+			return (p + 1) - source;
+		p = memchr(p, '\n', end - p);
+		if (p == NULL)
+			break;
+		line = p + 1;
+	}
+	return len;
 }
 
-char * markdown_to_string(char * source, int extensions, int format) {
-	char *out;
+/* parse_metadata -- parse only the leading metadata block of source,
+	returning the METADATA node (to be freed by the caller) or NULL */
+static node * parse_metadata(const char *source, size_t len, int extensions) {
 	char *formatted;
-	char *critic_resolved;
-	node *refined;
-	GREG g;               /* create parser context */
+	parser_data data;
+	node *result = NULL;
+	GREG g;
+
+	if ((extensions & EXT_COMPATIBILITY) || (extensions & EXT_NO_METADATA))
+		return NULL;
+
+	formatted = preformat_text_len(source, metadata_prefix_length(source, len));
+
 	yyinit(&g);
+	init_parser_data(&data, formatted, extensions);
+	g.data = &data;
 
-	/* Resolve Critic Markup before parsing */
-	if ((extensions & EXT_CRITIC_ACCEPT) || (extensions & EXT_CRITIC_REJECT)) {
-		g.data = mk_parser_data(source, extensions);
+	if (yyparse_from(&g, yy_MetaDataOnly))
+		result = g.ss;
 
-		while (yyparse_from(&g, yy_DocForCritic));
-		
-		if (extensions & EXT_CRITIC_REJECT) {
-			if ((extensions & EXT_CRITIC_ACCEPT) && (format == HTML_FORMAT))
-				critic_resolved = export_node_tree(((parser_data *)g.data)->result, CRITIC_HTML_HIGHLIGHT_FORMAT, extensions);
-			else
-				critic_resolved = export_node_tree(((parser_data *)g.data)->result, CRITIC_REJECT_FORMAT, extensions);
-		} else {
-			critic_resolved = export_node_tree(((parser_data *)g.data)->result, CRITIC_ACCEPT_FORMAT , extensions);
-		}
-		
-		free_parser_data((parser_data *)g.data);
-		yydeinit(&g);
-		yyinit(&g);
+	yydeinit(&g);
+	free(formatted);
+	return result;
+}
 
-		formatted = preformat_text(critic_resolved);
-		free(critic_resolved);
-	} else {
-		formatted = preformat_text(source);
-	}
-	
-	g.data = mk_parser_data(formatted,extensions);
-	
-	if (format == OPML_FORMAT) {
-		while (yyparse_from(&g, yy_DocForOPML));	/* We want simpler version */
-	} else {
-		while (yyparse(&g));       /* parse */
+/* extract_metadata -- return all metadata key/value pairs as a NULL
+	terminated array { key, value, key, value, ..., NULL }.  Keys are
+	normalized with label_from_string, as metadata_for_key does.  Free
+	with free_metadata. */
+char ** extract_metadata(const char *source, size_t len, int extensions) {
+	node *metadata = parse_metadata(source, len, extensions);
+	char **pairs;
+
+	pairs = metadata_pairs(metadata);
+	free_node_tree(metadata);
+	return pairs;
+}
+
+/* metadata_pairs -- key/value array for the first METADATA node in list */
+static char ** metadata_pairs(node *list) {
+	node *step;
+	char **pairs;
+	int count = 0;
+
+	while ((list != NULL) && (list->key != METADATA))
+		list = list->next;
+
+	if (list != NULL) {
+		for (step = list->children; step != NULL; step = step->next)
+			count++;
 	}
 
-	if (((parser_data *)g.data)->parse_aborted) {
-		/* clean up */
-		free_parser_data((parser_data *)g.data);
-		yydeinit(&g);
-		
-		free(formatted);
-		
-		out = strdup("MultiMarkdown was unable to parse this file.");
-		return out;
+	pairs = (char **)malloc(sizeof(char *) * (2 * count + 1));
+	count = 0;
+	if (list != NULL) {
+		for (step = list->children; step != NULL; step = step->next) {
+			pairs[count++] = label_from_string(step->str);
+			pairs[count] = strdup(step->children->str);
+			trim_trailing_whitespace(pairs[count++]);
+		}
 	}
+	pairs[count] = NULL;
+	return pairs;
+}
 
-	refined = process_raw_blocks(((parser_data *)g.data)->result, extensions);    /* iteratively parse RAW bits */
+void free_metadata(char **pairs) {
+	char **step;
 
-	/* move autolabels to main parse tree */
-	if (((parser_data *)g.data)->autolabels != NULL) {
-//		fprintf(stderr, "We have autolabels\n");
-		append_list(((parser_data *)g.data)->autolabels,refined);
-		((parser_data *)g.data)->autolabels = NULL;	
-	} else {
-//		fprintf(stderr, "No autolabels\n");
-	}
-	
-	/* Show what we got */
-	out = export_node_tree(refined, format, extensions);
-	
-	/* clean up */
-	free_parser_data((parser_data *)g.data);
-	yydeinit(&g);
-	
-	free(formatted);
-	return out;
+	if (pairs == NULL)
+		return;
+	for (step = pairs; *step != NULL; step++)
+		free(*step);
+	free(pairs);
 }
 
 /* has_metadata -- determine whether metadata exists or not */
 bool has_metadata(char *source, int extensions) {
-    char *formatted;
-    GREG g;
-    yyinit(&g);
-    node *result;
-    bool answer = FALSE;
-    
-    formatted = preformat_text(source);
-    g.data = mk_parser_data(formatted, extensions);
-    
-    /* TODO: change this to parse only the metadata for speed */
-    while (yyparse(&g));
-
-    result = ((parser_data *)g.data)->result;
-
-    if ((result != NULL) && (result->key == METADATA)) {
-		answer = TRUE;
-    }
+	node *metadata = parse_metadata(source, strlen(source), extensions);
 
-	free_parser_data((parser_data *)g.data);
-	yydeinit(&g);
-	
-	free(formatted);
-	return answer;
+	if (metadata == NULL)
+		return FALSE;
+	free_node_tree(metadata);
+	return TRUE;
 }
 
 /* extract_metadata_value -- find the value and return it */
 char * extract_metadata_value(char *source, int extensions, char *key) {
+	return extract_metadata_value_len(source, strlen(source), extensions, key, NULL);
+}
+
+/* extract_metadata_value_len -- as extract_metadata_value, for len bytes of
+	source; if found isn't NULL it is set to whether there is metadata */
+char * extract_metadata_value_len(const char *source, size_t len, int extensions, char *key, bool *found) {
 	char *out;
-	char *formatted;
-	GREG g;
-	yyinit(&g);
-	
-	/* don't preformat if doing syntax highlighting */
-	formatted = preformat_text(source);
-	g.data = mk_parser_data(formatted,extensions);
-	
-	while (yyparse(&g));       /* parse */
+	node *metadata = parse_metadata(source, len, extensions);
 
-	if (((parser_data *)g.data)->parse_aborted) {
-		out = strdup("MultiMarkdown was unable to parse this file.");
-	} else {
-		out = metavalue_for_key(key,((parser_data *)g.data)->result);
-	}
-	
-	
-	free_parser_data((parser_data *)g.data);
-	yydeinit(&g);
-	
-	free(formatted);
+	if (found != NULL)
+		*found = (metadata != NULL);
+	out = metavalue_for_key(key, metadata);
+	free_node_tree(metadata);
 	return out;
 }
-
-
@@ -41,15 +41,107 @@ struct link_data {
 
 typedef struct link_data link_data;
 
+/* Line classes recorded by classify_lines, so that block rules can rule
+	out alternatives without scanning the start of the line again */
+#define LINE_BLANK      0x0001      /* only spaces and tabs */
+#define LINE_INDENTED   0x0002      /* tab or four spaces */
+#define LINE_QUOTE      0x0004      /* '>' */
+#define LINE_BULLET     0x0008      /* up to 3 spaces, [+*-] and a space */
+#define LINE_ORDERED    0x0010      /* up to 3 spaces, digits, '.' and a space */
+#define LINE_RULE       0x0020      /* up to 3 spaces and [*_-] */
+#define LINE_ATX        0x0040      /* '#' */
+#define LINE_UNDERLINE  0x0080      /* nothing but '=' or nothing but '-' */
+#define LINE_SETEXT     0x0100      /* the next line is an underline */
+#define LINE_HTML       0x0200      /* '<' */
+#define LINE_SP_HTML    0x0400      /* '<' after spaces and tabs */
+#define LINE_BRACKET    0x0800      /* up to 3 spaces and '[' */
+#define LINE_COLON      0x1000      /* up to 3 spaces and ':' */
+#define LINE_PIPE       0x2000      /* a '|' anywhere */
+#define LINE_BANG       0x4000      /* '!' */
+#define LINE_TERM       0x8000      /* a definition (':') may follow */
+#define LINE_ANY        0xffff      /* not a known line start */
+
+typedef struct {
+	size_t         start;       /* offset of the first character */
+	unsigned short flags;       /* LINE_* classes */
+} line_info;
+
+typedef struct {
+	line_info *lines;
+	size_t     count;
+	size_t     capacity;
+	size_t     cursor;          /* last line found, where the next is likely */
+} line_map;
+
+/* What earlier scans found about inline link tails, "](source 'title')",
+	and the ends of other inline spans, so that the linear inline engine
+	(EXT_LINEAR_INLINES) doesn't scan the same text again for each one
+	left unfinished */
+#define NO_SCAN_END ((size_t) -1)
+
+/* Inline spans whose closer is found by scanning ahead (see yySpanEnd) */
+enum span_kinds {
+	SPAN_REFERENCE,             /* "[#label]" and "[^label]" */
+	SPAN_AUTOLINK,              /* "<scheme://...>" and "<user@...>" */
+	SPAN_COMMENT,               /* "<!-- ... -->" */
+	SPAN_MATH_PAREN,            /* "\\( ... \\)" */
+	SPAN_MATH_BRACKET,          /* "\\[ ... \\]" */
+	SPAN_DOLLAR,                /* "$...$" */
+	SPAN_DOUBLE_DOLLAR,         /* "$$...$$" */
+	SPAN_KINDS
+};
+
+typedef struct {
+	size_t *source_end;         /* where a source starting at from + i ends */
+	int    *pending;            /* scratch stack of unmatched ')' */
+	size_t  from;               /* offset covered by source_end ... */
+	size_t  count;              /* ... and the number of entries */
+	size_t  capacity;
+	size_t  title_from[2];      /* a title closed by ' (or ") opening here */
+	size_t  title_end[2];       /* ... or anywhere up to here closes here */
+	size_t  span_from[SPAN_KINDS];  /* a span of each kind opening here ... */
+	size_t  span_end[SPAN_KINDS];   /* ... or anywhere up to here stops here */
+} link_scan;
+
+/* Where the HTML blocks opened at given offsets end, so that each open tag
+	is matched with its close tag once per parse (see HtmlBlockInTags) */
+typedef struct {
+	size_t  at;                 /* offset of the open tag's '<' */
+	size_t  end;                /* offset after the close tag, or NO_SCAN_END */
+	int     tag;                /* which tag name; -1 for an unused entry */
+} html_scan_entry;
+
+typedef struct {
+	html_scan_entry *entries;   /* hashed on at and tag */
+	size_t  count;
+	size_t  capacity;           /* a power of two, or 0 */
+	size_t *pending;            /* scratch stack of unclosed open tags */
+	size_t  room;
+} html_scan;
+
+/* Points input and input_end at the next piece of a document that is read
+	a piece at a time; false once there is no more.  An empty piece means
+	that more is to come but none is there yet (see starved). */
+typedef bool (*input_refill)(void *stream, char **input, const char **input_end);
+
 /* This is the data we store in the parser context */
 typedef struct {
 	char *charbuf;              /* Input buffer */
+	const char *charbuf_end;    /* End of the input */
+	const char *trailer;        /* Read once the input is used up */
+	input_refill refill;        /* More input once charbuf runs out, or NULL */
+	void *stream;               /* Where refill gets it from */
+	line_map   *lines;          /* Classified input lines, or NULL */
+	link_scan  *tails;          /* Link tail scans, or NULL */
+	html_scan  *blocks;         /* HTML block scans, or NULL */
 	char *original;             /* Original input buffer */
 	node *result;               /* Resulting parse tree */
 	int   extensions;           /* Extension bitfield */
 	node *autolabels;           /* Store for later retrieval */
 	bool  parse_aborted;        /* We got bogged down - fail parse */
 	clock_t stop_time;          /* Note the deadline to complete parsing */
+	bool  flat_sections;        /* A heading doesn't gather the blocks after it */
+	bool  starved;              /* The parse ran into input not there yet */
 } parser_data;
 
 /* A "scratch pad" for storing data when writing output 
@@ -62,6 +154,9 @@ typedef struct {
 	char *table_alignment;      /* Hold the alignment string while parsing table */
 	int   table_column;         /* Track the current column number */
 	char  cell_type;            /* What sort of cell type are we in? */
+	char **column_styles;       /* Cell attributes for each table column */
+	size_t column_count;
+	size_t column_room;
 	node *notes;                /* Store reference notes */
 	node *links;                /* ... links */
 	node *glossary;             /* ... glossary */
@@ -121,11 +216,28 @@ node    * mk_str_from_list(node *list, bool extra_newline);
 GString * concat_string_list(node *list);
 
 parser_data * mk_parser_data(char *charbuf, int extensions);
+void   init_parser_data(parser_data *data, char *charbuf, int extensions);
+void   init_parser_data_len(parser_data *data, const char *input, size_t len, const char *trailer, int extensions);
 void   free_parser_data(parser_data *data);
 
 char * preformat_text(char *text);
+char * preformat_text_len(const char *text, size_t len);
+void   preformat_text_into(GString *buf, const char *text, size_t len);
+void   preformat_text_append(GString *buf, const char *text, size_t len, int *charstotab);
+bool   needs_preformat(const char *text, size_t len);
+
+void   classify_lines(line_map *map, const char *input, size_t len, const char *trailer);
+unsigned int line_class_at(line_map *map, size_t offset);
+void   free_line_map(line_map *map);
+
+void   reset_link_scan(link_scan *scan);
+void   free_link_scan(link_scan *scan);
+
+void   reset_html_scan(html_scan *scan);
+void   free_html_scan(html_scan *scan);
 
 scratch_pad * mk_scratch_pad(int extensions);
+void   reset_scratch_pad(scratch_pad *scratch, int extensions);
 void   free_scratch_pad(scratch_pad *scratch);
 
 link_data * mk_link_data(char *label, char *source, char *title, node *attr);
@@ -156,6 +268,7 @@ char * metavalue_for_key(char *key, node *list);
 bool tree_contains_key(node *list, int key);
 
 bool check_timeout();
+clock_t parser_clock(void);
 
 void debug_node(node *n);
 
@@ -0,0 +1,477 @@
+/*
+
+	serialize.c -- parse trees saved in a binary form, so that a document
+		can be exported again, in another format or with other options,
+		without being parsed again
+
+	(c) 2013 Fletcher T. Penney (http://fletcherpenney.net/).
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License or the MIT
+	license.  See LICENSE for details.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+*/
+
+/*	The image is a header, a table of nodes, a table of link data and a
+	pool of NUL terminated strings.  Nodes and links refer to each other by
+	index + 1 and to strings by offset + 1 (0 standing for NULL), so the
+	image means the same wherever it is loaded, and mmd_deserialize uses it
+	where it lies: loading is a check of the header, of a hash of the rest
+	and of each reference, with nothing to fix up.
+
+	Nodes are numbered in the order they are reached, a node before its
+	link's attributes, its children and its next sibling, so every
+	reference is to a later node.  An image where that holds, and where no
+	node or link is referred to twice, is a tree; the writers also need the
+	nodes that the parser always gives link data to have it.  The hash
+	turns away images that were damaged after they were written, but it
+	has no key, so anyone can recompute it: beyond those checks, the
+	writers take the shape of each node (a heading's label, a metadata
+	key's value, a table cell's span) on trust, and an image edited to
+	break that can crash them.  Images are only to be read from where the
+	text they were made from would be trusted.
+
+	The writers take apart the tree they export (definitions and notes are
+	moved out of it and freed), so each export builds a tree from the image
+	first; that is a single walk, without any parsing. */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "serialize.h"
+#include "cache.h"
+#include "writer.h"
+
+#define TREE_MAGIC      "MMDTREE"
+#define TREE_VERSION    2
+#define TREE_BYTE_ORDER 0x01020304
+
+/* The parse was abandoned, and the image holds no tree */
+#define TREE_ABORTED    0x0001
+
+typedef struct {
+	char            magic[8];
+	uint32_t        version;
+	uint32_t        byte_order;       /* TREE_BYTE_ORDER, as written */
+	uint32_t        extensions;       /* those it was parsed with */
+	uint32_t        format;           /* the format it was parsed for */
+	uint32_t        flags;
+	uint32_t        root;             /* node index + 1 */
+	uint32_t        node_count;
+	uint32_t        link_count;
+	uint64_t        strings_size;
+	uint64_t        size;             /* of the whole image */
+	uint64_t        check[2];         /* hash of the tables and the pool */
+} tree_header;
+
+typedef struct {
+	int32_t         key;
+	uint32_t        str;              /* string offset + 1 */
+	uint32_t        link;             /* link index + 1 */
+	uint32_t        children;         /* node index + 1 */
+	uint32_t        next;             /* node index + 1 */
+} tree_node;
+
+typedef struct {
+	uint32_t        label;            /* string offset + 1 */
+	uint32_t        source;
+	uint32_t        title;
+	uint32_t        attr;             /* node index + 1 */
+} tree_link;
+
+struct mmd_tree {
+	const tree_header *header;
+	const tree_node   *nodes;
+	const tree_link   *links;
+	const char        *strings;
+	void              *mapping;       /* the file, if mapped by mmd_tree_map */
+	size_t             mapped;
+	void              *copy;          /* or an aligned copy of the image */
+};
+
+/* A tree being turned into an image */
+typedef struct {
+	tree_node      *nodes;
+	size_t          node_count;
+	size_t          node_room;
+	tree_link      *links;
+	size_t          link_count;
+	size_t          link_room;
+	GString        *strings;
+	bool            overflow;         /* too big for 32 bit references */
+} freezer;
+
+static uint32_t freeze_list(freezer *f, node *list);
+
+/* image_check -- the hash of an image's tables and pool, stored in h */
+static void image_check(tree_header *h, const tree_node *nodes, const tree_link *links, const char *strings) {
+	cache_key key = { 0, 0 };
+
+	cache_key_mix(&key, nodes, h->node_count * sizeof(tree_node));
+	cache_key_mix(&key, links, h->link_count * sizeof(tree_link));
+	cache_key_mix(&key, strings, h->strings_size);
+	h->check[0] = key.h1;
+	h->check[1] = key.h2;
+}
+
+/* freeze_string -- add str to the pool */
+static uint32_t freeze_string(freezer *f, const char *str) {
+	size_t at = f->strings->currentStringLength;
+
+	if (str == NULL)
+		return 0;
+	if (at >= UINT32_MAX) {
+		f->overflow = true;
+		return 0;
+	}
+	g_string_append_len(f->strings, str, strlen(str) + 1);
+	return (uint32_t)at + 1;
+}
+
+/* freeze_link -- add a link and its attributes */
+static uint32_t freeze_link(freezer *f, link_data *l) {
+	size_t i;
+	uint32_t attr;
+
+	if (f->link_count >= UINT32_MAX - 1) {
+		f->overflow = true;
+		return 0;
+	}
+	if (f->link_count == f->link_room) {
+		f->link_room = (f->link_room > 0) ? f->link_room * 2 : 16;
+		f->links = (tree_link *)realloc(f->links, f->link_room * sizeof(tree_link));
+	}
+	i = f->link_count++;
+	f->links[i].label  = freeze_string(f, l->label);
+	f->links[i].source = freeze_string(f, l->source);
+	f->links[i].title  = freeze_string(f, l->title);
+	attr = freeze_list(f, l->attr);
+	f->links[i].attr   = attr;
+	return (uint32_t)i + 1;
+}
+
+/* freeze_list -- add the nodes of list, and everything under them */
+static uint32_t freeze_list(freezer *f, node *list) {
+	uint32_t first = 0;
+	size_t last = 0;
+	size_t i;
+	uint32_t ref;
+
+	for (; list != NULL; list = list->next) {
+		if (f->node_count >= UINT32_MAX - 1) {
+			f->overflow = true;
+			return first;
+		}
+		if (f->node_count == f->node_room) {
+			f->node_room = (f->node_room > 0) ? f->node_room * 2 : 256;
+			f->nodes = (tree_node *)realloc(f->nodes, f->node_room * sizeof(tree_node));
+		}
+		i = f->node_count++;
+		if (first == 0)
+			first = (uint32_t)i + 1;
+		else
+			f->nodes[last].next = (uint32_t)i + 1;
+		last = i;
+
+		/* the tables move as they grow, so each field is set once its
+			part of the tree has been added */
+		f->nodes[i].key = list->key;
+		f->nodes[i].next = 0;
+		ref = freeze_string(f, list->str);
+		f->nodes[i].str = ref;
+		ref = (list->link_data != NULL) ? freeze_link(f, list->link_data) : 0;
+		f->nodes[i].link = ref;
+		ref = freeze_list(f, list->children);
+		f->nodes[i].children = ref;
+	}
+	return first;
+}
+
+/* serialize_tree -- pass the image of tree, parsed with extensions for
+	format, to write */
+bool serialize_tree(node *tree, int extensions, int format, bool aborted, mmd_write_fn write, void *context) {
+	freezer f;
+	tree_header header;
+	bool ok;
+
+	memset(&f, 0, sizeof(f));
+	f.strings = g_string_sized_new(4096);
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, TREE_MAGIC, sizeof(header.magic));
+	header.version    = TREE_VERSION;
+	header.byte_order = TREE_BYTE_ORDER;
+	header.extensions = (uint32_t)extensions;
+	header.format     = (uint32_t)format;
+	if (aborted)
+		header.flags |= TREE_ABORTED;
+	else
+		header.root = freeze_list(&f, tree);
+
+	if (f.overflow) {
+		ok = false;
+	} else {
+		header.node_count   = (uint32_t)f.node_count;
+		header.link_count   = (uint32_t)f.link_count;
+		header.strings_size = f.strings->currentStringLength;
+		header.size         = sizeof(header) + f.node_count * sizeof(tree_node) +
+			f.link_count * sizeof(tree_link) + header.strings_size;
+		image_check(&header, f.nodes, f.links, f.strings->str);
+
+		ok = write(context, (const char *)&header, sizeof(header)) &&
+			((f.node_count == 0) || write(context, (const char *)f.nodes, f.node_count * sizeof(tree_node))) &&
+			((f.link_count == 0) || write(context, (const char *)f.links, f.link_count * sizeof(tree_link))) &&
+			((header.strings_size == 0) || write(context, f.strings->str, header.strings_size));
+	}
+
+	free(f.nodes);
+	free(f.links);
+	g_string_free(f.strings, true);
+	return ok;
+}
+
+/* claim -- mark a node or link as referred to; false if it already was */
+static bool claim(unsigned char *seen, size_t i) {
+	if (seen[i / 8] & (1 << (i % 8)))
+		return false;
+	seen[i / 8] |= (1 << (i % 8));
+	return true;
+}
+
+/* valid_string -- does ref point into the pool (which ends in a NUL)? */
+static bool valid_string(const tree_header *h, uint32_t ref) {
+	return (ref == 0) || (ref <= h->strings_size);
+}
+
+/* needs_link -- does the parser always give nodes of this type link data,
+	which the writers then take for granted? */
+static bool needs_link(int key) {
+	switch (key) {
+		case LINK:
+		case IMAGE:
+		case IMAGEBLOCK:
+		case LINKREFERENCE:
+		case CITATION:
+		case NOCITATION:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/* valid_tree -- is the image at t well formed? */
+static bool valid_tree(const mmd_tree *t) {
+	const tree_header *h = t->header;
+	tree_header check;
+	size_t nodes = h->node_count;
+	size_t links = h->link_count;
+	unsigned char *seen;
+	const tree_node *n;
+	const tree_link *l;
+	bool ok = true;
+	size_t i;
+
+	memcpy(&check, h, sizeof(check));
+	image_check(&check, t->nodes, t->links, t->strings);
+	if ((check.check[0] != h->check[0]) || (check.check[1] != h->check[1]))
+		return false;
+	if ((h->strings_size > 0) && (t->strings[h->strings_size - 1] != '\0'))
+		return false;
+	if ((h->root > nodes) || ((h->root == 0) != (nodes == 0)))
+		return false;
+
+	seen = (unsigned char *)calloc((nodes + links) / 8 + 1, 1);
+	if (h->root > 0)
+		claim(seen, h->root - 1);
+
+	for (i = 0; ok && (i < nodes); i++) {
+		n = &t->nodes[i];
+		ok = (n->key >= 0) && (n->key < KEY_COUNTER) &&
+			valid_string(h, n->str) &&
+			(n->children <= nodes) && ((n->children == 0) || ((n->children > i + 1) && claim(seen, n->children - 1))) &&
+			(n->next <= nodes) && ((n->next == 0) || ((n->next > i + 1) && claim(seen, n->next - 1))) &&
+			(n->link <= links) && ((n->link > 0) || !needs_link(n->key));
+		if (ok && (n->link > 0)) {
+			l = &t->links[n->link - 1];
+			ok = claim(seen, nodes + n->link - 1) &&
+				valid_string(h, l->label) && valid_string(h, l->source) && valid_string(h, l->title) &&
+				(l->attr <= nodes) && ((l->attr == 0) || ((l->attr > i + 1) && claim(seen, l->attr - 1)));
+		}
+	}
+
+	free(seen);
+	return ok;
+}
+
+/* mmd_deserialize -- the tree in the len bytes at data, as written by
+	mmd_serialize, or NULL if they don't hold one this library can read
+	(errno is EINVAL).  The bytes are used where they are, and must outlive
+	the tree, unless they aren't aligned for it, when they are copied. */
+mmd_tree * mmd_deserialize(const void *data, size_t len) {
+	const tree_header *h = (const tree_header *)data;
+	mmd_tree *t;
+	void *copy = NULL;
+	size_t tables;
+
+	if ((data == NULL) || (len < sizeof(tree_header)))
+		goto invalid;
+	if (((uintptr_t)data % sizeof(uint64_t)) != 0) {
+		copy = malloc(len);
+		memcpy(copy, data, len);
+		h = (const tree_header *)copy;
+	}
+	if ((memcmp(h->magic, TREE_MAGIC, sizeof(h->magic)) != 0) ||
+		(h->version != TREE_VERSION) || (h->byte_order != TREE_BYTE_ORDER) ||
+		(h->size != len))
+		goto invalid;
+	tables = (size_t)h->node_count * sizeof(tree_node) + (size_t)h->link_count * sizeof(tree_link);
+	if ((tables > len - sizeof(tree_header)) || (h->strings_size != len - sizeof(tree_header) - tables))
+		goto invalid;
+
+	t = (mmd_tree *)malloc(sizeof(mmd_tree));
+	t->header  = h;
+	t->nodes   = (const tree_node *)(h + 1);
+	t->links   = (const tree_link *)(t->nodes + h->node_count);
+	t->strings = (const char *)(t->links + h->link_count);
+	t->mapping = NULL;
+	t->mapped  = 0;
+	t->copy    = copy;
+
+	if (!valid_tree(t)) {
+		free(t);
+		goto invalid;
+	}
+	return t;
+
+invalid:
+	free(copy);
+	errno = EINVAL;
+	return NULL;
+}
+
+/* mmd_tree_map -- the tree in the file at path, mapped rather than read */
+mmd_tree * mmd_tree_map(const char *path) {
+	struct stat st;
+	void *mapping;
+	mmd_tree *t;
+	int saved;
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return NULL;
+	if (fstat(fd, &st) != 0) {
+		saved = errno;
+		close(fd);
+		errno = saved;
+		return NULL;
+	}
+	if ((size_t)st.st_size < sizeof(tree_header)) {
+		close(fd);
+		errno = EINVAL;
+		return NULL;
+	}
+	mapping = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	saved = errno;
+	close(fd);
+	if (mapping == MAP_FAILED) {
+		errno = saved;
+		return NULL;
+	}
+
+	t = mmd_deserialize(mapping, st.st_size);
+	if (t == NULL) {
+		munmap(mapping, st.st_size);
+		errno = EINVAL;
+		return NULL;
+	}
+	t->mapping = mapping;
+	t->mapped  = st.st_size;
+	return t;
+}
+
+void mmd_tree_free(mmd_tree *t) {
+	if (t == NULL)
+		return;
+	if (t->mapping != NULL)
+		munmap(t->mapping, t->mapped);
+	free(t->copy);
+	free(t);
+}
+
+static node * thaw_list(const mmd_tree *t, uint32_t ref);
+
+static char * thaw_string(const mmd_tree *t, uint32_t ref) {
+	return (ref != 0) ? (char *)(t->strings + ref - 1) : NULL;
+}
+
+/* thaw_list -- build the nodes from ref on, and everything under them */
+static node * thaw_list(const mmd_tree *t, uint32_t ref) {
+	node *first = NULL;
+	node **tail = &first;
+	const tree_node *r;
+	const tree_link *l;
+	node *n;
+
+	while (ref != 0) {
+		r = &t->nodes[ref - 1];
+		n = mk_node(r->key);
+		if (r->str != 0)
+			n->str = strdup(thaw_string(t, r->str));
+		if (r->link != 0) {
+			l = &t->links[r->link - 1];
+			n->link_data = mk_link_data(thaw_string(t, l->label), thaw_string(t, l->source),
+				thaw_string(t, l->title), thaw_list(t, l->attr));
+		}
+		n->children = thaw_list(t, r->children);
+		*tail = n;
+		tail = &n->next;
+		ref = r->next;
+	}
+	return first;
+}
+
+/* parsed_alike -- is a document parsed for format a parsed the same way for
+	format b?  OPML has a grammar of its own, and with both Critic flags HTML
+	shows the changes where the other formats reject them. */
+static bool parsed_alike(int extensions, int a, int b) {
+	if ((a == OPML_FORMAT) != (b == OPML_FORMAT))
+		return false;
+	if ((extensions & EXT_CRITIC_ACCEPT) && (extensions & EXT_CRITIC_REJECT) &&
+		((a == HTML_FORMAT) != (b == HTML_FORMAT)))
+		return false;
+	return true;
+}
+
+/* mmd_tree_export -- the tree written in format with the given extensions
+	(those that change the parse have no effect here), as a malloc'ed
+	string whose length is stored in out_len (if not NULL).  NULL if format
+	parses documents differently from the format the tree was parsed for. */
+char * mmd_tree_export(mmd_tree *t, int extensions, int format, size_t *out_len) {
+	const tree_header *h = t->header;
+	char *out;
+	node *tree;
+
+	if (!parsed_alike(h->extensions, h->format, format))
+		return NULL;
+
+	if (h->flags & TREE_ABORTED) {
+		out = strdup("MultiMarkdown was unable to parse this file.");
+		if (out_len != NULL)
+			*out_len = strlen(out);
+		return out;
+	}
+
+	tree = thaw_list(t, h->root);
+	out = export_node_tree_len(tree, format, extensions, out_len);
+	free_node_tree(tree);
+	return out;
+}
@@ -0,0 +1,8 @@
+#ifndef SERIALIZE_PARSER_H
+#define SERIALIZE_PARSER_H
+
+#include "parser.h"
+
+bool   serialize_tree(node *tree, int extensions, int format, bool aborted, mmd_write_fn write, void *context);
+
+#endif
@@ -0,0 +1,452 @@
+/*
+
+	shared_cache.c -- the cache of recent conversions kept in a file mapped
+		by every process that uses it, so that the workers of a prefork
+		server share one cache and it outlasts any of them
+
+	(c) 2013 Fletcher T. Penney (http://fletcherpenney.net/).
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License or the MIT
+	license.  See LICENSE for details.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+*/
+
+/*	The file holds a header, an index and a log.  Outputs are appended to
+	the log, which wraps around and overwrites the oldest of them; positions
+	in the log only ever grow, so a record at pos is intact while
+	pos + log_size >= head.  The index is a table of buckets of SHARED_WAYS
+	slots, each bucket guarded by one of SHARED_STRIPES locks, mapping keys
+	to log positions.
+
+	Readers copy a record without holding the log lock and then check that
+	head hasn't moved past it; writers move head on before writing, so a
+	record that was being overwritten while it was copied is never used.
+	The locks are robust process-shared mutexes, so a worker that dies
+	holding one doesn't stop the others. */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "cache.h"
+
+#define SHARED_MAGIC   "MMDCACHE"
+#define SHARED_LAYOUT  1
+#define SHARED_WAYS    8
+#define SHARED_STRIPES 64
+
+/* Bytes of log for each slot in the index */
+#define SHARED_BYTES_PER_SLOT 2048
+
+/* Outputs bigger than this part of the log aren't kept */
+#define SHARED_LARGEST_SHARE 8
+
+typedef struct {
+	char            magic[8];
+	uint32_t        layout;
+	uint32_t        mutex_size;       /* guards against a different libc */
+	uint64_t        size;             /* of the whole file */
+	uint64_t        buckets;
+	uint64_t        index_offset;
+	uint64_t        log_offset;
+	uint64_t        log_size;
+	uint64_t        head;             /* log position just past the last record */
+	uint64_t        hits;
+	uint64_t        misses;
+	uint64_t        evictions;
+	pthread_mutex_t log_lock;
+	pthread_mutex_t stripes[SHARED_STRIPES];
+} shared_header;
+
+/* A slot in the index; end is the log position just past the record, and
+	is 0 for an empty slot */
+typedef struct {
+	uint64_t h1;
+	uint64_t h2;
+	uint64_t end;
+	uint64_t len;
+} shared_slot;
+
+/* The start of a record in the log; the output follows, padded to 8 bytes */
+typedef struct {
+	uint64_t h1;
+	uint64_t h2;
+	uint64_t len;
+} shared_record;
+
+#define record_size(len) (sizeof(shared_record) + (((len) + 7) & ~(uint64_t) 7))
+
+static shared_header *shared = NULL;
+static char          *shared_path = NULL;
+
+static void shared_lock(pthread_mutex_t *m) {
+	if (pthread_mutex_lock(m) == EOWNERDEAD)
+		pthread_mutex_consistent(m);
+}
+
+static inline shared_slot * bucket_slots(shared_header *h, const cache_key *key) {
+	return (shared_slot *)((char *)h + h->index_offset) + (key->h2 % h->buckets) * SHARED_WAYS;
+}
+
+static inline pthread_mutex_t * bucket_lock(shared_header *h, const cache_key *key) {
+	return &h->stripes[(key->h2 % h->buckets) % SHARED_STRIPES];
+}
+
+static inline shared_record * record_at(shared_header *h, uint64_t pos) {
+	return (shared_record *)((char *)h + h->log_offset + (pos % h->log_size));
+}
+
+/* Records are copied in and out a word at a time with relaxed atomic
+	accesses, as a reader may be copying one that is being overwritten; it
+	then finds out from intact() and throws the copy away */
+static void copy_in(shared_record *record, const cache_key *key, const char *data, size_t len) {
+	uint64_t *words = (uint64_t *)(record + 1);
+	uint64_t word;
+	size_t i;
+
+	__atomic_store_n(&record->h1, key->h1, __ATOMIC_RELAXED);
+	__atomic_store_n(&record->h2, key->h2, __ATOMIC_RELAXED);
+	__atomic_store_n(&record->len, (uint64_t) len, __ATOMIC_RELAXED);
+	for (i = 0; i < len; i += sizeof(word)) {
+		word = 0;
+		memcpy(&word, data + i, (len - i < sizeof(word)) ? len - i : sizeof(word));
+		__atomic_store_n(&words[i / sizeof(word)], word, __ATOMIC_RELAXED);
+	}
+}
+
+static void copy_out(GString *out, shared_record *record, size_t len) {
+	uint64_t *words = (uint64_t *)(record + 1);
+	uint64_t chunk[64];
+	size_t done;
+	size_t n;
+	size_t i;
+
+	for (done = 0; done < len; done += n) {
+		n = (len - done < sizeof(chunk)) ? len - done : sizeof(chunk);
+		for (i = 0; i < (n + 7) / 8; i++)
+			chunk[i] = __atomic_load_n(&words[done / 8 + i], __ATOMIC_RELAXED);
+		g_string_append_len(out, (char *)chunk, n);
+	}
+}
+
+/* intact -- whether the record starting at pos hasn't been overwritten */
+static inline bool intact(shared_header *h, uint64_t pos) {
+	return pos + h->log_size >= __atomic_load_n(&h->head, __ATOMIC_ACQUIRE);
+}
+
+/* init_shared -- lay out a new cache file of size bytes in the mapping h */
+static bool init_shared(shared_header *h, uint64_t size) {
+	pthread_mutexattr_t attr;
+	uint64_t slots;
+	int i;
+
+	memset(h, 0, sizeof(shared_header));
+	h->layout = SHARED_LAYOUT;
+	h->mutex_size = sizeof(pthread_mutex_t);
+	h->size = size;
+	h->index_offset = (sizeof(shared_header) + 63) & ~(uint64_t) 63;
+
+	slots = (size - h->index_offset) / (SHARED_BYTES_PER_SLOT + sizeof(shared_slot));
+	h->buckets = slots / SHARED_WAYS;
+	if (h->buckets == 0)
+		return false;
+	h->log_offset = h->index_offset + h->buckets * SHARED_WAYS * sizeof(shared_slot);
+	h->log_size = (size - h->log_offset) & ~(uint64_t) 7;
+
+	if ((pthread_mutexattr_init(&attr) != 0)
+		|| (pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED) != 0)
+		|| (pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST) != 0))
+		return false;
+	pthread_mutex_init(&h->log_lock, &attr);
+	for (i = 0; i < SHARED_STRIPES; i++)
+		pthread_mutex_init(&h->stripes[i], &attr);
+	pthread_mutexattr_destroy(&attr);
+
+	/* the file is only taken as a cache once it is complete */
+	memcpy(h->magic, SHARED_MAGIC, sizeof(h->magic));
+	return true;
+}
+
+/* usable -- whether the header describes a cache this library can share */
+static bool usable(shared_header *h, uint64_t file_size) {
+	return (memcmp(h->magic, SHARED_MAGIC, sizeof(h->magic)) == 0)
+		&& (h->layout == SHARED_LAYOUT)
+		&& (h->mutex_size == sizeof(pthread_mutex_t))
+		&& (h->size == file_size);
+}
+
+/* fail -- give up on the cache file fd, leaving error in errno */
+static void fail(int fd, int error) {
+	flock(fd, LOCK_UN);
+	close(fd);
+	errno = error;
+}
+
+/* mmd_cache_share -- keep the cache in the file at path, shared with every
+	other process using the same file, instead of in this process.  A new
+	file is made size bytes long; an existing one keeps its size and
+	contents.  Only an empty file or a cache file is used.  False, with errno
+	set, if the file can't be used. */
+bool mmd_cache_share(const char *path, size_t size) {
+	shared_header *h = NULL;
+	struct stat st;
+	uint64_t file_size;
+	int fd;
+
+	if (shared != NULL)
+		mmd_cache_unshare();
+
+	fd = open(path, O_RDWR | O_CREAT, 0666);
+	if (fd < 0)
+		return false;
+
+	/* one process at a time looks at the file, and lays it out if need be */
+	while ((flock(fd, LOCK_EX) != 0) && (errno == EINTR));
+
+	if (fstat(fd, &st) != 0) {
+		fail(fd, errno);
+		return false;
+	}
+
+	if ((size_t) st.st_size >= sizeof(shared_header)) {
+		h = (shared_header *)mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		if (h == MAP_FAILED) {
+			fail(fd, errno);
+			return false;
+		}
+		if (!usable(h, st.st_size)) {
+			/* only a cache file (perhaps left half made) is laid out again,
+				never some other file */
+			if ((memcmp(h->magic, SHARED_MAGIC, sizeof(h->magic)) != 0)
+				&& (memcmp(h->magic, "\0\0\0\0\0\0\0\0", sizeof(h->magic)) != 0)) {
+				munmap(h, st.st_size);
+				fail(fd, EINVAL);
+				return false;
+			}
+			munmap(h, st.st_size);
+			h = NULL;
+		}
+	} else if (st.st_size > 0) {
+		fail(fd, EINVAL);
+		return false;
+	}
+
+	if (h == NULL) {
+		file_size = size;
+		if (file_size < sizeof(shared_header) + SHARED_WAYS * (SHARED_BYTES_PER_SLOT + sizeof(shared_slot)) * 2) {
+			fail(fd, EINVAL);
+			return false;
+		}
+		if ((ftruncate(fd, 0) != 0) || (ftruncate(fd, file_size) != 0)) {
+			fail(fd, errno);
+			return false;
+		}
+		h = (shared_header *)mmap(NULL, file_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		if (h == MAP_FAILED) {
+			fail(fd, errno);
+			return false;
+		}
+		if (!init_shared(h, file_size)) {
+			munmap(h, file_size);
+			fail(fd, EINVAL);
+			return false;
+		}
+	}
+
+	flock(fd, LOCK_UN);
+	close(fd);
+
+	shared_path = strdup(path);
+	__atomic_store_n(&shared, h, __ATOMIC_RELEASE);
+	return true;
+}
+
+/* mmd_cache_unshare -- go back to a cache of this process's own.  Not to
+	be called while other threads are converting. */
+void mmd_cache_unshare(void) {
+	shared_header *h = shared;
+
+	if (h == NULL)
+		return;
+	__atomic_store_n(&shared, NULL, __ATOMIC_RELEASE);
+	munmap(h, h->size);
+	free(shared_path);
+	shared_path = NULL;
+}
+
+/* mmd_cache_shared_path -- the file the cache is kept in, or NULL */
+const char * mmd_cache_shared_path(void) {
+	return shared_path;
+}
+
+bool shared_cache_attached(void) {
+	return __atomic_load_n(&shared, __ATOMIC_ACQUIRE) != NULL;
+}
+
+/* shared_cache_fetch -- append the output filed under key to out, if the
+	shared cache has it intact */
+bool shared_cache_fetch(const cache_key *key, GString *out) {
+	shared_header *h = __atomic_load_n(&shared, __ATOMIC_ACQUIRE);
+	shared_slot *slots = bucket_slots(h, key);
+	shared_record *record;
+	uint64_t end = 0;
+	uint64_t len = 0;
+	uint64_t pos;
+	size_t start = out->currentStringLength;
+	int i;
+
+	shared_lock(bucket_lock(h, key));
+	for (i = 0; i < SHARED_WAYS; i++) {
+		if ((slots[i].end != 0) && (slots[i].h1 == key->h1) && (slots[i].h2 == key->h2)) {
+			end = slots[i].end;
+			len = slots[i].len;
+			break;
+		}
+	}
+	pthread_mutex_unlock(bucket_lock(h, key));
+
+	/* a slot left half written by a worker that died is caught by these
+		checks, and never leads outside the log */
+	if ((end != 0) && (record_size(len) <= h->log_size / SHARED_LARGEST_SHARE)
+		&& (end >= record_size(len)) && (end <= __atomic_load_n(&h->head, __ATOMIC_ACQUIRE))) {
+		pos = end - record_size(len);
+		record = record_at(h, pos);
+		if (intact(h, pos) && ((pos % h->log_size) + record_size(len) <= h->log_size)
+			&& (__atomic_load_n(&record->h1, __ATOMIC_RELAXED) == key->h1)
+			&& (__atomic_load_n(&record->h2, __ATOMIC_RELAXED) == key->h2)
+			&& (__atomic_load_n(&record->len, __ATOMIC_RELAXED) == len)) {
+			copy_out(out, record, len);
+
+			/* only if the record is still there now that it has been copied */
+			__atomic_thread_fence(__ATOMIC_ACQUIRE);
+			if (intact(h, pos)) {
+				__atomic_fetch_add(&h->hits, 1, __ATOMIC_RELAXED);
+
+				/* an output that is still wanted is moved to the front of the
+					log before it is overwritten */
+				if (pos + h->log_size / 2 < __atomic_load_n(&h->head, __ATOMIC_ACQUIRE))
+					shared_cache_store(key, out->str + start, len);
+				return true;
+			}
+			g_string_truncate(out, start);
+		}
+	}
+
+	__atomic_fetch_add(&h->misses, 1, __ATOMIC_RELAXED);
+	return false;
+}
+
+/* live -- whether slot s refers to a record that is still in the log */
+static inline bool live(shared_header *h, shared_slot *s) {
+	return (s->end != 0) && intact(h, s->end - record_size(s->len));
+}
+
+/* pick_slot -- the slot in a bucket for key: the one already holding key,
+	else one that is empty or whose output has been overwritten, else the
+	one with the oldest output, which is evicted */
+static int pick_slot(shared_header *h, shared_slot *slots, const cache_key *key) {
+	int oldest = 0;
+	int i;
+
+	for (i = 0; i < SHARED_WAYS; i++) {
+		if ((slots[i].end != 0) && (slots[i].h1 == key->h1) && (slots[i].h2 == key->h2))
+			return i;
+	}
+	for (i = 0; i < SHARED_WAYS; i++) {
+		if (!live(h, &slots[i]))
+			return i;
+		if (slots[i].end < slots[oldest].end)
+			oldest = i;
+	}
+	__atomic_fetch_add(&h->evictions, 1, __ATOMIC_RELAXED);
+	return oldest;
+}
+
+/* shared_cache_store -- append len bytes of output to the log and file
+	them under key, in place of the oldest output in the key's bucket if it
+	is full */
+void shared_cache_store(const cache_key *key, const char *data, size_t len) {
+	shared_header *h = __atomic_load_n(&shared, __ATOMIC_ACQUIRE);
+	shared_slot *slots = bucket_slots(h, key);
+	shared_record *record;
+	uint64_t size = record_size(len);
+	uint64_t at;
+	uint64_t pos;
+	int victim;
+
+	if (size > h->log_size / SHARED_LARGEST_SHARE)
+		return;
+
+	shared_lock(&h->log_lock);
+	pos = h->head;
+	at = pos % h->log_size;
+	if (at + size > h->log_size)
+		pos += h->log_size - at;	/* records don't wrap around */
+
+	/* move head on first, so that anyone copying what is about to be
+		overwritten will know */
+	__atomic_store_n(&h->head, pos + size, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+
+	record = record_at(h, pos);
+	copy_in(record, key, data, len);
+	pthread_mutex_unlock(&h->log_lock);
+
+	shared_lock(bucket_lock(h, key));
+	victim = pick_slot(h, slots, key);
+	slots[victim].h1 = key->h1;
+	slots[victim].h2 = key->h2;
+	slots[victim].len = len;
+	slots[victim].end = pos + size;
+	pthread_mutex_unlock(bucket_lock(h, key));
+}
+
+/* shared_cache_flush -- empty the index, which leaves everything in the
+	log unreachable */
+void shared_cache_flush(void) {
+	shared_header *h = __atomic_load_n(&shared, __ATOMIC_ACQUIRE);
+	shared_slot *slots = (shared_slot *)((char *)h + h->index_offset);
+	uint64_t b;
+
+	for (b = 0; b < SHARED_STRIPES; b++)
+		shared_lock(&h->stripes[b]);
+	memset(slots, 0, h->buckets * SHARED_WAYS * sizeof(shared_slot));
+	for (b = 0; b < SHARED_STRIPES; b++)
+		pthread_mutex_unlock(&h->stripes[b]);
+}
+
+/* shared_cache_get_stats -- the limit, contents and counters of the shared
+	cache, counted across every process that uses it */
+void shared_cache_get_stats(mmd_cache_stats *stats) {
+	shared_header *h = __atomic_load_n(&shared, __ATOMIC_ACQUIRE);
+	shared_slot *slots = (shared_slot *)((char *)h + h->index_offset);
+	uint64_t b;
+	int i;
+
+	stats->limit = h->log_size;
+	stats->entries = 0;
+	stats->bytes = 0;
+	for (b = 0; b < h->buckets; b++) {
+		shared_lock(&h->stripes[b % SHARED_STRIPES]);
+		for (i = 0; i < SHARED_WAYS; i++) {
+			shared_slot *s = &slots[b * SHARED_WAYS + i];
+			if (live(h, s)) {
+				stats->entries++;
+				stats->bytes += record_size(s->len);
+			}
+		}
+		pthread_mutex_unlock(&h->stripes[b % SHARED_STRIPES]);
+	}
+	stats->hits = __atomic_load_n(&h->hits, __ATOMIC_RELAXED);
+	stats->misses = __atomic_load_n(&h->misses, __ATOMIC_RELAXED);
+	stats->evictions = __atomic_load_n(&h->evictions, __ATOMIC_RELAXED);
+}
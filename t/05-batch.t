@@ -0,0 +1,37 @@
+#!/usr/bin/env perl
+
+# Test parallel conversion of many documents with markdown_many
+
+use blib;
+use Test::More;
+use Text::MultiMarkdown::XS qw(markdown markdown_many);
+
+my @texts = map { "Heading $_\n----------\n\nSome \"text\" number $_.\n" } 1 .. 200;
+
+my @expected = map { markdown($_) } @texts;
+
+is_deeply(markdown_many(\@texts), \@expected, 'results in input order');
+is_deeply(markdown_many(\@texts, { threads => 1 }), \@expected, 'single thread');
+is_deeply(markdown_many(\@texts, { threads => 3 }), \@expected, 'three threads');
+
+my @latex = map { markdown($_, { output => 'latex', smart => 0 }) } @texts[0..9];
+is_deeply(markdown_many([ @texts[0..9] ], { output => 'latex', smart => 0 }), \@latex,
+          'options apply to every document');
+
+is_deeply(markdown_many([]), [], 'empty list');
+
+my $results = markdown_many([ "*a*", undef, "*b*" ]);
+is(scalar(@$results), 3,           'undef input keeps its slot');
+ok(!defined $results->[1],         'undef input gives undef result');
+is($results->[2], '<p><em>b</em></p>', 'document after undef');
+
+my @nul = ("before\0after", "*a*\0\n\n*b*");
+is_deeply(markdown_many(\@nul), [ map { markdown($_) } @nul ], 'embedded NULs do not truncate');
+
+is_deeply(Text::MultiMarkdown::XS->new->markdown_many([ "*a*" ]), [ '<p><em>a</em></p>' ],
+          'method call');
+
+eval { markdown_many("not a list") };
+like($@, qr/array reference/, 'non-array argument');
+
+done_testing();
@@ -0,0 +1,77 @@
+#!/usr/bin/env perl
+
+# Test string handling in the XS glue: UTF-8 flag, embedded NULs, long input
+
+use strict;
+use utf8;
+use blib;
+use Test::More;
+use Text::MultiMarkdown::XS;
+
+my $html = markdown("Caf\x{e9} *cr\x{e8}me* \x{2014} \x{263a}");
+ok(utf8::is_utf8($html), 'UTF-8 flag carried over to result');
+is($html, "<p>Caf\x{e9} <em>cr\x{e8}me</em> \x{2014} \x{263a}</p>", 'UTF-8 text round trips');
+
+my $bytes = "plain *ascii*";
+ok(!utf8::is_utf8(markdown($bytes)), 'byte string stays a byte string');
+
+like(markdown("before\0after"), qr/before\x{fffd}after|before\xef\xbf\xbdafter/,
+     'embedded NUL does not truncate the document');
+
+my $long = join("\n\n", map { "Paragraph *$_* with some text." } 1 .. 20000);
+my $out  = markdown($long);
+like($out, qr{<p>Paragraph <em>20000</em> with some text.</p>$}, 'long document converted in full');
+is(length($out), length(join("\n\n", map { "<p>Paragraph <em>$_</em> with some text.</p>" } 1 .. 20000)),
+   'result length');
+
+my $copy = $out;
+$copy =~ s/Paragraph/Para/g;
+like($out, qr/^<p>Paragraph/, 'result is an independent string');
+
+# Short inputs are converted with a per-thread converter, longer ones without
+my $mmd = Text::MultiMarkdown::XS->new;
+my ($head, $tail) = ("Title: t\n\n# Head\n\n", "\n\n[^1]\n\n[^1]: n\n");
+foreach my $len (4094 .. 4097) {
+    my $text = $head . ("x" x ($len - length($head) - length($tail))) . $tail;
+    is(markdown($text), $mmd->markdown($text), "input of $len bytes");
+}
+is(markdown("*a*", { output => 'latex' }), "\\emph{a}", 'short input, other format');
+is(markdown("*a*"), "<p><em>a</em></p>", 'short input, back to html');
+
+# The per-thread converter is reused from call to call: whatever options and
+# format each call asks for, the result matches a converter of its own, and no
+# definitions, notes or labels are left over from the call before
+my $refs = "A [link][r] and a note.[^n] \"Quote\"\n\n[r]: http://example.com/ \"Title\"\n[^n]: The note.\n";
+my @calls = (
+    [ $refs,                              { notes => 1 } ],
+    [ $refs,                              { notes => 1, output => 'latex' } ],
+    [ $refs,                              { smart => 0 } ],
+    [ "Again [link][r] and [^n].",        { notes => 1 } ],
+    [ "[link][r][^n]\n\n[^n]: Other.",    { notes => 1, output => 'latex' } ],
+    [ "# Head\n\n[Head] and [r]",         {} ],
+    [ "[Head]",                           { linear_inlines => 1 } ],
+    [ "Title: t\n\n[%title]",             { complete => 1 } ],
+    [ $refs,                              { notes => 1, use_metadata => 0, output => 'memoir' } ],
+);
+foreach my $call (@calls) {
+    my ($text, $options) = @$call;
+    my $name = join(',', map { "$_=$options->{$_}" } sort keys %$options) || 'defaults';
+    is(markdown($text, $options), Text::MultiMarkdown::XS->new($options)->markdown($text),
+       "reused converter: $name");
+}
+like(markdown($refs, { notes => 1 }), qr{<li id="fn:1">\n<p>The note\. }, 'note of the first call');
+my $again = markdown("Again [link][r] and [^n].", { notes => 1 });
+unlike($again, qr/example\.com|The note/, 'definitions are not kept between calls');
+is(markdown("[Head]"), '<p>[Head]</p>', 'heading labels are not kept between calls');
+
+# Line endings, tabs and the byte order mark are normalized before parsing
+my $lf = "Title: t\n\n# Head\n\n    code\tx\n\npara\nline\n";
+(my $crlf = $lf) =~ s/\n/\r\n/g;
+(my $cr   = $lf) =~ s/\n/\r/g;
+is(markdown($crlf), markdown($lf), 'CRLF line endings');
+is(markdown($cr),   markdown($lf), 'CR line endings');
+is(markdown("\xEF\xBB\xBF$lf"), markdown($lf), 'byte order mark');
+is(markdown("\xEF\xBB\xBF\tcode"), "<pre><code>code\n</code></pre>", 'tab after byte order mark');
+is(markdown("\tx\ty\n\tab\tc"), "<pre><code>x   y\nab  c\n</code></pre>", 'tab stops');
+
+done_testing();
@@ -0,0 +1,41 @@
+#!/usr/bin/env perl
+
+# Test the object interface, which reuses a native converter between calls
+
+use strict;
+use blib;
+use Test::More;
+use Text::MultiMarkdown::XS;
+
+my @texts = ( "Heading\n-------\n\nHere is some \"quoted text\".\n",
+              "* one\n* two\n\n[link][ref]\n\n[ref]: http://example.com/\n",
+              "Text with a note[^1].\n\n[^1]: The note.\n",
+              "Title: Doc\n\nBody *text*.\n",
+              "short",
+              "" );
+
+my $mmd = Text::MultiMarkdown::XS->new;
+isa_ok($mmd, 'Text::MultiMarkdown::XS');
+
+foreach my $round (1 .. 3) {
+    foreach my $i (0 .. $#texts) {
+        is($mmd->markdown($texts[$i]), markdown($texts[$i]), "round $round, text $i");
+    }
+}
+
+my $plain = Text::MultiMarkdown::XS->new(smart => 0);
+is($plain->markdown($texts[0]), markdown($texts[0], { smart => 0 }), 'options from new()');
+is($plain->markdown($texts[0]), markdown($texts[0], { smart => 0 }), 'options from new() reused');
+is($plain->markdown($texts[0], { smart => 1 }), markdown($texts[0], { smart => 1 }), 'per-call options override');
+
+my $latex = Text::MultiMarkdown::XS->new({ output => 'latex' });
+is($latex->markdown($texts[0]), markdown($texts[0], { output => 'latex' }), 'latex converter');
+
+my $big = join("\n\n", ("A paragraph of *text*.") x 10000);
+is($mmd->markdown($big), markdown($big), 'large document');
+is($mmd->markdown($texts[0]), markdown($texts[0]), 'small document after large one');
+
+is_deeply($plain->markdown_many([ @texts ]), [ map { markdown($_, { smart => 0 }) } @texts ],
+          'markdown_many uses the object options');
+
+done_testing();
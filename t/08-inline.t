@@ -0,0 +1,33 @@
+#!/usr/bin/env perl
+
+# Test inline-only conversion
+
+use strict;
+use blib;
+use Test::More;
+use Text::MultiMarkdown::XS qw(markdown markdown_inline);
+
+is(markdown_inline('*emphasis* and **strong**'), '<em>emphasis</em> and <strong>strong</strong>',
+   'no paragraph wrapper');
+is(markdown_inline('a `code` span & [link](http://example.com/)'),
+   'a <code>code</code> span &amp; <a href="http://example.com/">link</a>', 'code and links');
+is(markdown_inline('Some "quotes"'),                  'Some &#8220;quotes&#8221;', 'smart quotes');
+is(markdown_inline('Some "quotes"', { smart => 0 }),  'Some &quot;quotes&quot;',   'smart option');
+is(markdown_inline('# Not a heading'),                '# Not a heading',           'no block syntax');
+is(markdown_inline('Title: not metadata'),            'Title: not metadata',       'no metadata');
+is(markdown_inline("two\nlines"),                     "two\nlines",                'soft line break');
+is(markdown_inline("two\n\nparagraphs"),              "two paragraphs",            'blank line becomes a space');
+is(markdown_inline("a\n# b"),                         "a\n# b",                    'line end before a heading line');
+is(markdown_inline("a\n> b"),                         "a\n&gt; b",                 'line end before a quote line');
+is(markdown_inline("a\n* b\n1. c"),                   "a\n* b\n1. c",              'line ends before list lines');
+is(markdown_inline("a\n\n\n# b"),                     "a # b",                     'blank lines before a heading line');
+is(markdown_inline(''),                               '',                          'empty input');
+is(markdown_inline('*a*', { output => 'latex' }),     '\emph{a}',                  'latex output');
+is(markdown_inline('*a*', { complete => 1 }),         '<em>a</em>',                'complete is ignored');
+
+my $mmd = Text::MultiMarkdown::XS->new;
+is($mmd->markdown_inline('*a* b'), '<em>a</em> b', 'method');
+is($mmd->markdown('*a* b'), '<p><em>a</em> b</p>', 'block conversion after inline');
+is($mmd->markdown_inline('*a* b'), '<em>a</em> b', 'inline conversion after block');
+
+done_testing();
@@ -0,0 +1,42 @@
+#!/usr/bin/env perl
+
+# Test metadata extraction without a full conversion
+
+use strict;
+use blib;
+use Test::More;
+use Text::MultiMarkdown::XS qw(metadata);
+
+my $input = <<EOS;
+Title:  A Test Document
+Author: Some Body
+Base Header Level: 2
+Keywords: one,
+    two
+Date:   2013-06-21   
+
+Body text with Colon: not metadata.
+
+Later: not metadata either
+EOS
+
+is_deeply(metadata($input),
+          { title           => 'A Test Document',
+            author          => 'Some Body',
+            baseheaderlevel => '2',
+            keywords        => "one,\ntwo",
+            date            => '2013-06-21' },
+          'all key/value pairs');
+
+is_deeply(metadata("No metadata here.\n\nTitle: x\n"), {}, 'no metadata');
+is_deeply(metadata("Heading\n=======\n"),               {}, 'setext heading is not metadata');
+is_deeply(metadata("http://example.com: x\n"),          {}, 'URL is not metadata');
+is_deeply(metadata("Title: x"),                         { title => 'x' }, 'no trailing newline');
+is_deeply(metadata("Title:\tTabbed\r\nDate: d\r\n\r\nbody\r\n"), { title => 'Tabbed', date => 'd' },
+          'tabs and CRLF line endings');
+is_deeply(metadata($input, { use_metadata => 0 }),     {}, 'use_metadata off');
+
+my $mmd = Text::MultiMarkdown::XS->new;
+is($mmd->metadata($input)->{title}, 'A Test Document', 'method');
+
+done_testing();
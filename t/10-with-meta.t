@@ -0,0 +1,42 @@
+#!/usr/bin/env perl
+
+# Test conversion and metadata extraction from a single parse
+
+use strict;
+use blib;
+use Test::More;
+use Text::MultiMarkdown::XS qw(markdown markdown_with_meta metadata);
+
+my $input = <<EOS;
+Title:  A Test Document
+Author: Some Body
+Base Header Level: 2
+
+Some *text*.
+EOS
+
+my $meta_expected = { title           => 'A Test Document',
+                      author          => 'Some Body',
+                      baseheaderlevel => '2' };
+
+my ($html, $meta) = markdown_with_meta($input);
+is($html, markdown($input),                'output same as markdown()');
+is_deeply($meta, $meta_expected,           'metadata');
+is_deeply($meta, metadata($input),         'metadata same as metadata()');
+
+($html, $meta) = markdown_with_meta("No metadata.\n");
+is($html, "<p>No metadata.</p>",           'output without metadata');
+is_deeply($meta, {},                       'no metadata');
+
+($html, $meta) = markdown_with_meta($input, { use_metadata => 0 });
+is($html, markdown($input, { use_metadata => 0 }), 'output with use_metadata off');
+is_deeply($meta, {},                       'use_metadata off');
+
+my $mmd = Text::MultiMarkdown::XS->new(output => 'latex');
+for my $pass (1 .. 2) {
+    ($html, $meta) = $mmd->markdown_with_meta($input);
+    is($html, markdown($input, { output => 'latex' }), "method output, pass $pass");
+    is_deeply($meta, $meta_expected,       "method metadata, pass $pass");
+}
+
+done_testing();
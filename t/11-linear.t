@@ -0,0 +1,70 @@
+#!/usr/bin/env perl
+
+# Test the linear-time inline engine against the grammar's own rules
+
+use strict;
+use blib;
+use Test::More;
+use Text::MultiMarkdown::XS qw(markdown markdown_inline);
+
+my @same = (
+    '*emphasis* and **strong** and ***both***',
+    '_under_ and __strong under__ and a_b_c',
+    '**b****b** and a****b',
+    '*a **b** c* and **a *b* c**',
+    'unclosed *star and __double and a** b',
+    '[link](http://example.com/ "Title") and [link](<http://example.com/>)',
+    '[nested *emph*](http://example.com/(paren)) text',
+    '![image](pic.jpg "Pic") and ![alt][pic]',
+    '[ref] and [text][ref] and [text] [ref] and [ref][]',
+    '[missing] and [text][missing] and [missing][]',
+    'a [cite][#doe] and [#doe] and [#doe][]',
+    'a footnote[^note] here',
+    '"double" and \'single\' and don\'t and rock \'n\' roll',
+    '"unclosed and \'open',
+    '`*code*` and <span>*html*</span> and <http://example.com/>',
+    '\*escaped\* and \[brackets\]',
+    "line one *across\nlines* and [link\ntext](http://example.com/)",
+);
+
+my $refs = "\n\n[ref]: http://example.com/ref\n[pic]: pic.png\n[^note]: The note.\n";
+
+for my $text (@same) {
+    my $input = $text . $refs;
+    is(markdown($input, { linear_inlines => 1 }), markdown($input), "same output: $text");
+    is(markdown($input, { linear_inlines => 1, smart => 0, notes => 0 }),
+       markdown($input, { smart => 0, notes => 0 }), "same output, plain: $text");
+}
+
+# closers after whitespace, and reference labels with brackets inside
+for my $text ('*a *', '**a **', '_a _', "**x\na*b*c", '*a **b** c* d',
+              "[foo [bar]: http://e.com/\n\nbody",
+              "[unclosed\n[ref]: http://x.com/\n+ item\n",
+              "[a [b] c]: http://x/\n\n[a [b] c] and [r][r](/u)") {
+    is(markdown($text, { linear_inlines => 1 }), markdown($text), "same pairing: $text");
+}
+
+# documented: a setext underline or a definition isn't kept inside a span
+is(markdown("a *b\n: c* d"), "<p>a <em>b\n: c</em> d</p>", 'definition inside emphasis');
+is(markdown("a *b\n: c* d", { linear_inlines => 1 }), "<dl>\n<dt>a *b</dt>\n<dd>c* d</dd>\n</dl>",
+   'definition ends the term with linear_inlines');
+is(markdown("a *b\n===\nc* d", { linear_inlines => 1 }), "<h1 id=\"ab\">a *b</h1>\n\n<p>c* d</p>",
+   'underline ends the heading with linear_inlines');
+
+is(markdown_inline('*a* and [b](c)', { linear_inlines => 1 }), '<em>a</em> and <a href="c">b</a>',
+   'inline conversion');
+
+my $mmd = Text::MultiMarkdown::XS->new(linear_inlines => 1);
+is($mmd->markdown('**a**'), '<p><strong>a</strong></p>', 'object option');
+is($mmd->markdown('"q"'),   '<p>&#8220;q&#8221;</p>',    'reused converter');
+
+# inputs that make the grammar backtrack without bound
+for my $text ('[a ' x 20000, '"a \'b ' x 20000, '*a _b [c ' x 20000, '[#a ' x 20000,
+              '<!-- ' x 20000, '$a ' x 20000, '\\\\( ' x 20000, '<http://a ' x 20000) {
+    my $start  = time;
+    my $output = markdown($text, { linear_inlines => 1 });
+    ok(time - $start < 5, 'pathological input converts quickly');
+    like($output, qr{^<p>.*</p>$}s, 'pathological input is one paragraph');
+}
+
+done_testing();
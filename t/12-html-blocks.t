@@ -0,0 +1,39 @@
+#!/usr/bin/env perl
+
+# Test recognition of block-level HTML
+
+use strict;
+use blib;
+use Test::More;
+use Text::MultiMarkdown::XS qw(markdown);
+
+my @cases = (
+    [ "<div>\n*not emphasis*\n</div>\n\nafter",
+      "<div>\n*not emphasis*\n</div>\n\n<p>after</p>",            'block is passed through' ],
+    [ "<DIV>\n*x*\n</DIV>",        "<DIV>\n*x*\n</DIV>",            'upper case tag name' ],
+    [ "<Div>\n*x*\n</Div>",        "<p><Div>\n<em>x</em>\n</Div></p>", 'mixed case is not a block' ],
+    [ "<div class=\"a\">\n<div>inner</div>\n</div>",
+      "<div class=\"a\">\n<div>inner</div>\n</div>",                'nested blocks' ],
+    [ "<div title=\"a > b\">\ntext\n</div>",
+      "<div title=\"a > b\">\ntext\n</div>",                        'quoted attribute' ],
+    [ "<div>\nnever closed\n\n*para*",
+      "<p><div>\nnever closed</p>\n\n<p><em>para</em></p>",        'unclosed block' ],
+    [ "<pre>\n  code\n</pre>",      "<pre>\n  code\n</pre>",         'tag with a shorter tag as prefix' ],
+    [ "<script>\nif (a<b) { x(); }\n</script>",
+      "<script>\nif (a<b) { x(); }\n</script>",                     'script' ],
+    [ "<hr />\n\ntext",            "<hr />\n\n<p>text</p>",         'self-closing tag' ],
+);
+
+for my $case (@cases) {
+    my ($input, $output, $name) = @$case;
+    is(markdown($input), $output, $name);
+}
+
+# every block below is left open, so each one is matched against the rest
+# of the document
+my $start = time;
+my $output = markdown("<div>\n\n" x 20000);
+ok(time - $start < 5, 'many unclosed blocks convert quickly');
+like($output, qr/^<p><div><\/p>/, 'unclosed blocks become paragraphs');
+
+done_testing();
@@ -0,0 +1,51 @@
+#!/usr/bin/env perl
+
+# Test tables, including rows of plain cells built in one step
+
+use strict;
+use blib;
+use Test::More;
+use Text::MultiMarkdown::XS qw(markdown);
+
+my $head = "| a | b | c |\n|:--|:-:|--:|\n";
+
+sub body {
+    my ($output) = @_;
+    return $output =~ m{<tbody>\n(.*)</tbody>}s ? $1 : $output;
+}
+
+my @cases = (
+    [ "| one | two words | 3.5 |\n",
+      "<tr>\n\t<td style=\"text-align:left;\">one</td>\n\t<td style=\"text-align:center;\">two words</td>\n"
+      . "\t<td style=\"text-align:right;\">3.5</td>\n</tr>\n",                                    'plain cells' ],
+    [ "one|two|three\n",
+      "<tr>\n\t<td style=\"text-align:left;\">one</td>\n\t<td style=\"text-align:center;\">two</td>\n"
+      . "\t<td style=\"text-align:right;\">three</td>\n</tr>\n",                                  'no outer dividers' ],
+    [ "| 1-2 | a-b | x... |\n",
+      "<tr>\n\t<td style=\"text-align:left;\">1&#8211;2</td>\n\t<td style=\"text-align:center;\">a-b</td>\n"
+      . "\t<td style=\"text-align:right;\">x&#8230;</td>\n</tr>\n",                               'smart typography' ],
+    [ "| *em* | `code` | x |\n",
+      "<tr>\n\t<td style=\"text-align:left;\"><em>em</em></td>\n\t<td style=\"text-align:center;\"><code>code</code></td>\n"
+      . "\t<td style=\"text-align:right;\">x</td>\n</tr>\n",                                      'inline markup' ],
+    [ "| span || x |\n",
+      "<tr>\n\t<td style=\"text-align:left;\" colspan=\"2\">span</td>\n\t<td style=\"text-align:center;\">x</td>\n</tr>\n",
+                                                                                                  'spanning cell' ],
+    [ "| | b | c | d |\n",
+      "<tr>\n\t<td style=\"text-align:left;\"></td>\n\t<td style=\"text-align:center;\">b</td>\n"
+      . "\t<td style=\"text-align:right;\">c</td>\n\t<td style=\"text-align:left;\">d</td>\n</tr>\n",
+                                                                                                  'empty cell and extra column' ],
+);
+
+for my $case (@cases) {
+    my ($rows, $output, $name) = @$case;
+    is(body(markdown($head . $rows)), $output, $name);
+}
+
+is(markdown($head . "| one | two |\n", { smart => 0 }), markdown($head . "| one | two |\n"),
+   'plain row without smart typography');
+
+my $rows = join('', map { "| $_ | item $_ | $_.25 |\n" } 1 .. 20000);
+my $output = markdown($head . $rows);
+is(() = $output =~ /<tr>/g, 20001, 'large table');
+
+done_testing();
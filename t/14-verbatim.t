@@ -0,0 +1,31 @@
+#!/usr/bin/env perl
+
+# Test indented code blocks
+
+use strict;
+use blib;
+use Test::More;
+use Text::MultiMarkdown::XS qw(markdown);
+
+my @cases = (
+    [ "    if (a < b && c > \"d\")\n    {\n\treturn;\n    }",
+      "<pre><code>if (a &lt; b &amp;&amp; c &gt; &quot;d&quot;)\n{\nreturn;\n}\n</code></pre>",   'escaping and indents' ],
+    [ "    one\n\n   \n    two\n\n\n",
+      "<pre><code>one\n\n\ntwo\n</code></pre>",                                          'blank lines inside' ],
+    [ "        nested\n    flat\n     ",
+      "<pre><code>    nested\nflat\n</code></pre>",                                       'deeper indent kept' ],
+    [ "para\n\n    code\nlazy",
+      "<p>para</p>\n\n<pre><code>code\n</code></pre>\n\n<p>lazy</p>",                    'block ends at an unindented line' ],
+);
+
+for my $case (@cases) {
+    my ($input, $output, $name) = @$case;
+    is(markdown($input), $output, $name);
+}
+
+my $code = join('', map { "    line $_ <tag> & more\n" } 1 .. 50000);
+my $output = markdown($code);
+is(length($output), length("<pre><code></code></pre>") + 50000 * length("line  &lt;tag&gt; &amp; more\n")
+   + length(join('', 1 .. 50000)), 'large code block');
+
+done_testing();
@@ -0,0 +1,54 @@
+#!/usr/bin/env perl
+
+# Test streaming output to filehandles and callbacks
+
+use strict;
+use blib;
+use Test::More;
+use Text::MultiMarkdown::XS qw(markdown markdown_to);
+
+my $text = "# Title\n\nSome *text* and a [link](http://example.com/).\n";
+
+my @chunks;
+ok(markdown_to($text, sub { push @chunks, $_[0] }), 'callback returns true');
+is(join('', @chunks), markdown($text), 'callback receives the output');
+
+my $output = '';
+open(my $fh, '>', \$output) or die;
+markdown_to($text, $fh, { smart => 0 });
+close($fh);
+is($output, markdown($text, { smart => 0 }), 'filehandle receives the output');
+
+# big enough to be written in several pieces
+my $big = join("\n\n", map { "Paragraph $_ with *emphasis* & <html>." } 1 .. 20000);
+@chunks = ();
+markdown_to($big, sub { push @chunks, $_[0] });
+ok(@chunks > 1, 'large output comes in pieces');
+ok(!(grep { length > 128 * 1024 } @chunks), 'pieces are bounded');
+is(join('', @chunks), markdown($big), 'pieces join up to the whole output');
+
+my $mmd = Text::MultiMarkdown::XS->new(smart => 0);
+@chunks = ();
+$mmd->markdown_to('"q"', sub { push @chunks, $_[0], $mmd->markdown('*inner*') });
+is_deeply(\@chunks, [ "<p>&quot;q&quot;</p>", "<p><em>inner</em></p>" ], 'object used inside its own callback');
+is($mmd->markdown('"q"'), '<p>&quot;q&quot;</p>', 'object still usable');
+
+my $utf8 = "caf\x{e9} \x{263a}";
+@chunks = ();
+markdown_to($utf8, sub { push @chunks, $_[0] });
+is($chunks[0], markdown($utf8), 'character strings stay characters');
+
+# LaTeX is written a byte at a time, so pieces can end inside a character
+my $wide = join("\n\n", map { "Caf\x{e9} $_ \x{263a} na\x{ef}ve." } 1 .. 20000);
+@chunks = ();
+markdown_to($wide, sub { push @chunks, $_[0] }, { output => 'latex' });
+ok(@chunks > 1, 'large LaTeX output comes in pieces');
+ok(!(grep { !utf8::is_utf8($_) || !utf8::valid($_) } @chunks), 'each piece is whole characters');
+is(join('', @chunks), markdown($wide, { output => 'latex' }), 'LaTeX pieces join up to the whole output');
+
+eval { markdown_to($text, sub { die "stop\n" }) };
+is($@, "stop\n", 'exception from the callback is passed on');
+is(markdown($text), "<h1 id=\"title\">Title</h1>\n\n<p>Some <em>text</em> and a <a href=\"http://example.com/\">link</a>.</p>",
+   'conversion works after an exception');
+
+done_testing();
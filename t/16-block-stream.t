@@ -0,0 +1,75 @@
+#!/usr/bin/env perl
+
+# Test converting a block at a time (the streaming option of markdown_to)
+
+use strict;
+use blib;
+use Test::More;
+use Text::MultiMarkdown::XS qw(markdown markdown_to);
+
+sub streamed {
+    my ($text, $options) = @_;
+    my $output = '';
+    markdown_to($text, sub { $output .= $_[0] }, { %{ $options || {} }, streaming => 1 });
+    return $output;
+}
+
+my $refs = <<'EOT';
+Title:  Forward references
+Author: A. N. Other
+
+# Introduction
+
+A [link][later], a [reference] link, a note[^n] and a [glossary][?g] entry,
+with a link to [the section](#section) and to [Section].
+
+[reference]: http://example.com/ref "Ref"
+
+## Section
+
+| a | b |
+|---|---|
+| 1 | 2 |
+[Table]
+
+See [Table] and [Introduction].
+
+[later]: http://example.com/later
+[^n]: The note, defined after its use.
+
+    code
+
+> quoted [later]
+EOT
+
+for my $output (qw(html latex memoir beamer odf opml)) {
+    is(streamed($refs, { output => $output }), markdown($refs, { output => $output }),
+       "forward references, $output");
+}
+is(streamed($refs, { complete => 1 }), markdown($refs, { complete => 1 }), 'complete document');
+is(streamed("latexmode: beamer\n\n$refs", { output => 'latex' }),
+   markdown("latexmode: beamer\n\n$refs", { output => 'latex' }), 'latex mode from metadata');
+
+my $first = "[a]: http://example.com/a\n\n[a] and [b]\n\n[b]: http://example.com/b\n[a]: http://example.com/other\n";
+is(streamed($first), markdown($first), 'definitions first and repeated');
+
+is(streamed(''), markdown(''), 'empty document');
+is(streamed("\n\n\n"), markdown("\n\n\n"), 'blank document');
+
+# line endings and tabs are normalized a piece at a time
+my $big = "\x{feff}" . join("\r\n\r\n", map { "Item\t$_ with [ref] and\ttabs\r\n* a\r\n* b" } 1 .. 5000)
+    . "\r\n\r\n[ref]: http://example.com/\r\n";
+my @chunks;
+markdown_to($big, sub { push @chunks, $_[0] }, { streaming => 1 });
+ok(@chunks > 1, 'large output comes in pieces');
+is(join('', @chunks), markdown($big), 'large document with CRLF and tabs');
+
+my $mmd = Text::MultiMarkdown::XS->new(streaming => 1, smart => 0);
+my $output = '';
+$mmd->markdown_to($refs, sub { $output .= $_[0] });
+is($output, markdown($refs, { smart => 0 }), 'object option');
+$output = '';
+$mmd->markdown_to('"q"', sub { $output .= $_[0] . $mmd->markdown('*inner*') });
+is($output, "<p>&quot;q&quot;</p><p><em>inner</em></p>", 'object used inside its own callback');
+
+done_testing();
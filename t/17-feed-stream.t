@@ -0,0 +1,97 @@
+#!/usr/bin/env perl
+
+# Test feeding a document a piece at a time (markdown_stream)
+
+use strict;
+use blib;
+use Test::More;
+use Text::MultiMarkdown::XS qw(markdown markdown_stream);
+
+# feed the text in pieces of the given sizes, repeated until it is used up
+sub fed {
+    my ($text, $options, @sizes) = @_;
+    my $output = '';
+    my $stream = markdown_stream(sub { $output .= $_[0] }, $options);
+    my $at = 0;
+    @sizes = (length $text) unless @sizes;
+    for (my $i = 0; $at < length $text; $i++) {
+        my $size = $sizes[$i % @sizes];
+        $stream->feed(substr($text, $at, $size));
+        $at += $size;
+    }
+    $stream->finish;
+    return $output;
+}
+
+my $refs = <<'EOT';
+Title:  Forward references
+Author: A. N. Other
+
+# Introduction
+
+A [link][later], a [reference] link, a note[^n] and a [glossary][?g] entry,
+with a link to [the section](#section) and to [Section].
+
+[reference]: http://example.com/ref "Ref"
+
+## Section
+
+| a | b |
+|---|---|
+| 1 | 2 |
+[Table]
+
+See [Table] and [Introduction].
+
+[later]: http://example.com/later
+[^n]: The note, defined after its use.
+[?g]: The glossary entry.
+
+    code
+
+> quoted [later]
+EOT
+
+for my $output (qw(html latex memoir beamer odf opml)) {
+    is(fed($refs, { output => $output }, 1, 7, 64), markdown($refs, { output => $output }),
+       "forward references, $output");
+}
+is(fed($refs, { complete => 1 }, 3), markdown($refs, { complete => 1 }), 'complete document');
+is(fed("latexmode: beamer\n\n$refs", { output => 'latex' }, 5),
+   markdown("latexmode: beamer\n\n$refs", { output => 'latex' }), 'latex mode from metadata');
+is(fed($refs, { linear_inlines => 1 }, 2), markdown($refs, { linear_inlines => 1 }), 'linear inlines');
+
+is(fed(''), markdown(''), 'empty document');
+is(fed("\n\n\n", {}, 1), markdown("\n\n\n"), 'blank document');
+
+# a \r\n, a tab or a byte order mark split between pieces
+my $crlf = "\xEF\xBB\xBFTitle: x\r\n\r\nItem\t1\r\n\r\n* a\r\n*\tb\r\n";
+is(fed($crlf, {}, 1), markdown($crlf), 'line endings and tabs split between pieces');
+
+# output comes as soon as a block is known to be complete
+my @seen;
+my $stream = markdown_stream(sub { push @seen, $_[0] });
+$stream->feed("First paragraph.\n\nSecond ");
+is(join('', @seen), "<p>First paragraph.</p>", 'finished block is written');
+$stream->feed("paragraph with a [link].\n\nThird.\n\n");
+is(join('', @seen), "<p>First paragraph.</p>", 'unresolved reference holds the output back');
+$stream->feed("[link]: http://example.com/\n\nFourth.");
+like(join('', @seen), qr{<a href="http://example.com/">link</a>.*Third}s, 'definition releases it');
+$stream->finish;
+is(join('', @seen), markdown("First paragraph.\n\nSecond paragraph with a [link].\n\nThird.\n\n"
+                             . "[link]: http://example.com/\n\nFourth."), 'whole output');
+eval { $stream->feed('more') };
+like($@, qr/finished/, 'no feeding after finish');
+
+# characters in, characters out
+my $chars = "\x{263a} *smile*\n\n\x{e9}t\x{e9}\n";
+is(fed($chars, {}, 1), markdown($chars), 'character strings');
+
+my $out = '';
+my $mmd = Text::MultiMarkdown::XS->new(smart => 0);
+$stream = $mmd->markdown_stream(sub { $out .= $_[0] });
+$stream->feed('"q"');
+$stream->finish;
+is($out, markdown('"q"', { smart => 0 }), 'object options');
+
+done_testing();
@@ -0,0 +1,73 @@
+#!/usr/bin/env perl
+
+# Test the cache of converted documents
+
+use strict;
+use blib;
+use Test::More;
+use Text::MultiMarkdown::XS qw(markdown markdown_inline markdown_many cache_size cache_stats cache_flush);
+
+my $text = "# Title\n\nSome *text* with a [link](http://example.com/) and <me\@example.com>.\n";
+
+my $plain  = markdown($text);
+my $latex  = markdown($text, { output => 'latex' });
+my $masked = markdown($text, { obfuscate => 1 });
+
+is(cache_size(), 0, 'off to begin with');
+is(cache_stats()->{hits} + cache_stats()->{misses}, 0, 'not used while off');
+
+is(cache_size(1 << 20), 1 << 20, 'size set');
+is(markdown($text), $plain, 'first conversion');
+is(markdown($text), $plain, 'second conversion');
+my $stats = cache_stats();
+is($stats->{hits}, 1, 'second conversion is a hit');
+is($stats->{misses}, 1, 'first conversion is a miss');
+is($stats->{entries}, 1, 'one document held');
+ok($stats->{bytes} > length $plain, 'bytes include the output');
+
+# the options are part of the key
+is(markdown($text, { output => 'latex' }), $latex, 'other format');
+is(markdown_inline('*text*'), "<em>text</em>", 'inline');
+is(markdown('*text*'), "<p><em>text</em></p>", 'the same text as a document');
+is(cache_stats()->{entries}, 4, 'each kept separately');
+
+# masked addresses are the same every time
+is(markdown($text, { obfuscate => 1 }), $masked, 'masked addresses are repeatable');
+is(markdown($text, { obfuscate => 1 }), $masked, 'and come from the cache');
+
+# characters in, characters out
+my $chars = "\x{263a} *smile*\n";
+is(markdown($chars), markdown($chars), 'character strings');
+ok(utf8::is_utf8(markdown($chars)), 'cached output keeps the UTF-8 flag');
+
+# objects and markdown_many share it
+my $mmd = Text::MultiMarkdown::XS->new(output => 'latex');
+my $hits = cache_stats()->{hits};
+is($mmd->markdown($text), $latex, 'object');
+is(cache_stats()->{hits}, $hits + 1, 'object conversion is a hit');
+is_deeply(markdown_many([ ($text) x 8 ], { threads => 4 }), [ ($plain) x 8 ], 'many threads');
+
+cache_flush();
+is(cache_stats()->{entries}, 0, 'flush empties it');
+is(cache_stats()->{bytes}, 0, 'and frees it');
+is(cache_size(), 1 << 20, 'but keeps its size');
+
+# the least recently used documents make way for new ones
+cache_size(16 * 1024);
+markdown("Document $_\n\n" . ('word ' x 40) . "\n") for 1 .. 200;
+$stats = cache_stats();
+ok($stats->{bytes} <= 16 * 1024, 'stays within its size');
+ok($stats->{evictions} > 0, 'older documents are dropped');
+my $misses = $stats->{misses};
+markdown("Document 200\n\n" . ('word ' x 40) . "\n");
+is(cache_stats()->{misses}, $misses, 'the most recent document is still there');
+
+is(cache_size(0), 0, 'turned off');
+is(cache_stats()->{entries}, 0, 'and emptied');
+markdown($text);
+is(cache_stats()->{misses}, $misses, 'not used once off');
+
+eval { cache_size(-1) };
+like($@, qr/invalid cache size/, 'bad size');
+
+done_testing();
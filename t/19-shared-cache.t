@@ -0,0 +1,85 @@
+#!/usr/bin/env perl
+
+# Test the cache kept in a file shared between processes
+
+use strict;
+use blib;
+use Test::More;
+use File::Temp qw(tempdir);
+use Text::MultiMarkdown::XS qw(markdown markdown_many cache_file cache_stats cache_flush);
+
+my $dir  = tempdir(CLEANUP => 1);
+my $file = "$dir/mmd.cache";
+my $text = "# Title\n\nSome *text* with a [link](http://example.com/).\n";
+my $html = markdown($text);
+
+is(cache_file(), undef, 'no file to begin with');
+is(cache_file($file, 1 << 20), $file, 'file made');
+is(cache_file(), $file, 'and in use');
+ok(-s $file == 1 << 20, 'of the size asked for');
+
+is(markdown($text), $html, 'first conversion');
+is(markdown($text), $html, 'second conversion');
+my $stats = cache_stats();
+is($stats->{hits}, 1, 'second conversion is a hit');
+is($stats->{entries}, 1, 'one document held');
+ok($stats->{limit} > 0 && $stats->{limit} < 1 << 20, 'limit is the room for outputs');
+
+# another process sees what this one stored, and this one what it stores
+my $pid = fork();
+die "fork: $!" unless defined $pid;
+if ($pid == 0) {
+    my $hits = cache_stats()->{hits};
+    my $ok = (markdown($text) eq $html) && (cache_stats()->{hits} == $hits + 1);
+    markdown("From the child\n");
+    exit($ok ? 0 : 1);
+}
+waitpid($pid, 0);
+is($?, 0, 'a child process gets a hit');
+is(cache_stats()->{entries}, 2, 'and its document is held');
+my $hits = cache_stats()->{hits};
+markdown("From the child\n");
+is(cache_stats()->{hits}, $hits + 1, 'which is a hit here');
+
+# threads share it too
+is_deeply(markdown_many([ ($text) x 8 ], { threads => 4 }), [ ($html) x 8 ], 'many threads');
+
+# a process that attaches later finds what is there, whatever size it asks for
+cache_file(undef);
+is(cache_file(), undef, 'detached');
+cache_file($file, 1 << 24);
+ok(-s $file == 1 << 20, 'an existing file keeps its size');
+$hits = cache_stats()->{hits};
+is(markdown($text), $html, 'conversion after attaching again');
+is(cache_stats()->{hits}, $hits + 1, 'is a hit');
+
+# the log wraps around, and what comes out of it is always right
+cache_flush();
+is(cache_stats()->{entries}, 0, 'flush empties it');
+my $small = "$dir/small.cache";
+cache_file($small, 64 * 1024);
+my @docs = map { "Document $_\n\n" . ('word ' x 40) . "\n" } 1 .. 300;
+my @html = map { markdown($_) } @docs;
+is_deeply([ map { markdown($_) } @docs ], \@html, 'outputs right while the file wraps');
+ok(cache_stats()->{evictions} > 0, 'older documents are dropped');
+my $misses = cache_stats()->{misses};
+markdown($docs[-1]);
+is(cache_stats()->{misses}, $misses, 'the most recent document is still there');
+
+# only empty files and cache files are used
+my $other = "$dir/other";
+open(my $fh, '>', $other) or die "$other: $!";
+print $fh "not a cache\n" x 1000;
+close($fh);
+eval { cache_file($other) };
+like($@, qr/cannot use '\Q$other\E' as a cache file/, 'other file refused');
+is(-s $other, length("not a cache\n") * 1000, 'and left alone');
+eval { cache_file("$dir/small2.cache", 1024) };
+like($@, qr/cannot use/, 'too small a size');
+eval { cache_file($file, 'big') };
+like($@, qr/invalid cache size/, 'bad size');
+
+cache_file(undef);
+is(markdown($text), $html, 'without the file');
+
+done_testing();
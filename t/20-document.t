@@ -0,0 +1,86 @@
+#!/usr/bin/env perl
+
+# Test documents rendered again as they are edited
+
+use strict;
+use blib;
+use Test::More;
+use Text::MultiMarkdown::XS qw(markdown markdown_document);
+
+my @blocks = (
+    "# Title\n",
+    "A paragraph with a note[^one] and a [link].\n",
+    "* a list\n* of items\n",
+    "Another paragraph with a note[^two].\n",
+    "> A quote with a [link] of its own.\n",
+    "[link]: http://example.com/ \"Example\"\n",
+    "[^one]: The first note.\n",
+    "[^two]: The second note.\n",
+);
+my $text = join("\n", @blocks);
+
+for my $options ({}, { output => 'latex' }, { output => 'odf' }, { complete => 1 }) {
+    my $name = join(',', %$options) || 'html';
+    $options = { %$options, notes => 1 };
+    my $doc = markdown_document($options);
+
+    is($doc->render($text), markdown($text, $options), "$name: first render");
+    is_deeply([ $doc->changed ], [ 0 .. $#blocks ], "$name: every block is new");
+    is($doc->render($text), markdown($text, $options), "$name: render again");
+    is_deeply([ $doc->changed ], [], "$name: no block changed");
+
+    # an edit to one block
+    my @edited = @blocks;
+    $edited[2] = "* a list\n* of *more* items\n";
+    my $edited = join("\n", @edited);
+    is($doc->render($edited), markdown($edited, $options), "$name: edited list");
+    is_deeply([ $doc->changed ], [ 2 ], "$name: only the list changed");
+
+    # a definition changes what refers to it
+    $doc->render($text);
+    @edited = @blocks;
+    $edited[5] = "[link]: http://example.org/\n";
+    $edited = join("\n", @edited);
+    is($doc->render($edited), markdown($edited, $options), "$name: changed link");
+    is_deeply([ $doc->changed ], [ 1, 4 ], "$name: the blocks using the link changed");
+
+    # a note referred to earlier renumbers the notes after it
+    $doc->render($text);
+    @edited = @blocks;
+    $edited[0] = "# Title[^two]\n";
+    $edited = join("\n", @edited);
+    is($doc->render($edited), markdown($edited, $options), "$name: notes renumbered");
+    ok(scalar(grep { $_ == 0 } $doc->changed), "$name: the title changed");
+    ok(scalar(grep { $_ == 3 } $doc->changed), "$name: and the paragraph whose note moved");
+    ok(!grep({ $_ == 2 } $doc->changed), "$name: but not the list");
+
+    # blocks taken away and put back
+    @edited = @blocks[0, 1, 5 .. 7];
+    $edited = join("\n", @edited);
+    is($doc->render($edited), markdown($edited, $options), "$name: blocks removed");
+    is($doc->render($text), markdown($text, $options), "$name: and put back");
+}
+
+# the blocks make up the output
+my $doc = markdown_document({ notes => 1 });
+my $html = $doc->render($text);
+my @out = $doc->blocks;
+is(scalar(@out), scalar(@blocks), 'a block for each block');
+like($out[0], qr{<h1 id="title">Title</h1>}, 'the heading');
+like($out[2], qr{<li>of items</li>}, 'the list');
+is($out[5], '', 'a definition has no output');
+is(index($html, join('', @out)), 0, 'the blocks, then the footnotes');
+
+# characters in, characters out
+my $chars = "\x{263a} *smile*\n";
+is($doc->render($chars), markdown($chars), 'character strings');
+ok(utf8::is_utf8(($doc->blocks)[0]), 'blocks keep the UTF-8 flag');
+
+# formats that need the whole document
+my $opml = markdown_document({ output => 'opml' });
+is($opml->render($text), markdown($text, { output => 'opml' }), 'OPML');
+is_deeply([ $opml->changed ], [ 0 ], 'rendered as one block');
+$opml->render($text);
+is_deeply([ $opml->changed ], [], 'which is kept');
+
+done_testing();
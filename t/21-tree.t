@@ -0,0 +1,181 @@
+#!/usr/bin/env perl
+
+# Test parse trees saved as images and converted later
+
+use strict;
+use blib;
+use Test::More;
+use File::Temp qw(tempdir);
+use Text::MultiMarkdown::XS qw(markdown serialize_tree deserialize_tree map_tree);
+
+my $text = <<'EOT';
+Title:  A Document
+Author: Someone
+
+# A Heading #
+
+A paragraph with *emphasis*, **strong** text, `code`, "quotes" and a note[^one].
+A [link] and an ![image][picture] with attributes.
+
+* a list
+* of [items][link]
+
+| Left | Right |
+|:-----|------:|
+| a    |     1 |
+| b    |     2 |
+[A table]
+
+> A quote, with a citation[#cite].
+
+    indented code
+
+<div>Some HTML</div>
+
+[link]: http://example.com/ "Example"
+[picture]: http://example.com/picture.png width=40px height=30px
+[^one]: The note.
+[#cite]: A citation.
+EOT
+
+# (the text writer doesn't handle blocks yet, and RTF isn't written)
+my @formats = qw(html latex memoir beamer man odf opml);
+
+# every format, each from a tree parsed for it
+for my $format (@formats) {
+    my $options = { output => $format, notes => 1 };
+    my $tree = deserialize_tree(serialize_tree($text, $options));
+    is($tree->markdown($options), markdown($text, $options), "$format: same as a fresh parse");
+    is($tree->markdown($options), markdown($text, $options), "$format: and again");
+}
+
+# one tree, many formats and options
+my $tree = deserialize_tree(serialize_tree($text, { notes => 1 }));
+for my $format (grep { $_ ne 'opml' } @formats) {
+    for my $extra ({}, { complete => 1 }, { obfuscate => 1 }) {
+        my $options = { output => $format, notes => 1, %$extra };
+        my $name = join(',', %$options);
+        is($tree->markdown($options), markdown($text, $options), "one tree: $name");
+    }
+}
+eval { $tree->markdown({ output => 'opml' }) };
+like($@, qr/parsed for OPML/, 'not OPML from a tree parsed for HTML');
+
+# parse options are those the tree was made with
+my $plain = deserialize_tree(serialize_tree($text, { smart => 0 }));
+is($plain->markdown, markdown($text, { smart => 0 }), 'parsed without smart quotes');
+is(deserialize_tree(serialize_tree(''))->markdown, markdown(''), 'empty document');
+
+# a tree mapped from a file
+my $dir = tempdir(CLEANUP => 1);
+my $file = "$dir/doc.tree";
+open(my $fh, '>:raw', $file) or die "$file: $!";
+print $fh serialize_tree($text, { notes => 1 });
+close($fh);
+my $mapped = map_tree($file);
+is($mapped->markdown({ notes => 1, output => 'latex' }), markdown($text, { notes => 1, output => 'latex' }), 'mapped');
+undef $mapped;
+
+# an image the caller changes afterwards doesn't change the tree
+my $image = serialize_tree($text, { notes => 1 });
+$tree = deserialize_tree($image);
+substr($image, 100, 50) = 'x' x 50;
+is($tree->markdown({ notes => 1 }), markdown($text, { notes => 1 }), 'image copied');
+
+# anything else is refused
+my $good = serialize_tree($text);
+eval { deserialize_tree('not a tree') };
+like($@, qr/not a parse tree/, 'not an image');
+eval { deserialize_tree(substr($good, 0, -1)) };
+like($@, qr/not a parse tree/, 'cut short');
+my $other = $good;
+substr($other, 8, 1) = chr(ord(substr($other, 8, 1)) + 1);
+eval { deserialize_tree($other) };
+like($@, qr/not a parse tree/, 'another version');
+
+# the image's hash (MurmurHash3 x64 128, as in cache.c), which has no key
+sub mul  { use integer; $_[0] * $_[1] }
+sub add  { use integer; $_[0] + $_[1] }
+sub rotl { (($_[0] << $_[1]) | ($_[0] >> (64 - $_[1]))) & ~0 }
+
+sub fmix {
+    my ($k) = @_;
+    $k = mul($k ^ ($k >> 33), 0xff51afd7ed558ccd) & ~0;
+    $k = mul($k ^ ($k >> 33), 0xc4ceb9fe1a85ec53) & ~0;
+    return $k ^ ($k >> 33);
+}
+
+sub murmur3 {
+    my ($data, $seed) = @_;
+    my ($c1, $c2) = (0x87c37b91114253d5, 0x4cf5ad432745937f);
+    my ($h1, $h2) = ($seed, $seed);
+    my $len = length($data);
+    my $tail = substr($data, $len - ($len & 15)) . "\0" x 16;
+    my @blocks = unpack('(Q<)*', substr($data, 0, $len - ($len & 15)));
+    while (my ($k1, $k2) = splice(@blocks, 0, 2)) {
+        $h1 ^= mul(rotl(mul($k1, $c1) & ~0, 31), $c2) & ~0;
+        $h1 = add(mul(add(rotl($h1, 27), $h2), 5), 0x52dce729) & ~0;
+        $h2 ^= mul(rotl(mul($k2, $c2) & ~0, 33), $c1) & ~0;
+        $h2 = add(mul(add(rotl($h2, 31), $h1), 5), 0x38495ab5) & ~0;
+    }
+    my ($k1, $k2) = unpack('Q< Q<', $tail);
+    $h2 ^= mul(rotl(mul($k2, $c2) & ~0, 33), $c1) & ~0 if ($len & 15) > 8;
+    $h1 ^= mul(rotl(mul($k1, $c1) & ~0, 31), $c2) & ~0 if ($len & 15) > 0;
+    ($h1, $h2) = ($h1 ^ $len, $h2 ^ $len);
+    $h1 = add($h1, $h2) & ~0;
+    $h2 = add($h2, $h1) & ~0;
+    ($h1, $h2) = (fmix($h1), fmix($h2));
+    $h1 = add($h1, $h2) & ~0;
+    $h2 = add($h2, $h1) & ~0;
+    return ($h1, $h2);
+}
+
+# an image edited after it was written, with its hash made again
+my $header = 72;
+sub forge {
+    my ($image) = @_;
+    my ($nodes, $links) = unpack('x32 L L', $image);
+    my ($h1, $h2) = (0, 0);
+    my $at = $header;
+    for my $size (20 * $nodes, 16 * $links, length($image) - $at - 20 * $nodes - 16 * $links) {
+        my ($m1, $m2) = murmur3(substr($image, $at, $size), $h1 ^ rotl($h2, 17));
+        $h1 = fmix($h1 ^ $m1);
+        $h2 = fmix(add(add($h2, $m2), $h1) & ~0);
+        $at += $size;
+    }
+    substr($image, 56, 16) = pack('Q< Q<', $h1, $h2);
+    return $image;
+}
+
+SKIP: {
+    skip('64 bit integers needed to make the hash', 5) unless length(pack('j', 0)) == 8;
+
+    is(forge($good), $good, 'the hash made again');
+
+    # the hash turns away damage, not a forgery
+    my $damaged = $good;
+    $damaged =~ s/Heading/Hexding/ or die 'no heading';
+    eval { deserialize_tree($damaged) };
+    like($@, qr/not a parse tree/, 'damaged');
+    like(deserialize_tree(forge($damaged))->markdown, qr/Hexding/, 'forged');
+
+    # but a forged image still has to hold a tree the writers can take
+    my ($nodes) = unpack('x32 L', $good);
+    my $edited = $good;
+    my $found;
+    for my $i (0 .. $nodes - 1) {
+        my ($key, $str, $link) = unpack("x@{[$header + 20 * $i]} l L L", $edited);
+        next unless $key == 23 && $link;
+        substr($edited, $header + 20 * $i + 8, 4) = pack('L', 0);
+        $found = 1;
+        last;
+    }
+    ok($found, 'the image has a link');
+    eval { deserialize_tree(forge($edited)) };
+    like($@, qr/not a parse tree/, 'a link without link data');
+}
+
+eval { map_tree("$dir/missing") };
+like($@, qr/cannot map '\Q$dir\E\/missing'/, 'missing file');
+
+done_testing();
@@ -0,0 +1,64 @@
+#!/usr/bin/env perl
+
+# Test the request protocol of multimarkdown --serve, with the command line
+# tool built from the sources here
+
+use strict;
+use blib;
+use Test::More;
+use Config;
+use File::Temp qw(tempdir);
+use Text::MultiMarkdown::XS qw(markdown);
+
+my $dir = tempdir(CLEANUP => 1);
+my $mmd = "$dir/multimarkdown";
+my @sources = grep { $_ ne 'XS.c' } glob('*.c');
+system("$Config{cc} -w -I. -o $mmd @sources -lpthread >/dev/null 2>&1") == 0
+    or plan(skip_all => 'cannot build the command line tool');
+
+# serve -- what the server replies to the bytes of requests, and how it ended
+sub serve {
+    my ($requests) = @_;
+    open(my $fh, '>:raw', "$dir/in") or die "$dir/in: $!";
+    print $fh $requests;
+    close($fh);
+    system("$mmd --serve < $dir/in > $dir/out");
+    my $status = $?;
+    open($fh, '<:raw', "$dir/out") or die "$dir/out: $!";
+    local $/;
+    my $replies = <$fh>;
+    close($fh);
+    return ($replies, $status);
+}
+
+sub request { "0 0 " . length($_[0]) . "\n$_[0]" }
+sub reply   { my $out = markdown($_[0], { smart => 0 }); length($out) . "\n$out" }
+
+my @texts = ("# Title\n\nSome *text*.\n", "Another [link](http://example.com/).\n");
+
+my ($replies, $status) = serve(join('', map { request($_) } @texts));
+is($replies, join('', map { reply($_) } @texts), 'requests answered in turn');
+is($status, 0, 'and the server stops at the end of the input');
+
+# a malformed request ends the connection, after what came before it
+my $first = request($texts[0]);
+my %malformed = (
+    'negative length'     => "0 0 -1\n" . ('A' x 5000),
+    'length with a sign'  => "0 0 +5\nhello",
+    'length too big'      => "0 0 18446744073709551616\nhello",
+    'length of SIZE_MAX'  => "0 0 18446744073709551615\nhello",
+    'oversized request'   => "0 0 " . ((1 << 30) + 1) . "\nhello",
+    'no length'           => "0 0\nhello",
+    'trailing text'       => "0 0 5 x\nhello",
+    'unknown format'      => "0 99 5\nhello",
+    'negative format'     => "0 -1 5\nhello",
+    'no end of line'      => "0 0 " . ('1' x 100),
+    'cut short'           => "0 0 50\nhello",
+);
+for my $name (sort keys %malformed) {
+    ($replies, $status) = serve($first . $malformed{$name} . request($texts[1]));
+    is($replies, reply($texts[0]), "$name: refused");
+    is($status, 0, "$name: without a crash");
+}
+
+done_testing();
@@ -0,0 +1,67 @@
+#!/usr/bin/env perl
+
+# Test CriticMarkup accepted, rejected or highlighted before the parse
+
+use strict;
+use blib;
+use Test::More;
+use Text::MultiMarkdown::XS;
+
+# the options aren't offered by markdown(), so the flags are given directly
+my $accept    = Text::MultiMarkdown::XS::EXT_CRITIC_ACCEPT();
+my $reject    = Text::MultiMarkdown::XS::EXT_CRITIC_REJECT();
+my $highlight = $accept | $reject;
+
+sub critic {
+    my ($text, $extensions, $format) = @_;
+    return Text::MultiMarkdown::XS::_markdown($text, $extensions,
+                                              $format || Text::MultiMarkdown::XS::HTML_FORMAT());
+}
+
+my @markup = (
+    # text                  accepted         rejected         highlighted
+    [ 'a {++b++} c',        'a b c',         'a c',           'a <ins>b</ins> c' ],
+    [ 'a {--b--} c',        'a c',           'a b c',         'a <del>b</del> c' ],
+    [ 'a {~~a~>b~~} c',     'a b c',         'a a c',         'a <del>a</del><ins>b</ins> c' ],
+    [ 'a {==b==} c',        'a b c',         'a b c',         'a <mark>b</mark> c' ],
+    [ 'a {>>c<<} d',        'a d',           'a d',           'a d' ],
+);
+
+for my $case (@markup) {
+    my ($text, @want) = @$case;
+    for my $i (0 .. 2) {
+        my $flags = ($accept, $reject, $highlight)[$i];
+        my $name  = (qw(accepted rejected highlighted))[$i];
+        is(critic($text, $flags), "<p>$want[$i]</p>", "$name: $text");
+    }
+}
+
+# the changes are made before the text is parsed as Markdown
+is(critic("{++# A heading++}\n\ntext", $accept), "<h1 id=\"aheading\">A heading</h1>\n\n<p>text</p>",
+   'accepted markup is parsed');
+is(critic("a {~~*b*~>**c**~~}", $reject), '<p>a <em>b</em></p>', 'rejected markup is parsed');
+is(critic("{++a\n\nb++}", $highlight), "<p><ins>a</p>\n\n<p>b</ins></p>", 'highlight across paragraphs');
+
+# without HTML output, both flags reject
+is(critic('a {++b++}{--c--}', $highlight, Text::MultiMarkdown::XS::LATEX_FORMAT()),
+   critic('a {++b++}{--c--}', $reject, Text::MultiMarkdown::XS::LATEX_FORMAT()), 'highlight is HTML only');
+
+# markup that is never closed stays as it was written, and so does the rest
+for my $text ('a {++b', 'a {--b', 'a {~~b~>c', 'a {~~b~~}', 'a {==b', 'a {>>b') {
+    for my $flags ($accept, $reject, $highlight) {
+        (my $html = $text) =~ s/>/&gt;/g;
+        is(critic("$text\n\nmore *text*", $flags), "<p>$html</p>\n\n<p>more <em>text</em></p>",
+           "unclosed: $text ($flags)");
+    }
+}
+is(critic('{++a++} {++b', $accept), '<p>a {++b</p>', 'closed before unclosed');
+is(critic('{++b {++a++}', $accept), '<p>b {++a</p>', 'an opener inside the markup is text');
+
+# tabs are expanded on the resolved text, counting columns across the pieces
+is(critic("\ta{++bc++}\td", $accept), "<pre><code>abc d\n</code></pre>", 'tab after an addition');
+is(critic("\ta{++bc++}\td", $reject), "<pre><code>a   d\n</code></pre>", 'tab after a rejected addition');
+is(critic("\ta{--bc--}\td", $reject), "<pre><code>abc d\n</code></pre>", 'tab after a deletion');
+is(critic("\t{~~ab~>abcdef~~}\tx", $accept), "<pre><code>abcdef  x\n</code></pre>", 'tab after a substitution');
+is(critic("\t{++a\tb++}", $accept), "<pre><code>a   b\n</code></pre>", 'tab inside an addition');
+
+done_testing();
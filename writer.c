@@ -20,14 +20,35 @@
 
 */
 
+#include <errno.h>
 #include "writer.h"
 
 /* export_node_tree -- given a tree, export as specified format */
 char * export_node_tree(node *list, int format, int extensions) {
+	return export_node_tree_len(list, format, extensions, NULL);
+}
+
+/* export_node_tree_len -- as export_node_tree, also storing the length of
+	the output in out_len (if not NULL) */
+char * export_node_tree_len(node *list, int format, int extensions, size_t *out_len) {
 	char *output;
 	GString *out = g_string_new("");
 	scratch_pad *scratch = mk_scratch_pad(extensions);
 
+	export_node_tree_into(out, list, format, scratch);
+
+	output = out->str;
+	if (out_len != NULL)
+		*out_len = out->currentStringLength;
+	g_string_free(out, false);
+	free_scratch_pad(scratch);
+
+	return output;
+}
+
+/* export_node_tree_into -- export tree as specified format, appending to out
+	and using the supplied (fresh or reset) scratch pad */
+void export_node_tree_into(GString *out, node *list, int format, scratch_pad *scratch) {
 #ifdef DEBUG_ON
 	fprintf(stderr, "export_node_tree\n");
 #endif
@@ -36,43 +57,73 @@ char * export_node_tree(node *list, int format, int extensions) {
 	fprintf(stderr, "extract_references\n");
 #endif
 	/* Parse for link, images, etc reference definitions */
-	if ((format != OPML_FORMAT) &&
-		(format != CRITIC_ACCEPT_FORMAT) &&
-		(format != CRITIC_REJECT_FORMAT) &&
-		(format != CRITIC_HTML_HIGHLIGHT_FORMAT))
+	if (format_uses_references(format))
 			extract_references(list, scratch);
 	
+	format = export_begin(out, list, format, scratch);
+	export_blocks(out, list, format, scratch);
+	export_end(out, list, format, scratch);
+	
+#ifdef DEBUG_ON
+	fprintf(stderr, "finish export_node_tree\n");
+#endif
+}
+
+/* format_uses_references -- are reference definitions extracted from the
+	tree before it is written in this format? */
+bool format_uses_references(int format) {
+	return ((format != OPML_FORMAT) &&
+		(format != CRITIC_ACCEPT_FORMAT) &&
+		(format != CRITIC_REJECT_FORMAT) &&
+		(format != CRITIC_HTML_HIGHLIGHT_FORMAT));
+}
+
+/* export_begin -- write whatever comes before the first block; list need
+	only hold the document's first block (its metadata, if any) unless the
+	format is OPML.  Returns the format to write the rest in, as metadata
+	can turn LaTeX into beamer or memoir. */
+int export_begin(GString *out, node *list, int format, scratch_pad *scratch) {
 	/* Change our desired format based on metadata */
 	if (format == LATEX_FORMAT)
 		format = find_latex_mode(format, list);
 	
 	switch (format) {
-		case TEXT_FORMAT:
-			print_text_node_tree(out, list, scratch);
-			break;
 		case HTML_FORMAT:
 			if (scratch->extensions & EXT_COMPLETE) {
 			    g_string_append_printf(out,
 				"<!DOCTYPE html>\n<html>\n<head>\n\t<meta charset=\"utf-8\"/>\n");
 			}
+			break;
+		case OPML_FORMAT:
 #ifdef DEBUG_ON
-	fprintf(stderr, "print_html output\n");
-#endif
-			print_html_node_tree(out, list, scratch);
-#ifdef DEBUG_ON
-	fprintf(stderr, "print html endnotes\n");
+	fprintf(stderr, "export OPML\n");
 #endif
-			print_html_endnotes(out, scratch);
+			begin_opml_output(out, list, scratch);
+			break;
+		case ODF_FORMAT:
 #ifdef DEBUG_ON
-	fprintf(stderr, "finished printing html endnotes\n");
+	fprintf(stderr, "export ODF\n");
 #endif
-			if (scratch->extensions & EXT_COMPLETE) {
-				pad(out,2, scratch);
-				g_string_append_printf(out, "</body>\n</html>");
-			}
+			begin_odf_output(out, list, scratch);
+			break;
+		default:
+			break;
+	}
+	return format;
+}
+
+/* export_blocks -- write a run of top-level nodes; a document can be
+	written all at once or a block at a time */
+void export_blocks(GString *out, node *list, int format, scratch_pad *scratch) {
+	switch (format) {
+		case TEXT_FORMAT:
+			print_text_node_tree(out, list, scratch);
+			break;
+		case HTML_FORMAT:
 #ifdef DEBUG_ON
-	fprintf(stderr, "closed HTML document\n");
+	fprintf(stderr, "print_html output\n");
 #endif
+			print_html_node_tree(out, list, scratch);
 			break;
 		case LATEX_FORMAT:
 			print_latex_node_tree(out, list, scratch);
@@ -87,20 +138,10 @@ char * export_node_tree(node *list, int format, int extensions) {
 			print_man_node_tree(out, list, scratch);
 			break;
 		case OPML_FORMAT:
-#ifdef DEBUG_ON
-	fprintf(stderr, "export OPML\n");
-#endif
-			begin_opml_output(out, list, scratch);
 			print_opml_node_tree(out, list, scratch);
-			end_opml_output(out, list, scratch);
 			break;
 		case ODF_FORMAT:
-#ifdef DEBUG_ON
-	fprintf(stderr, "export ODF\n");
-#endif
-			begin_odf_output(out, list, scratch);
 			print_odf_node_tree(out, list, scratch);
-			end_odf_output(out, list, scratch);
 			break;
 		case CRITIC_ACCEPT_FORMAT:
 			print_critic_accept_node_tree(out, list, scratch);
@@ -115,15 +156,69 @@ char * export_node_tree(node *list, int format, int extensions) {
 			fprintf(stderr, "Unknown export format = %d\n",format);
 			exit(EXIT_FAILURE);
 	}
-	
-	output = out->str;
-	g_string_free(out, false);
-	free_scratch_pad(scratch);
+}
 
+/* export_end -- write whatever comes after the last block (list is only
+	needed for OPML) */
+void export_end(GString *out, node *list, int format, scratch_pad *scratch) {
+	switch (format) {
+		case HTML_FORMAT:
 #ifdef DEBUG_ON
-	fprintf(stderr, "finish export_node_tree\n");
+	fprintf(stderr, "print html endnotes\n");
 #endif
-	return output;
+			print_html_endnotes(out, scratch);
+#ifdef DEBUG_ON
+	fprintf(stderr, "finished printing html endnotes\n");
+#endif
+			if (scratch->extensions & EXT_COMPLETE) {
+				pad(out,2, scratch);
+				g_string_append_printf(out, "</body>\n</html>");
+			}
+#ifdef DEBUG_ON
+	fprintf(stderr, "closed HTML document\n");
+#endif
+			break;
+		case OPML_FORMAT:
+			end_opml_output(out, list, scratch);
+			break;
+		case ODF_FORMAT:
+			end_odf_output(out, list, scratch);
+			break;
+		default:
+			break;
+	}
+}
+
+/* Stock output sinks for mmd_converter_convert_to and markdown_to_sink */
+
+/* mmd_write_gstring -- append to the GString in context */
+bool mmd_write_gstring(void *context, const char *data, size_t len) {
+	g_string_append_len((GString *)context, data, len);
+	return true;
+}
+
+/* mmd_write_fd -- write to the file descriptor pointed to by context,
+	retrying short and interrupted writes */
+bool mmd_write_fd(void *context, const char *data, size_t len) {
+	int fd = *(int *)context;
+	ssize_t written;
+
+	while (len > 0) {
+		written = write(fd, data, len);
+		if (written < 0) {
+			if (errno == EINTR)
+				continue;
+			return false;
+		}
+		data += written;
+		len -= written;
+	}
+	return true;
+}
+
+/* mmd_write_file -- write to the stdio stream in context */
+bool mmd_write_file(void *context, const char *data, size_t len) {
+	return fwrite(data, 1, len, (FILE *)context) == len;
 }
 
 /* extract_references -- go through node tree and find elements we need to reference;
@@ -280,6 +375,118 @@ link_data * extract_link_data(char *label, scratch_pad *scratch) {
 	return NULL;
 }
 
+/* find_link -- the definition the link or image n is matched to, as the
+	writers work out its label, or NULL.  has_label is set to whether there
+	was a label to look up at all. */
+static link_data * find_link(node *n, scratch_pad *scratch, bool *has_label) {
+	GString *raw = NULL;
+	char *label;
+	link_data *d;
+
+	label = n->link_data->label;
+	if ((label == NULL) && (n->link_data->source == NULL)) {
+		/* a [foo][] style link */
+		raw = g_string_new("");
+		print_raw_node_tree(raw, n->children);
+		label = raw->str;
+	}
+	*has_label = (label != NULL) && (strlen(label) > 0);
+	d = (*has_label) ? extract_link_data(label, scratch) : NULL;
+	if (raw != NULL)
+		g_string_free(raw, true);
+	if (d != NULL)
+		d->attr = NULL;		/* belongs to the definition */
+	return d;
+}
+
+/* find_note -- the note, glossary entry or citation that text refers to,
+	looked up as note_number_for_label does, or NULL */
+static node * find_note(char *text, scratch_pad *scratch) {
+	char *clean;
+	char *label;
+	node *n;
+
+	clean = clean_string(text);
+	label = label_from_string(clean);
+	n = node_matching_label(clean, scratch->used_notes);
+	if (n == NULL)
+		n = node_matching_label(clean, scratch->notes);
+	if (n == NULL)
+		n = node_matching_label(label, scratch->used_notes);
+	if (n == NULL)
+		n = node_matching_label(label, scratch->notes);
+	free(label);
+	free(clean);
+	return n;
+}
+
+/* visit_references -- call visit for every link, image, note and citation
+	in list that the writers look up, with what it resolves to in scratch as
+	it stands: the definition of a link or image (NULL if there is none, and
+	a definition of no link if there was no label to look up), or the
+	source of a note or citation (NULL if there is none).  Stops, returning
+	false, as soon as visit does. */
+bool visit_references(node *list, scratch_pad *scratch, reference_visitor visit, void *context) {
+	link_data *d;
+	bool has_label;
+	bool go_on;
+
+	for (; list != NULL; list = list->next) {
+		switch (list->key) {
+			case LINK:
+			case IMAGE:
+			case IMAGEBLOCK:
+				if (list->link_data == NULL)
+					break;
+				d = find_link(list, scratch, &has_label);
+				go_on = visit(context, list, has_label, d, NULL);
+				free_link_data(d);
+				if (!go_on)
+					return false;
+				break;
+			case NOTEREFERENCE:
+				if ((list->str != NULL) && (strlen(list->str) > 0) &&
+					!visit(context, list, true, NULL, find_note(list->str, scratch)))
+					return false;
+				break;
+			case CITATION:
+			case NOCITATION:
+				/* external citations aren't looked up */
+				if ((list->link_data != NULL) && (list->link_data->label != NULL) &&
+					(strlen(list->link_data->label) > 0) &&
+					(strncmp(list->link_data->label, "[#", 2) != 0) &&
+					!visit(context, list, true, NULL, find_note(list->link_data->label, scratch)))
+					return false;
+				break;
+			default:
+				break;
+		}
+		if (!visit_references(list->children, scratch, visit, context))
+			return false;
+	}
+	return true;
+}
+
+/* resolved -- the visitor for references_resolved */
+static bool resolved(void *context, node *ref, bool has_label, link_data *link, node *note) {
+	switch (ref->key) {
+		case LINK:
+		case IMAGE:
+		case IMAGEBLOCK:
+			return (link != NULL) || !has_label;
+		default:
+			return note != NULL;
+	}
+}
+
+/* references_resolved -- would every link, image, note and citation in list
+	find its definition in scratch as it stands?  One that wouldn't may be
+	defined further on, so a tree exported before the whole document is
+	parsed should wait until then. */
+bool references_resolved(node *list, scratch_pad *scratch) {
+	return visit_references(list, scratch, resolved, NULL);
+}
+
 /* pad -- ensure that at least 'x' newlines are at end of output */
 void pad(GString *out, int num, scratch_pad *scratch) {
 	while (num-- > scratch->padded)
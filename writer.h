@@ -11,9 +11,20 @@
 #include "critic.h"
 
 char * export_node_tree(node *list, int format, int extensions);
+char * export_node_tree_len(node *list, int format, int extensions, size_t *out_len);
+void   export_node_tree_into(GString *out, node *list, int format, scratch_pad *scratch);
+
+bool   format_uses_references(int format);
+int    export_begin(GString *out, node *list, int format, scratch_pad *scratch);
+void   export_blocks(GString *out, node *list, int format, scratch_pad *scratch);
+void   export_end(GString *out, node *list, int format, scratch_pad *scratch);
 
 void extract_references(node *list, scratch_pad *scratch);
 link_data * extract_link_data(char *label, scratch_pad *scratch);
+bool references_resolved(node *list, scratch_pad *scratch);
+
+typedef bool (*reference_visitor)(void *context, node *ref, bool has_label, link_data *link, node *note);
+bool visit_references(node *list, scratch_pad *scratch, reference_visitor visit, void *context);
 
 void pad(GString *out, int num, scratch_pad *scratch);
 